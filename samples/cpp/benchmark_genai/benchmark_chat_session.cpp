@@ -0,0 +1,128 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <cxxopts.hpp>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+
+#include "openvino/genai/llm_pipeline.hpp"
+
+namespace {
+
+struct Chat {
+    ov::genai::ChatSession session;
+    ov::genai::ChatHistory history;
+};
+
+std::string make_prompt(size_t chat_id, size_t turn) {
+    return "User " + std::to_string(chat_id) + " asks question " + std::to_string(turn) + ": why is the sky blue?";
+}
+
+double get_ms(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("benchmark_chat_session", "Compares latency of switching between chats by LLMPipeline::resume_chat() with processing of chat histories again");
+
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("d,device", "Device", cxxopts::value<std::string>()->default_value("CPU"))
+    ("s,num_sessions", "Number of chats served by the pipeline", cxxopts::value<size_t>()->default_value(std::to_string(4)))
+    ("t,num_turns", "Number of turns in a chat history", cxxopts::value<size_t>()->default_value(std::to_string(4)))
+    ("mt,max_new_tokens", "Maximal number of new tokens of an answer in a chat history", cxxopts::value<size_t>()->default_value(std::to_string(64)))
+    ("n,num_iter", "Number of iterations", cxxopts::value<size_t>()->default_value(std::to_string(3)))
+    ("o,offload_dir", "Directory to offload KV cache of chats to, chats are kept in host memory if it's not set", cxxopts::value<std::string>())
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const size_t num_sessions = result["num_sessions"].as<size_t>();
+    const size_t num_turns = result["num_turns"].as<size_t>();
+    const size_t num_iter = result["num_iter"].as<size_t>();
+
+    ov::genai::LLMPipeline pipe(result["model"].as<std::string>(), result["device"].as<std::string>());
+    ov::genai::Tokenizer tokenizer = pipe.get_tokenizer();
+    ov::genai::GenerationConfig config = pipe.get_generation_config();
+    config.max_new_tokens = result["max_new_tokens"].as<size_t>();
+    ov::genai::GenerationConfig first_token_config = pipe.get_generation_config();
+    first_token_config.max_new_tokens = 1;
+
+    std::vector<Chat> chats;
+    for (size_t chat_id = 0; chat_id < num_sessions; ++chat_id) {
+        ov::genai::ChatHistory history;
+        pipe.start_chat();
+        for (size_t turn = 0; turn < num_turns; ++turn) {
+            const std::string prompt = make_prompt(chat_id, turn);
+            const std::string answer = pipe.generate(prompt, config).texts.at(0);
+            history.push_back({{"role", "user"}, {"content", prompt}});
+            history.push_back({{"role", "assistant"}, {"content", answer}});
+        }
+        chats.push_back({pipe.suspend_chat(), history});
+        if (result.count("offload_dir"))
+            chats.back().session.offload(std::filesystem::path(result["offload_dir"].as<std::string>()) / ("chat_" + std::to_string(chat_id) + ".bin"));
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "KV cache length: " << chats.front().session.get_kv_cache_length() << " tokens" << std::endl;
+    std::cout << "KV cache in host memory: " << chats.front().session.get_memory_size() / (1024.0 * 1024.0) << " MiB" << std::endl;
+
+    double resume_ms = 0.0, resume_first_token_ms = 0.0, prefill_first_token_ms = 0.0;
+    for (size_t iter = 0; iter < num_iter; ++iter) {
+        for (size_t chat_id = 0; chat_id < num_sessions; ++chat_id) {
+            const std::string prompt = make_prompt(chat_id, num_turns);
+
+            // switch to the chat by restoring its KV cache
+            auto start = std::chrono::steady_clock::now();
+            pipe.resume_chat(chats[chat_id].session);
+            auto resumed = std::chrono::steady_clock::now();
+            pipe.generate(prompt, first_token_config);
+            auto end = std::chrono::steady_clock::now();
+            pipe.finish_chat();
+            resume_ms += get_ms(start, resumed);
+            resume_first_token_ms += get_ms(start, end);
+
+            // switch to the chat by processing its whole history
+            ov::genai::ChatHistory history = chats[chat_id].history;
+            history.push_back({{"role", "user"}, {"content", prompt}});
+            const std::string templated_history = tokenizer.apply_chat_template(history, true);
+            start = std::chrono::steady_clock::now();
+            pipe.generate(templated_history, first_token_config);
+            end = std::chrono::steady_clock::now();
+            prefill_first_token_ms += get_ms(start, end);
+        }
+    }
+
+    const size_t num_switches = num_iter * num_sessions;
+    std::cout << "Resume chat: " << resume_ms / num_switches << " ms" << std::endl;
+    std::cout << "Resume chat and first token: " << resume_first_token_ms / num_switches << " ms" << std::endl;
+    std::cout << "Process history and first token: " << prefill_first_token_ms / num_switches << " ms" << std::endl;
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,102 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <atomic>
+#include <chrono>
+#include <cxxopts.hpp>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace {
+
+std::vector<size_t> parse_list(const std::string& list) {
+    std::vector<size_t> values;
+    std::istringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        values.push_back(std::stoul(item));
+    }
+    return values;
+}
+
+ov::genai::ChatHistory make_history(size_t num_turns) {
+    ov::genai::ChatHistory history;
+    for (size_t turn = 0; turn < num_turns; ++turn) {
+        history.push_back({{"role", "user"}, {"content", "Why is the sky blue? Question " + std::to_string(turn)}});
+        history.push_back({{"role", "assistant"}, {"content", "Because of Rayleigh scattering of sunlight in the atmosphere."}});
+    }
+    history.push_back({{"role", "user"}, {"content", "And why are sunsets red?"}});
+    return history;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("benchmark_chat_template", "Measures throughput of Tokenizer::apply_chat_template() called from several threads");
+
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("c,concurrency", "Comma separated list of numbers of threads applying the template at the same time", cxxopts::value<std::string>()->default_value("1,2,4,8"))
+    ("n,num_calls", "Number of apply_chat_template() calls per measurement", cxxopts::value<size_t>()->default_value(std::to_string(10000)))
+    ("t,num_turns", "Number of previous chat turns in a history", cxxopts::value<size_t>()->default_value(std::to_string(4)))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    ov::genai::Tokenizer tokenizer(result["model"].as<std::string>());
+    const ov::genai::ChatHistory history = make_history(result["num_turns"].as<size_t>());
+    const size_t num_calls = result["num_calls"].as<size_t>();
+
+    std::cout << std::fixed << std::setprecision(2);
+
+    // the first call parses the template, following calls reuse it
+    auto start = std::chrono::steady_clock::now();
+    tokenizer.apply_chat_template(history, true);
+    std::cout << "First call: " << std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() << " us" << std::endl;
+
+    std::cout << "threads, calls/s, mean call us" << std::endl;
+    for (size_t num_threads : parse_list(result["concurrency"].as<std::string>())) {
+        std::atomic<size_t> next_call{0};
+        start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (size_t thread_id = 0; thread_id < num_threads; ++thread_id) {
+            threads.emplace_back([&] {
+                while (next_call++ < num_calls)
+                    tokenizer.apply_chat_template(history, true);
+            });
+        }
+        for (std::thread& thread : threads)
+            thread.join();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << num_threads << ", " << num_calls / seconds << ", " << seconds * 1e6 * num_threads / num_calls << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,125 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <cxxopts.hpp>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace {
+
+// documents of random words and lengths, so batches need padding
+std::vector<std::string> make_documents(size_t num_documents, size_t max_words) {
+    const std::vector<std::string> words = {"the", "sky", "is", "blue", "because", "of", "Rayleigh", "scattering",
+                                            "sunlight", "molecules", "atmosphere", "wavelength", "shorter", "red", "light"};
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<size_t> num_words(1, max_words);
+    std::uniform_int_distribution<size_t> word(0, words.size() - 1);
+
+    std::vector<std::string> documents(num_documents);
+    for (std::string& document : documents) {
+        for (size_t i = num_words(generator); i > 0; --i) {
+            document += words[word(generator)];
+            document += i > 1 ? " " : ".";
+        }
+    }
+    return documents;
+}
+
+// unpadded token ids of each document, the batch is left padded
+std::vector<std::vector<int64_t>> get_lines(const ov::genai::TokenizedInputs& inputs) {
+    const size_t batch_size = inputs.input_ids.get_shape()[0], length = inputs.input_ids.get_shape()[1];
+    const int64_t* input_ids = inputs.input_ids.data<const int64_t>();
+    const int64_t* attention_mask = inputs.attention_mask.data<const int64_t>();
+
+    std::vector<std::vector<int64_t>> lines(batch_size);
+    for (size_t batch = 0; batch < batch_size; ++batch) {
+        for (size_t i = batch * length; i < (batch + 1) * length; ++i) {
+            if (attention_mask[i] == 1)
+                lines[batch].push_back(input_ids[i]);
+        }
+    }
+    return lines;
+}
+
+template <typename Function>
+double measure_seconds(size_t num_iter, const Function& function) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t iter = 0; iter < num_iter; ++iter)
+        function();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / num_iter;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("benchmark_tokenizer",
+                             "Measures throughput of batch encoding and decoding of documents with tokenizers compiled for latency and throughput");
+
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("b,batch_size", "Number of documents in a batch", cxxopts::value<size_t>()->default_value(std::to_string(10000)))
+    ("w,max_words", "Maximal number of words in a document", cxxopts::value<size_t>()->default_value(std::to_string(512)))
+    ("nw,num_warmup", "Number of warmup iterations", cxxopts::value<size_t>()->default_value(std::to_string(1)))
+    ("n,num_iter", "Number of iterations", cxxopts::value<size_t>()->default_value(std::to_string(3)))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string models_path = result["model"].as<std::string>();
+    const size_t num_warmup = result["num_warmup"].as<size_t>();
+    const size_t num_iter = result["num_iter"].as<size_t>();
+    std::vector<std::string> documents = make_documents(result["batch_size"].as<size_t>(), result["max_words"].as<size_t>());
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "performance hint, encode ms, encode docs/s, encode tokens/s, decode ms, decode docs/s" << std::endl;
+
+    // the latency hint compiles one infer request, so sub-batches of a batch are processed one by one
+    for (auto mode : {ov::hint::PerformanceMode::LATENCY, ov::hint::PerformanceMode::THROUGHPUT}) {
+        ov::genai::Tokenizer tokenizer(models_path, {ov::hint::performance_mode(mode)});
+
+        ov::genai::TokenizedInputs inputs;
+        for (size_t iter = 0; iter < num_warmup; ++iter)
+            inputs = tokenizer.encode(documents);
+        const double encode_seconds = measure_seconds(num_iter, [&] { inputs = tokenizer.encode(documents); });
+
+        std::vector<std::vector<int64_t>> lines = get_lines(inputs);
+        size_t num_tokens = 0;
+        for (const auto& line : lines)
+            num_tokens += line.size();
+
+        for (size_t iter = 0; iter < num_warmup; ++iter)
+            tokenizer.decode(lines);
+        const double decode_seconds = measure_seconds(num_iter, [&] { tokenizer.decode(lines); });
+
+        std::cout << mode << ", " << encode_seconds * 1000 << ", " << documents.size() / encode_seconds << ", " << num_tokens / encode_seconds
+                  << ", " << decode_seconds * 1000 << ", " << documents.size() / decode_seconds << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,39 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/llm_pipeline.hpp"
+
+int main(int argc, char* argv[]) try {
+    if (3 > argc)
+        throw std::runtime_error(std::string{"Usage: "} + argv[0] + " <MODEL_DIR> <ADAPTER_SAFETENSORS_FILE> [<NUM_ITERATIONS>]");
+
+    std::string models_path = argv[1];
+    std::string adapter_path = argv[2];
+    size_t num_iterations = argc > 3 ? std::stoul(argv[3]) : 3;
+    std::string device = "CPU";  // GPU can be used as well
+
+    using namespace ov::genai;
+
+    // load time without adapters is a baseline for the load time with a fused adapter
+    float base_load_time = 0;
+    for (size_t i = 0; i < num_iterations; ++i) {
+        LLMPipeline pipe(models_path, device);
+        base_load_time += pipe.generate("Hello", max_new_tokens(1)).perf_metrics.get_load_time();
+    }
+    std::cout << "Load time without adapters: " << base_load_time / num_iterations << " ms" << std::endl;
+
+    Adapter adapter(adapter_path);
+    float fused_load_time = 0;
+    for (size_t i = 0; i < num_iterations; ++i) {
+        LLMPipeline pipe(models_path, device, adapters(adapter, 0.75f, AdapterConfig::MODE_FUSE));
+        fused_load_time += pipe.generate("Hello", max_new_tokens(1)).perf_metrics.get_load_time();
+    }
+    std::cout << "Load time with fused adapter: " << fused_load_time / num_iterations << " ms" << std::endl;
+    std::cout << "Fusion time: " << adapter.get_load_stats().fusion_duration / num_iterations << " ms" << std::endl;
+} catch (const std::exception& error) {
+    std::cerr << error.what() << '\n';
+    return EXIT_FAILURE;
+} catch (...) {
+    std::cerr << "Non-exception object thrown\n";
+    return EXIT_FAILURE;
+}
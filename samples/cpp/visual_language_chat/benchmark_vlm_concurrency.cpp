@@ -0,0 +1,146 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <atomic>
+#include <chrono>
+#include <cxxopts.hpp>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+
+#include <openvino/genai/visual_language/pipeline.hpp>
+
+namespace {
+
+std::vector<size_t> parse_list(const std::string& list) {
+    std::vector<size_t> values;
+    std::istringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        values.push_back(std::stoul(item));
+    }
+    return values;
+}
+
+// random pixels with a per request seed, so requests don't share image embeddings or prefix cache blocks
+ov::Tensor make_image(size_t size, size_t seed) {
+    ov::Tensor image(ov::element::u8, {1, size, size, 3});
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    uint8_t* data = image.data<uint8_t>();
+    for (size_t i = 0; i < image.get_size(); ++i)
+        data[i] = static_cast<uint8_t>(distribution(generator));
+    return image;
+}
+
+// runs `num_requests` generate() calls from `num_threads` threads and prints throughput and mean latencies
+void run(ov::genai::VLMPipeline& pipe, const std::string& mode, size_t num_threads, const std::vector<ov::Tensor>& images,
+         const ov::genai::GenerationConfig& config) {
+    std::atomic<size_t> next_request{0};
+    std::mutex metrics_mutex;
+    std::vector<ov::genai::VLMPerfMetrics> metrics;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t thread_id = 0; thread_id < num_threads; ++thread_id) {
+        threads.emplace_back([&] {
+            for (size_t request = next_request++; request < images.size(); request = next_request++) {
+                auto res = pipe.generate("Describe the image in details.", ov::genai::image(images[request]),
+                                         ov::genai::generation_config(config));
+                std::lock_guard<std::mutex> lock{metrics_mutex};
+                metrics.push_back(res.perf_metrics);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    size_t num_generated_tokens = 0;
+    float ttft_ms = 0.0f, latency_ms = 0.0f;
+    for (auto& request_metrics : metrics) {
+        num_generated_tokens += request_metrics.get_num_generated_tokens();
+        ttft_ms += request_metrics.get_ttft().mean;
+        latency_ms += request_metrics.get_generate_duration().mean;
+    }
+
+    std::cout << mode << ", " << num_threads << ", " << seconds << ", " << metrics.size() / seconds << ", "
+              << num_generated_tokens / seconds << ", " << ttft_ms / metrics.size() << ", " << latency_ms / metrics.size() << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("benchmark_vlm_concurrency",
+                             "Measures throughput and latency of concurrent VLM requests served by the stateful and the continuous batching backends");
+
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("c,concurrency", "Comma separated list of numbers of threads calling generate() at the same time", cxxopts::value<std::string>()->default_value("1,2,4,8"))
+    ("n,num_requests", "Number of requests per measurement, each request has its own image", cxxopts::value<size_t>()->default_value(std::to_string(16)))
+    ("s,image_size", "Side of square random images", cxxopts::value<size_t>()->default_value(std::to_string(448)))
+    ("mt,max_new_tokens", "Maximal number of new tokens", cxxopts::value<size_t>()->default_value(std::to_string(64)))
+    ("cache_size", "KV cache size in GB of the continuous batching backend", cxxopts::value<size_t>()->default_value(std::to_string(4)))
+    ("prefix_caching", "Enable prefix caching in the continuous batching backend", cxxopts::value<bool>()->default_value("false"))
+    ("skip_stateful", "Don't measure the stateful backend", cxxopts::value<bool>()->default_value("false"))
+    ("d,device", "device", cxxopts::value<std::string>()->default_value("CPU"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string models_path = result["model"].as<std::string>();
+    const std::string device = result["device"].as<std::string>();
+
+    std::vector<ov::Tensor> images;
+    for (size_t request = 0; request < result["num_requests"].as<size_t>(); ++request)
+        images.push_back(make_image(result["image_size"].as<size_t>(), request));
+
+    // greedy decoding of a fixed number of tokens, so both backends do the same amount of work
+    ov::genai::GenerationConfig config;
+    config.max_new_tokens = result["max_new_tokens"].as<size_t>();
+    config.ignore_eos = true;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "backend, threads, total s, requests/s, tokens/s, mean TTFT ms, mean latency ms" << std::endl;
+
+    if (!result["skip_stateful"].as<bool>()) {
+        // the stateful backend serves one conversation at a time, so requests are sent by one thread
+        ov::genai::VLMPipeline pipe(models_path, device);
+        run(pipe, "stateful", 1, images, config);
+    }
+
+    ov::genai::SchedulerConfig scheduler_config;
+    scheduler_config.cache_size = result["cache_size"].as<size_t>();
+    scheduler_config.enable_prefix_caching = result["prefix_caching"].as<bool>();
+    ov::genai::VLMPipeline pipe(models_path, device, ov::genai::scheduler_config(scheduler_config));
+    for (size_t num_threads : parse_list(result["concurrency"].as<std::string>())) {
+        run(pipe, "continuous batching", num_threads, images, config);
+    }
+
+    return 0;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,110 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cxxopts.hpp>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+#include <openvino/genai/visual_language/pipeline.hpp>
+
+namespace {
+
+// parses "3840x2160,1920x1080" into {width, height} pairs
+std::vector<std::pair<size_t, size_t>> parse_resolutions(const std::string& list) {
+    std::vector<std::pair<size_t, size_t>> resolutions;
+    std::istringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        const size_t separator = item.find('x');
+        if (separator == std::string::npos) {
+            throw std::invalid_argument("Resolution must be WIDTHxHEIGHT, got " + item);
+        }
+        resolutions.emplace_back(std::stoul(item.substr(0, separator)), std::stoul(item.substr(separator + 1)));
+    }
+    return resolutions;
+}
+
+// random pixels, so the content of an image doesn't matter for timings
+ov::Tensor make_image(size_t width, size_t height) {
+    ov::Tensor image(ov::element::u8, {1, height, width, 3});
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    uint8_t* data = image.data<uint8_t>();
+    for (size_t i = 0; i < image.get_size(); ++i)
+        data[i] = static_cast<uint8_t>(distribution(generator));
+    return image;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("benchmark_vlm_preprocessing",
+                             "Measures embeddings preparation time of a VLM (image preprocessing, vision encoder and resampler) for several image sizes");
+
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("r,resolutions", "Comma separated list of WIDTHxHEIGHT image sizes", cxxopts::value<std::string>()->default_value("640x480,1920x1080,3840x2160"))
+    ("nw,num_warmup", "Number of warmup iterations per image size", cxxopts::value<size_t>()->default_value(std::to_string(1)))
+    ("n,num_iter", "Number of iterations per image size", cxxopts::value<size_t>()->default_value(std::to_string(5)))
+    ("d,device", "device", cxxopts::value<std::string>()->default_value("CPU"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string models_path = result["model"].as<std::string>();
+    const std::string device = result["device"].as<std::string>();
+    const size_t num_warmup = result["num_warmup"].as<size_t>();
+    const size_t num_iter = result["num_iter"].as<size_t>();
+
+    // the image embedding cache is disabled by default, so every iteration preprocesses and encodes the image
+    ov::genai::VLMPipeline pipe(models_path, device);
+
+    // a single token is enough, the time of interest is spent before the first inference of the language model
+    ov::genai::GenerationConfig config;
+    config.max_new_tokens = 1;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "resolution, embeddings preparation ms, std ms, TTFT ms" << std::endl;
+    for (const auto& [width, height] : parse_resolutions(result["resolutions"].as<std::string>())) {
+        const ov::Tensor image = make_image(width, height);
+        for (size_t i = 0; i < num_warmup; i++)
+            pipe.generate("What is on the image?", ov::genai::image(image), ov::genai::generation_config(config));
+
+        ov::genai::VLMPerfMetrics metrics;
+        for (size_t i = 0; i < num_iter; i++) {
+            auto res = pipe.generate("What is on the image?", ov::genai::image(image), ov::genai::generation_config(config));
+            metrics = i == 0 ? res.perf_metrics : metrics + res.perf_metrics;
+        }
+
+        std::cout << width << "x" << height << ", "
+                  << metrics.get_prepare_embeddings_duration().mean << ", "
+                  << metrics.get_prepare_embeddings_duration().std << ", "
+                  << metrics.get_ttft().mean << std::endl;
+    }
+
+    return 0;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
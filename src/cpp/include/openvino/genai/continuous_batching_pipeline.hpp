@@ -5,6 +5,8 @@
 
 #include <memory>
 #include <filesystem>
+#include <map>
+#include <vector>
 
 #include <openvino/openvino.hpp>
 
@@ -19,9 +21,25 @@
 
 namespace ov::genai {
 
+/**
+ * @brief Distribution of a latency in milliseconds. Percentiles are estimated by a histogram with relative error of at most 3%.
+ */
+struct LatencyPercentiles {
+    /**
+    * Number of measured latencies.
+    */
+    size_t count = 0;
+
+    float mean = 0.0;
+    float p50 = 0.0;
+    float p90 = 0.0;
+    float p99 = 0.0;
+    float max = 0.0;
+};
+
 /**
  * @brief Contains general pipeline metrics, either aggregated throughout the lifetime of the generation pipeline
- * or measured at the previous generation step.
+ * (or since the last ContinuousBatchingPipeline::reset_metrics() call) or measured at the previous generation step.
  */
 struct PipelineMetrics {
     /**
@@ -48,6 +66,65 @@ struct PipelineMetrics {
     * Running average of the KV cache usage during the lifetime of the pipeline, with max window size of 1000 steps
     */
     float avg_cache_usage = 0.0;
+
+    /**
+    * Time to first token: time from adding a request to the pipeline to generation of its first token.
+    */
+    LatencyPercentiles ttft;
+
+    /**
+    * Time per output token: mean time between tokens generated after the first one, measured per finished request.
+    */
+    LatencyPercentiles tpot;
+
+    /**
+    * Time from adding a request to the pipeline to its first scheduling.
+    */
+    LatencyPercentiles queue_wait;
+
+    /**
+    * Number of times requests were preempted to free KV cache blocks for other requests.
+    */
+    size_t preemptions = 0;
+
+    /**
+    * Number of processed tokens dropped from KV cache by preemption, which had to be processed again.
+    */
+    size_t recomputed_tokens = 0;
+
+    /**
+    * Percentage of prompt tokens restored from KV cache by prefix caching instead of processing.
+    */
+    float prefix_cache_hit_rate = 0.0;
+};
+
+/**
+ * @brief Aggregated durations of a traced part of pipeline steps, e.g. scheduling or inference.
+ */
+struct TraceSpanStatistics {
+    static constexpr size_t NUM_HISTOGRAM_BUCKETS = 32;
+
+    /**
+    * Number of recorded spans.
+    */
+    size_t count = 0;
+
+    /**
+    * Total, minimal and maximal span durations in milliseconds.
+    */
+    float total_ms = 0.0;
+    float min_ms = 0.0;
+    float max_ms = 0.0;
+
+    /**
+    * Histogram of span durations with power of two bucket bounds: histogram[0] counts spans shorter than 1 microsecond,
+    * histogram[i] counts spans from 2^(i-1) to 2^i microseconds, the last bucket also counts longer spans.
+    */
+    std::vector<size_t> histogram = std::vector<size_t>(NUM_HISTOGRAM_BUCKETS, 0);
+
+    float get_mean_ms() const {
+        return count == 0 ? 0.0f : total_ms / count;
+    }
 };
 
 class OPENVINO_GENAI_EXPORTS ContinuousBatchingPipeline {
@@ -58,13 +135,18 @@ protected:
     class ContinuousBatchingForPromptLookupImpl;
     class SpeculativeDecodingImpl;
     class PromptLookupImpl;
+    class Engine;
 
     friend class ContinuousBatchingForSpeculativeDecodingImpl;
     friend class ContinuousBatchingForPromptLookupImpl;
     friend class SpeculativeDecodingImpl;
     friend class PromptLookupImpl;
+    // serves VLMPipeline requests with prompt embeddings when it's created with scheduler_config
+    friend class VLMPipeline;
 
     std::shared_ptr<ImplInterface> m_impl;
+    // background thread calling step(), set between start_engine() and stop_engine()
+    std::shared_ptr<Engine> m_engine;
 
     ContinuousBatchingPipeline() = default;
 
@@ -128,6 +210,37 @@ public:
      */
     ov::genai::PipelineMetrics get_metrics() const;
 
+    /**
+     * Resets metrics aggregated throughout the lifetime of the pipeline: latency percentiles, preemption counters,
+     * prefix cache hit rate and max KV cache usage. Allows to scrape metrics for consecutive intervals.
+     * @return The pipeline metrics before the reset, no measurement is lost between them and the reset.
+     */
+    ov::genai::PipelineMetrics reset_metrics();
+
+    /**
+    * @brief Enables or disables tracing of pipeline steps. Traced spans are scheduling, block copy, input assembly, inference,
+    * cache eviction, sampling, forking and freeing of sequences, notification and freeing of finished requests, and tokenization.
+    * Tracing is disabled by default, it can be switched at any time, including while the engine thread is running.
+    */
+    void enable_tracing(bool enabled = true);
+
+    /**
+    * @brief Returns spans traced by this pipeline as a JSON object in Chrome trace event format, which can be opened
+    * in chrome://tracing or Perfetto. Up to 2^20 spans are kept, later spans are counted by get_trace_statistics() only.
+    */
+    std::string get_chrome_trace() const;
+
+    /**
+    * @brief Returns statistics of traced spans keyed by span names. Spans of the draft and the main models
+    * of speculative decoding are prefixed by "draft/" and "main/".
+    */
+    std::map<std::string, ov::genai::TraceSpanStatistics> get_trace_statistics() const;
+
+    /**
+    * @brief Removes traced spans and their statistics.
+    */
+    void clear_trace();
+
     GenerationHandle add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params);
     GenerationHandle add_request(uint64_t request_id, const std::string& prompt, const ov::genai::GenerationConfig& sampling_params);
 
@@ -135,6 +248,22 @@ public:
 
     bool has_non_finished_requests();
 
+    /**
+    * @brief Starts a background thread, which calls step() while there are unfinished requests and sleeps otherwise.
+    * Requests added by add_request() wake the thread up, their outputs are read from generation handles,
+    * e.g. with GenerationHandleImpl::read_async() or GenerationHandleImpl::set_callback().
+    * step() and generate() can't be called while the thread is running.
+    * If a step throws, the thread drops all requests: read() and futures of read_async() of their handles rethrow the exception,
+    * callbacks get empty outputs, and the next add_request() or stop_engine() rethrows it as well.
+    */
+    void start_engine();
+
+    /**
+    * @brief Stops the thread started by start_engine() after the current step, unfinished requests stay in the pipeline.
+    * Rethrows an exception which stopped the thread, if any. The thread is also stopped when the pipeline is destroyed.
+    */
+    void stop_engine();
+
     // more high level interface, which can process multiple prompts in continuous batching manner
     std::vector<EncodedGenerationResult> generate(const std::vector<ov::Tensor>& input_ids, const std::vector<ov::genai::GenerationConfig>& sampling_params, const ov::genai::StreamerVariant& streamer=std::monostate{});
     std::vector<GenerationResult> generate(const std::vector<std::string>& prompts, const std::vector<ov::genai::GenerationConfig>& sampling_params, const ov::genai::StreamerVariant& streamer=std::monostate{});
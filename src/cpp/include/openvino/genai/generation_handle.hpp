@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <functional>
+#include <future>
 #include <memory>
 #include <unordered_map>
 
@@ -91,6 +93,19 @@ public:
     GenerationOutputs read();
     // Reads all generated tokens for all sequences
     std::vector<GenerationOutput> read_all();
+
+    /**
+     * Returns a future of the next chunk of outputs, which becomes ready as soon as the pipeline generates the chunk.
+     * Empty outputs mean that generation is over and all chunks are read. Chunks are moved to futures without copying.
+     */
+    std::future<GenerationOutputs> read_async();
+
+    /**
+     * Makes the pipeline pass each next chunk of outputs to `callback` instead of keeping it for read() and read_async(),
+     * chunks generated before the call are passed right away. The last call gets empty outputs once generation is over.
+     * The callback runs on the thread calling step(), so it should be short and must not read from this handle.
+     */
+    void set_callback(std::function<void(GenerationOutputs)> callback);
 };
 
 using GenerationHandle = std::shared_ptr<GenerationHandleImpl>;
@@ -31,6 +31,19 @@ public:
         explicit Config(const std::filesystem::path& config_path);
     };
 
+    /**
+     * Tiled VAE mode: images larger than a tile are encoded / decoded tile by tile and overlapping parts of
+     * neighbour tiles are blended, so peak memory of VAE inference is bounded by the tile size instead of the image size.
+     */
+    struct OPENVINO_GENAI_EXPORTS TilingConfig {
+        // tile size in pixels, 0 disables tiling; must be divisible by VAE scale factor
+        size_t tile_size = 0;
+        // fraction of a tile shared with each neighbour tile, within [0, 1)
+        float tile_overlap = 0.25f;
+        // max number of tiles inferred at the same time
+        size_t max_concurrent_tiles = 1;
+    };
+
     explicit AutoencoderKL(const std::filesystem::path& vae_decoder_path);
 
     AutoencoderKL(const std::filesystem::path& vae_encoder_path,
@@ -116,6 +129,12 @@ public:
 
     AutoencoderKL(const AutoencoderKL&);
 
+    /**
+     * Creates a copy of not compiled model, which can be reshaped and compiled independently of this one.
+     * Both models share weights.
+     */
+    AutoencoderKL clone() const;
+
     AutoencoderKL& reshape(int batch_size, int height, int width);
 
     AutoencoderKL& compile(const std::string& device, const ov::AnyMap& properties = {});
@@ -129,8 +148,12 @@ public:
 
     ov::Tensor decode(ov::Tensor latent);
 
+    ov::Tensor decode(ov::Tensor latent, const TilingConfig& tiling);
+
     ov::Tensor encode(ov::Tensor image, std::shared_ptr<Generator> generator);
 
+    ov::Tensor encode(ov::Tensor image, std::shared_ptr<Generator> generator, const TilingConfig& tiling);
+
     const Config& get_config() const;
 
     size_t get_vae_scale_factor() const;
@@ -140,6 +163,8 @@ private:
 
     Config m_config;
     ov::InferRequest m_encoder_request, m_decoder_request;
+    // extra infer requests used to process several tiles at the same time, created on demand
+    std::vector<ov::InferRequest> m_encoder_tile_requests, m_decoder_tile_requests;
     std::shared_ptr<ov::Model> m_encoder_model = nullptr, m_decoder_model = nullptr;
 };
 
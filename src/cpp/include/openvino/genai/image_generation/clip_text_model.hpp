@@ -5,10 +5,12 @@
 
 #include <filesystem>
 #include <string>
+#include <vector>
 
 #include "openvino/genai/visibility.hpp"
 #include "openvino/genai/tokenizer.hpp"
 #include "openvino/genai/lora_adapter.hpp"
+#include "openvino/genai/image_generation/text_encoder_cache_stats.hpp"
 
 #include "openvino/core/any.hpp"
 #include "openvino/runtime/tensor.hpp"
@@ -82,6 +84,17 @@ public:
         return compile(device, ov::AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * Enables LRU cache of text encoder outputs for up to `capacity` prompts, 0 disables the cache and drops cached outputs.
+     * Outputs are cached per prompt, so a repeated negative prompt is reused with new positive prompts.
+     * The cache is shared by all copies of the model, so Text2ImagePipeline, Image2ImagePipeline and InpaintingPipeline
+     * created from the same model or from each other reuse outputs of each other's prompts.
+     * The cache is bypassed while LoRA adapters are applied.
+     */
+    CLIPTextModel& set_cache_capacity(size_t capacity);
+
+    TextEncoderCacheStats get_cache_stats() const;
+
     void set_adapters(const std::optional<AdapterConfig>& adapters);
 
     ov::Tensor infer(const std::string& pos_prompt, const std::string& neg_prompt, bool do_classifier_free_guidance);
@@ -92,6 +105,10 @@ private:
     Config m_config;
     AdapterController m_adapter_controller;
     ov::InferRequest m_request;
+    std::shared_ptr<TextEncoderCache> m_cache;
+    // outputs of the last infer call, they may be taken from the cache instead of the infer request
+    std::vector<ov::Tensor> m_outputs;
+    bool m_adapters_applied = false;
     std::shared_ptr<ov::Model> m_model;
 
     Tokenizer m_clip_tokenizer;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <string>
 #include <random>
 #include <optional>
@@ -71,6 +72,39 @@ private:
     std::normal_distribution<float> m_normal;
 };
 
+/**
+ * Counter-based random generator: normally distributed values are computed with Box-Muller transform from
+ * Philox4x32-10 output for a value index and a seed, so 'randn_tensor' fills tensors in parallel and the result
+ * depends only on a seed and a number of previously generated values, but not on a number of threads.
+ * Values returned by 'next()' and by 'randn_tensor' belong to the same sequence.
+ */
+class OPENVINO_GENAI_EXPORTS PhiloxGenerator : public Generator {
+public:
+    /**
+     * Initializes Philox generator with a given seed
+     * @param seed A seed value
+     */
+    explicit PhiloxGenerator(uint64_t seed);
+
+    virtual float next() override;
+
+    virtual ov::Tensor randn_tensor(const ov::Shape& shape) override;
+
+    virtual void seed(size_t new_seed) override;
+
+    // a number of values computed at once from consecutive Philox counters
+    static constexpr size_t GROUP_SIZE = 32;
+
+private:
+    uint64_t m_seed;
+    // index of the next value in the sequence
+    uint64_t m_offset = 0;
+
+    // the last group computed by 'next()'
+    std::array<float, GROUP_SIZE> m_group_values;
+    uint64_t m_group_index;
+};
+
 /**
  * Generation config used for Image generation pipelines.
  * Note, that not all values are applicable for all pipelines and models - please, refer
@@ -90,7 +124,8 @@ struct OPENVINO_GENAI_EXPORTS ImageGenerationConfig {
 
     /**
      * Random generator to initialize latents, add noise to initial images in case of image to image / inpainting pipelines
-     * By default, random generator is initialized as `CppStdGenerator(generation_config.rng_seed)`
+     * By default, random generator is initialized as `CppStdGenerator(generation_config.rng_seed)`.
+     * `PhiloxGenerator` can be used to generate noise for large latents in parallel.
      * @note If `generator` is specified, it has higher priority than `rng_seed` parameter.
      */
     std::shared_ptr<Generator> generator = nullptr;
@@ -122,6 +157,15 @@ struct OPENVINO_GENAI_EXPORTS ImageGenerationConfig {
      */
     std::optional<AdapterConfig> adapters;
 
+    /**
+     * Tiled VAE parameters used to cap peak memory of VAE encoding / decoding of high resolution images.
+     * Tile size is given in pixels and must be divisible by VAE scale factor, 0 disables tiling.
+     * Overlap is a fraction of a tile shared with each neighbour tile.
+     */
+    size_t vae_tile_size = 0;
+    float vae_tile_overlap = 0.25f;
+    size_t vae_max_concurrent_tiles = 1;
+
     /**
      * Checks whether image generation config is valid, otherwise throws an exception.
      */
@@ -236,6 +280,24 @@ extern OPENVINO_GENAI_EXPORTS ov::Property<size_t> rng_seed;
  */
 static constexpr ov::Property<int> max_sequence_length{"max_sequence_length"};
 
+/**
+ * Enables tiled VAE encoding / decoding: images larger than 'vae_tile_size' pixels are processed tile by tile
+ * and overlapping parts of neighbour tiles are blended. It caps peak memory of VAE inference for high resolution images,
+ * but the image is slightly different from the one decoded at once. Tiling requires VAE models with dynamic spatial dimensions.
+ */
+static constexpr ov::Property<size_t> vae_tile_size{"vae_tile_size"};
+
+/**
+ * A fraction of a VAE tile shared with each neighbour tile, which is used to blend seams between tiles. Default is 0.25.
+ */
+static constexpr ov::Property<float> vae_tile_overlap{"vae_tile_overlap"};
+
+/**
+ * Max number of VAE tiles inferred at the same time. Increasing it improves device utilization
+ * at the cost of higher peak memory. Default is 1.
+ */
+static constexpr ov::Property<size_t> vae_max_concurrent_tiles{"vae_max_concurrent_tiles"};
+
 /**
  * User callback for image generation pipelines, which is called within a pipeline with the following arguments:
  * - Current inference step
@@ -0,0 +1,64 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "openvino/genai/perf_metrics.hpp"
+#include "openvino/genai/visibility.hpp"
+
+namespace ov {
+namespace genai {
+
+struct OPENVINO_GENAI_EXPORTS RawImageGenerationPerfMetrics {
+    /** @brief Duration of denoising model (UNet or transformer) inference for each denoising step */
+    std::vector<MicroSeconds> step_inference_durations;
+    /** @brief Duration of host work for each denoising step: model inputs preparation and scheduler step with guidance */
+    std::vector<MicroSeconds> step_host_durations;
+    /**
+     * @brief Duration of switching to compiled models of the requested resolution bucket including their lazy compilation,
+     * empty if the pipeline is not reshaped to resolution buckets
+     */
+    std::vector<MicroSeconds> model_switch_durations;
+};
+
+/**
+ * @brief Performance metrics of the last generate call of an image generation pipeline.
+ * Getters calculate mean and standard deviation in milliseconds from raw_metrics and cache them.
+ */
+struct OPENVINO_GENAI_EXPORTS ImageGenerationPerfMetrics {
+    /** @brief Mean and standard deviation of denoising model inference duration per step in milliseconds */
+    MeanStdPair step_inference_duration;
+    /** @brief Mean and standard deviation of host work duration per step in milliseconds */
+    MeanStdPair step_host_duration;
+    /** @brief Mean and standard deviation of resolution bucket switch duration in milliseconds */
+    MeanStdPair model_switch_duration;
+
+    MeanStdPair get_step_inference_duration();
+    MeanStdPair get_step_host_duration();
+    MeanStdPair get_model_switch_duration();
+
+    void evaluate_statistics();
+
+    bool m_evaluated = false;
+
+    RawImageGenerationPerfMetrics raw_metrics;
+};
+
+/**
+ * @brief State of denoising and VAE models compiled for one resolution bucket of an image generation pipeline
+ * reshaped to several resolutions.
+ */
+struct OPENVINO_GENAI_EXPORTS ResolutionBucketStats {
+    int64_t height = 0;
+    int64_t width = 0;
+    /** @brief Whether models are compiled, models of lazily compiled buckets are compiled by the first request with their resolution */
+    bool is_compiled = false;
+    /** @brief Duration of models compilation in milliseconds, 0 if models are not compiled yet */
+    float compile_duration = 0.0f;
+};
+
+} // namespace genai
+} // namespace ov
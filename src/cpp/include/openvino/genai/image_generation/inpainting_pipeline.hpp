@@ -7,12 +7,15 @@
 #include <string>
 #include <random>
 #include <filesystem>
+#include <utility>
+#include <vector>
 
 #include "openvino/core/any.hpp"
 #include "openvino/runtime/tensor.hpp"
 
 #include "openvino/genai/image_generation/scheduler.hpp"
 #include "openvino/genai/image_generation/generation_config.hpp"
+#include "openvino/genai/image_generation/image_generation_perf_metrics.hpp"
 
 #include "openvino/genai/image_generation/clip_text_model.hpp"
 #include "openvino/genai/image_generation/clip_text_model_with_projection.hpp"
@@ -80,6 +83,12 @@ public:
     // with static shapes performance is better
     void reshape(const int num_images_per_prompt, const int height, const int width, const float guidance_scale);
 
+    // reshapes models to several static resolutions, see Text2ImagePipeline::reshape
+    void reshape(const int num_images_per_prompt,
+                 const std::vector<std::pair<int, int>>& resolutions,
+                 const float guidance_scale,
+                 const bool compile_lazily = false);
+
     void compile(const std::string& device, const ov::AnyMap& properties = {});
 
     template <typename... Properties>
@@ -110,6 +119,29 @@ public:
 
     ov::Tensor decode(const ov::Tensor latent);
 
+    /**
+     * Returns performance metrics of the last 'generate' call, e.g. per step durations of denoising model inference
+     * and of host work around it
+     */
+    ImageGenerationPerfMetrics get_performance_metrics() const;
+
+    /**
+     * Enables LRU cache of text encoder outputs for up to `capacity` prompts per text encoder, 0 disables the cache.
+     * Text encoders are shared with pipelines created from this one or from the same models, so they share the cache as well.
+     * @note The cache is bypassed while LoRA adapters are applied, as text encoder outputs depend on their alphas.
+     */
+    void set_text_encoder_cache_capacity(size_t capacity);
+
+    /**
+     * Returns text encoder cache counters summed over all text encoders of the pipeline
+     */
+    TextEncoderCacheStats get_text_encoder_cache_stats() const;
+
+    /**
+     * Returns compilation state of resolution buckets, empty if the pipeline is not reshaped to several resolutions
+     */
+    std::vector<ResolutionBucketStats> get_resolution_bucket_stats() const;
+
 private:
     std::shared_ptr<DiffusionPipeline> m_impl;
 
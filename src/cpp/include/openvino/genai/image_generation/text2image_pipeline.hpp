@@ -184,6 +184,24 @@ public:
      */
     void reshape(const int num_images_per_prompt, const int height, const int width, const float guidance_scale);
 
+    /**
+     * Reshapes denoising and VAE models to several static resolutions at once, so requests with any of them run on
+     * static shapes without recompilation. Models of all resolution buckets share weights; the text encoders don't depend
+     * on resolution and are reshaped once. Requested height and width must match one of buckets exactly,
+     * the first bucket becomes the default resolution.
+     * Supported by Stable Diffusion, Latent Consistency Model and Stable Diffusion XL pipelines.
+     * @param num_images_per_prompt A number of image to generate per 'generate()' call
+     * @param resolutions (height, width) pairs of resolution buckets
+     * @param guidance_scale A guidance scale, see the other overload
+     * @param compile_lazily Whether models of a bucket are compiled by the first 'generate()' call with its resolution
+     * rather than by 'compile()'. Models of the first bucket are always compiled by 'compile()'.
+     * @note If pipeline has been already compiled, it cannot be reshaped and an exception is thrown.
+     */
+    void reshape(const int num_images_per_prompt,
+                 const std::vector<std::pair<int, int>>& resolutions,
+                 const float guidance_scale,
+                 const bool compile_lazily = false);
+
     /**
      * Compiles image generation pipeline for a given device
      * @param device A device to compile models with
@@ -214,6 +232,17 @@ public:
         return generate(positive_prompt, ov::AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * Generates images for several requests at once: their latents are denoised together by one denoising model
+     * inference per step, while each request keeps its own guidance scale, random generator and scheduler state.
+     * Requests must have the same resolution, number of inference steps and LoRA adapters. Supported by
+     * Stable Diffusion and Latent Consistency Model pipelines, the denoising model must have a dynamic batch dimension.
+     * @param positive_prompts Prompts of requests
+     * @param properties Image generation parameters of each request, including an optional callback
+     * @returns Images of each request in the same order, an empty tensor for requests interrupted by a callback
+     */
+    std::vector<ov::Tensor> generate_batch(const std::vector<std::string>& positive_prompts, const std::vector<ov::AnyMap>& properties);
+
     /**
      * Performs latent image decoding. It can be useful to use within 'callback' which accepts current latent image
      * @param latent A latent image
@@ -221,10 +250,35 @@ public:
      */
     ov::Tensor decode(const ov::Tensor latent);
 
+    /**
+     * Returns performance metrics of the last 'generate' call, e.g. per step durations of denoising model inference
+     * and of host work around it
+     */
+    ImageGenerationPerfMetrics get_performance_metrics() const;
+
+    /**
+     * Enables LRU cache of text encoder outputs for up to `capacity` prompts per text encoder, 0 disables the cache.
+     * Text encoders are shared with pipelines created from this one or from the same models, so they share the cache as well.
+     * @note The cache is bypassed while LoRA adapters are applied, as text encoder outputs depend on their alphas.
+     */
+    void set_text_encoder_cache_capacity(size_t capacity);
+
+    /**
+     * Returns text encoder cache counters summed over all text encoders of the pipeline
+     */
+    TextEncoderCacheStats get_text_encoder_cache_stats() const;
+
+    /**
+     * Returns compilation state of resolution buckets, empty if the pipeline is not reshaped to several resolutions
+     */
+    std::vector<ResolutionBucketStats> get_resolution_bucket_stats() const;
+
 private:
     std::shared_ptr<DiffusionPipeline> m_impl;
 
     explicit Text2ImagePipeline(const std::shared_ptr<DiffusionPipeline>& impl);
+
+    friend class Text2ImageRequestQueue;
 };
 
 } // namespace genai
@@ -0,0 +1,62 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+
+#include "openvino/genai/image_generation/text2image_pipeline.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Serves concurrent text to image requests with one set of models. A worker thread takes the oldest waiting
+ * request together with the waiting requests which can be batched with it (the same resolution, number of inference
+ * steps and LoRA adapters) and generates them by Text2ImagePipeline::generate_batch, so a denoising model runs
+ * one inference per step for the whole batch.
+ * @note The pipeline must not be used directly while the queue is alive, as they share models.
+ */
+class OPENVINO_GENAI_EXPORTS Text2ImageRequestQueue {
+    class Text2ImageRequestQueueImpl;
+    std::shared_ptr<Text2ImageRequestQueueImpl> m_impl;
+
+public:
+    /**
+     * @param pipeline A pipeline to generate images with, the queue shares its models
+     * @param max_batch_size Max number of images denoised together; a request with more images is processed alone
+     * @param max_wait_time Time the worker waits for more requests to fill a batch after the first request arrives
+     */
+    Text2ImageRequestQueue(const Text2ImagePipeline& pipeline,
+                           size_t max_batch_size = 4,
+                           std::chrono::milliseconds max_wait_time = std::chrono::milliseconds(10));
+
+    // waits for all added requests to be processed
+    ~Text2ImageRequestQueue();
+
+    /**
+     * Adds a request, can be called from any thread. Invalid image generation parameters are reported immediately
+     * by an exception, generation errors are reported by the returned future.
+     * @param positive_prompt Prompt to generate image(s) from
+     * @param properties Image generation parameters, the same as for Text2ImagePipeline::generate
+     * @returns A future of a tensor which has dimensions [num_images_per_prompt, height, width, 3], or an empty tensor
+     * if generation is interrupted by a callback
+     */
+    std::future<ov::Tensor> add_request(const std::string& positive_prompt, const ov::AnyMap& properties = {});
+
+    template <typename... Properties>
+    ov::util::EnableIfAllStringAny<std::future<ov::Tensor>, Properties...> add_request(
+            const std::string& positive_prompt,
+            Properties&&... properties) {
+        return add_request(positive_prompt, ov::AnyMap{std::forward<Properties>(properties)...});
+    }
+
+    // returns number of requests which are not taken by the worker yet
+    size_t get_num_waiting_requests() const;
+};
+
+} // namespace genai
+} // namespace ov
@@ -0,0 +1,39 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+
+#include "openvino/genai/visibility.hpp"
+
+namespace ov {
+namespace genai {
+
+class TextEncoderCache;
+
+/**
+ * @brief Counters of a text encoder outputs cache, which is enabled by `set_cache_capacity` of text encoder models
+ * or `set_text_encoder_cache_capacity` of image generation pipelines.
+ * Each prompt of a text encoder batch is counted separately, so a generation with classifier-free guidance
+ * makes two lookups: for negative and positive prompts. Models reshaped to a static batch size encode the whole batch
+ * if any prompt is missing, so all its prompts are counted as misses.
+ */
+struct OPENVINO_GENAI_EXPORTS TextEncoderCacheStats {
+    /** @brief Number of prompts whose outputs were taken from the cache */
+    size_t hits = 0;
+    /** @brief Number of prompts encoded by a model */
+    size_t misses = 0;
+    /** @brief Number of cached prompts */
+    size_t size = 0;
+    /** @brief Max number of cached prompts, 0 if the cache is disabled */
+    size_t capacity = 0;
+
+    /** @brief Ratio of hits to all lookups, 0 if there were no lookups */
+    float get_hit_rate() const;
+
+    TextEncoderCacheStats& operator+=(const TextEncoderCacheStats& right);
+};
+
+} // namespace genai
+} // namespace ov
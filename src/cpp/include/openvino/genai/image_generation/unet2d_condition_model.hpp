@@ -72,6 +72,12 @@ public:
 
     UNet2DConditionModel(const UNet2DConditionModel&);
 
+    /**
+     * Creates a copy of not compiled model, which can be reshaped and compiled independently of this one.
+     * Both models share weights.
+     */
+    UNet2DConditionModel clone() const;
+
     const Config& get_config() const;
 
     UNet2DConditionModel& reshape(int batch_size, int height, int width, int tokenizer_model_max_length);
@@ -92,6 +92,42 @@ public:
 
 class LLMPipelineImplBase;
 
+/**
+* @brief Chat detached from LLMPipeline by LLMPipeline::suspend_chat(): chat history and KV cache of the model saved
+* in host memory or in a file. LLMPipeline::resume_chat() restores the KV cache instead of processing the chat history again,
+* so one pipeline can serve chats of many users. Copies of a session share its state.
+*/
+class OPENVINO_GENAI_EXPORTS ChatSession {
+public:
+    /**
+    * @brief Number of tokens in the saved KV cache.
+    */
+    size_t get_kv_cache_length() const;
+
+    /**
+    * @brief Size of the saved KV cache in host memory in bytes, 0 if the session is offloaded.
+    */
+    size_t get_memory_size() const;
+
+    /**
+    * @brief Moves the saved KV cache to a file and releases its host memory. The file is read when the session is resumed,
+    * the session stays offloaded, so it can be resumed again. The file must be kept while the session is in use.
+    *
+    * @param path path of the file to be created or overwritten
+    */
+    void offload(const std::filesystem::path& path);
+
+    bool is_offloaded() const;
+
+private:
+    class ChatSessionImpl;
+    friend class StatefulLLMPipeline;
+
+    explicit ChatSession(std::shared_ptr<ChatSessionImpl> impl);
+
+    std::shared_ptr<ChatSessionImpl> m_pimpl;
+};
+
 /**
 * @brief This class is used for generation with LLMs.
  */
@@ -276,6 +312,23 @@ public:
     * Turns off keeping KV cache between generate calls.
     */
     void finish_chat();
+
+    /**
+    * @brief Detaches the current chat from the pipeline: its history and KV cache are copied to a ChatSession,
+    * and the pipeline is left without a chat as after finish_chat(). Supported only by pipelines with stateful models.
+    *
+    * @return ChatSession to continue the chat by resume_chat()
+    */
+    ChatSession suspend_chat();
+
+    /**
+    * @brief Finishes the current chat, if any, and continues the chat of the session from the point it was suspended at.
+    * The KV cache of the session is restored instead of being computed from the chat history. The session keeps its state,
+    * so resuming it again continues from the same point, e.g. to branch a chat.
+    *
+    * @param session ChatSession returned by suspend_chat() of this pipeline
+    */
+    void resume_chat(const ChatSession& session);
 private:
     std::unique_ptr<LLMPipelineImplBase> m_pimpl;
 };
@@ -22,6 +22,20 @@ namespace genai {
 class OPENVINO_GENAI_EXPORTS AdapterController;
 struct AdapterControllerImpl;
 
+// Loading statistics of LoRA adapter file
+struct OPENVINO_GENAI_EXPORTS AdapterLoadStats {
+    // Duration of mapping and parsing of the adapter file in milliseconds
+    float load_duration = 0.0f;
+    // Size of the adapter file in bytes
+    size_t file_size = 0;
+    // Number of bytes of the file currently resident in physical memory, 0 if the OS doesn't allow to query it.
+    // The file is memory mapped, so its pages are loaded on demand and shared with other adapters loaded from the same file.
+    size_t resident_size = 0;
+    // Total duration of fusing the adapter into model weights with AdapterConfig::MODE_FUSE in milliseconds, summed over all models
+    // the adapter was fused to. If several adapters are fused at once, the duration is counted for each of them.
+    float fusion_duration = 0.0f;
+};
+
 // Immutable LoRA Adapter that carries the adaptation matrices and serves as unique adapter identifier
 class OPENVINO_GENAI_EXPORTS Adapter {
     class Impl;
@@ -35,6 +49,8 @@ public:
     explicit Adapter(const std::filesystem::path& path);
     Adapter() = default;
 
+    AdapterLoadStats get_load_stats() const;
+
     operator bool() const {
         return bool(m_pimpl);
     }
@@ -187,9 +203,23 @@ public:
 
     AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device);
 
+    // Name of i32 model input of [number of tokens] shape added by a controller created with `per_token_adapters` flag.
+    // It holds a slot index returned by `apply_batched` for each token in the batch, or -1 for tokens without adapters.
+    static constexpr const char* ADAPTER_SLOTS_INPUT_NAME = "adapter_slots";
+
+    // If `per_token_adapters` is true, the model is prepared to apply different adapter configs to different tokens of a batch
+    // in one inference, which is used to serve requests with different adapters in continuous batching.
+    // All adapters that can be used by requests should be registered in `config`, only MODE_AUTO and MODE_DYNAMIC are supported.
+    AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device, bool per_token_adapters);
+
     // Apply adapters configured in the current config set last time, or set and use new config given as optional `config` argument
     void apply(ov::InferRequest& request, const std::optional<AdapterConfig>& config = std::nullopt);
 
+    // Makes all `configs` applicable in the next inference of a controller created with `per_token_adapters` flag.
+    // Returns a slot index for each config to be set in ADAPTER_SLOTS_INPUT_NAME input for tokens adapted by that config, -1 for empty configs.
+    // State tensors are updated only if a config that isn't in the state yet is used.
+    std::vector<int32_t> apply_batched(ov::InferRequest& request, const std::vector<AdapterConfig>& configs);
+
     // Returns true if a given name is one of the state names created by this adapter controller for dynamic LoRA
     // Helps to distinguish LoRA states from other states (e.g. KV cache state) in the model for a partial state reset.
     bool has_state_name(const std::string& name);
@@ -51,11 +51,16 @@ struct SchedulerConfig {
     // when a sequence has finished genegartion its cache is released.
     bool enable_prefix_caching = false;
 
+    // max number of audio chunks encoded by one encoder inference of WhisperContinuousBatchingPipeline,
+    // other chunks are encoded at the next steps, so decoding of running requests isn't stalled by a large encoder batch
+    std::size_t max_num_encoder_seqs = 4;
+
     bool operator==(const SchedulerConfig& other) const {
         return max_num_batched_tokens == other.max_num_batched_tokens && num_kv_blocks == other.num_kv_blocks &&
                cache_size == other.cache_size &&
                dynamic_split_fuse == other.dynamic_split_fuse && use_cache_eviction == other.use_cache_eviction &&
-               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching;
+               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching &&
+               max_num_encoder_seqs == other.max_num_encoder_seqs;
     }
 };
 }
@@ -114,6 +114,9 @@ public:
     
     /**
     * @brief encode batch of prompts. Left padding will be applied by default
+    *
+    * Large batches are split into sub-batches of prompts of similar lengths, which are encoded in parallel
+    * if the tokenizer has several infer requests, e.g. if it's compiled with ov::hint::PerformanceMode::THROUGHPUT.
     * @param prompts vector storing batch of prompts
     * @param tokenization_params AnyMap with tokenization parameters, e.g. {"add_special_tokens", false}
     * @return pair of [input_ids, attention_mask]
@@ -184,6 +187,9 @@ public:
 
     /**
     * @brief batched decoding of tokens. 
+    *
+    * Lines are padded within sub-batches of lines of similar lengths, sub-batches of large batches are decoded in parallel
+    * if the detokenizer has several infer requests.
     * @param tokens vector of vectors with tokens, tokens.size() is equal to batch_size
     * @param detokenization_params AnyMap with detokenization parameters, e.g. {"skip_special_tokens", false}
     * @return vector of std::string, with size equal to batch_size
@@ -12,6 +12,10 @@ namespace ov::genai {
 struct OPENVINO_GENAI_EXPORTS VLMRawPerfMetrics {
     /** @brief Duration of preparation of embeddings */
     std::vector<MicroSeconds> prepare_embeddings_durations;
+    /** @brief Number of images whose embeddings were taken from the image embedding cache */
+    size_t image_embedding_cache_hits = 0;
+    /** @brief Number of images encoded by a vision encoder while the image embedding cache is enabled */
+    size_t image_embedding_cache_misses = 0;
 };
 
 struct OPENVINO_GENAI_EXPORTS VLMPerfMetrics : public PerfMetrics {
@@ -20,6 +24,11 @@ struct OPENVINO_GENAI_EXPORTS VLMPerfMetrics : public PerfMetrics {
 
     MeanStdPair get_prepare_embeddings_duration();
 
+    /** @brief Share of images found in the image embedding cache, 0 if the cache is disabled */
+    float image_embedding_cache_hit_rate = 0.0f;
+
+    float get_image_embedding_cache_hit_rate();
+
     VLMPerfMetrics() = default;
 
     VLMPerfMetrics(PerfMetrics& perf_metrics) : PerfMetrics(perf_metrics){};
@@ -34,6 +34,10 @@ public:
     /// @param device Inference device. A tokenizer is always compiled
     /// for CPU.
     /// @param properties A config to pass to ov::Core::compile_model().
+    /// Add ov::genai::scheduler_config property to run the language
+    /// model with paged attention, so generate() calls from several
+    /// threads are served in one continuous batch. Chat mode isn't
+    /// supported in that case.
     VLMPipeline(
         const std::filesystem::path& models_path,
         const std::string& device,
@@ -48,6 +52,8 @@ public:
     /// @param device Inference device. A tokenizer is always compiled
     /// for CPU.
     /// @param properties A config to pass to ov::Core::compile_model().
+    /// Add ov::genai::scheduler_config property to run the language
+    /// model with paged attention, see the constructor above.
     /// @param generation_config Optional generation configuration for the pipeline.
     VLMPipeline(
         const ModelsMap& models_map,
@@ -181,6 +187,15 @@ public:
     /// @param new_config A config to override default values with.
     void set_generation_config(const GenerationConfig& new_config);
 
+    /// @brief Keep embeddings of up to `capacity` most recently used
+    /// images, so an image passed again, e.g. in the next chat turn,
+    /// isn't encoded again. Images are matched by a hash of their
+    /// content. Cache hits and misses are reported in
+    /// VLMRawPerfMetrics.
+    /// @param capacity Max number of cached images, 0 disables the
+    /// cache. The cache is disabled by default.
+    void set_image_embedding_cache_capacity(size_t capacity);
+
 private:
     class VLMPipelineImpl;
     std::unique_ptr<VLMPipelineImpl> m_pimpl;
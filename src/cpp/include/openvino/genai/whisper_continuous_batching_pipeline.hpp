@@ -0,0 +1,74 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "openvino/genai/generation_handle.hpp"
+#include "openvino/genai/scheduler_config.hpp"
+#include "openvino/genai/tokenizer.hpp"
+#include "openvino/genai/whisper_generation_config.hpp"
+#include "openvino/genai/whisper_pipeline.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Automatic speech recognition pipeline which serves many transcription requests at once with one set of
+ * compiled models.
+ *
+ * At each step chunks of requests which need encoding are encoded by one encoder inference. Requests which
+ * start decoding of a chunk at the same step with the same number of prompt tokens are decoded as one batch,
+ * finished rows leave the batch. Only greedy decoding is supported.
+ * Only SchedulerConfig::max_num_seqs and SchedulerConfig::max_num_encoder_seqs are used: the first one limits
+ * the number of requests processed at once, other requests wait in the queue, the second one limits the number
+ * of chunks encoded at one step, other chunks are encoded at the next steps.
+ */
+class OPENVINO_GENAI_EXPORTS WhisperContinuousBatchingPipeline {
+    class WhisperContinuousBatchingImpl;
+    std::shared_ptr<WhisperContinuousBatchingImpl> m_impl;
+
+public:
+    WhisperContinuousBatchingPipeline(const std::filesystem::path& models_path,
+                                      const SchedulerConfig& scheduler_config,
+                                      const std::string& device,
+                                      const ov::AnyMap& properties = {});
+
+    ~WhisperContinuousBatchingPipeline();
+
+    ov::genai::Tokenizer get_tokenizer();
+
+    WhisperGenerationConfig get_generation_config() const;
+
+    /**
+     * Allows to get the current pipeline metrics.
+     * @return The struct with pipeline metrics for the previous generation step. KV cache usage is not tracked.
+     */
+    ov::genai::PipelineMetrics get_metrics() const;
+
+    /**
+     * @brief Adds transcription request. Can be called from another thread than step().
+     * Generated text tokens are pushed to the handle after each step for short-form audio without timestamps and
+     * after each 30 seconds chunk otherwise. Timestamp tokens are not pushed.
+     *
+     * @param request_id request id
+     * @param raw_speech_input raw speech input. Required to be normalized to near [-1, 1] range and have 16k Hz
+     * sampling rate.
+     * @param generation_config generation config of the request
+     */
+    GenerationHandle add_request(uint64_t request_id,
+                                 const RawSpeechInput& raw_speech_input,
+                                 const WhisperGenerationConfig& generation_config);
+
+    void step();
+
+    bool has_non_finished_requests();
+
+    // more high level interface, which transcribes multiple audios in continuous batching manner
+    std::vector<WhisperDecodedResults> generate(const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                const std::vector<WhisperGenerationConfig>& generation_configs);
+};
+
+}  // namespace ov::genai
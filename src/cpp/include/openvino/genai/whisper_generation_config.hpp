@@ -104,6 +104,16 @@ public:
      */
     std::optional<std::string> hotwords = std::nullopt;
 
+    /*
+     * Number of 30 seconds chunks of long-form audio encoded by one encoder inference and decoded together as a batch.
+     * With the default value 1 chunks are processed one by one and every next chunk starts right after the last
+     * timestamp predicted for the previous chunk.
+     * Values greater than 1 split audio into fixed 30 seconds chunks, so words crossing chunk boundaries may be
+     * recognized worse, but offline transcription of long files runs with a better throughput. In this mode timestamps
+     * are predicted only if `return_timestamps` is set.
+     */
+    size_t chunks_batch_size = 1;
+
     // A list containing tokens that will be suppressed at the beginning of the sampling process.
     std::vector<int64_t> begin_suppress_tokens;
 
@@ -146,6 +156,7 @@ static constexpr ov::Property<std::string> task{"task"};
 static constexpr ov::Property<bool> return_timestamps{"return_timestamps"};
 static constexpr ov::Property<std::string> initial_prompt{"initial_prompt"};
 static constexpr ov::Property<std::string> hotwords{"hotwords"};
+static constexpr ov::Property<size_t> chunks_batch_size{"chunks_batch_size"};
 static constexpr ov::Property<std::map<std::string, int64_t>> lang_to_id{"lang_to_id"};
 
 }  // namespace genai
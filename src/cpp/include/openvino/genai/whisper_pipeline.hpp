@@ -37,13 +37,23 @@ using ChunkStreamerVariant =
 struct OPENVINO_GENAI_EXPORTS WhisperRawPerfMetrics {
     /** @brief Duration for each features extraction call */
     std::vector<MicroSeconds> features_extraction_durations;
+    /** @brief Duration for each encoder inference call, one call may encode several 30 seconds chunks */
+    std::vector<MicroSeconds> encode_inference_durations;
+    /** @brief Duration of greedy decoding for each batch of encoded chunks */
+    std::vector<MicroSeconds> decode_durations;
 };
 
 struct OPENVINO_GENAI_EXPORTS WhisperPerfMetrics : public PerfMetrics {
     /** @brief Mean and standard deviation of Features Extraction Duration in milliseconds */
     MeanStdPair features_extraction_duration;
+    /** @brief Mean and standard deviation of Encoder Inference Duration in milliseconds */
+    MeanStdPair encode_inference_duration;
+    /** @brief Mean and standard deviation of Decode Duration of a batch of chunks in milliseconds */
+    MeanStdPair decode_duration;
 
     MeanStdPair get_features_extraction_duration();
+    MeanStdPair get_encode_inference_duration();
+    MeanStdPair get_decode_duration();
 
     WhisperPerfMetrics() = default;
 
@@ -101,6 +111,19 @@ struct WhisperDecodedResults {
     }
 };
 
+/**
+ * @brief Result of a live transcription step
+ */
+struct WhisperStreamingResult {
+    // segments which will not change anymore, timestamps are relative to the beginning of the stream
+    std::vector<WhisperDecodedResultChunk> final_chunks;
+
+    // transcription of the not finalized end of the stream, can be revised by the next steps
+    std::string partial_text;
+
+    WhisperPerfMetrics perf_metrics;
+};
+
 /**
  * @brief Automatic speech recognition pipeline
  */
@@ -169,6 +192,32 @@ public:
     }
     WhisperDecodedResults generate(const RawSpeechInput& raw_speech_input, const ov::AnyMap& config_map);
 
+    /**
+     * @brief Starts live transcription of an audio stream. Audio is passed by parts with push_audio(). Transcription
+     * of a sliding window of up to 30 seconds is recomputed each time `step` seconds of new audio are received.
+     * Segments which can't change anymore are returned as final chunks, the rest of the window as partial text.
+     *
+     * @param generation_config optional WhisperGenerationConfig
+     * @param step transcription step in seconds
+     */
+    void start_stream(OptionalWhisperGenerationConfig generation_config = std::nullopt, float step = 1.0f);
+
+    /**
+     * @brief Appends audio to the live transcription started with start_stream().
+     *
+     * @param audio_frames raw speech frames. Required to be normalized to near [-1, 1] range and have 16k Hz sampling
+     * rate.
+     * @return WhisperStreamingResult chunks finalized by the step and current partial text
+     */
+    WhisperStreamingResult push_audio(const RawSpeechInput& audio_frames);
+
+    /**
+     * @brief Transcribes the rest of the audio stream and finishes live transcription.
+     *
+     * @return WhisperStreamingResult the rest of the final chunks
+     */
+    WhisperStreamingResult finish_stream();
+
     ov::genai::Tokenizer get_tokenizer();
     WhisperGenerationConfig get_generation_config() const;
     void set_generation_config(const WhisperGenerationConfig& config);
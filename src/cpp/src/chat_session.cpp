@@ -0,0 +1,119 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "chat_session.hpp"
+
+#include <fstream>
+#include <unordered_map>
+
+namespace ov::genai {
+
+KVCacheSnapshot::KVCacheSnapshot(std::vector<std::pair<std::string, ov::Tensor>> states, ov::Tensor attention_mask)
+    : m_attention_mask(std::move(attention_mask)) {
+    m_states.reserve(states.size());
+    for (auto& [name, tensor] : states)
+        m_states.push_back({std::move(name), tensor.get_element_type(), tensor.get_shape(), tensor});
+}
+
+KVCacheSnapshot KVCacheSnapshot::save(ov::InferRequest& request, const std::optional<AdapterController>& adapter_controller) {
+    std::vector<std::pair<std::string, ov::Tensor>> states;
+    for (ov::VariableState& state : request.query_state()) {
+        if (adapter_controller && adapter_controller->has_state_name(state.get_name()))
+            continue;
+        // a plugin may return its own memory, which is changed by the following inference
+        const ov::Tensor tensor = state.get_state();
+        ov::Tensor copy(tensor.get_element_type(), tensor.get_shape());
+        tensor.copy_to(copy);
+        states.emplace_back(state.get_name(), copy);
+    }
+
+    const ov::Tensor attention_mask = request.get_tensor("attention_mask");
+    ov::Tensor attention_mask_copy(attention_mask.get_element_type(), attention_mask.get_shape());
+    attention_mask.copy_to(attention_mask_copy);
+    return KVCacheSnapshot(std::move(states), attention_mask_copy);
+}
+
+void KVCacheSnapshot::restore(ov::InferRequest& request) const {
+    std::unordered_map<std::string, ov::VariableState> request_states;
+    for (ov::VariableState& state : request.query_state())
+        request_states.emplace(state.get_name(), state);
+
+    for (auto& [name, tensor] : get_states()) {
+        auto it = request_states.find(name);
+        OPENVINO_ASSERT(it != request_states.end(), "The chat session was suspended by a pipeline with a different model: state '", name, "' is not found");
+        it->second.set_state(tensor);
+    }
+    // a chat suspended before the first generate() call has no KV cache
+    if (m_attention_mask)
+        request.set_tensor("attention_mask", m_attention_mask);
+}
+
+size_t KVCacheSnapshot::get_length() const {
+    return m_attention_mask ? m_attention_mask.get_shape().at(1) : 0;
+}
+
+size_t KVCacheSnapshot::get_byte_size() const {
+    size_t byte_size = 0;
+    for (const State& state : m_states)
+        byte_size += state.tensor ? state.tensor.get_byte_size() : 0;
+    return byte_size;
+}
+
+void KVCacheSnapshot::offload(const std::filesystem::path& path) {
+    std::vector<std::pair<std::string, ov::Tensor>> states = get_states();
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    OPENVINO_ASSERT(file.is_open(), "Failed to open ", path, " to offload KV cache");
+    for (const auto& [name, tensor] : states)
+        file.write(static_cast<const char*>(tensor.data()), tensor.get_byte_size());
+    file.close();
+    OPENVINO_ASSERT(file.good(), "Failed to write KV cache to ", path);
+
+    for (State& state : m_states)
+        state.tensor = ov::Tensor();
+    m_path = path;
+}
+
+bool KVCacheSnapshot::is_offloaded() const {
+    return !m_path.empty();
+}
+
+std::vector<std::pair<std::string, ov::Tensor>> KVCacheSnapshot::get_states() const {
+    std::vector<std::pair<std::string, ov::Tensor>> states;
+    states.reserve(m_states.size());
+    if (!is_offloaded()) {
+        for (const State& state : m_states)
+            states.emplace_back(state.name, state.tensor);
+        return states;
+    }
+
+    std::ifstream file(m_path, std::ios::binary);
+    OPENVINO_ASSERT(file.is_open(), "Failed to open ", m_path, " to read offloaded KV cache");
+    for (const State& state : m_states) {
+        ov::Tensor tensor(state.type, state.shape);
+        file.read(static_cast<char*>(tensor.data()), tensor.get_byte_size());
+        OPENVINO_ASSERT(file.good(), "Failed to read KV cache from ", m_path);
+        states.emplace_back(state.name, tensor);
+    }
+    return states;
+}
+
+ChatSession::ChatSession(std::shared_ptr<ChatSessionImpl> impl) : m_pimpl(std::move(impl)) {
+}
+
+size_t ChatSession::get_kv_cache_length() const {
+    return m_pimpl->kv_cache.get_length();
+}
+
+size_t ChatSession::get_memory_size() const {
+    return m_pimpl->kv_cache.get_byte_size();
+}
+
+void ChatSession::offload(const std::filesystem::path& path) {
+    m_pimpl->kv_cache.offload(path);
+}
+
+bool ChatSession::is_offloaded() const {
+    return m_pimpl->kv_cache.is_offloaded();
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,75 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <openvino/runtime/infer_request.hpp>
+
+#include "openvino/genai/llm_pipeline.hpp"
+#include "openvino/genai/lora_adapter.hpp"
+#include "utils.hpp"
+
+namespace ov::genai {
+
+/**
+ * KV cache states of a stateful model and the attention mask matching them, copied to host memory or offloaded to a file.
+ * States of LoRA adapters aren't saved, they are set by AdapterController before each inference.
+ */
+class KVCacheSnapshot {
+public:
+    KVCacheSnapshot() = default;
+
+    KVCacheSnapshot(std::vector<std::pair<std::string, ov::Tensor>> states, ov::Tensor attention_mask);
+
+    static KVCacheSnapshot save(ov::InferRequest& request, const std::optional<AdapterController>& adapter_controller);
+
+    // sets the saved states and attention mask to `request`, offloaded states are read from the file
+    void restore(ov::InferRequest& request) const;
+
+    // number of tokens in the saved KV cache, i.e. the length of the attention mask, tokens masked by trimming are included
+    size_t get_length() const;
+
+    // bytes of host memory kept by the saved states
+    size_t get_byte_size() const;
+
+    void offload(const std::filesystem::path& path);
+
+    bool is_offloaded() const;
+
+    // saved states in host memory, offloaded states are read from the file
+    std::vector<std::pair<std::string, ov::Tensor>> get_states() const;
+
+private:
+    struct State {
+        std::string name;
+        ov::element::Type type;
+        ov::Shape shape;
+        // empty if offloaded
+        ov::Tensor tensor;
+    };
+
+    std::vector<State> m_states;
+    ov::Tensor m_attention_mask;
+    // empty if the states are in host memory
+    std::filesystem::path m_path;
+};
+
+// everything StatefulLLMPipeline needs to continue a chat
+class ChatSession::ChatSessionImpl {
+public:
+    bool trust_encoded_history = true;
+    ChatHistory history;
+    std::string templated_chat_history;
+    std::vector<int64_t> tokenized_chat_history;
+    utils::GenerationChatInputsType chat_input_type = utils::GenerationChatInputsType::UNDEF;
+    std::optional<int64_t> last_disappeared_token;
+    utils::HistoryRemoveManager kv_history_manager;
+    KVCacheSnapshot kv_cache;
+};
+
+}  // namespace ov::genai
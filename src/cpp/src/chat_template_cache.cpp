@@ -0,0 +1,75 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "chat_template_cache.hpp"
+
+#include <jinja2cpp/template.h>
+#include <jinja2cpp/template_env.h>
+
+namespace ov::genai {
+
+struct ChatTemplateCache::ParsedTemplate {
+    jinja2::TemplateEnv env;
+    jinja2::Template tpl;
+
+    explicit ParsedTemplate(const std::string& chat_template) : tpl(&env) {
+        env.GetSettings().lstripBlocks = true;
+        env.GetSettings().trimBlocks = true;
+        tpl.Load(chat_template).value();
+    }
+};
+
+ChatTemplateCache::ChatTemplateCache(size_t capacity) : m_templates(capacity) {
+}
+
+ChatTemplateCache::~ChatTemplateCache() = default;
+
+size_t ChatTemplateCache::get_size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_templates.size();
+}
+
+size_t ChatTemplateCache::get_num_parsed() const {
+    return m_num_parsed;
+}
+
+std::unique_ptr<ChatTemplateCache::ParsedTemplate> ChatTemplateCache::acquire(const std::string& chat_template,
+                                                                              std::shared_ptr<Entry>& entry) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (std::shared_ptr<Entry>* cached = m_templates.find(chat_template)) {
+            entry = *cached;
+        } else {
+            // copies of an evicted template which are being rendered are destroyed after rendering
+            entry = std::make_shared<Entry>();
+            m_templates.insert(chat_template, entry);
+        }
+
+        if (!entry->empty()) {
+            std::unique_ptr<ParsedTemplate> parsed = std::move(entry->back());
+            entry->pop_back();
+            return parsed;
+        }
+    }
+
+    // parsing takes most of the time, so it's done without the lock
+    auto parsed = std::make_unique<ParsedTemplate>(chat_template);
+    ++m_num_parsed;
+    return parsed;
+}
+
+void ChatTemplateCache::release(const std::shared_ptr<Entry>& entry, std::unique_ptr<ParsedTemplate> parsed) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    entry->push_back(std::move(parsed));
+}
+
+std::string ChatTemplateCache::render(const std::string& chat_template, const jinja2::ValuesMap& params) {
+    std::shared_ptr<Entry> entry;
+    std::unique_ptr<ParsedTemplate> parsed = acquire(chat_template, entry);
+    // a template which failed to render is dropped and parsed again by the next call
+    std::string result = parsed->tpl.RenderAsString(params).value();
+    release(entry, std::move(parsed));
+    return result;
+}
+
+}  // namespace ov::genai
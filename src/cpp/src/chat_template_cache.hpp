@@ -0,0 +1,55 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <jinja2cpp/value.h>
+
+#include "lru_cache.hpp"
+
+namespace ov::genai {
+
+/**
+ * Thread-safe LRU cache of parsed Jinja2 chat templates keyed by a template string, so a template is parsed once
+ * instead of on each apply_chat_template() call. A parsed template is rendered by one thread at a time: it's taken
+ * from the cache for rendering and returned after it, so concurrent calls with the same template parse extra copies,
+ * which are kept for following calls.
+ */
+class ChatTemplateCache {
+public:
+    explicit ChatTemplateCache(size_t capacity = 8);
+
+    ChatTemplateCache(const ChatTemplateCache&) = delete;
+    ChatTemplateCache& operator=(const ChatTemplateCache&) = delete;
+
+    ~ChatTemplateCache();
+
+    // renders `chat_template` with `params`, throws if the template can't be parsed or rendered
+    std::string render(const std::string& chat_template, const jinja2::ValuesMap& params);
+
+    // number of different templates in the cache
+    size_t get_size() const;
+
+    // number of templates parsed since the cache was created
+    size_t get_num_parsed() const;
+
+private:
+    struct ParsedTemplate;
+    // idle parsed copies of one template, guarded by the cache mutex
+    using Entry = std::vector<std::unique_ptr<ParsedTemplate>>;
+
+    std::unique_ptr<ParsedTemplate> acquire(const std::string& chat_template, std::shared_ptr<Entry>& entry);
+    void release(const std::shared_ptr<Entry>& entry, std::unique_ptr<ParsedTemplate> parsed);
+
+    mutable std::mutex m_mutex;
+    std::atomic<size_t> m_num_parsed{0};
+    LRUCache<std::string, std::shared_ptr<Entry>> m_templates;
+};
+
+}  // namespace ov::genai
@@ -0,0 +1,85 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "continuous_batching_engine.hpp"
+
+namespace ov::genai {
+
+ContinuousBatchingPipeline::Engine::Engine(std::shared_ptr<ImplInterface> impl) :
+    m_impl(std::move(impl)),
+    m_has_requests(m_impl->has_non_finished_requests()),
+    m_thread([this] { run(); }) {
+}
+
+ContinuousBatchingPipeline::Engine::~Engine() {
+    try {
+        stop();
+    } catch (...) {
+    }
+}
+
+void ContinuousBatchingPipeline::Engine::run() {
+    while (true) {
+        {
+            // add_request() adds a request before notify() takes the mutex, so the wake up isn't missed
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_has_requests = m_impl->has_non_finished_requests();
+            m_cv.wait(lock, [this] { return m_stop || m_impl->has_non_finished_requests(); });
+            if (m_stop) {
+                return;
+            }
+        }
+
+        try {
+            m_impl->step();
+        } catch (...) {
+            std::exception_ptr error = std::current_exception();
+            {
+                // requests added after the error is set are rejected by notify(), the rest are failed below
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_error = error;
+                m_has_requests = false;
+            }
+            try {
+                m_impl->fail_requests(error);
+            } catch (...) {
+            }
+            return;
+        }
+    }
+}
+
+void ContinuousBatchingPipeline::Engine::notify() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_error) {
+        std::rethrow_exception(m_error);
+    }
+    m_has_requests = true;
+    m_cv.notify_one();
+}
+
+bool ContinuousBatchingPipeline::Engine::has_non_finished_requests() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_has_requests;
+}
+
+void ContinuousBatchingPipeline::Engine::check() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_error) {
+        std::rethrow_exception(m_error);
+    }
+}
+
+void ContinuousBatchingPipeline::Engine::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+        m_cv.notify_one();
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    check();
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,57 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "continuous_batching_impl_interface.hpp"
+
+namespace ov::genai {
+
+/**
+ * Background thread which calls step() of a pipeline while it has unfinished requests and waits for notify() otherwise,
+ * so clients only add requests and consume their outputs. If step() throws, the thread fails all requests of the pipeline,
+ * so their readers get the exception, stops, and the exception is rethrown by notify(), check() and stop().
+ */
+class ContinuousBatchingPipeline::Engine {
+public:
+    explicit Engine(std::shared_ptr<ImplInterface> impl);
+
+    Engine(const Engine&) = delete;
+    Engine& operator=(const Engine&) = delete;
+
+    // stops the thread, an exception which stopped it is ignored
+    ~Engine();
+
+    // wakes the thread up after a request is added, rethrows an exception which stopped the thread
+    // as the request could be added after the thread failed the requests of the pipeline
+    void notify();
+
+    // pipeline requests aren't accessed by other threads while the engine runs, so the state is tracked by the engine
+    bool has_non_finished_requests();
+
+    // rethrows an exception which stopped the thread
+    void check();
+
+    // stops the thread after the current step and rethrows an exception which stopped it
+    void stop();
+
+private:
+    void run();
+
+    std::shared_ptr<ImplInterface> m_impl;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stop = false;
+    std::exception_ptr m_error;
+    // requests left by the last step or added after it
+    bool m_has_requests = false;
+    std::thread m_thread;
+};
+
+}  // namespace ov::genai
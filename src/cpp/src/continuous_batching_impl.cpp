@@ -1,10 +1,13 @@
 // Copyright (C) 2023-2024 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <cstring>
+
 #include "text_callback_streamer.hpp"
 #include "continuous_batching_impl.hpp"
 #include "utils.hpp"
 #include "utils/paged_attention_transformations.hpp"
+#include "lora_helper.hpp"
 
 namespace ov::genai {
 template<class... Ts> struct overloaded : Ts... {using Ts::operator()...;};
@@ -28,18 +31,28 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::ContinuousBatchingImpl(
     auto [core_properties, compile_properties] = utils::split_core_compile_config(properties);
     core.set_property(core_properties);
 
+    // adapters passed to the pipeline are the set of adapters that requests can use, each request selects its own ones in sampling parameters
+    if (auto filtered_properties = extract_adapters_from_properties(compile_properties, &m_generation_config.adapters)) {
+        compile_properties = *filtered_properties;
+    }
+
     DeviceConfig device_config(core, scheduler_config, device, compile_properties);
 
     bool is_need_per_layer_cache_control = scheduler_config.use_cache_eviction;
     utils::apply_paged_attention_transformations(model, device_config, is_need_per_layer_cache_control);
 
+    if (m_generation_config.adapters) {
+        if (!m_generation_config.adapters->get_tensor_name_prefix()) {
+            m_generation_config.adapters->set_tensor_name_prefix("base_model.model.model.");
+        }
+        m_adapter_controller = AdapterController(model, *m_generation_config.adapters, device, /*per_token_adapters=*/true);
+    }
+
     init(model, scheduler_config, compile_properties, device_config, core);
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_pull_awaiting_requests() {
-    std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
-    m_requests.insert(m_requests.end(), m_awaiting_requests.begin(), m_awaiting_requests.end());
-    m_awaiting_requests.clear();
+    m_awaiting_requests.drain_to(m_requests);
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::init(
@@ -76,6 +89,8 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::init(
     // and finally create model runner
     bool is_use_cache_eviction = m_scheduler->get_config().use_cache_eviction;
     m_model_runner = std::make_shared<ModelRunner>(infer_request, m_scheduler->get_block_size(), device_config.get_num_layers(), is_use_cache_eviction);
+    m_model_runner->set_adapter_controller(m_adapter_controller);
+    m_model_runner->set_tracer(m_tracer);
     m_sampler = std::make_shared<Sampler>(m_tokenizer);
     m_sampler->set_seed(m_generation_config.rng_seed);
 
@@ -85,69 +100,131 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::init(
 };
 
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::set_tracer(const StepTracer& tracer) {
+    ImplInterface::set_tracer(tracer);
+    m_model_runner->set_tracer(tracer);
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::set_embedding_model(const EmbeddingsModel& embedding) {
+    const ov::PartialShape embeds_shape = m_model_runner->get_infer_request().get_compiled_model().input("inputs_embeds").get_partial_shape();
+    OPENVINO_ASSERT(embeds_shape.rank().is_static() && embeds_shape[embeds_shape.size() - 1].is_static(),
+                    "Hidden size of 'inputs_embeds' model input must be static, got ", embeds_shape);
+    m_model_runner->set_embedding_model(embedding, embeds_shape[embeds_shape.size() - 1].get_length());
+}
+
+GenerationHandle
+ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request_id,
+                                                               const ov::Tensor& input_ids,
+                                                               ov::genai::GenerationConfig sampling_params) {
+    return add_request(request_id, input_ids, ov::Tensor(), sampling_params);
+}
+
 GenerationHandle
 ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request_id,
                                                                const ov::Tensor& input_ids,
+                                                               const ov::Tensor& input_embeds,
                                                                ov::genai::GenerationConfig sampling_params) {
+    SequenceGroup::Ptr sequence_group = _add_sequence_group(request_id, input_ids, input_embeds, sampling_params);
+    return std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), sequence_group->get_sampling_parameters());
+}
+
+SequenceGroup::Ptr
+ContinuousBatchingPipeline::ContinuousBatchingImpl::_add_sequence_group(uint64_t request_id,
+                                                                        const ov::Tensor& input_ids,
+                                                                        const ov::Tensor& input_embeds,
+                                                                        ov::genai::GenerationConfig sampling_params) {
     // If eos_token_id was not provided, take value from default m_generation_config
     if (sampling_params.eos_token_id == -1)
         sampling_params.set_eos_token_id(m_generation_config.eos_token_id);
     sampling_params.validate();
 
+    // an adapter is identified by its index in the adapters registered at the pipeline construction, which live as long as the pipeline
+    std::vector<int64_t> adapters_key;
+    if (sampling_params.adapters && *sampling_params.adapters) {
+        OPENVINO_ASSERT(m_adapter_controller, "Request uses LoRA adapters, but the pipeline was created without them. "
+                        "Pass all adapters used by requests to the pipeline constructor in `adapters` property.");
+        const auto& registered_adapters = m_generation_config.adapters->get_adapters();
+        for (const auto& adapter : sampling_params.adapters->get_adapters()) {
+            auto registered = std::find(registered_adapters.begin(), registered_adapters.end(), adapter);
+            OPENVINO_ASSERT(registered != registered_adapters.end(),
+                            "Request uses LoRA adapter that wasn't passed to the pipeline constructor in `adapters` property.");
+            const float alpha = sampling_params.adapters->get_alpha(adapter);
+            int32_t alpha_bits = 0;
+            std::memcpy(&alpha_bits, &alpha, sizeof(alpha));
+            adapters_key.push_back(registered - registered_adapters.begin());
+            adapters_key.push_back(alpha_bits);
+        }
+    }
+
     SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(request_id, input_ids,
                                                                         sampling_params,
                                                                         m_scheduler->get_block_size(),
                                                                         m_scheduler->get_config().enable_prefix_caching);
     sequence_group->set_sequence_group_ptr(sequence_group);
+    sequence_group->set_adapters_key(std::move(adapters_key));
+    if (input_embeds) {
+        sequence_group->set_input_embeds(input_embeds);
+    }
     if (m_scheduler->get_config().enable_prefix_caching) {
         m_scheduler->restore_cached_blocks(sequence_group);
     }
 
-    {
-        std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
-        m_awaiting_requests.push_back(sequence_group);
-    }
-    return std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), sampling_params);
-};
+    m_awaiting_requests.push(sequence_group);
+    return sequence_group;
+}
 
 GenerationHandle
 ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request_id,
                                                                 const std::string& prompt,
                                                                 ov::genai::GenerationConfig sampling_params) {
-    static ManualTimer timer("tokenize");
-    timer.start();
-    ov::Tensor input_ids = m_tokenizer.encode(prompt).input_ids;
-    timer.end();
+    ov::Tensor input_ids;
+    {
+        StepTracer::Span span(m_tracer, "tokenize");
+        input_ids = m_tokenizer.encode(prompt).input_ids;
+    }
     return add_request(request_id, input_ids, sampling_params);
 }
 
 bool ContinuousBatchingPipeline::ContinuousBatchingImpl::has_non_finished_requests() {
-    std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
     return !m_awaiting_requests.empty() || !m_requests.empty();
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::fail_requests(std::exception_ptr error) {
+    m_awaiting_requests.drain_to(m_requests);
+    // readers are woken up first, as the state left by a failed step may fail the cleanup
+    for (const auto& request : m_requests) {
+        if (request->get_generation_stream()->get_status() == GenerationStatus::RUNNING) {
+            request->get_generation_stream()->fail(error);
+        }
+    }
+    for (const auto& request : m_requests) {
+        for (const auto& sequence : request->get_sequences()) {
+            if (m_scheduler->has_block_table(sequence->get_id())) {
+                m_scheduler->free_sequence(sequence->get_id());
+            }
+        }
+        m_sampler->clear_request_info(request->get_request_id());
+    }
+    m_requests.clear();
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
-    static ManualTimer step_timer("step()");
-    step_timer.start();
+    StepTracer::Span step_span(m_tracer, "step");
 
     _pull_awaiting_requests();
 
-    m_pipeline_metrics.requests = m_requests.size();
-
     Scheduler::Output scheduler_output;
     {
-        static ManualTimer timer("scheduling");
-        timer.start();
+        StepTracer::Span span(m_tracer, "scheduling");
         m_scheduler->clean_empty_blocks(m_requests);
         scheduler_output = m_scheduler->schedule(m_requests);
-        m_pipeline_metrics.scheduled_requests = scheduler_output.m_scheduled_sequence_groups_ids.size();
-        m_pipeline_metrics.cache_usage = scheduler_output.m_cache_usage;
-        m_pipeline_metrics.max_cache_usage =
-            std::max(m_pipeline_metrics.max_cache_usage, scheduler_output.m_cache_usage);
         _register_step_cache_usage(scheduler_output.m_cache_usage);
-        m_pipeline_metrics.avg_cache_usage = _get_current_running_average_cache_usage();
+        _register_scheduled_requests(scheduler_output);
+    }
+
+    {
+        StepTracer::Span span(m_tracer, "block copy");
         m_cache_manager->copy_blocks(scheduler_output.m_block_copy_map);
-        timer.end();
     }
 
     // if no tokens were scheduled, we are out of memory
@@ -165,10 +242,8 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
     ov::Tensor logits;
     {
-        static ManualTimer timer("forward");
-        timer.start();
+        StepTracer::Span span(m_tracer, "forward");
         logits = m_model_runner->forward(m_requests, scheduler_output);
-        timer.end();
     }
 
 #ifdef DEBUG_CACHE_STATE_DUMP
@@ -180,6 +255,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
     // evict unimportant blocks from KV cache, if requested
     if (sched_config.use_cache_eviction) {
+        StepTracer::Span span(m_tracer, "eviction");
         maybe_evict_cache_blocks(sched_config);
     }
 
@@ -193,16 +269,14 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
     SamplerOutput sampler_output;
     {
-        static ManualTimer timer("sample");
-        timer.start();
+        StepTracer::Span span(m_tracer, "sampling");
         sampler_output = m_sampler->sample(m_requests, logits, m_is_validation_mode_enabled);
-        timer.end();
     }
+    _register_generated_tokens(scheduler_output);
 
     // process sampler_output (e.g. fork or drop sequences from BlockScheduler)
     {
-        static ManualTimer timer("fork / free sequence");
-        timer.start();
+        StepTracer::Span span(m_tracer, "fork / free sequences");
 
         for (const auto& pair : sampler_output.m_forked_sequences) {
             uint64_t parent_id = pair.first;
@@ -213,28 +287,20 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
         for (auto seq_id : sampler_output.m_dropped_sequences)
             m_scheduler->free_sequence(seq_id);
-
-        timer.end();
     }
 
     // notify requests dropped by handle
     {
-        static ManualTimer timer("notify requests dropped by handle");
-        timer.start();
+        StepTracer::Span span(m_tracer, "notify");
         _notify_requests_dropped_by_handle();
-        timer.end();
     }
 
     // free non running requests for current step
 
     {
-        static ManualTimer timer("free non running requests");
-        timer.start();
+        StepTracer::Span span(m_tracer, "free requests");
         _free_non_running_requests();
-        timer.end();
     }
-
-    step_timer.end();
 }
 
 std::vector<EncodedGenerationResult>
@@ -263,6 +329,7 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
                 }
             }
             m_sampler->clear_request_info(request->get_request_id());
+            request->get_generation_stream()->close();
         }
         m_requests.clear();
     };
@@ -271,12 +338,15 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
         (sampling_params[0].is_greedy_decoding() || sampling_params[0].is_multinomial()),
         "Currently streaming is possible only with batch size=1 and only for greedy or multinomial decoding");
 
+    // we need to store all requests to get results from them once generation has finished
+    std::vector<SequenceGroup::Ptr> all_requests;
     std::vector<GenerationHandle> generations;
     for (size_t request_id = 0; request_id < input_ids.size(); ++request_id) {
         OPENVINO_ASSERT(1 == input_ids[request_id].get_shape().at(0), "Use multiple tensors to pass a batch.");
-        generations.push_back(add_request(request_id, input_ids[request_id], sampling_params[request_id]));
+        all_requests.push_back(_add_sequence_group(request_id, input_ids[request_id], ov::Tensor(), sampling_params[request_id]));
+        generations.push_back(std::make_shared<GenerationHandleImpl>(all_requests.back()->get_generation_stream(),
+                                                                     all_requests.back()->get_sampling_parameters()));
     }
-    auto all_requests = m_awaiting_requests; // we need to store all requests to get results from them once generation has finished
 
     bool continue_generation = true;
     while (has_non_finished_requests() && continue_generation) {
@@ -348,12 +418,20 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_free_non_running_reque
     while (requests_iterator != m_requests.end()) {
         const auto& request = *requests_iterator;
         if(request->has_finished() || request->out_of_memory() || request->handle_dropped()) {
+            const size_t generated_len = request->get_max_generated_len();
+            if (request->has_finished() && request->get_first_token_time() && generated_len > 1) {
+                auto time_after_first_token = std::chrono::steady_clock::now() - *request->get_first_token_time();
+                std::lock_guard<std::mutex> lock{m_metrics_mutex};
+                m_tpot_histogram.record(std::chrono::duration_cast<std::chrono::microseconds>(time_after_first_token / (generated_len - 1)));
+            }
             for (const auto& sequence: request->get_sequences()) {
                 if (m_scheduler->has_block_table(sequence->get_id())) {
                     m_scheduler->free_sequence(sequence->get_id());
                 }
             }
             m_sampler->clear_request_info(request->get_request_id());
+            // handles awaiting outputs learn that there are no more
+            request->get_generation_stream()->close();
             requests_iterator = m_requests.erase(requests_iterator);
         } else {
             requests_iterator++;
@@ -381,6 +459,74 @@ float ContinuousBatchingPipeline::ContinuousBatchingImpl::_get_current_running_a
     return std::accumulate(m_previous_step_cache_usages.begin(), m_previous_step_cache_usages.end(), 0.0) / m_previous_step_cache_usages.size();
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_register_scheduled_requests(const Scheduler::Output& scheduler_output) {
+    const auto now = std::chrono::steady_clock::now();
+    const bool enable_prefix_caching = m_scheduler->get_config().enable_prefix_caching;
+
+    std::lock_guard<std::mutex> lock{m_metrics_mutex};
+    m_pipeline_metrics.requests = m_requests.size();
+    m_pipeline_metrics.scheduled_requests = scheduler_output.m_scheduled_sequence_groups_ids.size();
+    m_pipeline_metrics.cache_usage = scheduler_output.m_cache_usage;
+    m_pipeline_metrics.max_cache_usage = std::max(m_pipeline_metrics.max_cache_usage, scheduler_output.m_cache_usage);
+    m_pipeline_metrics.avg_cache_usage = _get_current_running_average_cache_usage();
+    m_pipeline_metrics.preemptions += scheduler_output.m_num_preemptions;
+    m_pipeline_metrics.recomputed_tokens += scheduler_output.m_num_preempted_tokens;
+
+    for (size_t seq_group_id : scheduler_output.m_scheduled_sequence_groups_ids) {
+        const SequenceGroup::Ptr& sequence_group = m_requests[seq_group_id];
+        if (sequence_group->get_first_scheduled_time())
+            continue;
+        sequence_group->set_first_scheduled_time(now);
+        m_queue_wait_histogram.record(std::chrono::duration_cast<std::chrono::microseconds>(now - sequence_group->get_arrival_time()));
+        // before the first scheduling, processed tokens are the ones restored from the prefix cache
+        if (enable_prefix_caching) {
+            m_num_prompt_tokens += sequence_group->get_prompt_len();
+            m_num_cached_prompt_tokens += sequence_group->get_num_processed_tokens();
+        }
+    }
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_register_generated_tokens(const Scheduler::Output& scheduler_output) {
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock{m_metrics_mutex};
+    for (size_t seq_group_id : scheduler_output.m_scheduled_sequence_groups_ids) {
+        const SequenceGroup::Ptr& sequence_group = m_requests[seq_group_id];
+        if (!sequence_group->get_first_token_time() && sequence_group->get_max_generated_len() > 0) {
+            sequence_group->set_first_token_time(now);
+            m_ttft_histogram.record(std::chrono::duration_cast<std::chrono::microseconds>(now - sequence_group->get_arrival_time()));
+        }
+    }
+}
+
+PipelineMetrics ContinuousBatchingPipeline::ContinuousBatchingImpl::_collect_metrics() const {
+    PipelineMetrics metrics = m_pipeline_metrics;
+    metrics.ttft = m_ttft_histogram.get_percentiles();
+    metrics.tpot = m_tpot_histogram.get_percentiles();
+    metrics.queue_wait = m_queue_wait_histogram.get_percentiles();
+    if (m_num_prompt_tokens != 0)
+        metrics.prefix_cache_hit_rate = 100.0f * m_num_cached_prompt_tokens / m_num_prompt_tokens;
+    return metrics;
+}
+
+PipelineMetrics ContinuousBatchingPipeline::ContinuousBatchingImpl::get_metrics() const {
+    std::lock_guard<std::mutex> lock{m_metrics_mutex};
+    return _collect_metrics();
+}
+
+PipelineMetrics ContinuousBatchingPipeline::ContinuousBatchingImpl::reset_metrics() {
+    std::lock_guard<std::mutex> lock{m_metrics_mutex};
+    PipelineMetrics metrics = _collect_metrics();
+    m_ttft_histogram.reset();
+    m_tpot_histogram.reset();
+    m_queue_wait_histogram.reset();
+    m_num_prompt_tokens = 0;
+    m_num_cached_prompt_tokens = 0;
+    m_pipeline_metrics.preemptions = 0;
+    m_pipeline_metrics.recomputed_tokens = 0;
+    m_pipeline_metrics.max_cache_usage = m_pipeline_metrics.cache_usage;
+    return metrics;
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::maybe_evict_cache_blocks(const SchedulerConfig& sched_config) {
     std::unordered_map<SequenceGroup::Ptr, size_t> seq_group_to_num_blocks_evicted_map;
     auto sequence_attention_scores = m_model_runner->get_last_attention_scores();
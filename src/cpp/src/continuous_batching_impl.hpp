@@ -6,6 +6,8 @@
 #include "continuous_batching_impl_interface.hpp"
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "cache_eviction.hpp"
+#include "latency_histogram.hpp"
+#include "mpsc_queue.hpp"
 
 namespace ov::genai {
 class ContinuousBatchingPipeline::ContinuousBatchingImpl : public ContinuousBatchingPipeline::ImplInterface {
@@ -14,18 +16,25 @@ protected:
     std::shared_ptr<CacheManager> m_cache_manager;
     std::shared_ptr<ModelRunner> m_model_runner;
     std::shared_ptr<Sampler> m_sampler;
+    // applies LoRA adapters of each request to its tokens, set if adapters are registered at the pipeline construction
+    std::optional<AdapterController> m_adapter_controller;
 
     // current requests to process
     std::vector<SequenceGroup::Ptr> m_requests;
-    // requests added to the pipeline that will be added to m_requests in the next iteration
-    std::vector<SequenceGroup::Ptr> m_awaiting_requests;
-    // Mutex protecting access to m_awaiting_requests, so add_request and step methods can be called from different threads
-    std::mutex m_awaiting_requests_mutex;
+    // requests added to the pipeline that will be added to m_requests in the next iteration.
+    // add_request may be called from many threads, step pops the requests
+    MPSCQueue<SequenceGroup::Ptr> m_awaiting_requests;
 
     std::map<size_t, CacheEvictionAlgorithm> m_seq_group_id_to_cache_eviction_algo_map;
 
     static const size_t AVG_CACHE_USAGE_WINDOW_SIZE_IN_STEPS = 1000;
     std::deque<float> m_previous_step_cache_usages;
+
+    // guards m_pipeline_metrics and the latency statistics below, so metrics can be read while step() is running in another thread
+    mutable std::mutex m_metrics_mutex;
+    // aggregated since the pipeline creation or the last reset_metrics()
+    LatencyHistogram m_ttft_histogram, m_tpot_histogram, m_queue_wait_histogram;
+    size_t m_num_prompt_tokens = 0, m_num_cached_prompt_tokens = 0;
     
     // flag to enable validation mode for sampler
     bool m_is_validation_mode_enabled = false;
@@ -41,6 +50,11 @@ protected:
     void _notify_requests_dropped_by_handle();
     void _register_step_cache_usage(float step_cache_usage);
     float _get_current_running_average_cache_usage() const;
+    // update metrics after scheduling and after sampling of a step
+    void _register_scheduled_requests(const Scheduler::Output& scheduler_output);
+    void _register_generated_tokens(const Scheduler::Output& scheduler_output);
+    // requires m_metrics_mutex to be locked
+    PipelineMetrics _collect_metrics() const;
     void maybe_evict_cache_blocks(const SchedulerConfig& sched_config);
 
     void init(std::shared_ptr<ov::Model> model,
@@ -51,6 +65,12 @@ protected:
 
     virtual void _pull_awaiting_requests();
 
+    // creates a sequence group of the request and queues it to m_awaiting_requests
+    SequenceGroup::Ptr _add_sequence_group(uint64_t request_id,
+                                           const ov::Tensor& input_ids,
+                                           const ov::Tensor& input_embeds,
+                                           ov::genai::GenerationConfig sampling_params);
+
     void _fill_prompt_log_probs(std::vector<SequenceGroup::Ptr>& sequence_groups, ov::Tensor& logits);
 public:
     ContinuousBatchingImpl(const std::shared_ptr<ov::Model>& model,
@@ -68,8 +88,30 @@ public:
                                  const std::string& prompt,
                                  ov::genai::GenerationConfig sampling_params) override;
 
+    /**
+     * Adds a request with a prompt given by embeddings of shape [1, prompt_len, hidden_size], e.g. a prompt of a visual language model
+     * with image features. `input_ids` of prompt_len tokens are used by logit processors only. Requires set_embedding_model().
+     */
+    GenerationHandle add_request(uint64_t request_id,
+                                 const ov::Tensor& input_ids,
+                                 const ov::Tensor& input_embeds,
+                                 ov::genai::GenerationConfig sampling_params);
+
+    /**
+     * Makes the model consume `inputs_embeds` instead of `input_ids`: embeddings of generated tokens and prompts passed as token ids
+     * are computed by `embedding`, which must not be inferred by other threads during step().
+     */
+    void set_embedding_model(const EmbeddingsModel& embedding);
+
+    void set_tracer(const StepTracer& tracer) override;
+
+    PipelineMetrics get_metrics() const override;
+    PipelineMetrics reset_metrics() override;
+
     bool has_non_finished_requests() override;
 
+    void fail_requests(std::exception_ptr error) override;
+
     void step() override;
 
     std::vector<EncodedGenerationResult>
@@ -13,10 +13,36 @@ PipelineMetrics ContinuousBatchingPipeline::ImplInterface::get_metrics() const {
     return m_pipeline_metrics;
 }
 
+PipelineMetrics ContinuousBatchingPipeline::ImplInterface::reset_metrics() {
+    PipelineMetrics metrics = m_pipeline_metrics;
+    m_pipeline_metrics.max_cache_usage = m_pipeline_metrics.cache_usage;
+    return metrics;
+}
+
 Tokenizer ContinuousBatchingPipeline::ImplInterface::get_tokenizer() {
     return m_tokenizer;
 }
 
+void ContinuousBatchingPipeline::ImplInterface::enable_tracing(bool enabled) {
+    m_tracer.set_enabled(enabled);
+}
+
+std::string ContinuousBatchingPipeline::ImplInterface::get_chrome_trace() const {
+    return m_tracer.get_chrome_trace();
+}
+
+std::map<std::string, TraceSpanStatistics> ContinuousBatchingPipeline::ImplInterface::get_trace_statistics() const {
+    return m_tracer.get_statistics();
+}
+
+void ContinuousBatchingPipeline::ImplInterface::clear_trace() {
+    m_tracer.clear();
+}
+
+void ContinuousBatchingPipeline::ImplInterface::set_tracer(const StepTracer& tracer) {
+    m_tracer = tracer;
+}
+
 void ContinuousBatchingPipeline::ImplInterface::start_chat(const std::string& system_message) {
     if (!system_message.empty()) {
         m_history.push_back({{"role", "system"}, {"content", system_message}});
@@ -35,22 +61,19 @@ ContinuousBatchingPipeline::ImplInterface::generate(
     std::vector<ov::genai::GenerationConfig> sampling_params,
     const StreamerVariant& streamer) {
     std::vector<ov::Tensor> input_ids;
-    static ManualTimer timer("tokenize");
     if (m_is_chat_conversation) {
         OPENVINO_ASSERT(1 == prompts.size(), "Can't chat with multiple prompts");
         m_history.push_back({{"role", "user"}, {"content", prompts.at(0)}});
         constexpr bool add_generation_prompt = true;
         std::string history = m_tokenizer.apply_chat_template(m_history, add_generation_prompt);
-        timer.start();
+        StepTracer::Span span(m_tracer, "tokenize");
         // ov::genai::add_special_tokens(false) is aligned with stateful pipeline
         input_ids.push_back(m_tokenizer.encode(history, ov::genai::add_special_tokens(false)).input_ids);
-        timer.end();
     } else {
         input_ids.reserve(prompts.size());
         for (const std::string& prompt : prompts) {
-            timer.start();
+            StepTracer::Span span(m_tracer, "tokenize");
             input_ids.push_back(m_tokenizer.encode(prompt).input_ids);
-            timer.end();
         }
     }
     std::vector<EncodedGenerationResult> encoded = generate(input_ids, sampling_params, streamer);
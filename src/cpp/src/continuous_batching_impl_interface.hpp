@@ -3,12 +3,15 @@
 
 #pragma once
 
+#include <exception>
+
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 
 #include "cache_manager.hpp"
 #include "sampler.hpp"
 #include "model_runner.hpp"
 #include "scheduler.hpp"
+#include "step_tracer.hpp"
 
 namespace ov::genai {
 
@@ -38,11 +41,24 @@ protected:
     bool m_is_chat_conversation = false;
     ChatHistory m_history;
 
+    // spans of this pipeline, pipelines it's composed of write to the same trace
+    StepTracer m_tracer;
+
 public:
     ov::genai::GenerationConfig get_config() const;
-    PipelineMetrics get_metrics() const;
+    virtual PipelineMetrics get_metrics() const;
+    // returns metrics before the reset
+    virtual PipelineMetrics reset_metrics();
     ov::genai::Tokenizer get_tokenizer();
 
+    void enable_tracing(bool enabled);
+    std::string get_chrome_trace() const;
+    std::map<std::string, TraceSpanStatistics> get_trace_statistics() const;
+    void clear_trace();
+
+    // makes the pipeline record its spans by `tracer`, called by pipelines which own this one before it's used
+    virtual void set_tracer(const StepTracer& tracer);
+
     virtual GenerationHandle add_request(uint64_t request_id,
                                          const ov::Tensor& input_ids,
                                          ov::genai::GenerationConfig sampling_params) = 0;
@@ -54,6 +70,9 @@ public:
 
     virtual void step() = 0;
 
+    // drops all requests after step() failed with `error`, their readers get the error
+    virtual void fail_requests(std::exception_ptr error) = 0;
+
     virtual std::vector<EncodedGenerationResult>
     generate(const std::vector<ov::Tensor>& input_ids,
              const std::vector<GenerationConfig>& sampling_params,
@@ -10,9 +10,9 @@
 #include "openvino/genai/generation_handle.hpp"
 #include "openvino/genai/tokenizer.hpp"
 #include "continuous_batching_impl.hpp"
+#include "continuous_batching_engine.hpp"
 #include "speculative_decoding/speculative_decoding_impl.hpp"
 #include "prompt_lookup/prompt_lookup_impl.hpp"
-#include "timer.hpp"
 #include "utils.hpp"
 #include "debug_utils.hpp"
 #include "cache_state_dumper.hpp"
@@ -123,27 +123,79 @@ PipelineMetrics ContinuousBatchingPipeline::get_metrics() const{
     return m_impl->get_metrics();
 }
 
+PipelineMetrics ContinuousBatchingPipeline::reset_metrics() {
+    return m_impl->reset_metrics();
+}
+
+void ContinuousBatchingPipeline::enable_tracing(bool enabled) {
+    m_impl->enable_tracing(enabled);
+}
+
+std::string ContinuousBatchingPipeline::get_chrome_trace() const {
+    return m_impl->get_chrome_trace();
+}
+
+std::map<std::string, TraceSpanStatistics> ContinuousBatchingPipeline::get_trace_statistics() const {
+    return m_impl->get_trace_statistics();
+}
+
+void ContinuousBatchingPipeline::clear_trace() {
+    m_impl->clear_trace();
+}
+
 GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, const std::string& prompt, const ov::genai::GenerationConfig& sampling_params) {
-    return m_impl->add_request(request_id, prompt, sampling_params);
+    if (m_engine) {
+        m_engine->check();
+    }
+    auto handle = m_impl->add_request(request_id, prompt, sampling_params);
+    if (m_engine) {
+        m_engine->notify();
+    }
+    return handle;
 }
 
 GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params) {
-    return m_impl->add_request(request_id, input_ids, sampling_params);
+    if (m_engine) {
+        m_engine->check();
+    }
+    auto handle = m_impl->add_request(request_id, input_ids, sampling_params);
+    if (m_engine) {
+        m_engine->notify();
+    }
+    return handle;
 }
 
 void ContinuousBatchingPipeline::step() {
+    OPENVINO_ASSERT(!m_engine, "step() can't be called while the engine thread started by start_engine() is running");
     m_impl->step();
 }
 
+void ContinuousBatchingPipeline::start_engine() {
+    OPENVINO_ASSERT(!m_engine, "Engine thread is already running");
+    m_engine = std::make_shared<Engine>(m_impl);
+}
+
+void ContinuousBatchingPipeline::stop_engine() {
+    if (m_engine) {
+        auto engine = std::move(m_engine);
+        engine->stop();
+    }
+}
+
 bool ContinuousBatchingPipeline::has_non_finished_requests() {
+    if (m_engine) {
+        return m_engine->has_non_finished_requests();
+    }
     return m_impl->has_non_finished_requests();
 }
 
 std::vector<EncodedGenerationResult> ContinuousBatchingPipeline::generate(const std::vector<ov::Tensor>& input_ids, const std::vector<ov::genai::GenerationConfig>& sampling_params, const StreamerVariant& streamer) {
+    OPENVINO_ASSERT(!m_engine, "generate() can't be called while the engine thread started by start_engine() is running");
     return m_impl->generate(input_ids, sampling_params, streamer);
 }
 
 std::vector<GenerationResult> ContinuousBatchingPipeline::generate(const std::vector<std::string>& prompts, const std::vector<ov::genai::GenerationConfig>& sampling_params, const StreamerVariant& streamer) {
+    OPENVINO_ASSERT(!m_engine, "generate() can't be called while the engine thread started by start_engine() is running");
     return m_impl->generate(prompts, sampling_params, streamer);
 }
 
@@ -38,6 +38,16 @@ std::unordered_map<uint64_t, GenerationOutput> GenerationHandleImpl::read() {
     return m_generation_stream->read();
 }
 
+std::future<GenerationOutputs> GenerationHandleImpl::read_async() {
+    OPENVINO_ASSERT(!is_dropped(), "GenerationHandle cannot be used after it is dropped.");
+    return m_generation_stream->read_async();
+}
+
+void GenerationHandleImpl::set_callback(std::function<void(GenerationOutputs)> callback) {
+    OPENVINO_ASSERT(!is_dropped(), "GenerationHandle cannot be used after it is dropped.");
+    m_generation_stream->set_callback(std::move(callback));
+}
+
 void add_partial_result(std::unordered_map<uint64_t, GenerationOutput>& partial_results, std::unordered_map<uint64_t, GenerationOutput>& iteration_results) {
     for (auto& iteration_result: iteration_results) {
         auto partial_result_iter = partial_results.find(iteration_result.first);
@@ -4,15 +4,80 @@
 #pragma once
 #include <mutex>
 #include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
+#include <queue>
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "openvino/genai/generation_handle.hpp"
-#include "synchronized_queue.hpp"
+#include "spsc_queue.hpp"
 
 namespace ov::genai {
 class GenerationStream {
     std::mutex m_mutex;
     GenerationStatus m_status = GenerationStatus::RUNNING;
-    SynchronizedQueue<GenerationOutputs> m_output_queue;
+    // written by the pipeline step only, so push() doesn't lock unless outputs are subscribed
+    SPSCQueue<GenerationOutputs> m_output_queue;
+
+    // Consumers subscribed by set_callback() and read_async() get outputs instead of the queue.
+    // The mutex is held while the callback runs, so chunks are passed in order.
+    std::mutex m_subscription_mutex;
+    // set under m_subscription_mutex by the first subscriber; from then on outputs are popped under the mutex only
+    std::atomic<bool> m_subscribed{false};
+    std::function<void(GenerationOutputs)> m_callback;
+    std::queue<std::promise<GenerationOutputs>> m_promises;
+    // empty outputs are the last ones, they are pushed when a request is dropped or passed to subscribers by close()
+    bool m_closed = false;
+    // set by fail() before the last empty outputs are pushed, so consumers popping them see it
+    std::exception_ptr m_error;
+
+    // passes the last empty outputs or the error which stopped generation to a promise
+    void set_last_outputs(std::promise<GenerationOutputs>& promise) {
+        if (m_error) {
+            promise.set_exception(m_error);
+        } else {
+            promise.set_value({});
+        }
+    }
+
+    void fulfill_promises_if_closed() {
+        while (m_closed && !m_promises.empty()) {
+            set_last_outputs(m_promises.front());
+            m_promises.pop();
+        }
+    }
+
+    GenerationOutputs rethrow_if_failed(GenerationOutputs outputs) {
+        if (outputs.empty() && m_error) {
+            std::rethrow_exception(m_error);
+        }
+        return outputs;
+    }
+
+    // passes queued outputs to subscribers, requires m_subscription_mutex to be locked
+    void dispatch_queued_outputs() {
+        GenerationOutputs outputs;
+        while ((m_callback || !m_promises.empty()) && m_output_queue.try_pop(outputs)) {
+            m_closed = m_closed || outputs.empty();
+            if (m_callback) {
+                m_callback(std::move(outputs));
+            } else {
+                if (outputs.empty()) {
+                    set_last_outputs(m_promises.front());
+                } else {
+                    m_promises.front().set_value(std::move(outputs));
+                }
+                m_promises.pop();
+                fulfill_promises_if_closed();
+            }
+        }
+    }
+
+    void subscribe() {
+        m_subscribed.store(true, std::memory_order_relaxed);
+        // pairs with the fence in push(): either push() sees the flag or outputs it pushed are seen here
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
 
 public:
     using Ptr = std::shared_ptr<GenerationStream>;
@@ -26,18 +91,89 @@ public:
 
     void push(GenerationOutputs outputs) {
         m_output_queue.push(std::move(outputs));
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_subscribed.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(m_subscription_mutex);
+            dispatch_queued_outputs();
+        }
+    }
+
+    // Notifies subscribers that generation is over, called when a request leaves a pipeline.
+    // Nothing is pushed to the queue, so read() and back() are not affected.
+    void close() {
+        std::lock_guard<std::mutex> lock(m_subscription_mutex);
+        if (m_closed) {
+            return;
+        }
+        m_closed = true;
+        if (m_callback) {
+            m_callback({});
+        }
+        fulfill_promises_if_closed();
+    }
+
+    // Drops the request after a pipeline step failed with `error`, called by the pipeline thread instead of close().
+    // Blocked readers wake up: read(), back() and futures of read_async() rethrow the error, callbacks get empty outputs.
+    void fail(std::exception_ptr error) {
+        m_error = std::move(error);
+        set_generation_status(GenerationStatus::DROPPED_BY_PIPELINE);
+        push({});
+        close();
     }
 
     // Retrieving vector of pairs <sequence_id, token_ids> as we can generate multiple outputs for a single prompt
     GenerationOutputs back() {
-        return m_output_queue.back();
+        return rethrow_if_failed(m_output_queue.back());
     }
 
     GenerationOutputs read() {
-        return m_output_queue.pull();
+        return rethrow_if_failed(m_output_queue.pull());
+    }
+
+    std::future<GenerationOutputs> read_async() {
+        std::lock_guard<std::mutex> lock(m_subscription_mutex);
+        OPENVINO_ASSERT(!m_callback, "Outputs of a generation with a callback are passed to the callback only");
+        subscribe();
+        std::promise<GenerationOutputs> promise;
+        std::future<GenerationOutputs> future = promise.get_future();
+        GenerationOutputs outputs;
+        const bool popped = m_output_queue.try_pop(outputs);
+        if (popped && !outputs.empty()) {
+            promise.set_value(std::move(outputs));
+        } else if (popped || m_closed) {
+            m_closed = true;
+            set_last_outputs(promise);
+        } else {
+            m_promises.push(std::move(promise));
+        }
+        return future;
+    }
+
+    void set_callback(std::function<void(GenerationOutputs)> callback) {
+        std::lock_guard<std::mutex> lock(m_subscription_mutex);
+        OPENVINO_ASSERT(callback, "Generation callback must not be empty");
+        OPENVINO_ASSERT(!m_callback, "Generation callback is already set");
+        OPENVINO_ASSERT(m_promises.empty(), "Generation callback can't be set while outputs are awaited by read_async()");
+        subscribe();
+        bool end_passed = false;
+        GenerationOutputs outputs;
+        while (m_output_queue.try_pop(outputs)) {
+            end_passed = outputs.empty();
+            callback(std::move(outputs));
+        }
+        if (m_closed && !end_passed) {
+            callback({});
+        }
+        m_closed = m_closed || end_passed;
+        m_callback = std::move(callback);
     }
 
     bool can_read() {
+        if (m_subscribed.load(std::memory_order_relaxed)) {
+            // outputs are popped by push() of the pipeline thread
+            std::lock_guard<std::mutex> lock(m_subscription_mutex);
+            return !m_output_queue.empty();
+        }
         return !m_output_queue.empty();
     }
 
@@ -3,11 +3,16 @@
 
 #pragma once
 
+#include <chrono>
 #include <fstream>
 #include <tuple>
 
+#include "image_generation/request_batching.hpp"
 #include "image_generation/schedulers/ischeduler.hpp"
+#include "openvino/genai/image_generation/autoencoder_kl.hpp"
 #include "openvino/genai/image_generation/generation_config.hpp"
+#include "openvino/genai/image_generation/image_generation_perf_metrics.hpp"
+#include "openvino/genai/image_generation/text_encoder_cache_stats.hpp"
 
 #include "json_utils.hpp"
 namespace {
@@ -44,6 +49,14 @@ ov::Tensor get_guidance_scale_embedding(float guidance_scale, uint32_t embedding
     return w_embedding;
 }
 
+ov::genai::AutoencoderKL::TilingConfig get_vae_tiling_config(const ov::genai::ImageGenerationConfig& generation_config) {
+    ov::genai::AutoencoderKL::TilingConfig tiling;
+    tiling.tile_size = generation_config.vae_tile_size;
+    tiling.tile_overlap = generation_config.vae_tile_overlap;
+    tiling.max_concurrent_tiles = generation_config.vae_max_concurrent_tiles;
+    return tiling;
+}
+
 } // namespace
 
 
@@ -70,6 +83,10 @@ public:
         m_generation_config.validate();
     }
 
+    ImageGenerationPerfMetrics get_performance_metrics() const {
+        return m_perf_metrics;
+    }
+
     void set_scheduler(std::shared_ptr<Scheduler> scheduler) {
         auto casted = std::dynamic_pointer_cast<IScheduler>(scheduler);
         OPENVINO_ASSERT(casted != nullptr, "Passed incorrect scheduler type");
@@ -78,6 +95,22 @@ public:
 
     virtual void reshape(const int num_images_per_prompt, const int height, const int width, const float guidance_scale) = 0;
 
+    /**
+     * Reshapes denoising and VAE models to each of static resolutions given as (height, width) pairs. Models of each
+     * resolution bucket are compiled by compile() or, if `compile_lazily` is set, by the first generate call with
+     * their resolution, except the first bucket, which is always compiled by compile().
+     */
+    virtual void reshape_resolution_buckets(const int num_images_per_prompt,
+                                            const std::vector<std::pair<int, int>>& resolutions,
+                                            const float guidance_scale,
+                                            const bool compile_lazily) {
+        OPENVINO_THROW("Resolution buckets are not supported by this pipeline");
+    }
+
+    virtual std::vector<ResolutionBucketStats> get_resolution_bucket_stats() const {
+        return {};
+    }
+
     virtual void compile(const std::string& device, const ov::AnyMap& properties) = 0;
 
     virtual std::tuple<ov::Tensor, ov::Tensor, ov::Tensor, ov::Tensor> prepare_latents(ov::Tensor initial_image, const ImageGenerationConfig& generation_config) const = 0;
@@ -86,10 +119,30 @@ public:
 
     virtual void set_lora_adapters(std::optional<AdapterConfig> adapters) = 0;
 
+    virtual void set_text_encoder_cache_capacity(size_t capacity) = 0;
+
+    virtual TextEncoderCacheStats get_text_encoder_cache_stats() const = 0;
+
     virtual ov::Tensor generate(const std::string& positive_prompt, ov::Tensor initial_image, ov::Tensor mask_image, const ov::AnyMap& properties) = 0;
 
     virtual ov::Tensor decode(const ov::Tensor latent) = 0;
 
+    /**
+     * Generates images for several requests, which are denoised together by one denoising model inference per step.
+     * Returns images in the order of requests, an empty tensor for a request interrupted by its callback.
+     */
+    virtual std::vector<ov::Tensor> generate_batch(const std::vector<std::string>& positive_prompts, const std::vector<ov::AnyMap>& properties) {
+        OPENVINO_THROW("Batched generation of several requests is not supported by this pipeline");
+    }
+
+    /**
+     * Returns the generation config of a request for generate_batch() with resolved image size, the config is checked
+     * as generate_batch() does, so invalid parameters are reported before the request is batched with others.
+     */
+    virtual ImageGenerationConfig resolve_batch_request_config(const ov::AnyMap& properties) {
+        OPENVINO_THROW("Batched generation of several requests is not supported by this pipeline");
+    }
+
     virtual ~DiffusionPipeline() = default;
 
 protected:
@@ -135,6 +188,8 @@ protected:
     PipelineType m_pipeline_type;
     std::shared_ptr<IScheduler> m_scheduler;
     ImageGenerationConfig m_generation_config;
+    // metrics of the last generate call
+    ImageGenerationPerfMetrics m_perf_metrics;
 };
 
 } // namespace genai
@@ -315,6 +315,17 @@ public:
         OPENVINO_THROW("LORA adapters are not implemented for FLUX pipeline yet");
     }
 
+    void set_text_encoder_cache_capacity(size_t capacity) override {
+        m_clip_text_encoder->set_cache_capacity(capacity);
+        m_t5_text_encoder->set_cache_capacity(capacity);
+    }
+
+    TextEncoderCacheStats get_text_encoder_cache_stats() const override {
+        TextEncoderCacheStats stats = m_clip_text_encoder->get_cache_stats();
+        stats += m_t5_text_encoder->get_cache_stats();
+        return stats;
+    }
+
     ov::Tensor generate(const std::string& positive_prompt,
                         ov::Tensor initial_image,
                         ov::Tensor mask_image,
@@ -357,21 +368,30 @@ public:
         ov::Tensor timestep(ov::element::f32, {1});
         float* timestep_data = timestep.data<float>();
 
+        m_perf_metrics = ImageGenerationPerfMetrics();
+        auto& raw_perf_metrics = m_perf_metrics.raw_metrics;
+
         for (size_t inference_step = 0; inference_step < timesteps.size(); ++inference_step) {
             timestep_data[0] = timesteps[inference_step] / 1000;
 
+            auto infer_start = std::chrono::steady_clock::now();
             ov::Tensor noise_pred_tensor = m_transformer->infer(latents, timestep);
+            auto infer_end = std::chrono::steady_clock::now();
 
+            // latents are updated in place
             auto scheduler_step_result = m_scheduler->step(noise_pred_tensor, latents, inference_step, m_custom_generation_config.generator);
             latents = scheduler_step_result["latent"];
 
+            raw_perf_metrics.step_inference_durations.emplace_back(infer_end - infer_start);
+            raw_perf_metrics.step_host_durations.emplace_back(std::chrono::steady_clock::now() - infer_end);
+
             if (callback && callback(inference_step, timesteps.size(), latents)) {
                 return ov::Tensor(ov::element::u8, {});
             }
         }
 
         latents = unpack_latents(latents, m_custom_generation_config.height, m_custom_generation_config.width, vae_scale_factor);
-        return m_vae->decode(latents);
+        return m_vae->decode(latents, get_vae_tiling_config(m_custom_generation_config));
     }
 
     ov::Tensor decode(const ov::Tensor latent) override {
@@ -379,7 +399,7 @@ public:
                                                 m_custom_generation_config.height,
                                                 m_custom_generation_config.width,
                                                 m_vae->get_vae_scale_factor());
-        return m_vae->decode(unpacked_latent);
+        return m_vae->decode(unpacked_latent, get_vae_tiling_config(m_custom_generation_config));
     }
 
 private:
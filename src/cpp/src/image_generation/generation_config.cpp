@@ -3,8 +3,13 @@
 
 #include "openvino/genai/image_generation/generation_config.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <ctime>
 #include <cstdlib>
+#include <limits>
+
+#include "openvino/core/parallel.hpp"
 
 #include "utils.hpp"
 
@@ -38,6 +43,115 @@ void CppStdGenerator::seed(size_t new_seed) {
     m_gen.seed(new_seed);
 }
 
+namespace {
+
+constexpr size_t PHILOX_BLOCK_SIZE = 4;
+constexpr size_t PHILOX_GROUP_BLOCKS = PhiloxGenerator::GROUP_SIZE / PHILOX_BLOCK_SIZE;
+
+// Computes a group of normally distributed values with indices [group_index * GROUP_SIZE, (group_index + 1) * GROUP_SIZE).
+// The whole group is always computed by the same code, so values don't depend on how tensors are split between threads.
+// Loops over blocks of the group are independent and are vectorized by a compiler.
+void philox_normal_group(uint64_t seed, uint64_t group_index, float* values) {
+    constexpr uint32_t PHILOX_M0 = 0xD2511F53, PHILOX_M1 = 0xCD9E8D57;
+    constexpr uint32_t PHILOX_W0 = 0x9E3779B9, PHILOX_W1 = 0xBB67AE85;
+    constexpr size_t PHILOX_ROUNDS = 10;
+
+    // Philox4x32 counters of the group blocks in structure of arrays layout
+    uint32_t c0[PHILOX_GROUP_BLOCKS], c1[PHILOX_GROUP_BLOCKS], c2[PHILOX_GROUP_BLOCKS], c3[PHILOX_GROUP_BLOCKS];
+    for (size_t b = 0; b < PHILOX_GROUP_BLOCKS; ++b) {
+        const uint64_t block_index = group_index * PHILOX_GROUP_BLOCKS + b;
+        c0[b] = static_cast<uint32_t>(block_index);
+        c1[b] = static_cast<uint32_t>(block_index >> 32);
+        c2[b] = 0;
+        c3[b] = 0;
+    }
+
+    uint32_t k0 = static_cast<uint32_t>(seed), k1 = static_cast<uint32_t>(seed >> 32);
+    for (size_t round = 0; round < PHILOX_ROUNDS; ++round) {
+        for (size_t b = 0; b < PHILOX_GROUP_BLOCKS; ++b) {
+            const uint64_t product0 = static_cast<uint64_t>(PHILOX_M0) * c0[b];
+            const uint64_t product1 = static_cast<uint64_t>(PHILOX_M1) * c2[b];
+            const uint32_t next0 = static_cast<uint32_t>(product1 >> 32) ^ c1[b] ^ k0;
+            const uint32_t next2 = static_cast<uint32_t>(product0 >> 32) ^ c3[b] ^ k1;
+            c1[b] = static_cast<uint32_t>(product1);
+            c3[b] = static_cast<uint32_t>(product0);
+            c0[b] = next0;
+            c2[b] = next2;
+        }
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    // Box-Muller transform of two pairs of uniform values per block
+    constexpr float UINT24_SCALE = 1.0f / (1u << 24);
+    constexpr float TWO_PI = 6.283185307179586f;
+    for (size_t b = 0; b < PHILOX_GROUP_BLOCKS; ++b) {
+        const uint32_t uniform[PHILOX_BLOCK_SIZE] = {c0[b], c1[b], c2[b], c3[b]};
+        for (size_t pair = 0; pair < PHILOX_BLOCK_SIZE; pair += 2) {
+            // u1 is in (0, 1] to avoid log(0)
+            const float u1 = static_cast<float>((uniform[pair] >> 8) + 1) * UINT24_SCALE;
+            const float u2 = static_cast<float>(uniform[pair + 1] >> 8) * UINT24_SCALE;
+            const float radius = std::sqrt(-2.0f * std::log(u1)), angle = TWO_PI * u2;
+            values[b * PHILOX_BLOCK_SIZE + pair] = radius * std::cos(angle);
+            values[b * PHILOX_BLOCK_SIZE + pair + 1] = radius * std::sin(angle);
+        }
+    }
+}
+
+}  // namespace
+
+PhiloxGenerator::PhiloxGenerator(uint64_t seed)
+    : m_seed(seed),
+      m_group_index(std::numeric_limits<uint64_t>::max()) {
+}
+
+float PhiloxGenerator::next() {
+    const uint64_t group_index = m_offset / GROUP_SIZE;
+    if (group_index != m_group_index) {
+        philox_normal_group(m_seed, group_index, m_group_values.data());
+        m_group_index = group_index;
+    }
+    return m_group_values[m_offset++ % GROUP_SIZE];
+}
+
+ov::Tensor PhiloxGenerator::randn_tensor(const ov::Shape& shape) {
+    ov::Tensor rand_tensor(ov::element::f32, shape);
+    float* rand_tensor_data = rand_tensor.data<float>();
+    const uint64_t begin = m_offset, end = m_offset + rand_tensor.get_size();
+    if (begin == end) {
+        return rand_tensor;
+    }
+
+    // groups are distributed between threads in chunks, each group is computed once
+    constexpr size_t GROUPS_PER_CHUNK = 512;
+    const uint64_t first_group = begin / GROUP_SIZE, num_groups = (end - 1) / GROUP_SIZE - first_group + 1;
+    const size_t num_chunks = std::max<size_t>(1, num_groups / GROUPS_PER_CHUNK);
+
+    ov::parallel_for(num_chunks, [&](size_t chunk) {
+        size_t chunk_begin = 0, chunk_end = 0;
+        ov::splitter(static_cast<size_t>(num_groups), num_chunks, chunk, chunk_begin, chunk_end);
+
+        float group_values[GROUP_SIZE];
+        for (size_t group = chunk_begin; group < chunk_end; ++group) {
+            const uint64_t group_index = first_group + group, group_begin = group_index * GROUP_SIZE;
+            philox_normal_group(m_seed, group_index, group_values);
+
+            const uint64_t copy_begin = std::max(begin, group_begin), copy_end = std::min(end, group_begin + GROUP_SIZE);
+            std::copy(group_values + (copy_begin - group_begin), group_values + (copy_end - group_begin),
+                      rand_tensor_data + (copy_begin - begin));
+        }
+    });
+
+    m_offset = end;
+    return rand_tensor;
+}
+
+void PhiloxGenerator::seed(size_t new_seed) {
+    m_seed = new_seed;
+    m_offset = 0;
+    m_group_index = std::numeric_limits<uint64_t>::max();
+}
+
 //
 // GenerationConfig
 //
@@ -66,6 +180,9 @@ void ImageGenerationConfig::update_generation_config(const ov::AnyMap& propertie
     read_anymap_param(properties, "strength", strength);
     read_anymap_param(properties, "adapters", adapters);
     read_anymap_param(properties, "max_sequence_length", max_sequence_length);
+    read_anymap_param(properties, "vae_tile_size", vae_tile_size);
+    read_anymap_param(properties, "vae_tile_overlap", vae_tile_overlap);
+    read_anymap_param(properties, "vae_max_concurrent_tiles", vae_max_concurrent_tiles);
 
     // 'generator' has higher priority than 'seed' parameter
     const bool have_generator_param = properties.find(ov::genai::generator.name()) != properties.end();
@@ -93,6 +210,8 @@ void ImageGenerationConfig::validate() const {
     OPENVINO_ASSERT(guidance_scale > 1.0f || negative_prompt == std::nullopt, "Guidance scale <= 1.0 ignores negative prompt");
     OPENVINO_ASSERT(guidance_scale > 1.0f || negative_prompt_2 == std::nullopt, "Guidance scale <= 1.0 ignores negative prompt 2");
     OPENVINO_ASSERT(guidance_scale > 1.0f || negative_prompt_3 == std::nullopt, "Guidance scale <= 1.0 ignores negative prompt 3");
+    OPENVINO_ASSERT(vae_tile_overlap >= 0.0f && vae_tile_overlap < 1.0f, "VAE tile overlap must be within [0, 1), got ", vae_tile_overlap);
+    OPENVINO_ASSERT(vae_max_concurrent_tiles > 0, "Max number of concurrent VAE tiles must be positive");
 }
 
 }  // namespace genai
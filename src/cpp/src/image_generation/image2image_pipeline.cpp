@@ -110,6 +110,13 @@ void Image2ImagePipeline::reshape(const int num_images_per_prompt, const int hei
     m_impl->reshape(num_images_per_prompt, height, width, guidance_scale);
 }
 
+void Image2ImagePipeline::reshape(const int num_images_per_prompt,
+                    const std::vector<std::pair<int, int>>& resolutions,
+                    const float guidance_scale,
+                    const bool compile_lazily) {
+    m_impl->reshape_resolution_buckets(num_images_per_prompt, resolutions, guidance_scale, compile_lazily);
+}
+
 void Image2ImagePipeline::compile(const std::string& device, const ov::AnyMap& properties) {
     m_impl->compile(device, properties);
 }
@@ -123,5 +130,21 @@ ov::Tensor Image2ImagePipeline::decode(const ov::Tensor latent) {
     return m_impl->decode(latent);
 }
 
+ImageGenerationPerfMetrics Image2ImagePipeline::get_performance_metrics() const {
+    return m_impl->get_performance_metrics();
+}
+
+void Image2ImagePipeline::set_text_encoder_cache_capacity(size_t capacity) {
+    m_impl->set_text_encoder_cache_capacity(capacity);
+}
+
+TextEncoderCacheStats Image2ImagePipeline::get_text_encoder_cache_stats() const {
+    return m_impl->get_text_encoder_cache_stats();
+}
+
+std::vector<ResolutionBucketStats> Image2ImagePipeline::get_resolution_bucket_stats() const {
+    return m_impl->get_resolution_bucket_stats();
+}
+
 }  // namespace genai
 }  // namespace ov
@@ -0,0 +1,38 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/image_generation/image_generation_perf_metrics.hpp"
+
+namespace ov {
+namespace genai {
+
+MeanStdPair calc_mean_and_std(const std::vector<MicroSeconds>& durations);
+
+MeanStdPair ImageGenerationPerfMetrics::get_step_inference_duration() {
+    evaluate_statistics();
+    return step_inference_duration;
+}
+
+MeanStdPair ImageGenerationPerfMetrics::get_step_host_duration() {
+    evaluate_statistics();
+    return step_host_duration;
+}
+
+MeanStdPair ImageGenerationPerfMetrics::get_model_switch_duration() {
+    evaluate_statistics();
+    return model_switch_duration;
+}
+
+void ImageGenerationPerfMetrics::evaluate_statistics() {
+    if (m_evaluated) {
+        return;
+    }
+
+    step_inference_duration = calc_mean_and_std(raw_metrics.step_inference_durations);
+    step_host_duration = calc_mean_and_std(raw_metrics.step_host_durations);
+    model_switch_duration = calc_mean_and_std(raw_metrics.model_switch_durations);
+    m_evaluated = true;
+}
+
+} // namespace genai
+} // namespace ov
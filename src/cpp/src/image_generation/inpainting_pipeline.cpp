@@ -115,6 +115,13 @@ void InpaintingPipeline::reshape(const int num_images_per_prompt, const int heig
     m_impl->reshape(num_images_per_prompt, height, width, guidance_scale);
 }
 
+void InpaintingPipeline::reshape(const int num_images_per_prompt,
+                    const std::vector<std::pair<int, int>>& resolutions,
+                    const float guidance_scale,
+                    const bool compile_lazily) {
+    m_impl->reshape_resolution_buckets(num_images_per_prompt, resolutions, guidance_scale, compile_lazily);
+}
+
 void InpaintingPipeline::compile(const std::string& device, const ov::AnyMap& properties) {
     m_impl->compile(device, properties);
 }
@@ -129,5 +136,21 @@ ov::Tensor InpaintingPipeline::decode(const ov::Tensor latent) {
     return m_impl->decode(latent);
 }
 
+ImageGenerationPerfMetrics InpaintingPipeline::get_performance_metrics() const {
+    return m_impl->get_performance_metrics();
+}
+
+void InpaintingPipeline::set_text_encoder_cache_capacity(size_t capacity) {
+    m_impl->set_text_encoder_cache_capacity(capacity);
+}
+
+TextEncoderCacheStats InpaintingPipeline::get_text_encoder_cache_stats() const {
+    return m_impl->get_text_encoder_cache_stats();
+}
+
+std::vector<ResolutionBucketStats> InpaintingPipeline::get_resolution_bucket_stats() const {
+    return m_impl->get_resolution_bucket_stats();
+}
+
 }  // namespace genai
 }  // namespace ov
@@ -3,8 +3,10 @@
 
 #include "openvino/genai/image_generation/autoencoder_kl.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
+#include <optional>
 
 #include "openvino/runtime/core.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
@@ -18,6 +20,7 @@
 
 #include "json_utils.hpp"
 #include "lora_helper.hpp"
+#include "image_generation/vae_tiling.hpp"
 
 namespace ov {
 namespace genai {
@@ -64,6 +67,122 @@ private:
     ov::Tensor m_mean, m_std;
 };
 
+namespace {
+
+// returns tile size in latent space or 0 if the image fits into one tile and tiling is not needed
+size_t get_latent_tile_size(const AutoencoderKL::TilingConfig& tiling, size_t vae_scale_factor,
+                            size_t latent_height, size_t latent_width) {
+    if (tiling.tile_size == 0)
+        return 0;
+
+    OPENVINO_ASSERT(tiling.tile_size % vae_scale_factor == 0, "VAE tile size ", tiling.tile_size,
+        " must be divisible by VAE scale factor ", vae_scale_factor);
+    OPENVINO_ASSERT(tiling.tile_overlap >= 0.0f && tiling.tile_overlap < 1.0f, "VAE tile overlap must be within [0, 1), got ", tiling.tile_overlap);
+    OPENVINO_ASSERT(tiling.max_concurrent_tiles > 0, "Max number of concurrent VAE tiles must be positive");
+
+    const size_t latent_tile_size = tiling.tile_size / vae_scale_factor;
+    return latent_height > latent_tile_size || latent_width > latent_tile_size ? latent_tile_size : 0;
+}
+
+// returns `count` infer requests of the same compiled model, extra requests are created on demand
+std::vector<ov::InferRequest> get_tile_requests(ov::InferRequest& request, std::vector<ov::InferRequest>& extra_requests, size_t count) {
+    while (extra_requests.size() + 1 < count) {
+        extra_requests.push_back(request.get_compiled_model().create_infer_request());
+    }
+
+    std::vector<ov::InferRequest> requests{request};
+    requests.insert(requests.end(), extra_requests.begin(), extra_requests.begin() + (count - 1));
+    return requests;
+}
+
+TileRange scale_tile(const TileRange& tile, size_t factor) {
+    return TileRange{tile.begin * factor, tile.size * factor, tile.overlap_before * factor, tile.overlap_after * factor};
+}
+
+// infers NCHW `input` tile by tile: tiles are given in latent space, `input_scale` and `output_scale` convert them to
+// input and output spaces; outputs of neighbour tiles are blended on overlaps
+template <typename T>
+ov::Tensor infer_tiled(std::vector<ov::InferRequest>& requests, const ov::Tensor& input, size_t latent_tile_size, float tile_overlap,
+                       size_t input_scale, size_t output_scale, bool output_channels_last) {
+    const ov::Shape input_shape = input.get_shape();
+    const size_t batch = input_shape[0], channels = input_shape[1], height = input_shape[2], width = input_shape[3];
+    OPENVINO_ASSERT(height % input_scale == 0 && width % input_scale == 0, "Tiled VAE input spatial dimensions ",
+        height, "x", width, " must be divisible by ", input_scale);
+
+    const size_t latent_height = height / input_scale, latent_width = width / input_scale;
+    const size_t latent_overlap = static_cast<size_t>(latent_tile_size * tile_overlap);
+    std::vector<TileRange> tiles_y = split_into_tiles(latent_height, latent_tile_size, latent_overlap),
+                           tiles_x = split_into_tiles(latent_width, latent_tile_size, latent_overlap);
+
+    // all tiles have the same shape, so models with static shapes can be reshaped to a tile once
+    const ov::PartialShape model_input_shape = requests[0].get_compiled_model().input(0).get_partial_shape();
+    const size_t tile_height = tiles_y[0].size * input_scale, tile_width = tiles_x[0].size * input_scale;
+    OPENVINO_ASSERT(model_input_shape[2].compatible(static_cast<int64_t>(tile_height)) &&
+                    model_input_shape[3].compatible(static_cast<int64_t>(tile_width)),
+        "Tiled VAE inference requires a model accepting ", tile_height, "x", tile_width, " tiles, but model input shape is ",
+        model_input_shape, ". VAE must not be reshaped to the whole image size when tiling is enabled");
+
+    std::vector<std::pair<TileRange, TileRange>> tiles;
+    for (const TileRange& tile_y : tiles_y)
+        for (const TileRange& tile_x : tiles_x)
+            tiles.emplace_back(tile_y, tile_x);
+
+    const size_t num_slots = std::min(requests.size(), tiles.size());
+    std::vector<ov::Tensor> input_tiles(num_slots);
+    std::optional<TileBlender> blender;
+    ov::Shape output_shape;
+
+    const float* input_data = input.data<const float>();
+    for (size_t wave_begin = 0; wave_begin < tiles.size(); wave_begin += num_slots) {
+        const size_t wave_size = std::min(num_slots, tiles.size() - wave_begin);
+
+        for (size_t slot = 0; slot < wave_size; ++slot) {
+            const TileRange tile_y = scale_tile(tiles[wave_begin + slot].first, input_scale),
+                            tile_x = scale_tile(tiles[wave_begin + slot].second, input_scale);
+            if (!input_tiles[slot])
+                input_tiles[slot] = ov::Tensor(ov::element::f32, {batch, channels, tile_y.size, tile_x.size});
+
+            float* tile_data = input_tiles[slot].data<float>();
+            for (size_t plane = 0; plane < batch * channels; ++plane) {
+                for (size_t y = 0; y < tile_y.size; ++y) {
+                    const float* src = input_data + (plane * height + tile_y.begin + y) * width + tile_x.begin;
+                    std::copy_n(src, tile_x.size, tile_data + (plane * tile_y.size + y) * tile_x.size);
+                }
+            }
+
+            requests[slot].set_input_tensor(input_tiles[slot]);
+            requests[slot].start_async();
+        }
+
+        // tiles are blended in the same order for any number of concurrent tiles, so results are reproducible
+        for (size_t slot = 0; slot < wave_size; ++slot) {
+            requests[slot].wait();
+            ov::Tensor output_tile = requests[slot].get_output_tensor();
+            OPENVINO_ASSERT(output_tile.get_element_type() == ov::element::from<T>(), "Unexpected VAE output element type ",
+                output_tile.get_element_type());
+
+            if (!blender) {
+                const ov::Shape tile_shape = output_tile.get_shape();
+                const size_t output_channels = output_channels_last ? tile_shape[3] : tile_shape[1];
+                const size_t output_height = latent_height * output_scale, output_width = latent_width * output_scale;
+                output_shape = output_channels_last ? ov::Shape{batch, output_height, output_width, output_channels}
+                                                    : ov::Shape{batch, output_channels, output_height, output_width};
+                blender.emplace(batch, output_channels, output_height, output_width, output_channels_last);
+            }
+
+            blender->add_tile(output_tile.data<const T>(),
+                              scale_tile(tiles[wave_begin + slot].first, output_scale),
+                              scale_tile(tiles[wave_begin + slot].second, output_scale));
+        }
+    }
+
+    ov::Tensor output(ov::element::from<T>(), output_shape);
+    blender->get_result(output.data<T>());
+    return output;
+}
+
+} // namespace
+
 size_t get_vae_scale_factor(const std::filesystem::path& vae_config_path) {
     std::ifstream file(vae_config_path);
     OPENVINO_ASSERT(file.is_open(), "Failed to open ", vae_config_path);
@@ -181,6 +300,17 @@ AutoencoderKL::AutoencoderKL(const std::string& vae_encoder_model,
 
 AutoencoderKL::AutoencoderKL(const AutoencoderKL&) = default;
 
+AutoencoderKL AutoencoderKL::clone() const {
+    OPENVINO_ASSERT(m_decoder_model, "Model has been already compiled. Cannot clone already compiled model");
+
+    AutoencoderKL cloned(*this);
+    cloned.m_decoder_model = m_decoder_model->clone();
+    if (m_encoder_model) {
+        cloned.m_encoder_model = m_encoder_model->clone();
+    }
+    return cloned;
+}
+
 AutoencoderKL& AutoencoderKL::reshape(int batch_size, int height, int width) {
     OPENVINO_ASSERT(m_decoder_model, "Model has been already compiled. Cannot reshape already compiled model");
 
@@ -228,20 +358,49 @@ AutoencoderKL& AutoencoderKL::compile(const std::string& device, const ov::AnyMa
 }
 
 ov::Tensor AutoencoderKL::decode(ov::Tensor latent) {
+    return decode(latent, TilingConfig{});
+}
+
+ov::Tensor AutoencoderKL::decode(ov::Tensor latent, const TilingConfig& tiling) {
     OPENVINO_ASSERT(m_decoder_request, "VAE decoder model must be compiled first. Cannot infer non-compiled model");
 
+    const size_t vae_scale_factor = get_vae_scale_factor();
+    const ov::Shape latent_shape = latent.get_shape();
+    const size_t latent_tile_size = get_latent_tile_size(tiling, vae_scale_factor, latent_shape[2], latent_shape[3]);
+
+    if (latent_tile_size > 0) {
+        std::vector<ov::InferRequest> requests = get_tile_requests(m_decoder_request, m_decoder_tile_requests, tiling.max_concurrent_tiles);
+        // decoder output is postprocessed to u8 NHWC image
+        return infer_tiled<uint8_t>(requests, latent, latent_tile_size, tiling.tile_overlap, 1, vae_scale_factor, true);
+    }
+
     m_decoder_request.set_input_tensor(latent);
     m_decoder_request.infer();
     return m_decoder_request.get_output_tensor();
 }
 
 ov::Tensor AutoencoderKL::encode(ov::Tensor image, std::shared_ptr<Generator> generator) {
-    OPENVINO_ASSERT(m_encoder_request, "VAE encoder model must be compiled first. Cannot infer non-compiled model");
+    return encode(image, generator, TilingConfig{});
+}
 
-    m_encoder_request.set_input_tensor(image);
-    m_encoder_request.infer();
+ov::Tensor AutoencoderKL::encode(ov::Tensor image, std::shared_ptr<Generator> generator, const TilingConfig& tiling) {
+    OPENVINO_ASSERT(m_encoder_request, "VAE encoder model must be compiled first. Cannot infer non-compiled model");
 
-    ov::Tensor output = m_encoder_request.get_output_tensor(), latent;
+    const size_t vae_scale_factor = get_vae_scale_factor();
+    const ov::Shape image_shape = image.get_shape();
+    const size_t latent_tile_size = get_latent_tile_size(tiling, vae_scale_factor,
+        image_shape[2] / vae_scale_factor, image_shape[3] / vae_scale_factor);
+
+    ov::Tensor output, latent;
+    if (latent_tile_size > 0) {
+        std::vector<ov::InferRequest> requests = get_tile_requests(m_encoder_request, m_encoder_tile_requests, tiling.max_concurrent_tiles);
+        // distribution parameters are blended before sampling, so noise is the same as for the whole image
+        output = infer_tiled<float>(requests, image, latent_tile_size, tiling.tile_overlap, vae_scale_factor, 1, false);
+    } else {
+        m_encoder_request.set_input_tensor(image);
+        m_encoder_request.infer();
+        output = m_encoder_request.get_output_tensor();
+    }
 
     ov::CompiledModel compiled_model = m_encoder_request.get_compiled_model();
     auto outputs = compiled_model.outputs();
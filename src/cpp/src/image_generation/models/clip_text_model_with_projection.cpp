@@ -5,6 +5,7 @@
 
 #include <fstream>
 
+#include "image_generation/models/text_encoder_cache.hpp"
 #include "lora_helper.hpp"
 #include "json_utils.hpp"
 #include "utils.hpp"
@@ -30,6 +31,7 @@ CLIPTextModelWithProjection::CLIPTextModelWithProjection(const std::filesystem::
     m_config(root_dir / "config.json") {
     ov::Core core = utils::singleton_core();
     m_model = core.read_model((root_dir / "openvino_model.xml").string());
+    m_cache = std::make_shared<TextEncoderCache>();
 }
 
 CLIPTextModelWithProjection::CLIPTextModelWithProjection(const std::filesystem::path& root_dir,
@@ -46,6 +48,7 @@ CLIPTextModelWithProjection::CLIPTextModelWithProjection(const std::string& mode
     m_clip_tokenizer(clip_tokenizer), m_config(config) {
     ov::Core core = utils::singleton_core();
     m_model = core.read_model(model, weights);
+    m_cache = std::make_shared<TextEncoderCache>();
 }
 
 CLIPTextModelWithProjection::CLIPTextModelWithProjection(const std::string& model,
@@ -96,9 +99,20 @@ CLIPTextModelWithProjection& CLIPTextModelWithProjection::compile(const std::str
     return *this;
 }
 
+CLIPTextModelWithProjection& CLIPTextModelWithProjection::set_cache_capacity(size_t capacity) {
+    m_cache->set_capacity(capacity);
+    return *this;
+}
+
+TextEncoderCacheStats CLIPTextModelWithProjection::get_cache_stats() const {
+    return m_cache->get_stats();
+}
+
 void CLIPTextModelWithProjection::set_adapters(const std::optional<AdapterConfig>& adapters) {
     if (adapters) {
         m_adapter_controller.apply(m_request, *adapters);
+        // outputs depend on adapters and their alphas, which may change between calls
+        m_adapters_applied = static_cast<bool>(*adapters);
     }
 }
 
@@ -106,7 +120,6 @@ ov::Tensor CLIPTextModelWithProjection::infer(const std::string& pos_prompt, con
     OPENVINO_ASSERT(m_request, "CLIP text encoder model must be compiled first. Cannot infer non-compiled model");
 
     const int32_t pad_token_id = m_clip_tokenizer.get_pad_token_id();
-    const size_t text_embedding_batch_size = do_classifier_free_guidance ? 2 : 1;
 
     auto perform_tokenization = [&](const std::string& prompt, ov::Tensor input_ids) {
         ov::Tensor input_ids_token = m_clip_tokenizer.encode(prompt).input_ids;
@@ -120,32 +133,46 @@ ov::Tensor CLIPTextModelWithProjection::infer(const std::string& pos_prompt, con
         }
     };
 
-    ov::Tensor input_ids = m_request.get_input_tensor();
-    input_ids.set_shape({text_embedding_batch_size, m_config.max_position_embeddings});
+    auto encode = [&](const std::vector<std::string>& prompts) {
+        ov::Tensor input_ids = m_request.get_input_tensor();
+        input_ids.set_shape({prompts.size(), m_config.max_position_embeddings});
+
+        for (size_t current_batch_idx = 0; current_batch_idx < prompts.size(); ++current_batch_idx) {
+            perform_tokenization(prompts[current_batch_idx],
+                                 ov::Tensor(input_ids, {current_batch_idx    , 0},
+                                                       {current_batch_idx + 1, m_config.max_position_embeddings}));
+        }
+
+        // text embeddings
+        m_request.infer();
 
-    size_t current_batch_idx = 0;
+        std::vector<ov::Tensor> outputs;
+        for (size_t idx = 0; idx < m_request.get_compiled_model().outputs().size(); ++idx) {
+            outputs.push_back(m_request.get_output_tensor(idx));
+        }
+        return outputs;
+    };
 
+    // Negative prompt is ignored when --guidanceScale < 1.0
+    std::vector<std::string> prompts;
     if (do_classifier_free_guidance) {
-        perform_tokenization(neg_prompt,
-                             ov::Tensor(input_ids, {current_batch_idx    , 0},
-                                                   {current_batch_idx + 1, m_config.max_position_embeddings}));
-        ++current_batch_idx;
-    } else {
-        // Negative prompt is ignored when --guidanceScale < 1.0
+        prompts.push_back(neg_prompt);
     }
+    prompts.push_back(pos_prompt);
 
-    perform_tokenization(pos_prompt,
-                         ov::Tensor(input_ids, {current_batch_idx    , 0},
-                                               {current_batch_idx + 1, m_config.max_position_embeddings}));
-
-    // text embeddings
-    m_request.infer();
+    if (m_adapters_applied) {
+        m_outputs = encode(prompts);
+    } else {
+        const bool dynamic_batch = m_request.get_compiled_model().input(0).get_partial_shape()[0].is_dynamic();
+        m_outputs = m_cache->encode(prompts, m_config.max_position_embeddings, dynamic_batch, encode);
+    }
 
-    return m_request.get_output_tensor(0);
+    return m_outputs[0];
 }
 
 ov::Tensor CLIPTextModelWithProjection::get_output_tensor(const size_t idx) {
-    return m_request.get_output_tensor(idx);
+    OPENVINO_ASSERT(idx < m_outputs.size(), "CLIP text encoder model must be inferred before getting output ", idx);
+    return m_outputs[idx];
 }
 
 } // namespace genai
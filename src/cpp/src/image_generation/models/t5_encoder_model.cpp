@@ -6,6 +6,7 @@
 #include <fstream>
 
 #include "json_utils.hpp"
+#include "image_generation/models/text_encoder_cache.hpp"
 #include "lora_helper.hpp"
 #include "utils.hpp"
 
@@ -18,6 +19,7 @@ T5EncoderModel::T5EncoderModel(const std::filesystem::path& root_dir) :
     m_tokenizer(get_tokenizer_path_by_text_encoder(root_dir)) {
     ov::Core core = utils::singleton_core();
     m_model = core.read_model((root_dir / "openvino_model.xml").string());
+    m_cache = std::make_shared<TextEncoderCache>();
 }
 
 T5EncoderModel::T5EncoderModel(const std::filesystem::path& root_dir,
@@ -33,6 +35,7 @@ T5EncoderModel::T5EncoderModel(const std::string& model,
     m_tokenizer(tokenizer) {
     ov::Core core = utils::singleton_core();
     m_model = core.read_model(model, weights);
+    m_cache = std::make_shared<TextEncoderCache>();
 }
 
 T5EncoderModel::T5EncoderModel(const std::string& model,
@@ -71,6 +74,15 @@ T5EncoderModel& T5EncoderModel::compile(const std::string& device, const ov::Any
     return *this;
 }
 
+T5EncoderModel& T5EncoderModel::set_cache_capacity(size_t capacity) {
+    m_cache->set_capacity(capacity);
+    return *this;
+}
+
+TextEncoderCacheStats T5EncoderModel::get_cache_stats() const {
+    return m_cache->get_stats();
+}
+
 ov::Tensor T5EncoderModel::infer(const std::string& pos_prompt, const std::string& neg_prompt, bool do_classifier_free_guidance, int max_sequence_length) {
     OPENVINO_ASSERT(m_request, "T5 encoder model must be compiled first. Cannot infer non-compiled model");
 
@@ -89,43 +101,51 @@ ov::Tensor T5EncoderModel::infer(const std::string& pos_prompt, const std::strin
         }
     };
 
-    ov::Tensor input_ids = m_request.get_input_tensor();
-
-    // reshape in case of dynamic model
-    ov::Shape input_ids_shape = input_ids.get_shape();
+    const ov::PartialShape input_ids_shape = m_request.get_compiled_model().input(0).get_partial_shape();
 
-    OPENVINO_ASSERT(input_ids_shape[1] == 0 || max_sequence_length == input_ids_shape[1],
+    OPENVINO_ASSERT(input_ids_shape[1].is_dynamic() || max_sequence_length == input_ids_shape[1].get_length(),
         "In case of T5EncoderModel was reshaped before, reshape's max_sequence_length ", input_ids_shape[1], " must be equal to ",
         "infer's max_sequence_length ", max_sequence_length);
 
-    if (input_ids_shape[0] == 0 || input_ids_shape[1] == 0) {
-        size_t batch_size = do_classifier_free_guidance ? 2 : 1;
-        input_ids.set_shape({batch_size, static_cast<size_t>(max_sequence_length)});
-    }
+    auto encode = [&](const std::vector<std::string>& prompts) {
+        ov::Tensor input_ids = m_request.get_input_tensor();
+
+        // reshape in case of dynamic model
+        if (input_ids_shape.is_dynamic()) {
+            input_ids.set_shape({prompts.size(), static_cast<size_t>(max_sequence_length)});
+        }
+
+        for (size_t current_batch_idx = 0; current_batch_idx < prompts.size(); ++current_batch_idx) {
+            perform_tokenization(prompts[current_batch_idx],
+                                 ov::Tensor(input_ids, {current_batch_idx    , 0},
+                                                       {current_batch_idx + 1, input_ids.get_shape()[1]}));
+        }
+
+        // text embeddings
+        m_request.infer();
 
-    size_t current_batch_idx = 0;
+        std::vector<ov::Tensor> outputs;
+        for (size_t idx = 0; idx < m_request.get_compiled_model().outputs().size(); ++idx) {
+            outputs.push_back(m_request.get_output_tensor(idx));
+        }
+        return outputs;
+    };
+
+    // Negative prompt is ignored when --guidanceScale < 1.0
+    std::vector<std::string> prompts;
     if (do_classifier_free_guidance) {
-        perform_tokenization(neg_prompt,
-                             ov::Tensor(input_ids, {current_batch_idx    , 0},
-                                                   {current_batch_idx + 1, input_ids.get_shape()[1]}));
-        ++current_batch_idx;
-    } else {
-        // Negative prompt is ignored when --guidanceScale < 1.0
+        prompts.push_back(neg_prompt);
     }
+    prompts.push_back(pos_prompt);
 
-    // perform_tokenization(pos_prompt, input_ids);
-    perform_tokenization(pos_prompt,
-                         ov::Tensor(input_ids, {current_batch_idx    , 0},
-                                               {current_batch_idx + 1, input_ids.get_shape()[1]}));
-
-    // text embeddings
-    m_request.infer();
+    m_outputs = m_cache->encode(prompts, static_cast<size_t>(max_sequence_length), input_ids_shape[0].is_dynamic(), encode);
 
-    return m_request.get_output_tensor(0);
+    return m_outputs[0];
 }
 
 ov::Tensor T5EncoderModel::get_output_tensor(const size_t idx) {
-    return m_request.get_output_tensor(idx);
+    OPENVINO_ASSERT(idx < m_outputs.size(), "T5 encoder model must be inferred before getting output ", idx);
+    return m_outputs[idx];
 }
 
 } // namespace genai
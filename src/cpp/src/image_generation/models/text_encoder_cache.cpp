@@ -0,0 +1,157 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/models/text_encoder_cache.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+
+float TextEncoderCacheStats::get_hit_rate() const {
+    const size_t lookups = hits + misses;
+    return lookups > 0 ? static_cast<float>(hits) / lookups : 0.0f;
+}
+
+TextEncoderCacheStats& TextEncoderCacheStats::operator+=(const TextEncoderCacheStats& right) {
+    hits += right.hits;
+    misses += right.misses;
+    size += right.size;
+    capacity += right.capacity;
+    return *this;
+}
+
+TextEncoderCache::TextEncoderCache(size_t capacity) : m_entries(capacity) {
+}
+
+void TextEncoderCache::set_capacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.set_capacity(capacity);
+}
+
+TextEncoderCacheStats TextEncoderCache::get_stats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    TextEncoderCacheStats stats;
+    stats.hits = m_hits;
+    stats.misses = m_misses;
+    stats.size = m_entries.size();
+    stats.capacity = m_entries.get_capacity();
+    return stats;
+}
+
+TextEncoderCache::Entry TextEncoderCache::find(const Key& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Entry* entry = m_entries.find(key);
+    return entry ? *entry : nullptr;
+}
+
+void TextEncoderCache::record_lookups(size_t hits, size_t misses) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_hits += hits;
+    m_misses += misses;
+}
+
+TextEncoderCache::Entry TextEncoderCache::insert(const Key& key, Outputs outputs) {
+    Entry entry = std::make_shared<const Outputs>(std::move(outputs));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // the same prompt may be encoded concurrently by several pipelines sharing the model, the last result is kept
+    m_entries.insert(key, entry);
+    return entry;
+}
+
+TextEncoderCache::Outputs TextEncoderCache::encode(const std::vector<std::string>& prompts,
+                                                   size_t max_sequence_length,
+                                                   bool partial_batch,
+                                                   const Encoder& encoder) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_entries.get_capacity() == 0) {
+            return encoder(prompts);
+        }
+    }
+
+    std::vector<Entry> rows(prompts.size());
+    std::vector<size_t> missing;
+    for (size_t i = 0; i < prompts.size(); ++i) {
+        rows[i] = find({prompts[i], max_sequence_length});
+        if (!rows[i]) {
+            missing.push_back(i);
+        }
+    }
+
+    if (missing.empty()) {
+        record_lookups(prompts.size(), 0);
+        return concat_batch_rows(rows);
+    }
+
+    record_lookups(prompts.size() - missing.size(), missing.size());
+    if (missing.size() == prompts.size()) {
+        Outputs outputs = encoder(prompts);
+        for (size_t i : missing) {
+            insert({prompts[i], max_sequence_length}, copy_batch_row(outputs, i));
+        }
+        return outputs;
+    }
+
+    std::vector<std::string> missing_prompts;
+    for (size_t i : missing) {
+        missing_prompts.push_back(prompts[i]);
+    }
+    // a model with static batch size takes the whole batch, it's padded by a missing prompt and padding rows are dropped
+    if (!partial_batch) {
+        missing_prompts.resize(prompts.size(), missing_prompts.front());
+    }
+
+    const Outputs outputs = encoder(missing_prompts);
+    for (size_t j = 0; j < missing.size(); ++j) {
+        rows[missing[j]] = insert({prompts[missing[j]], max_sequence_length}, copy_batch_row(outputs, j));
+    }
+    return concat_batch_rows(rows);
+}
+
+TextEncoderCache::Outputs copy_batch_row(const TextEncoderCache::Outputs& batch, size_t row) {
+    TextEncoderCache::Outputs outputs;
+    outputs.reserve(batch.size());
+    for (const ov::Tensor& tensor : batch) {
+        ov::Shape shape = tensor.get_shape();
+        OPENVINO_ASSERT(!shape.empty() && row < shape[0], "Text encoder output of shape ", shape, " doesn't have batch element ", row);
+
+        const size_t row_byte_size = tensor.get_byte_size() / shape[0];
+        shape[0] = 1;
+        ov::Tensor output(tensor.get_element_type(), shape);
+        std::memcpy(output.data(), static_cast<const uint8_t*>(tensor.data()) + row * row_byte_size, row_byte_size);
+        outputs.push_back(output);
+    }
+    return outputs;
+}
+
+TextEncoderCache::Outputs concat_batch_rows(const std::vector<std::shared_ptr<const TextEncoderCache::Outputs>>& rows) {
+    OPENVINO_ASSERT(!rows.empty(), "At least one row is required");
+
+    TextEncoderCache::Outputs outputs;
+    const size_t num_outputs = rows.front()->size();
+    for (size_t idx = 0; idx < num_outputs; ++idx) {
+        const ov::Tensor& first = rows.front()->at(idx);
+        ov::Shape shape = first.get_shape();
+        shape[0] = rows.size();
+
+        ov::Tensor output(first.get_element_type(), shape);
+        uint8_t* dst = static_cast<uint8_t*>(output.data());
+        for (const auto& row : rows) {
+            const ov::Tensor& tensor = row->at(idx);
+            OPENVINO_ASSERT(tensor.get_element_type() == first.get_element_type() && tensor.get_byte_size() == first.get_byte_size(),
+                            "Cached text encoder outputs have different shapes");
+            std::memcpy(dst, tensor.data(), tensor.get_byte_size());
+            dst += tensor.get_byte_size();
+        }
+        outputs.push_back(output);
+    }
+    return outputs;
+}
+
+} // namespace genai
+} // namespace ov
@@ -0,0 +1,66 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+#include "openvino/genai/image_generation/text_encoder_cache_stats.hpp"
+#include "lru_cache.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Thread-safe LRU cache of text encoder outputs. An entry holds all outputs of a model for one prompt, each with batch
+ * dimension 1, so entries can be combined into batches of different prompts, e.g. a fixed negative prompt with new
+ * positive prompts. A cache belongs to a single compiled model and is shared by its copies, so it's keyed by a prompt
+ * and max sequence length only.
+ */
+class TextEncoderCache {
+public:
+    using Outputs = std::vector<ov::Tensor>;
+    // fills input ids with `prompts` as a batch, runs inference and returns all model outputs
+    using Encoder = std::function<Outputs(const std::vector<std::string>& prompts)>;
+
+    explicit TextEncoderCache(size_t capacity = 0);
+
+    // evicts least recently used entries if the cache is shrunk, 0 disables the cache
+    void set_capacity(size_t capacity);
+
+    TextEncoderCacheStats get_stats() const;
+
+    /**
+     * Returns outputs for a batch of `prompts`. Prompts found in the cache are not encoded again. If `partial_batch`
+     * is true, a model accepts any batch size and only missing prompts are encoded, otherwise missing prompts are padded
+     * to the size of `prompts`. Returned tensors may be model output tensors, which are overwritten by the next inference.
+     */
+    Outputs encode(const std::vector<std::string>& prompts, size_t max_sequence_length, bool partial_batch, const Encoder& encoder);
+
+private:
+    using Key = std::pair<std::string, size_t>;
+    using Entry = std::shared_ptr<const Outputs>;
+
+    Entry find(const Key& key);
+    Entry insert(const Key& key, Outputs outputs);
+    void record_lookups(size_t hits, size_t misses);
+
+    mutable std::mutex m_mutex;
+    LRUCache<Key, Entry> m_entries;
+    size_t m_hits = 0, m_misses = 0;
+};
+
+// copies `row`-th element along batch dimension of each tensor
+TextEncoderCache::Outputs copy_batch_row(const TextEncoderCache::Outputs& batch, size_t row);
+
+// stacks outputs with batch dimension 1 along batch dimension
+TextEncoderCache::Outputs concat_batch_rows(const std::vector<std::shared_ptr<const TextEncoderCache::Outputs>>& rows);
+
+} // namespace genai
+} // namespace ov
@@ -63,6 +63,14 @@ UNet2DConditionModel::UNet2DConditionModel(const std::string& model,
 
 UNet2DConditionModel::UNet2DConditionModel(const UNet2DConditionModel&) = default;
 
+UNet2DConditionModel UNet2DConditionModel::clone() const {
+    OPENVINO_ASSERT(m_model, "Model has been already compiled. Cannot clone already compiled model");
+
+    UNet2DConditionModel cloned(*this);
+    cloned.m_model = m_model->clone();
+    return cloned;
+}
+
 const UNet2DConditionModel::Config& UNet2DConditionModel::get_config() const {
     return m_config;
 }
@@ -0,0 +1,110 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <deque>
+#include <exception>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+#include "openvino/genai/image_generation/generation_config.hpp"
+
+namespace ov {
+namespace genai {
+
+// requests can be denoised together if they have the same latent shape, timesteps and LoRA adapters
+inline bool are_batchable(const ImageGenerationConfig& first, const ImageGenerationConfig& second) {
+    if (first.height != second.height || first.width != second.width ||
+        first.num_inference_steps != second.num_inference_steps || first.strength != second.strength) {
+        return false;
+    }
+
+    const bool first_has_adapters = first.adapters && *first.adapters, second_has_adapters = second.adapters && *second.adapters;
+    if (!first_has_adapters || !second_has_adapters) {
+        return first_has_adapters == second_has_adapters;
+    }
+
+    const std::vector<Adapter>& adapters = first.adapters->get_adapters();
+    if (first.adapters->get_mode() != second.adapters->get_mode() || !(adapters == second.adapters->get_adapters())) {
+        return false;
+    }
+    for (const Adapter& adapter : adapters) {
+        if (first.adapters->get_alpha(adapter) != second.adapters->get_alpha(adapter)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Takes the oldest request and following requests which can be batched with it, up to max_batch_size images.
+ * The oldest request is taken even if it has more images. Request must have `ImageGenerationConfig config` field.
+ */
+template <typename Request>
+std::vector<Request> take_batch(std::deque<Request>& requests, size_t max_batch_size) {
+    std::vector<Request> batch;
+    size_t num_images = 0;
+    for (auto it = requests.begin(); it != requests.end();) {
+        const size_t request_images = it->config.num_images_per_prompt;
+        const bool fits = batch.empty() ||
+            (num_images + request_images <= max_batch_size && are_batchable(batch.front().config, it->config));
+        if (!fits) {
+            ++it;
+            continue;
+        }
+
+        num_images += request_images;
+        batch.push_back(std::move(*it));
+        it = requests.erase(it);
+        if (num_images >= max_batch_size)
+            break;
+    }
+    return batch;
+}
+
+/**
+ * Generates images of a batch by `generate(request_indices)` and passes them to promises of the requests.
+ * If the batch fails, its requests are generated one by one, so an error is passed only to the requests which cause it.
+ * Request must have `std::promise<ov::Tensor> promise` field.
+ */
+template <typename Request, typename Generate>
+void generate_batch_isolating_errors(std::vector<Request>& batch, Generate&& generate) {
+    std::vector<size_t> request_indices(batch.size());
+    std::iota(request_indices.begin(), request_indices.end(), 0);
+    std::vector<ov::Tensor> images;
+    bool is_batch_failed = false;
+    try {
+        images = generate(request_indices);
+        if (images.size() != batch.size()) {
+            throw std::runtime_error("Number of generated images doesn't match number of requests");
+        }
+    } catch (...) {
+        if (batch.size() == 1) {
+            batch.front().promise.set_exception(std::current_exception());
+            return;
+        }
+        is_batch_failed = true;
+    }
+
+    if (!is_batch_failed) {
+        for (size_t i = 0; i < batch.size(); ++i) {
+            batch[i].promise.set_value(images[i]);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        try {
+            batch[i].promise.set_value(generate(std::vector<size_t>{i}).at(0));
+        } catch (...) {
+            batch[i].promise.set_exception(std::current_exception());
+        }
+    }
+}
+
+} // namespace genai
+} // namespace ov
@@ -0,0 +1,117 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/genai/image_generation/image_generation_perf_metrics.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Models reshaped to one of static resolutions each. Models of a bucket are compiled by compile() or, if buckets are
+ * compiled lazily, by the first select() of their resolution, except the first bucket, which is always compiled by compile().
+ */
+template <typename Models>
+class ResolutionBuckets {
+public:
+    using CompileCallback = std::function<void(Models&)>;
+
+    explicit ResolutionBuckets(bool compile_lazily = false) : m_compile_lazily(compile_lazily) {}
+
+    void add(int64_t height, int64_t width, Models models) {
+        OPENVINO_ASSERT(find(height, width) == m_buckets.end(), "Resolution bucket ", height, "x", width, " is specified twice");
+        Bucket bucket;
+        bucket.height = height;
+        bucket.width = width;
+        bucket.models = std::move(models);
+        m_buckets.push_back(std::move(bucket));
+    }
+
+    bool empty() const {
+        return m_buckets.empty();
+    }
+
+    void clear() {
+        m_buckets.clear();
+    }
+
+    // models of the first bucket, they are used when a resolution is not specified
+    const Models& front() const {
+        OPENVINO_ASSERT(!m_buckets.empty(), "No resolution buckets");
+        return m_buckets.front().models;
+    }
+
+    // `compile` is kept to compile lazily compiled buckets
+    void compile(CompileCallback compile) {
+        m_compile = std::move(compile);
+        for (size_t i = 0; i < m_buckets.size(); ++i) {
+            if (i == 0 || !m_compile_lazily) {
+                compile_bucket(m_buckets[i]);
+            }
+        }
+    }
+
+    // returns models of a bucket with the given resolution, compiles them if needed; `switch_duration` includes compilation
+    const Models& select(int64_t height, int64_t width, MicroSeconds& switch_duration) {
+        const auto switch_start = std::chrono::steady_clock::now();
+
+        auto bucket = find(height, width);
+        OPENVINO_ASSERT(bucket != m_buckets.end(), "Resolution ", height, "x", width,
+            " doesn't match any resolution bucket the pipeline is reshaped to");
+        if (!bucket->is_compiled) {
+            OPENVINO_ASSERT(m_compile, "Models of resolution bucket ", height, "x", width, " are not compiled");
+            compile_bucket(*bucket);
+        }
+
+        switch_duration = std::chrono::steady_clock::now() - switch_start;
+        return bucket->models;
+    }
+
+    std::vector<ResolutionBucketStats> get_stats() const {
+        std::vector<ResolutionBucketStats> stats;
+        for (const Bucket& bucket : m_buckets) {
+            ResolutionBucketStats bucket_stats;
+            bucket_stats.height = bucket.height;
+            bucket_stats.width = bucket.width;
+            bucket_stats.is_compiled = bucket.is_compiled;
+            bucket_stats.compile_duration = bucket.compile_duration.count() / 1000.0f;
+            stats.push_back(bucket_stats);
+        }
+        return stats;
+    }
+
+private:
+    struct Bucket {
+        int64_t height = 0, width = 0;
+        Models models;
+        bool is_compiled = false;
+        MicroSeconds compile_duration{0};
+    };
+
+    typename std::vector<Bucket>::iterator find(int64_t height, int64_t width) {
+        return std::find_if(m_buckets.begin(), m_buckets.end(), [&](const Bucket& bucket) {
+            return bucket.height == height && bucket.width == width;
+        });
+    }
+
+    void compile_bucket(Bucket& bucket) {
+        const auto compile_start = std::chrono::steady_clock::now();
+        m_compile(bucket.models);
+        bucket.compile_duration = std::chrono::steady_clock::now() - compile_start;
+        bucket.is_compiled = true;
+    }
+
+    std::vector<Bucket> m_buckets;
+    bool m_compile_lazily = false;
+    CompileCallback m_compile;
+};
+
+} // namespace genai
+} // namespace ov
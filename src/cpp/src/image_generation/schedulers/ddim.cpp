@@ -76,6 +76,10 @@ DDIMScheduler::DDIMScheduler(const Config& scheduler_config)
     m_final_alpha_cumprod = m_config.set_alpha_to_one ? 1 : m_alphas_cumprod[0];
 }
 
+std::shared_ptr<IScheduler> DDIMScheduler::clone() const {
+    return std::make_shared<DDIMScheduler>(m_config);
+}
+
 void DDIMScheduler::set_timesteps(size_t num_inference_steps, float strength) {
     m_timesteps.clear();
 
@@ -124,7 +128,7 @@ void DDIMScheduler::set_timesteps(size_t num_inference_steps, float strength) {
     }
 }
 
-std::map<std::string, ov::Tensor> DDIMScheduler::step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+std::map<std::string, ov::Tensor> DDIMScheduler::guided_step(ov::Tensor noise_pred, ov::Tensor latents, float guidance_scale, size_t inference_step, std::shared_ptr<Generator> generator) {
     // noise_pred - model_output
     // latents - sample
     // inference_step
@@ -139,35 +143,6 @@ std::map<std::string, ov::Tensor> DDIMScheduler::step(ov::Tensor noise_pred, ov:
     float alpha_prod_t_prev = (prev_timestep >= 0) ? m_alphas_cumprod[prev_timestep] : m_final_alpha_cumprod;
     float beta_prod_t = 1 - alpha_prod_t;
 
-    // compute predicted original sample from predicted noise also called
-    // "predicted x_0" of formula (12) from https://arxiv.org/pdf/2010.02502.pdf
-    std::vector<float> pred_original_sample, pred_epsilon;
-    float pos_val, pe_val;
-    for (size_t j = 0; j < noise_pred.get_size(); j++) {
-        switch (m_config.prediction_type) {
-            case PredictionType::EPSILON:
-                pos_val = (latents.data<float>()[j] - std::sqrt(beta_prod_t) * noise_pred.data<float>()[j]) / std::sqrt(alpha_prod_t);
-                pe_val = noise_pred.data<float>()[j];
-                pred_original_sample.push_back(pos_val);
-                pred_epsilon.push_back(pe_val);
-                break;
-            case PredictionType::SAMPLE:
-                pos_val = noise_pred.data<float>()[j];
-                pe_val = (latents.data<float>()[j] - std::sqrt(alpha_prod_t) * pos_val) / std::sqrt(beta_prod_t);
-                pred_original_sample.push_back(pos_val);
-                pred_epsilon.push_back(pe_val);
-                break;
-            case PredictionType::V_PREDICTION:
-                pos_val = std::sqrt(alpha_prod_t) * latents.data<float>()[j] - std::sqrt(beta_prod_t) * noise_pred.data<float>()[j];
-                pe_val = std::sqrt(alpha_prod_t) * noise_pred.data<float>()[j] + std::sqrt(beta_prod_t) * latents.data<float>()[j];
-                pred_original_sample.push_back(pos_val);
-                pred_epsilon.push_back(pe_val);
-                break;
-            default:
-                OPENVINO_THROW("Unsupported value for 'PredictionType'");
-        }
-    }
-
     // TODO: support m_config.thresholding
     OPENVINO_ASSERT(!m_config.thresholding,
                     "Parameter 'thresholding' is not supported. Please, add support.");
@@ -175,22 +150,42 @@ std::map<std::string, ov::Tensor> DDIMScheduler::step(ov::Tensor noise_pred, ov:
     OPENVINO_ASSERT(!m_config.clip_sample,
                     "Parameter 'clip_sample' is not supported. Please, add support.");
 
-    // compute "direction pointing to x_t" of formula (12) from https://arxiv.org/pdf/2010.02502.pdf
-    std::vector<float> pred_sample_direction(pred_epsilon.size());
-    std::transform(pred_epsilon.begin(), pred_epsilon.end(), pred_sample_direction.begin(), [alpha_prod_t_prev](auto x) {
-        return std::sqrt(1 - alpha_prod_t_prev) * x;
-    });
-
-    // compute x_t without "random noise" of formula (12) from https://arxiv.org/pdf/2010.02502.pdf
-    ov::Tensor prev_sample(latents.get_element_type(), latents.get_shape());
-    float* prev_sample_data = prev_sample.data<float>();
-    for (size_t i = 0; i < prev_sample.get_size(); ++i) {
-        prev_sample_data[i] = std::sqrt(alpha_prod_t_prev) * pred_original_sample[i] + pred_sample_direction[i];
+    // compute predicted original sample and predicted epsilon as linear combinations of sample and model output
+    // "predicted x_0" of formula (12) from https://arxiv.org/pdf/2010.02502.pdf
+    float pos_sample_coeff = 0.0f, pos_model_output_coeff = 0.0f, pe_sample_coeff = 0.0f, pe_model_output_coeff = 0.0f;
+    switch (m_config.prediction_type) {
+        case PredictionType::EPSILON:
+            pos_sample_coeff = 1.0f / std::sqrt(alpha_prod_t);
+            pos_model_output_coeff = -std::sqrt(beta_prod_t) / std::sqrt(alpha_prod_t);
+            pe_model_output_coeff = 1.0f;
+            break;
+        case PredictionType::SAMPLE:
+            pos_model_output_coeff = 1.0f;
+            pe_sample_coeff = 1.0f / std::sqrt(beta_prod_t);
+            pe_model_output_coeff = -std::sqrt(alpha_prod_t) / std::sqrt(beta_prod_t);
+            break;
+        case PredictionType::V_PREDICTION:
+            pos_sample_coeff = std::sqrt(alpha_prod_t);
+            pos_model_output_coeff = -std::sqrt(beta_prod_t);
+            pe_sample_coeff = std::sqrt(beta_prod_t);
+            pe_model_output_coeff = std::sqrt(alpha_prod_t);
+            break;
+        default:
+            OPENVINO_THROW("Unsupported value for 'PredictionType'");
     }
 
-    std::map<std::string, ov::Tensor> result{{"latent", prev_sample}};
+    // compute x_t without "random noise" of formula (12) from https://arxiv.org/pdf/2010.02502.pdf
+    // "direction pointing to x_t" is sqrt(1 - alpha_prod_t_prev) * pred_epsilon
+    const float pos_coeff = std::sqrt(alpha_prod_t_prev), direction_coeff = std::sqrt(1 - alpha_prod_t_prev);
+    float* sample_data = latents.data<float>();
+    kernels::for_each_guided_noise(noise_pred, latents.get_size(), guidance_scale, [&](size_t i, float model_output) {
+        const float sample = sample_data[i];
+        const float pred_original_sample = pos_sample_coeff * sample + pos_model_output_coeff * model_output;
+        const float pred_epsilon = pe_sample_coeff * sample + pe_model_output_coeff * model_output;
+        sample_data[i] = pos_coeff * pred_original_sample + direction_coeff * pred_epsilon;
+    });
 
-    return result;
+    return {{"latent", latents}};
 }
 
 std::vector<int64_t> DDIMScheduler::get_timesteps() const {
@@ -201,10 +196,6 @@ float DDIMScheduler::get_init_noise_sigma() const {
     return 1.0f;
 }
 
-void DDIMScheduler::scale_model_input(ov::Tensor sample, size_t inference_step) {
-    return;
-}
-
 void DDIMScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const {
     float sqrt_alpha_prod = std::sqrt(m_alphas_cumprod[latent_timestep]);
     float sqrt_one_minus_alpha_prod = std::sqrt(1.0 - m_alphas_cumprod[latent_timestep]);
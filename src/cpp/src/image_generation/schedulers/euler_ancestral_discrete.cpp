@@ -93,6 +93,10 @@ EulerAncestralDiscreteScheduler::EulerAncestralDiscreteScheduler(const Config& s
     m_is_scale_input_called = false;
 }
 
+std::shared_ptr<IScheduler> EulerAncestralDiscreteScheduler::clone() const {
+    return std::make_shared<EulerAncestralDiscreteScheduler>(m_config);
+}
+
 void EulerAncestralDiscreteScheduler::set_timesteps(size_t num_inference_steps, float strength) {
     m_timesteps.clear();
     m_sigmas.clear();
@@ -152,35 +156,26 @@ void EulerAncestralDiscreteScheduler::set_timesteps(size_t num_inference_steps,
     }
 }
 
-std::map<std::string, ov::Tensor> EulerAncestralDiscreteScheduler::step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+std::map<std::string, ov::Tensor> EulerAncestralDiscreteScheduler::guided_step(ov::Tensor noise_pred, ov::Tensor latents, float guidance_scale, size_t inference_step, std::shared_ptr<Generator> generator) {
     // noise_pred - model_output
     // latents - sample
     // inference_step
 
-    size_t timestep = m_timesteps[inference_step];
-
     if (m_step_index == -1)
         m_step_index = m_begin_index;
 
     float sigma = m_sigmas[m_step_index];
 
-    float* model_output_data = noise_pred.data<float>();
-    float* sample_data = latents.data<float>();
-
-    ov::Tensor pred_original_sample(noise_pred.get_element_type(), noise_pred.get_shape());
-    float* pred_original_sample_data = pred_original_sample.data<float>();
-
+    // x_0 = sample_coeff * sample + model_output_coeff * model_output
+    float sample_coeff = 0.0f, model_output_coeff = 0.0f;
     switch (m_config.prediction_type) {
     case PredictionType::EPSILON:
-        for (size_t i = 0; i < noise_pred.get_size(); ++i) {
-            pred_original_sample_data[i] = sample_data[i] - sigma * model_output_data[i];
-        }
+        sample_coeff = 1.0f;
+        model_output_coeff = -sigma;
         break;
     case PredictionType::V_PREDICTION:
-        for (size_t i = 0; i < noise_pred.get_size(); ++i) {
-            pred_original_sample_data[i] = model_output_data[i] * (-sigma / std::pow((std::pow(sigma, 2) + 1), 0.5)) +
-                                           (sample_data[i] / (std::pow(sigma, 2) + 1));
-        }
+        sample_coeff = 1.0f / (sigma * sigma + 1);
+        model_output_coeff = -sigma / std::sqrt(sigma * sigma + 1);
         break;
     default:
         OPENVINO_THROW("Unsupported value for 'PredictionType': must be one of `epsilon`, or `v_prediction`");
@@ -192,20 +187,26 @@ std::map<std::string, ov::Tensor> EulerAncestralDiscreteScheduler::step(ov::Tens
     float sigma_down = std::sqrt(std::pow(sigma_to, 2) - std::pow(sigma_up, 2));
     float dt = sigma_down - sigma;
 
-    ov::Tensor prev_sample = ov::Tensor(latents.get_element_type(), latents.get_shape());
-    float* prev_sample_data = prev_sample.data<float>();
+    if (!m_denoised || m_denoised.get_shape() != latents.get_shape())
+        m_denoised = ov::Tensor(latents.get_element_type(), latents.get_shape());
 
-    ov::Tensor noise = generator->randn_tensor(noise_pred.get_shape());
-    const float* noise_data = noise.data<float>();
-
-    for (size_t i = 0; i < prev_sample.get_size(); ++i) {
-        float derivative = (sample_data[i] - pred_original_sample_data[i]) / sigma;
-        prev_sample_data[i] = (sample_data[i] + derivative * dt) + noise_data[i] * sigma_up;
-    }
+    // random generator is sequential, so noise is generated before the parallel pass
+    ov::Tensor noise = generator->randn_tensor(latents.get_shape());
+    const float* noise_data = noise.data<const float>();
+    float* sample_data = latents.data<float>();
+    float* pred_original_sample_data = m_denoised.data<float>();
+
+    kernels::for_each_guided_noise(noise_pred, latents.get_size(), guidance_scale, [&](size_t i, float model_output) {
+        const float sample = sample_data[i];
+        const float pred_original_sample = sample_coeff * sample + model_output_coeff * model_output;
+        const float derivative = (sample - pred_original_sample) / sigma;
+        pred_original_sample_data[i] = pred_original_sample;
+        sample_data[i] = (sample + derivative * dt) + noise_data[i] * sigma_up;
+    });
 
     m_step_index++;
 
-    return {{"latent", prev_sample}, {"denoised", pred_original_sample}};
+    return {{"latent", latents}, {"denoised", m_denoised}};
 }
 
 size_t EulerAncestralDiscreteScheduler::_index_for_timestep(int64_t timestep) const{
@@ -234,16 +235,13 @@ std::vector<int64_t> EulerAncestralDiscreteScheduler::get_timesteps() const {
     return m_timesteps;
 }
 
-void EulerAncestralDiscreteScheduler::scale_model_input(ov::Tensor sample, size_t inference_step) {
+float EulerAncestralDiscreteScheduler::get_model_input_scale(size_t inference_step) {
     if (m_step_index == -1)
         m_step_index = m_begin_index;
 
-    float sigma = m_sigmas[m_step_index];
-    float* sample_data = sample.data<float>();
-    for (size_t i = 0; i < sample.get_size(); i++) {
-        sample_data[i] /= std::pow((std::pow(sigma, 2) + 1), 0.5);
-    }
     m_is_scale_input_called = true;
+    float sigma = m_sigmas[m_step_index];
+    return 1.0f / std::sqrt(sigma * sigma + 1);
 }
 
 float EulerAncestralDiscreteScheduler::get_init_noise_sigma() const {
@@ -105,6 +105,10 @@ EulerDiscreteScheduler::EulerDiscreteScheduler(const Config& scheduler_config) :
     m_begin_index = -1;
 }
 
+std::shared_ptr<IScheduler> EulerDiscreteScheduler::clone() const {
+    return std::make_shared<EulerDiscreteScheduler>(m_config);
+}
+
 void EulerDiscreteScheduler::set_timesteps(size_t num_inference_steps, float strength) {
     // TODO: support `timesteps` and `sigmas` inputs
     m_timesteps.clear();
@@ -207,13 +211,11 @@ void EulerDiscreteScheduler::set_timesteps(size_t num_inference_steps, float str
     }
 }
 
-std::map<std::string, ov::Tensor> EulerDiscreteScheduler::step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+std::map<std::string, ov::Tensor> EulerDiscreteScheduler::guided_step(ov::Tensor noise_pred, ov::Tensor latents, float guidance_scale, size_t inference_step, std::shared_ptr<Generator> generator) {
     // noise_pred - model_output
     // latents - sample
     // inference_step
 
-    size_t timestep = m_timesteps[inference_step];
-
     if (m_step_index == -1)
         m_step_index = m_begin_index;
 
@@ -222,32 +224,20 @@ std::map<std::string, ov::Tensor> EulerDiscreteScheduler::step(ov::Tensor noise_
     float gamma = 0.0f;
     float sigma_hat = sigma * (gamma + 1);
 
-    float* model_output_data = noise_pred.data<float>();
-    float* sample_data = latents.data<float>();
-
-    ov::Tensor pred_original_sample(noise_pred.get_element_type(), noise_pred.get_shape());
-    float* pred_original_sample_data = pred_original_sample.data<float>();
-
-    ov::Tensor prev_sample(noise_pred.get_element_type(), noise_pred.get_shape());
-    float* prev_sample_data = prev_sample.data<float>();
-
     // 1. compute predicted original sample (x_0) from sigma-scaled predicted noise
+    // all prediction types are linear: x_0 = sample_coeff * sample + model_output_coeff * model_output
+    float sample_coeff = 0.0f, model_output_coeff = 0.0f;
     switch (m_config.prediction_type) {
     case PredictionType::EPSILON:
-        for (size_t i = 0; i < noise_pred.get_size(); ++i) {
-            pred_original_sample_data[i] = sample_data[i] - model_output_data[i] * sigma_hat;
-        }
+        sample_coeff = 1.0f;
+        model_output_coeff = -sigma_hat;
         break;
     case PredictionType::SAMPLE:
-        for (size_t i = 0; i < noise_pred.get_size(); ++i) {
-            pred_original_sample_data[i] = model_output_data[i];
-        }
+        model_output_coeff = 1.0f;
         break;
     case PredictionType::V_PREDICTION:
-        for (size_t i = 0; i < noise_pred.get_size(); ++i) {
-            pred_original_sample_data[i] = model_output_data[i] * (-sigma / std::pow((std::pow(sigma, 2) + 1), 0.5)) +
-                                           (sample_data[i] / (std::pow(sigma, 2) + 1));
-        }
+        sample_coeff = 1.0f / (sigma * sigma + 1);
+        model_output_coeff = -sigma / std::sqrt(sigma * sigma + 1);
         break;
     default:
         OPENVINO_THROW("Unsupported value for 'PredictionType'");
@@ -255,14 +245,23 @@ std::map<std::string, ov::Tensor> EulerDiscreteScheduler::step(ov::Tensor noise_
 
     float dt = m_sigmas[m_step_index + 1] - sigma_hat;
 
-    // 2. Convert to an ODE derivative
-    for (size_t i = 0; i < prev_sample.get_size(); ++i) {
-        prev_sample_data[i] = ((sample_data[i] - pred_original_sample_data[i]) / sigma_hat) * dt + sample_data[i];
-    }
+    if (!m_denoised || m_denoised.get_shape() != latents.get_shape())
+        m_denoised = ov::Tensor(latents.get_element_type(), latents.get_shape());
+
+    float* sample_data = latents.data<float>();
+    float* pred_original_sample_data = m_denoised.data<float>();
+
+    // 2. Convert to an ODE derivative, guidance, x_0 and the derivative are computed in a single pass
+    kernels::for_each_guided_noise(noise_pred, latents.get_size(), guidance_scale, [&](size_t i, float model_output) {
+        const float sample = sample_data[i];
+        const float pred_original_sample = sample_coeff * sample + model_output_coeff * model_output;
+        pred_original_sample_data[i] = pred_original_sample;
+        sample_data[i] = ((sample - pred_original_sample) / sigma_hat) * dt + sample;
+    });
 
     m_step_index += 1;
 
-    return {{"latent", prev_sample}, {"denoised", pred_original_sample}};
+    return {{"latent", latents}, {"denoised", m_denoised}};
 }
 
 std::vector<int64_t> EulerDiscreteScheduler::get_timesteps() const {
@@ -280,15 +279,12 @@ float EulerDiscreteScheduler::get_init_noise_sigma() const {
     return std::sqrt(max_sigma * max_sigma + 1);
 }
 
-void EulerDiscreteScheduler::scale_model_input(ov::Tensor sample, size_t inference_step) {
+float EulerDiscreteScheduler::get_model_input_scale(size_t inference_step) {
     if (m_step_index == -1)
         m_step_index = m_begin_index;
 
     float sigma = m_sigmas[m_step_index];
-    float* sample_data = sample.data<float>();
-    for (size_t i = 0; i < sample.get_size(); i++) {
-        sample_data[i] /= std::pow((std::pow(sigma, 2) + 1), 0.5);
-    }
+    return 1.0f / std::sqrt(sigma * sigma + 1);
 }
 
 size_t EulerDiscreteScheduler::_index_for_timestep(int64_t timestep) const {
@@ -37,15 +37,17 @@ public:
     explicit EulerDiscreteScheduler(const std::filesystem::path& scheduler_config_path);
     explicit EulerDiscreteScheduler(const Config& scheduler_config);
 
+    std::shared_ptr<IScheduler> clone() const override;
+
     void set_timesteps(size_t num_inference_steps, float strength) override;
 
     std::vector<std::int64_t> get_timesteps() const override;
 
     float get_init_noise_sigma() const override;
 
-    void scale_model_input(ov::Tensor sample, size_t inference_step) override;
+    float get_model_input_scale(size_t inference_step) override;
 
-    std::map<std::string, ov::Tensor> step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) override;
+    std::map<std::string, ov::Tensor> guided_step(ov::Tensor noise_pred, ov::Tensor latents, float guidance_scale, size_t inference_step, std::shared_ptr<Generator> generator) override;
 
     void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const override;
 
@@ -58,6 +60,9 @@ private:
 
     int m_step_index, m_begin_index;
 
+    // predicted original sample, reused between steps
+    ov::Tensor m_denoised;
+
     size_t _index_for_timestep(int64_t timestep) const;
 };
 
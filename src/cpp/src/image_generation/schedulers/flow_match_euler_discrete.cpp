@@ -64,6 +64,10 @@ FlowMatchEulerDiscreteScheduler::FlowMatchEulerDiscreteScheduler(const Config& s
     m_sigma_max = m_sigmas[0], m_sigma_min = m_sigmas.back();
 }
 
+std::shared_ptr<IScheduler> FlowMatchEulerDiscreteScheduler::clone() const {
+    return std::make_shared<FlowMatchEulerDiscreteScheduler>(m_config);
+}
+
 double FlowMatchEulerDiscreteScheduler::sigma_to_t(double sigma) {
     return sigma * m_config.num_train_timesteps;
 }
@@ -99,29 +103,24 @@ void FlowMatchEulerDiscreteScheduler::set_timesteps(size_t num_inference_steps,
     m_step_index = -1, m_begin_index = -1;
 }
 
-std::map<std::string, ov::Tensor> FlowMatchEulerDiscreteScheduler::step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+std::map<std::string, ov::Tensor> FlowMatchEulerDiscreteScheduler::guided_step(ov::Tensor noise_pred, ov::Tensor latents, float guidance_scale, size_t inference_step, std::shared_ptr<Generator> generator) {
     // noise_pred - model_output
     // latents - sample
     // inference_step
 
-    const float* model_output_data = noise_pred.data<const float>();
-    const float* sample_data = latents.data<const float>();
-
     if (m_step_index == -1)
         init_step_index();
 
-    ov::Tensor prev_sample(latents.get_element_type(), latents.get_shape());
-    float* prev_sample_data = prev_sample.data<float>();
-
     float sigma_diff = m_sigmas[m_step_index + 1] - m_sigmas[m_step_index];
 
-    for (size_t i = 0; i < prev_sample.get_size(); ++i) {
-        prev_sample_data[i] = sample_data[i] + sigma_diff * model_output_data[i];
-    }
+    float* sample_data = latents.data<float>();
+    kernels::for_each_guided_noise(noise_pred, latents.get_size(), guidance_scale, [&](size_t i, float model_output) {
+        sample_data[i] += sigma_diff * model_output;
+    });
 
     m_step_index++;
 
-    return {{"latent", prev_sample}};
+    return {{"latent", latents}};
 }
 
 std::vector<float> FlowMatchEulerDiscreteScheduler::get_float_timesteps() const {
@@ -132,10 +131,6 @@ float FlowMatchEulerDiscreteScheduler::get_init_noise_sigma() const {
     return 1.0f;
 }
 
-void FlowMatchEulerDiscreteScheduler::scale_model_input(ov::Tensor sample, size_t inference_step) {
-    return;
-}
-
 void FlowMatchEulerDiscreteScheduler::init_step_index() {
     // TODO: support index_for_timestep method
     m_step_index = (m_begin_index == -1) ? 0 : m_begin_index;
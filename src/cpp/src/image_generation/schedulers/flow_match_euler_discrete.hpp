@@ -28,6 +28,8 @@ public:
     explicit FlowMatchEulerDiscreteScheduler(const std::filesystem::path& scheduler_config_path);
     explicit FlowMatchEulerDiscreteScheduler(const Config& scheduler_config);
 
+    std::shared_ptr<IScheduler> clone() const override;
+
     void set_timesteps(size_t num_inference_steps, float strength) override;
 
     void set_timesteps_with_sigma(std::vector<float> sigma, float mu) override;
@@ -36,9 +38,7 @@ public:
 
     float get_init_noise_sigma() const override;
 
-    void scale_model_input(ov::Tensor sample, size_t inference_step) override;
-
-    std::map<std::string, ov::Tensor> step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) override;
+    std::map<std::string, ov::Tensor> guided_step(ov::Tensor noise_pred, ov::Tensor latents, float guidance_scale, size_t inference_step, std::shared_ptr<Generator> generator) override;
 
     void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const override;
 
@@ -6,25 +6,55 @@
 #include <cstdint>
 #include <vector>
 #include <map>
+#include <memory>
 
 #include "openvino/genai/image_generation/scheduler.hpp"
 #include "openvino/genai/image_generation/generation_config.hpp"
 
 #include "openvino/runtime/tensor.hpp"
 
+#include "image_generation/schedulers/step_kernels.hpp"
+
 namespace ov {
 namespace genai {
 
 class IScheduler : public Scheduler {
 public:
+    // creates a scheduler of the same type and config without state, so several requests can be denoised at once
+    virtual std::shared_ptr<IScheduler> clone() const = 0;
+
     virtual void set_timesteps(size_t num_inference_steps, float strength) = 0;
 
     virtual float get_init_noise_sigma() const = 0;
 
-    virtual void scale_model_input(ov::Tensor sample, size_t inference_step) = 0;
+    /**
+     * A factor scale_model_input() multiplies a sample by at `inference_step`, so pipelines can fuse
+     * the scaling with preparation of denoising model inputs.
+     */
+    virtual float get_model_input_scale(size_t inference_step) {
+        return 1.0f;
+    }
 
-    virtual std::map<std::string, ov::Tensor> step(
-        ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) = 0;
+    void scale_model_input(ov::Tensor sample, size_t inference_step) {
+        const float scale = get_model_input_scale(inference_step);
+        if (scale != 1.0f) {
+            kernels::repeat_scaled(sample, sample, scale);
+        }
+    }
+
+    /**
+     * Scheduler step fused with classifier-free guidance: if `noise_pred` has twice larger batch than `latents`,
+     * its halves are unconditional and text conditioned noise predictions, which are combined with `guidance_scale`
+     * on the fly. `latents` are updated in place and returned as "latent"; other returned tensors, like "denoised",
+     * are owned by the scheduler and overwritten by the next step.
+     */
+    virtual std::map<std::string, ov::Tensor> guided_step(
+        ov::Tensor noise_pred, ov::Tensor latents, float guidance_scale, size_t inference_step, std::shared_ptr<Generator> generator) = 0;
+
+    std::map<std::string, ov::Tensor> step(
+        ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+        return guided_step(noise_pred, latents, 1.0f, inference_step, generator);
+    }
 
     virtual void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const = 0;
 
@@ -82,6 +82,10 @@ LCMScheduler::LCMScheduler(const Config& scheduler_config)
     m_final_alpha_cumprod = m_config.set_alpha_to_one ? 1 : m_alphas_cumprod[0];
 }
 
+std::shared_ptr<IScheduler> LCMScheduler::clone() const {
+    return std::make_shared<LCMScheduler>(m_config);
+}
+
 void LCMScheduler::set_timesteps(size_t num_inference_steps, float strength) {
     m_num_inference_steps = num_inference_steps;
 
@@ -116,10 +120,9 @@ void LCMScheduler::set_timesteps(size_t num_inference_steps, float strength) {
     //     m_timesteps.push_back(temp[i]);
 }
 
-std::map<std::string, ov::Tensor> LCMScheduler::step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+std::map<std::string, ov::Tensor> LCMScheduler::guided_step(ov::Tensor noise_pred, ov::Tensor latents, float guidance_scale, size_t inference_step, std::shared_ptr<Generator> generator) {
     ov::Shape shape = latents.get_shape();
     size_t batch_size = shape[0], latent_size = ov::shape_size(shape) / batch_size;
-    float* noise_pred_data = noise_pred.data<float>();
     float* latents_data = latents.data<float>();
 
     // 1. get previous step value
@@ -142,61 +145,54 @@ std::map<std::string, ov::Tensor> LCMScheduler::step(ov::Tensor noise_pred, ov::
     float c_out = scaled_timestep / std::sqrt((std::pow(scaled_timestep, 2) + std::pow(m_sigma_data, 2)));
 
     // 4. Compute the predicted original sample x_0 based on the model parameterization
-    std::vector<std::vector<float>> predicted_original_sample(batch_size);
-    // "epsilon" by default
-    if (m_config.prediction_type == PredictionType::EPSILON) {
-        for (std::size_t i = 0; i < batch_size; ++i) {
-            std::vector<float>& predicted_original_sample_l = predicted_original_sample[i];
-            predicted_original_sample_l.resize(latent_size);
-
-            for (std::size_t j = 0; j < latent_size; ++j)
-                predicted_original_sample_l[j] = (latents_data[i * latent_size + j] -
-                    beta_prod_t_sqrt * noise_pred_data[i * latent_size + j]) / alpha_prod_t_sqrt;
-        }
-    }
+    OPENVINO_ASSERT(m_config.prediction_type == PredictionType::EPSILON,
+                    "LCMScheduler supports only 'epsilon' prediction type");
 
-    // 5. Clip or threshold "predicted x_0"
-    if (m_config.thresholding) {
-        for (std::size_t i = 0; i < batch_size; ++i) {
-            predicted_original_sample[i] = threshold_sample(predicted_original_sample[i]);
-        }
-    } else if (m_config.clip_sample) {
-        for (std::size_t i = 0; i < batch_size; ++i) {
-            for (float& value : predicted_original_sample[i]) {
-                value = std::clamp(value, - m_config.clip_sample_range, m_config.clip_sample_range);
-            }
-        }
-    }
+    if (!m_denoised || m_denoised.get_shape() != shape)
+        m_denoised = ov::Tensor(latents.get_element_type(), shape);
+    float* denoised_data = m_denoised.data<float>();
 
-    // 6. Denoise model output using boundary conditions
-    ov::Tensor denoised(latents.get_element_type(), shape);
-    float* denoised_data = denoised.data<float>();
-    for (std::size_t i = 0; i < batch_size; ++i) {
-        for (std::size_t j = 0; j < latent_size; ++j) {
-            denoised_data[i * latent_size + j] = c_out * predicted_original_sample[i][j] + c_skip * latents_data[i * latent_size + j];
-        }
-    }
-
-    /// 7. Sample and inject noise z ~ N(0, I) for MultiStep Inference
     // Noise is not used on the final timestep of the timestep schedule.
     // This also means that noise is not used for one-step sampling.
-    ov::Tensor prev_sample(latents.get_element_type(), shape);
-    float* prev_sample_data = prev_sample.data<float>();
+    const bool inject_noise = inference_step != m_num_inference_steps - 1;
+    ov::Tensor rand_tensor = inject_noise ? generator->randn_tensor(shape) : ov::Tensor();
+    const float* rand_tensor_data = inject_noise ? rand_tensor.data<const float>() : nullptr;
 
-    if (inference_step != m_num_inference_steps - 1) {
-        ov::Tensor rand_tensor = generator->randn_tensor(shape);
-        const float * rand_tensor_data = rand_tensor.data<float>();
+    // 6. Denoise model output using boundary conditions
+    // 7. Sample and inject noise z ~ N(0, I) for MultiStep Inference
+    auto denoise = [&](size_t i, float predicted_original_sample) {
+        const float denoised = c_out * predicted_original_sample + c_skip * latents_data[i];
+        denoised_data[i] = denoised;
+        latents_data[i] = inject_noise ? alpha_prod_t_prev_sqrt * denoised + beta_prod_t_prev_sqrt * rand_tensor_data[i] : denoised;
+    };
 
-        for (std::size_t i = 0; i < batch_size * latent_size; ++i) {
-            prev_sample_data[i] = alpha_prod_t_prev_sqrt * denoised_data[i] + beta_prod_t_prev_sqrt * rand_tensor_data[i];
+    if (m_config.thresholding) {
+        // 5. Threshold "predicted x_0", it requires statistics over the whole sample, so x_0 is stored first
+        kernels::for_each_guided_noise(noise_pred, latents.get_size(), guidance_scale, [&](size_t i, float model_output) {
+            denoised_data[i] = (latents_data[i] - beta_prod_t_sqrt * model_output) / alpha_prod_t_sqrt;
+        });
+        for (std::size_t i = 0; i < batch_size; ++i) {
+            threshold_sample(denoised_data + i * latent_size, latent_size);
         }
+        kernels::parallel_chunks(latents.get_size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+                denoise(i, denoised_data[i]);
+        });
     } else {
-        std::copy_n(denoised_data, denoised.get_size(), prev_sample_data);
+        // 5. Clip "predicted x_0"
+        const bool clip_sample = m_config.clip_sample;
+        const float clip_sample_range = m_config.clip_sample_range;
+        kernels::for_each_guided_noise(noise_pred, latents.get_size(), guidance_scale, [&](size_t i, float model_output) {
+            float predicted_original_sample = (latents_data[i] - beta_prod_t_sqrt * model_output) / alpha_prod_t_sqrt;
+            if (clip_sample)
+                predicted_original_sample = std::clamp(predicted_original_sample, -clip_sample_range, clip_sample_range);
+            denoise(i, predicted_original_sample);
+        });
     }
 
     return {
-        {"latent", prev_sample},
-        {"denoised", denoised}
+        {"latent", latents},
+        {"denoised", m_denoised}
     };
 }
 
@@ -208,12 +204,8 @@ float LCMScheduler::get_init_noise_sigma() const {
     return 1.0f;
 }
 
-void LCMScheduler::scale_model_input(ov::Tensor sample, size_t inference_step) {
-    return;
-}
-
 // Copied from diffusers.schedulers.scheduling_ddpm.DDPMScheduler._threshold_sample
-std::vector<float> LCMScheduler::threshold_sample(const std::vector<float>& flat_sample) {
+void LCMScheduler::threshold_sample(float* flat_sample, size_t sample_size) {
     /*
     "Dynamic thresholding: At each sampling step we set s to a certain percentile absolute pixel value in xt0 (the
     prediction of x_0 at timestep t), and if s > 1, then we threshold xt0 to the range [-s, s] and then divide by
@@ -223,24 +215,21 @@ std::vector<float> LCMScheduler::threshold_sample(const std::vector<float>& flat
     https://arxiv.org/abs/2205.11487
     */
 
-    std::vector<float> thresholded_sample;
     // Calculate abs
-    std::vector<float> abs_sample(flat_sample.size());
-    std::transform(flat_sample.begin(), flat_sample.end(), abs_sample.begin(), [](float val) { return std::abs(val); });
+    std::vector<float> abs_sample(sample_size);
+    std::transform(flat_sample, flat_sample + sample_size, abs_sample.begin(), [](float val) { return std::abs(val); });
 
     // Calculate s, the quantile threshold
-    std::sort(abs_sample.begin(), abs_sample.end());
-    const int s_index = std::min(static_cast<int>(std::round(m_config.dynamic_thresholding_ratio * flat_sample.size())),
-                                 static_cast<int>(flat_sample.size()) - 1);
+    const int s_index = std::min(static_cast<int>(std::round(m_config.dynamic_thresholding_ratio * sample_size)),
+                                 static_cast<int>(sample_size) - 1);
+    std::nth_element(abs_sample.begin(), abs_sample.begin() + s_index, abs_sample.end());
     float s = abs_sample[s_index];
     s = std::clamp(s, 1.0f, m_config.sample_max_value);
 
-    // Threshold and normalize the sample
-    for (float& value : thresholded_sample) {
-        value = std::clamp(value, -s, s) / s;
+    // Threshold and normalize the sample in place
+    for (size_t i = 0; i < sample_size; ++i) {
+        flat_sample[i] = std::clamp(flat_sample[i], -s, s) / s;
     }
-
-    return thresholded_sample;
 }
 
 void LCMScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const {
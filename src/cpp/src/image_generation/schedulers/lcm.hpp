@@ -42,15 +42,15 @@ public:
     explicit LCMScheduler(const std::filesystem::path& scheduler_config_path);
     explicit LCMScheduler(const Config& scheduler_config);
 
+    std::shared_ptr<IScheduler> clone() const override;
+
     void set_timesteps(size_t num_inference_steps, float strength) override;
 
     std::vector<std::int64_t> get_timesteps() const override;
 
     float get_init_noise_sigma() const override;
 
-    void scale_model_input(ov::Tensor sample, size_t inference_step) override;
-
-    std::map<std::string, ov::Tensor> step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) override;
+    std::map<std::string, ov::Tensor> guided_step(ov::Tensor noise_pred, ov::Tensor latents, float guidance_scale, size_t inference_step, std::shared_ptr<Generator> generator) override;
 
     void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const override;
 
@@ -64,7 +64,11 @@ private:
 
     std::vector<int64_t> m_timesteps;
 
-    std::vector<float> threshold_sample(const std::vector<float>& flat_sample);
+    // denoised sample, reused between steps
+    ov::Tensor m_denoised;
+
+    // thresholds a sample of one batch element in place
+    void threshold_sample(float* flat_sample, size_t sample_size);
 };
 
 } // namespace genai
@@ -139,6 +139,10 @@ LMSDiscreteScheduler::LMSDiscreteScheduler(const Config& scheduler_config)
     }
 }
 
+std::shared_ptr<IScheduler> LMSDiscreteScheduler::clone() const {
+    return std::make_shared<LMSDiscreteScheduler>(m_config);
+}
+
 float LMSDiscreteScheduler::get_init_noise_sigma() const {
     float max_sigma = *std::max_element(m_sigmas.begin(), m_sigmas.end());
 
@@ -150,13 +154,8 @@ float LMSDiscreteScheduler::get_init_noise_sigma() const {
     return std::sqrt(max_sigma * max_sigma + 1);
 }
 
-void LMSDiscreteScheduler::scale_model_input(ov::Tensor sample, size_t inference_step) {
-    const double scale = 1.0 / std::sqrt((m_sigmas[inference_step] * m_sigmas[inference_step] + 1));
-
-    float* sample_data = sample.data<float>();
-    for (size_t i = 0; i < sample.get_size(); i++) {
-        sample_data[i] *= scale;
-    }
+float LMSDiscreteScheduler::get_model_input_scale(size_t inference_step) {
+    return 1.0f / std::sqrt(m_sigmas[inference_step] * m_sigmas[inference_step] + 1);
 }
 
 void LMSDiscreteScheduler::set_timesteps(size_t num_inference_steps, float strength) {
@@ -187,44 +186,42 @@ std::vector<int64_t> LMSDiscreteScheduler::get_timesteps() const {
     return m_timesteps;
 }
 
-std::map<std::string, ov::Tensor> LMSDiscreteScheduler::step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+std::map<std::string, ov::Tensor> LMSDiscreteScheduler::guided_step(ov::Tensor noise_pred, ov::Tensor latents, float guidance_scale, size_t inference_step, std::shared_ptr<Generator> generator) {
     const float sigma = m_sigmas[inference_step];
 
     // LMS step function:
-    std::vector<float> derivative;
-    derivative.reserve(latents.get_size());
-
-    for (size_t j = 0; j < latents.get_size(); j++) {
-        // 1. compute predicted original sample (x_0) from sigma-scaled predicted noise
-        float pred_latent = 0;
-        switch (m_config.prediction_type) {
-            case PredictionType::EPSILON:
-                pred_latent = latents.data<float>()[j] - sigma * noise_pred.data<float>()[j];
-                break;
-            case PredictionType::SAMPLE:
-                pred_latent = noise_pred.data<float>()[j];
-                break;
-            case PredictionType::V_PREDICTION:
-                // pred_original_sample = model_output * (-sigma / (sigma**2 + 1) ** 0.5) + (sample / (sigma**2 + 1))
-                pred_latent = noise_pred.data<float>()[j] * (-sigma / std::sqrt(sigma * sigma + 1.0f) + 
-                    latents.data<float>()[j] / (sigma * sigma + 1.0f));
-                break;
-            default:
-                OPENVINO_THROW("Unsupported value for 'PredictionType'");
-        }
-        // 2. Convert to an ODE derivative
-        derivative.push_back((latents.data<float>()[j] - pred_latent) / sigma);
+    // 1. compute predicted original sample (x_0) from sigma-scaled predicted noise:
+    // x_0 = sample_coeff * sample + model_output_coeff * model_output
+    float sample_coeff = 0.0f, model_output_coeff = 0.0f;
+    switch (m_config.prediction_type) {
+        case PredictionType::EPSILON:
+            sample_coeff = 1.0f;
+            model_output_coeff = -sigma;
+            break;
+        case PredictionType::SAMPLE:
+            model_output_coeff = 1.0f;
+            break;
+        case PredictionType::V_PREDICTION:
+            // pred_original_sample = model_output * (-sigma / (sigma**2 + 1) ** 0.5) + (sample / (sigma**2 + 1))
+            sample_coeff = 1.0f / (sigma * sigma + 1.0f);
+            model_output_coeff = -sigma / std::sqrt(sigma * sigma + 1.0f);
+            break;
+        default:
+            OPENVINO_THROW("Unsupported value for 'PredictionType'");
     }
 
-    m_derivative_list.push_back(derivative);
-    // keep the list size within 4
+    // keep the list size within 4, the oldest derivative buffer is reused for the current one
     size_t order = 4;
-    if (order < m_derivative_list.size()) {
+    std::vector<float> derivative;
+    if (m_derivative_list.size() == order) {
+        derivative = std::move(m_derivative_list.front());
         m_derivative_list.pop_front();
     }
+    derivative.resize(latents.get_size());
 
     // 3. Compute linear multistep coefficients
     order = std::min(inference_step + 1, order);
+    OPENVINO_ASSERT(m_derivative_list.size() + 1 == order, "LMSDiscreteScheduler derivatives history is inconsistent with inference step");
 
     std::vector<float> lms_coeffs(order);
     for (size_t curr_order = 0; curr_order < order; curr_order++) {
@@ -235,23 +232,31 @@ std::map<std::string, ov::Tensor> LMSDiscreteScheduler::step(ov::Tensor noise_pr
         lms_coeffs[curr_order] = trapezoidal(lms_derivative_functor, static_cast<double>(sigma), static_cast<double>(m_sigmas[inference_step + 1]), 1e-4);
     }
 
+    // previous derivatives from the oldest to the newest
+    std::vector<const float*> prev_derivatives;
+    for (const auto& prev_derivative : m_derivative_list)
+        prev_derivatives.push_back(prev_derivative.data());
+
+    // 2. Convert to an ODE derivative
     // 4. Compute previous sample based on the derivatives path
     // prev_sample = sample + sum(coeff * derivative for coeff, derivative in zip(lms_coeffs, reversed(self.derivatives)))
-    ov::Tensor prev_sample(latents.get_element_type(), latents.get_shape());
-    float* prev_sample_data = prev_sample.data<float>();
-    const float* latents_data = latents.data<const float>();
-    for (size_t i = 0; i < prev_sample.get_size(); ++i) {
-        float derivative_sum = 0.0f;
-        auto derivative_it = m_derivative_list.begin();
-        for (size_t curr_order = 0; curr_order < order; derivative_it++, curr_order++) {
-            derivative_sum += (*derivative_it)[i] * lms_coeffs[order - curr_order - 1];
+    float* derivative_data = derivative.data();
+    float* sample_data = latents.data<float>();
+    kernels::for_each_guided_noise(noise_pred, latents.get_size(), guidance_scale, [&](size_t i, float model_output) {
+        const float sample = sample_data[i];
+        const float curr_derivative = (sample - (sample_coeff * sample + model_output_coeff * model_output)) / sigma;
+        derivative_data[i] = curr_derivative;
+
+        float derivative_sum = curr_derivative * lms_coeffs[0];
+        for (size_t curr_order = 0; curr_order + 1 < order; curr_order++) {
+            derivative_sum += prev_derivatives[curr_order][i] * lms_coeffs[order - curr_order - 1];
         }
-        prev_sample_data[i] = latents_data[i] + derivative_sum;
-    }
+        sample_data[i] = sample + derivative_sum;
+    });
 
-    std::map<std::string, ov::Tensor> result{{"latent", prev_sample}};
+    m_derivative_list.push_back(std::move(derivative));
 
-    return result;
+    return {{"latent", latents}};
 }
 
 void LMSDiscreteScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const {
@@ -76,6 +76,10 @@ PNDMScheduler::PNDMScheduler(const Config& scheduler_config): m_config(scheduler
     m_timesteps = {};
 }
 
+std::shared_ptr<IScheduler> PNDMScheduler::clone() const {
+    return std::make_shared<PNDMScheduler>(m_config);
+}
+
 void PNDMScheduler::set_timesteps(size_t num_inference_steps, float strength) {
     m_timesteps.clear(), m_prk_timesteps.clear(), m_plms_timesteps.clear();
 
@@ -142,7 +146,7 @@ void PNDMScheduler::set_timesteps(size_t num_inference_steps, float strength) {
     }
 }
 
-std::map<std::string, ov::Tensor> PNDMScheduler::step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
+std::map<std::string, ov::Tensor> PNDMScheduler::guided_step(ov::Tensor noise_pred, ov::Tensor latents, float guidance_scale, size_t inference_step, std::shared_ptr<Generator> generator) {
     // noise_pred - model_output
     // latents - sample
     // inference_step
@@ -150,78 +154,60 @@ std::map<std::string, ov::Tensor> PNDMScheduler::step(ov::Tensor noise_pred, ov:
     if (m_counter < m_prk_timesteps.size() && !m_config.skip_prk_steps) {
         OPENVINO_THROW("'skip_prk_steps=false' case isn't supported. Please, add support.");
     } else {
-        return step_plms(noise_pred, latents, m_timesteps[inference_step]);
+        return step_plms(noise_pred, latents, guidance_scale, m_timesteps[inference_step]);
     }
 }
 
-std::map<std::string, ov::Tensor> PNDMScheduler::step_plms(ov::Tensor model_output, ov::Tensor sample, size_t timestep) {
+std::map<std::string, ov::Tensor> PNDMScheduler::step_plms(ov::Tensor model_output, ov::Tensor sample, float guidance_scale, size_t timestep) {
     OPENVINO_ASSERT(m_num_inference_steps != -1,
                     "Number of inference steps isn't set, you need to run `set_timesteps` after creating the scheduler");
 
     int prev_timestep = timestep - m_config.num_train_timesteps / m_num_inference_steps;
 
+    // current model output is stored to m_ets unless m_counter == 1, the oldest dropped tensor is reused for it
+    ov::Tensor ets_last;
     if (m_counter != 1) {
         if (m_ets.size() > 3) {
-            m_ets = std::vector<ov::Tensor>(m_ets.end() - 3, m_ets.end());
+            ets_last = m_ets.front();
+            m_ets.erase(m_ets.begin(), m_ets.end() - 3);
         }
-        ov::Tensor ets_last(model_output.get_element_type(), model_output.get_shape());
-        model_output.copy_to(ets_last);
-        m_ets.push_back(ets_last);
+        if (!ets_last || ets_last.get_shape() != sample.get_shape())
+            ets_last = ov::Tensor(sample.get_element_type(), sample.get_shape());
     } else {
         prev_timestep = timestep;
         timestep = timestep + m_config.num_train_timesteps / m_num_inference_steps;
     }
 
-    float* model_output_data = model_output.data<float>();
-
-    size_t m_ets_size = m_ets.size();
+    // combined model output is a linear combination of the current model output and the previous ones from m_ets
+    float model_output_coeff = 1.0f;
+    std::vector<std::pair<const float*, float>> prev_ets;
+    const size_t m_ets_size = m_ets.size() + (ets_last ? 1 : 0);
+    const float* sample_data = sample.data<const float>();
 
     if (m_ets_size == 1 && m_counter == 0) {
         m_cur_sample = ov::Tensor(sample.get_element_type(), sample.get_shape());
         sample.copy_to(m_cur_sample);
     } else if (m_ets_size == 1 && m_counter == 1) {
-        const float* ets_data = m_ets[0].data<float>();
-        for (size_t i = 0; i < model_output.get_size(); ++i) {
-            model_output_data[i] = (model_output_data[i] + ets_data[i]) / 2.0f;
-        }
-        sample = ov::Tensor(m_cur_sample.get_element_type(), m_cur_sample.get_shape());
-        m_cur_sample.copy_to(sample);
-        m_cur_sample = ov::Tensor(ov::element::f32, {});
+        model_output_coeff = 0.5f;
+        prev_ets = {{m_ets[0].data<const float>(), 0.5f}};
+        sample_data = m_cur_sample.data<const float>();
     } else if (m_ets_size == 2) {
-        const float* ets_data_1 = m_ets[1].data<float>();
-        const float* ets_data_2 = m_ets[0].data<float>();
-        for (size_t i = 0; i < model_output.get_size(); ++i) {
-            model_output_data[i] = (3.0f * ets_data_1[i] - ets_data_2[i]) / 2.0f;
-        }
+        model_output_coeff = 3.0f / 2.0f;
+        prev_ets = {{m_ets[0].data<const float>(), -1.0f / 2.0f}};
     } else if (m_ets_size == 3) {
-        const float* ets_data_1 = m_ets[2].data<float>();
-        const float* ets_data_2 = m_ets[1].data<float>();
-        const float* ets_data_3 = m_ets[0].data<float>();
-        for (size_t i = 0; i < model_output.get_size(); ++i) {
-            model_output_data[i] = (23.0f * ets_data_1[i] - 16.0f * ets_data_2[i] + 5.0f * ets_data_3[i]) / 12.0f;
-        }
+        model_output_coeff = 23.0f / 12.0f;
+        prev_ets = {{m_ets[1].data<const float>(), -16.0f / 12.0f},
+                    {m_ets[0].data<const float>(), 5.0f / 12.0f}};
     } else if (m_ets_size == 4) {
-        const float* ets_data_1 = m_ets[3].data<float>();
-        const float* ets_data_2 = m_ets[2].data<float>();
-        const float* ets_data_3 = m_ets[1].data<float>();
-        const float* ets_data_4 = m_ets[0].data<float>();
-
-        for (size_t i = 0; i < model_output.get_size(); ++i) {
-            model_output_data[i] = (1.0f / 24.0f)
-                                   * (55.0f * ets_data_1[i] - 59.0f * ets_data_2[i] + 37.0f * ets_data_3[i] - 9.0f * ets_data_4[i]);
-        }
+        model_output_coeff = 55.0f / 24.0f;
+        prev_ets = {{m_ets[2].data<const float>(), -59.0f / 24.0f},
+                    {m_ets[1].data<const float>(), 37.0f / 24.0f},
+                    {m_ets[0].data<const float>(), -9.0f / 24.0f}};
     } else {
         OPENVINO_THROW("PNDMScheduler: Unsupported step_plms case.");
     }
 
-    ov::Tensor prev_sample = get_prev_sample(sample, timestep, prev_timestep, model_output);
-    m_counter++;
-
-    std::map<std::string, ov::Tensor> result{{"latent", prev_sample}};
-    return result;
-}
-
-ov::Tensor PNDMScheduler::get_prev_sample(ov::Tensor sample, size_t timestep, int prev_timestep, ov::Tensor model_output) {
+    // get_prev_sample(...)
     float alpha_prod_t = m_alphas_cumprod[timestep];
     float alpha_prod_t_prev = (prev_timestep >= 0) ? m_alphas_cumprod[prev_timestep] : m_final_alpha_cumprod;
     float beta_prod_t = 1 - alpha_prod_t;
@@ -231,29 +217,44 @@ ov::Tensor PNDMScheduler::get_prev_sample(ov::Tensor sample, size_t timestep, in
     float model_output_denom_coeff = alpha_prod_t * std::sqrt(beta_prod_t_prev) +
                                      std::sqrt((alpha_prod_t * beta_prod_t * alpha_prod_t_prev));
 
-    float* model_output_data = model_output.data<float>();
-    float* sample_data = sample.data<float>();
-
+    // model_output = v_output_coeff * model_output + v_sample_coeff * sample
+    float v_output_coeff = 1.0f, v_sample_coeff = 0.0f;
     switch (m_config.prediction_type) {
         case PredictionType::EPSILON:
             break;
         case PredictionType::V_PREDICTION:
-            for (size_t i = 0; i < model_output.get_size(); ++i) {
-                model_output_data[i] = std::sqrt(alpha_prod_t) * model_output_data[i] + std::sqrt(beta_prod_t) * sample_data[i];
-            }
+            v_output_coeff = std::sqrt(alpha_prod_t);
+            v_sample_coeff = std::sqrt(beta_prod_t);
             break;
         default:
             OPENVINO_THROW("Unsupported value for 'PredictionType'");
     }
 
-    ov::Tensor prev_sample = ov::Tensor(model_output.get_element_type(), model_output.get_shape());
-    float* prev_sample_data = prev_sample.data<float>();
+    const float prev_output_coeff = (alpha_prod_t_prev - alpha_prod_t) / model_output_denom_coeff;
+    float* ets_last_data = ets_last ? ets_last.data<float>() : nullptr;
+    float* prev_sample_data = sample.data<float>();
 
-    for (size_t i = 0; i < prev_sample.get_size(); ++i) {
-        prev_sample_data[i] = sample_coeff * sample_data[i] - (alpha_prod_t_prev - alpha_prod_t) * model_output_data[i] / model_output_denom_coeff;
-    }
+    kernels::for_each_guided_noise(model_output, sample.get_size(), guidance_scale, [&](size_t i, float output) {
+        if (ets_last_data)
+            ets_last_data[i] = output;
 
-    return prev_sample;
+        float combined_output = model_output_coeff * output;
+        for (const auto& [ets_data, ets_coeff] : prev_ets)
+            combined_output += ets_coeff * ets_data[i];
+
+        const float sample_value = sample_data[i];
+        combined_output = v_output_coeff * combined_output + v_sample_coeff * sample_value;
+        prev_sample_data[i] = sample_coeff * sample_value - prev_output_coeff * combined_output;
+    });
+
+    if (ets_last)
+        m_ets.push_back(ets_last);
+    if (m_counter == 1)
+        m_cur_sample = ov::Tensor(ov::element::f32, {});
+    m_counter++;
+
+    std::map<std::string, ov::Tensor> result{{"latent", sample}};
+    return result;
 }
 
 void PNDMScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const {
@@ -272,10 +273,6 @@ std::vector<int64_t> PNDMScheduler::get_timesteps() const {
     return m_timesteps;
 }
 
-void PNDMScheduler::scale_model_input(ov::Tensor sample, size_t inference_step) {
-    return;
-}
-
 float PNDMScheduler::get_init_noise_sigma() const {
     return 1.0f;
 }
@@ -32,15 +32,15 @@ public:
     explicit PNDMScheduler(const std::filesystem::path& scheduler_config_path);
     explicit PNDMScheduler(const Config& scheduler_config);
 
+    std::shared_ptr<IScheduler> clone() const override;
+
     void set_timesteps(size_t num_inference_steps, float strength) override;
 
     std::vector<std::int64_t> get_timesteps() const override;
 
     float get_init_noise_sigma() const override;
 
-    void scale_model_input(ov::Tensor sample, size_t inference_step) override;
-
-    std::map<std::string, ov::Tensor> step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) override;
+    std::map<std::string, ov::Tensor> guided_step(ov::Tensor noise_pred, ov::Tensor latents, float guidance_scale, size_t inference_step, std::shared_ptr<Generator> generator) override;
 
     void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t timestep) const override;
 
@@ -59,8 +59,7 @@ private:
 
     ov::Tensor m_cur_sample;
 
-    std::map<std::string, ov::Tensor> step_plms(ov::Tensor model_output, ov::Tensor sample, size_t timestep);
-    ov::Tensor get_prev_sample(ov::Tensor sample, size_t timestep, int prev_timestep, ov::Tensor model_output);
+    std::map<std::string, ov::Tensor> step_plms(ov::Tensor model_output, ov::Tensor sample, float guidance_scale, size_t timestep);
 };
 
 } // namespace genai
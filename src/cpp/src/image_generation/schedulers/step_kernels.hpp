@@ -0,0 +1,80 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace genai {
+namespace kernels {
+
+// element-wise loops over smaller tensors are not split between threads, threading overhead exceeds the gain
+constexpr size_t PARALLEL_GRAIN_SIZE = 16384;
+
+// calls body(begin, end) for chunks of [0, size) in parallel, plain loops inside a chunk are vectorized by a compiler
+template <typename Body>
+void parallel_chunks(size_t size, const Body& body) {
+    const size_t num_chunks = std::max<size_t>(1, size / PARALLEL_GRAIN_SIZE);
+    if (num_chunks == 1) {
+        body(size_t{0}, size);
+        return;
+    }
+
+    ov::parallel_for(num_chunks, [&](size_t chunk) {
+        size_t begin = 0, end = 0;
+        ov::splitter(size, num_chunks, chunk, begin, end);
+        body(begin, end);
+    });
+}
+
+/**
+ * Calls body(i, noise) for each element of latents, where noise is a noise prediction with classifier-free guidance
+ * applied on the fly: if `noise_pred` has twice more elements than latents, its halves along the batch dimension
+ * are unconditional and text conditioned predictions.
+ */
+template <typename Body>
+void for_each_guided_noise(const ov::Tensor& noise_pred, size_t latent_size, float guidance_scale, const Body& body) {
+    const size_t noise_size = noise_pred.get_size();
+    OPENVINO_ASSERT(noise_size == latent_size || noise_size == 2 * latent_size,
+                    "Noise prediction size ", noise_size, " doesn't match latent size ", latent_size);
+
+    const float* noise_uncond = noise_pred.data<const float>();
+    if (noise_size == latent_size) {
+        parallel_chunks(latent_size, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+                body(i, noise_uncond[i]);
+        });
+    } else {
+        const float* noise_text = noise_uncond + latent_size;
+        parallel_chunks(latent_size, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+                body(i, noise_uncond[i] + guidance_scale * (noise_text[i] - noise_uncond[i]));
+        });
+    }
+}
+
+// writes `src` multiplied by `scale` to each of dst.get_size() / src.get_size() consecutive parts of `dst` in one pass
+inline void repeat_scaled(const ov::Tensor& src, ov::Tensor& dst, float scale) {
+    const size_t src_size = src.get_size(), num_repeats = dst.get_size() / src_size;
+    OPENVINO_ASSERT(num_repeats * src_size == dst.get_size(), "Destination size must be a multiple of source size");
+
+    const float* src_data = src.data<const float>();
+    float* dst_data = dst.data<float>();
+    parallel_chunks(src_size, [&](size_t begin, size_t end) {
+        for (size_t n = 0; n < num_repeats; ++n) {
+            float* dst_part = dst_data + n * src_size;
+            for (size_t i = begin; i < end; ++i)
+                dst_part[i] = src_data[i] * scale;
+        }
+    });
+}
+
+} // namespace kernels
+} // namespace genai
+} // namespace ov
@@ -427,6 +427,23 @@ public:
         OPENVINO_THROW("LORA adapters are not implemented for Stable Diffusion 3 yet");
     }
 
+    void set_text_encoder_cache_capacity(size_t capacity) override {
+        m_clip_text_encoder_1->set_cache_capacity(capacity);
+        m_clip_text_encoder_2->set_cache_capacity(capacity);
+        if (m_t5_text_encoder) {
+            m_t5_text_encoder->set_cache_capacity(capacity);
+        }
+    }
+
+    TextEncoderCacheStats get_text_encoder_cache_stats() const override {
+        TextEncoderCacheStats stats = m_clip_text_encoder_1->get_cache_stats();
+        stats += m_clip_text_encoder_2->get_cache_stats();
+        if (m_t5_text_encoder) {
+            stats += m_t5_text_encoder->get_cache_stats();
+        }
+        return stats;
+    }
+
     ov::Tensor generate(const std::string& positive_prompt,
                         ov::Tensor initial_image,
                         ov::Tensor mask_image,
@@ -465,56 +482,44 @@ public:
 
         ov::Shape latent_shape_cfg = latent.get_shape();
         latent_shape_cfg[0] *= batch_size_multiplier;
-        ov::Tensor latent_cfg(ov::element::f32, latent_shape_cfg);
+        ov::Tensor latent_cfg = batch_size_multiplier > 1 ? ov::Tensor(ov::element::f32, latent_shape_cfg) : latent;
 
-        // 6. Denoising loop
-        ov::Tensor noisy_residual_tensor(ov::element::f32, {});
+        m_perf_metrics = ImageGenerationPerfMetrics();
+        auto& raw_perf_metrics = m_perf_metrics.raw_metrics;
 
+        // 6. Denoising loop
         for (size_t inference_step = 0; inference_step < timesteps.size(); ++inference_step) {
-            // concat the same latent twice along a batch dimension in case of CFG
+            auto step_start = std::chrono::steady_clock::now();
+
+            // concat the same latent twice along a batch dimension in case of CFG, otherwise latent is passed as is
             if (batch_size_multiplier > 1) {
-                numpy_utils::batch_copy(latent, latent_cfg, 0, 0, generation_config.num_images_per_prompt);
-                numpy_utils::batch_copy(latent, latent_cfg, 0, generation_config.num_images_per_prompt, generation_config.num_images_per_prompt);
-            } else {
-                // just assign to save memory copy
-                latent_cfg = latent;
+                kernels::repeat_scaled(latent, latent_cfg, 1.0f);
             }
 
             ov::Tensor timestep(ov::element::f32, {1}, &timesteps[inference_step]);
-            ov::Tensor noise_pred_tensor = m_transformer->infer(latent_cfg, timestep);
-
-            ov::Shape noise_pred_shape = noise_pred_tensor.get_shape();
-            noise_pred_shape[0] /= batch_size_multiplier;
-
-            if (batch_size_multiplier > 1) {
-                noisy_residual_tensor.set_shape(noise_pred_shape);
 
-                // perform guidance
-                float* noisy_residual = noisy_residual_tensor.data<float>();
-                const float* noise_pred_uncond = noise_pred_tensor.data<const float>();
-                const float* noise_pred_text = noise_pred_uncond + noisy_residual_tensor.get_size();
-
-                for (size_t i = 0; i < noisy_residual_tensor.get_size(); ++i) {
-                    noisy_residual[i] = noise_pred_uncond[i] +
-                                        generation_config.guidance_scale * (noise_pred_text[i] - noise_pred_uncond[i]);
-                }
-            } else {
-                noisy_residual_tensor = noise_pred_tensor;
-            }
+            auto infer_start = std::chrono::steady_clock::now();
+            ov::Tensor noise_pred_tensor = m_transformer->infer(latent_cfg, timestep);
+            auto infer_end = std::chrono::steady_clock::now();
 
-            auto scheduler_step_result = m_scheduler->step(noisy_residual_tensor, latent, inference_step, generation_config.generator);
+            // perform guidance and scheduler step in one pass, latent is updated in place
+            auto scheduler_step_result = m_scheduler->guided_step(noise_pred_tensor, latent, generation_config.guidance_scale, inference_step, generation_config.generator);
             latent = scheduler_step_result["latent"];
 
+            auto step_end = std::chrono::steady_clock::now();
+            raw_perf_metrics.step_inference_durations.emplace_back(infer_end - infer_start);
+            raw_perf_metrics.step_host_durations.emplace_back((infer_start - step_start) + (step_end - infer_end));
+
             if (callback && callback(inference_step, timesteps.size(), latent)) {
                 return ov::Tensor(ov::element::u8, {});
             }
         }
 
-        return decode(latent);
+        return m_vae->decode(latent, get_vae_tiling_config(generation_config));
     }
 
     ov::Tensor decode(const ov::Tensor latent) override {
-        return m_vae->decode(latent);
+        return m_vae->decode(latent, get_vae_tiling_config(m_generation_config));
     }
 
 private:
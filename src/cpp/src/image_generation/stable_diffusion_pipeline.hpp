@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <filesystem>
 
 #include "image_generation/diffusion_pipeline.hpp"
+#include "image_generation/resolution_buckets.hpp"
 #include "image_generation/numpy_utils.hpp"
 #include "image_generation/image_processor.hpp"
 
@@ -166,14 +169,49 @@ public:
         m_clip_text_encoder->reshape(batch_size_multiplier);
         m_unet->reshape(num_images_per_prompt * batch_size_multiplier, height, width, m_clip_text_encoder->get_config().max_position_embeddings);
         m_vae->reshape(num_images_per_prompt, height, width);
+        m_resolution_buckets.clear();
+    }
+
+    void reshape_resolution_buckets(const int num_images_per_prompt,
+                                    const std::vector<std::pair<int, int>>& resolutions,
+                                    const float guidance_scale,
+                                    const bool compile_lazily) override {
+        OPENVINO_ASSERT(!resolutions.empty(), "At least one resolution bucket must be specified");
+
+        const size_t batch_size_multiplier = m_unet->do_classifier_free_guidance(guidance_scale) ? 2 : 1;  // Unet accepts 2x batch in case of CFG
+        m_clip_text_encoder->reshape(batch_size_multiplier);
+
+        ResolutionBuckets<DenoisingModels> buckets(compile_lazily);
+        for (const auto& [height, width] : resolutions) {
+            check_image_size(height, width);
+
+            // models of all buckets are cloned from the same not compiled models and share their weights
+            DenoisingModels models;
+            models.unet = std::make_shared<UNet2DConditionModel>(m_unet->clone());
+            models.unet->reshape(num_images_per_prompt * batch_size_multiplier, height, width, m_clip_text_encoder->get_config().max_position_embeddings);
+            models.vae = std::make_shared<AutoencoderKL>(m_vae->clone());
+            models.vae->reshape(num_images_per_prompt, height, width);
+            buckets.add(height, width, std::move(models));
+        }
+
+        m_resolution_buckets = std::move(buckets);
+        m_unet = m_resolution_buckets.front().unet;
+        m_vae = m_resolution_buckets.front().vae;
+
+        // the first bucket is used when a resolution is not specified in generate
+        m_generation_config.height = resolutions.front().first;
+        m_generation_config.width = resolutions.front().second;
+    }
+
+    std::vector<ResolutionBucketStats> get_resolution_bucket_stats() const override {
+        return m_resolution_buckets.get_stats();
     }
 
     void compile(const std::string& device, const ov::AnyMap& properties) override {
         update_adapters_from_properties(properties, m_generation_config.adapters);
 
         m_clip_text_encoder->compile(device, properties);
-        m_unet->compile(device, properties);
-        m_vae->compile(device, properties);
+        compile_denoising_models(device, properties);
     }
 
     void compute_hidden_states(const std::string& positive_prompt, const ImageGenerationConfig& generation_config) override {
@@ -233,7 +271,7 @@ public:
             // - inpainting with strength < 1.0
             // - inpainting with non-specialized model
             if (!is_strength_max || return_image_latent) {
-                image_latent = m_vae->encode(proccesed_image, generation_config.generator);
+                image_latent = m_vae->encode(proccesed_image, generation_config.generator, get_vae_tiling_config(generation_config));
 
                 // in case of image to image or inpaining with strength < 1.0, we need to initialize initial latent with image_latent
                 if (!is_strength_max) {
@@ -291,7 +329,7 @@ public:
             }
 
             // encode masked image to latent scape
-            masked_image_latent = m_vae->encode(masked_image, generation_config.generator);
+            masked_image_latent = m_vae->encode(masked_image, generation_config.generator, get_vae_tiling_config(generation_config));
             masked_image_latent = numpy_utils::repeat(masked_image_latent, generation_config.num_images_per_prompt * batch_size_multiplier);
         }
 
@@ -303,6 +341,14 @@ public:
         m_unet->set_adapters(adapters);
     }
 
+    void set_text_encoder_cache_capacity(size_t capacity) override {
+        m_clip_text_encoder->set_cache_capacity(capacity);
+    }
+
+    TextEncoderCacheStats get_text_encoder_cache_stats() const override {
+        return m_clip_text_encoder->get_cache_stats();
+    }
+
     ov::Tensor generate(const std::string& positive_prompt,
                         ov::Tensor initial_image,
                         ov::Tensor mask_image,
@@ -332,6 +378,11 @@ public:
 
         check_inputs(generation_config, initial_image);
 
+        std::optional<MicroSeconds> model_switch_duration;
+        if (!m_resolution_buckets.empty()) {
+            model_switch_duration = switch_resolution_bucket(generation_config.height, generation_config.width);
+        }
+
         set_lora_adapters(generation_config.adapters);
 
         m_scheduler->set_timesteps(generation_config.num_inference_steps, generation_config.strength);
@@ -354,41 +405,35 @@ public:
         ov::Shape latent_shape_cfg = latent.get_shape();
         latent_shape_cfg[0] *= batch_size_multiplier;
 
-        ov::Tensor latent_cfg(ov::element::f32, latent_shape_cfg), denoised, noisy_residual_tensor(ov::element::f32, {}), latent_model_input;
+        ov::Tensor latent_cfg(ov::element::f32, latent_shape_cfg), denoised;
+
+        m_perf_metrics = ImageGenerationPerfMetrics();
+        auto& raw_perf_metrics = m_perf_metrics.raw_metrics;
+        if (model_switch_duration) {
+            raw_perf_metrics.model_switch_durations.push_back(*model_switch_duration);
+        }
 
         for (size_t inference_step = 0; inference_step < timesteps.size(); inference_step++) {
-            numpy_utils::batch_copy(latent, latent_cfg, 0, 0, generation_config.num_images_per_prompt);
-            // concat the same latent twice along a batch dimension in case of CFG
-            if (batch_size_multiplier > 1) {
-                numpy_utils::batch_copy(latent, latent_cfg, 0, generation_config.num_images_per_prompt, generation_config.num_images_per_prompt);
+            auto step_start = std::chrono::steady_clock::now();
+
+            // concat the same scaled latent twice along a batch dimension in case of CFG in one pass,
+            // latent is passed as is when neither copy nor scaling is needed
+            const float model_input_scale = m_scheduler->get_model_input_scale(inference_step);
+            ov::Tensor latent_scaled = latent;
+            if (batch_size_multiplier > 1 || model_input_scale != 1.0f) {
+                kernels::repeat_scaled(latent, latent_cfg, model_input_scale);
+                latent_scaled = latent_cfg;
             }
 
-            m_scheduler->scale_model_input(latent_cfg, inference_step);
-
-            ov::Tensor latent_model_input = is_inpainting_model() ? numpy_utils::concat(numpy_utils::concat(latent_cfg, mask, 1), masked_image_latent, 1) : latent_cfg;
+            ov::Tensor latent_model_input = is_inpainting_model() ? numpy_utils::concat(numpy_utils::concat(latent_scaled, mask, 1), masked_image_latent, 1) : latent_scaled;
             ov::Tensor timestep(ov::element::i64, {1}, &timesteps[inference_step]);
-            ov::Tensor noise_pred_tensor = m_unet->infer(latent_model_input, timestep);
 
-            ov::Shape noise_pred_shape = noise_pred_tensor.get_shape();
-            noise_pred_shape[0] /= batch_size_multiplier;
- 
-            if (batch_size_multiplier > 1) {
-                noisy_residual_tensor.set_shape(noise_pred_shape);
-
-                // perform guidance
-                float* noisy_residual = noisy_residual_tensor.data<float>();
-                const float* noise_pred_uncond = noise_pred_tensor.data<const float>();
-                const float* noise_pred_text = noise_pred_uncond + noisy_residual_tensor.get_size();
-
-                for (size_t i = 0; i < noisy_residual_tensor.get_size(); ++i) {
-                    noisy_residual[i] = noise_pred_uncond[i] +
-                        generation_config.guidance_scale * (noise_pred_text[i] - noise_pred_uncond[i]);
-                }
-            } else {
-                noisy_residual_tensor = noise_pred_tensor;
-            }
+            auto infer_start = std::chrono::steady_clock::now();
+            ov::Tensor noise_pred_tensor = m_unet->infer(latent_model_input, timestep);
+            auto infer_end = std::chrono::steady_clock::now();
 
-            auto scheduler_step_result = m_scheduler->step(noisy_residual_tensor, latent, inference_step, generation_config.generator);
+            // perform guidance and scheduler step in one pass, latent is updated in place
+            auto scheduler_step_result = m_scheduler->guided_step(noise_pred_tensor, latent, generation_config.guidance_scale, inference_step, generation_config.generator);
             latent = scheduler_step_result["latent"];
 
             // in case of non-specialized inpainting model, we need manually mask current denoised latent and initial image latent
@@ -400,25 +445,269 @@ public:
             const auto it = scheduler_step_result.find("denoised");
             denoised = it != scheduler_step_result.end() ? it->second : latent;
 
+            auto step_end = std::chrono::steady_clock::now();
+            raw_perf_metrics.step_inference_durations.emplace_back(infer_end - infer_start);
+            raw_perf_metrics.step_host_durations.emplace_back((infer_start - step_start) + (step_end - infer_end));
+
             if (callback && callback(inference_step, timesteps.size(), denoised)) {
                 return ov::Tensor(ov::element::u8, {});
             }
         }
 
-        return decode(denoised);
+        return m_vae->decode(denoised, get_vae_tiling_config(generation_config));
     }
 
     ov::Tensor decode(const ov::Tensor latent) override {
-        return m_vae->decode(latent);
+        return m_vae->decode(latent, get_vae_tiling_config(m_generation_config));
+    }
+
+    ImageGenerationConfig resolve_batch_request_config(const ov::AnyMap& properties) override {
+        OPENVINO_ASSERT(m_pipeline_type == PipelineType::TEXT_2_IMAGE, "Batched generation is supported by text to image pipeline only");
+        ImageGenerationConfig config = m_generation_config;
+        config.update_generation_config(properties);
+
+        if (config.height < 0)
+            compute_dim(config.height, {}, 1 /* assume NHWC */);
+        if (config.width < 0)
+            compute_dim(config.width, {}, 2 /* assume NHWC */);
+
+        check_inputs(config, {});
+        return config;
+    }
+
+    std::vector<ov::Tensor> generate_batch(const std::vector<std::string>& positive_prompts,
+                                           const std::vector<ov::AnyMap>& properties) override {
+        OPENVINO_ASSERT(m_pipeline_type == PipelineType::TEXT_2_IMAGE, "Batched generation is supported by text to image pipeline only");
+        OPENVINO_ASSERT(!positive_prompts.empty() && positive_prompts.size() == properties.size(),
+            "Number of prompts ", positive_prompts.size(), " must be positive and equal to number of properties ", properties.size());
+
+        const auto& unet_config = m_unet->get_config();
+        const size_t vae_scale_factor = m_vae->get_vae_scale_factor();
+        const bool is_lcm = unet_config.time_cond_proj_dim >= 0;
+
+        // each request has its own scheduler state, random generator and guidance scale
+        struct Request {
+            ImageGenerationConfig config;
+            std::function<bool(size_t, size_t, ov::Tensor&)> callback = nullptr;
+            std::shared_ptr<IScheduler> scheduler;
+            size_t batch_size_multiplier = 1;
+            // the same layout as for a single request: unconditional rows are followed by text conditioned ones
+            ov::Tensor encoder_hidden_states;
+            ov::Tensor latent, denoised;
+            bool is_active = true;
+
+            size_t num_rows() const {
+                return batch_size_multiplier * config.num_images_per_prompt;
+            }
+        };
+
+        std::vector<Request> requests(positive_prompts.size());
+        for (size_t r = 0; r < requests.size(); ++r) {
+            Request& request = requests[r];
+            request.config = resolve_batch_request_config(properties[r]);
+
+            auto callback_iter = properties[r].find(ov::genai::callback.name());
+            if (callback_iter != properties[r].end()) {
+                request.callback = callback_iter->second.as<std::function<bool(size_t, size_t, ov::Tensor&)>>();
+            }
+
+            OPENVINO_ASSERT(are_batchable(requests.front().config, request.config), "Request ", r, " can't be batched with request 0: ",
+                "resolution, number of inference steps and LoRA adapters must be the same");
+
+            request.batch_size_multiplier = m_unet->do_classifier_free_guidance(request.config.guidance_scale) ? 2 : 1;
+            request.scheduler = m_scheduler->clone();
+            request.scheduler->set_timesteps(request.config.num_inference_steps, request.config.strength);
+        }
+
+        std::optional<MicroSeconds> model_switch_duration;
+        if (!m_resolution_buckets.empty()) {
+            model_switch_duration = switch_resolution_bucket(requests.front().config.height, requests.front().config.width);
+        }
+
+        set_lora_adapters(requests.front().config.adapters);
+        std::vector<std::int64_t> timesteps = requests.front().scheduler->get_timesteps();
+
+        const ov::Shape image_latent_shape{m_vae->get_config().latent_channels,
+                                           requests.front().config.height / vae_scale_factor,
+                                           requests.front().config.width / vae_scale_factor};
+        auto get_rows_shape = [&] (size_t num_rows) {
+            ov::Shape shape = image_latent_shape;
+            shape.insert(shape.begin(), num_rows);
+            return shape;
+        };
+
+        for (size_t r = 0; r < requests.size(); ++r) {
+            Request& request = requests[r];
+            const size_t num_images = request.config.num_images_per_prompt;
+
+            // text encoder output is overwritten by the next inference, so it's copied to a request own tensor
+            std::string negative_prompt = request.config.negative_prompt != std::nullopt ? *request.config.negative_prompt : std::string{};
+            ov::Tensor text_embeddings = m_clip_text_encoder->infer(positive_prompts[r], negative_prompt, request.batch_size_multiplier > 1);
+
+            ov::Shape hidden_states_shape = text_embeddings.get_shape();
+            hidden_states_shape[0] *= num_images;
+            request.encoder_hidden_states = ov::Tensor(text_embeddings.get_element_type(), hidden_states_shape);
+            for (size_t n = 0; n < num_images; ++n) {
+                numpy_utils::batch_copy(text_embeddings, request.encoder_hidden_states, 0, n);
+                if (request.batch_size_multiplier > 1) {
+                    numpy_utils::batch_copy(text_embeddings, request.encoder_hidden_states, 1, num_images + n);
+                }
+            }
+
+            request.latent = request.config.generator->randn_tensor(get_rows_shape(num_images));
+            kernels::repeat_scaled(request.latent, request.latent, request.scheduler->get_init_noise_sigma());
+        }
+
+        // concatenates conditioning of active requests, must be called when a request leaves the batch
+        auto set_batched_hidden_states = [&] () {
+            size_t num_rows = 0;
+            ov::Tensor first_hidden_states;
+            for (const Request& request : requests) {
+                if (request.is_active) {
+                    num_rows += request.num_rows();
+                    first_hidden_states = first_hidden_states ? first_hidden_states : request.encoder_hidden_states;
+                }
+            }
+
+            ov::Shape hidden_states_shape = first_hidden_states.get_shape();
+            hidden_states_shape[0] = num_rows;
+            ov::Tensor encoder_hidden_states(first_hidden_states.get_element_type(), hidden_states_shape), timestep_cond;
+            if (is_lcm) {
+                timestep_cond = ov::Tensor(ov::element::f32, {num_rows, static_cast<size_t>(unet_config.time_cond_proj_dim)});
+            }
+
+            size_t row = 0;
+            for (const Request& request : requests) {
+                if (!request.is_active)
+                    continue;
+
+                numpy_utils::batch_copy(request.encoder_hidden_states, encoder_hidden_states, 0, row, request.num_rows());
+                if (is_lcm) {
+                    ov::Tensor guidance_embedding = get_guidance_scale_embedding(request.config.guidance_scale - 1.0f, unet_config.time_cond_proj_dim);
+                    for (size_t n = 0; n < request.num_rows(); ++n) {
+                        numpy_utils::batch_copy(guidance_embedding, timestep_cond, 0, row + n);
+                    }
+                }
+                row += request.num_rows();
+            }
+
+            m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states);
+            if (is_lcm) {
+                m_unet->set_hidden_states("timestep_cond", timestep_cond);
+            }
+            return num_rows;
+        };
+
+        m_perf_metrics = ImageGenerationPerfMetrics();
+        auto& raw_perf_metrics = m_perf_metrics.raw_metrics;
+        if (model_switch_duration) {
+            raw_perf_metrics.model_switch_durations.push_back(*model_switch_duration);
+        }
+
+        ov::Tensor latent_model_input;
+        bool is_batch_changed = true;
+        for (size_t inference_step = 0; inference_step < timesteps.size(); inference_step++) {
+            auto step_start = std::chrono::steady_clock::now();
+
+            if (is_batch_changed) {
+                latent_model_input = ov::Tensor(ov::element::f32, get_rows_shape(set_batched_hidden_states()));
+                is_batch_changed = false;
+            }
+
+            // scaled latents of all requests are written to their rows of model input, repeated in case of CFG
+            float* input_data = latent_model_input.data<float>();
+            for (Request& request : requests) {
+                if (!request.is_active)
+                    continue;
+
+                ov::Tensor request_input(ov::element::f32, get_rows_shape(request.num_rows()), input_data);
+                kernels::repeat_scaled(request.latent, request_input, request.scheduler->get_model_input_scale(inference_step));
+                input_data += request_input.get_size();
+            }
+
+            ov::Tensor timestep(ov::element::i64, {1}, &timesteps[inference_step]);
+
+            auto infer_start = std::chrono::steady_clock::now();
+            ov::Tensor noise_pred_tensor = m_unet->infer(latent_model_input, timestep);
+            auto infer_end = std::chrono::steady_clock::now();
+
+            // each request applies its guidance scale and steps its scheduler on its rows of noise prediction
+            float* noise_pred_data = noise_pred_tensor.data<float>();
+            for (Request& request : requests) {
+                if (!request.is_active)
+                    continue;
+
+                ov::Tensor request_noise_pred(ov::element::f32, get_rows_shape(request.num_rows()), noise_pred_data);
+                noise_pred_data += request_noise_pred.get_size();
+
+                auto scheduler_step_result = request.scheduler->guided_step(request_noise_pred, request.latent,
+                    request.config.guidance_scale, inference_step, request.config.generator);
+                request.latent = scheduler_step_result["latent"];
+
+                const auto it = scheduler_step_result.find("denoised");
+                request.denoised = it != scheduler_step_result.end() ? it->second : request.latent;
+            }
+
+            auto step_end = std::chrono::steady_clock::now();
+            raw_perf_metrics.step_inference_durations.emplace_back(infer_end - infer_start);
+            raw_perf_metrics.step_host_durations.emplace_back((infer_start - step_start) + (step_end - infer_end));
+
+            bool has_active_requests = false;
+            for (Request& request : requests) {
+                if (request.is_active && request.callback && request.callback(inference_step, timesteps.size(), request.denoised)) {
+                    request.is_active = false;
+                    is_batch_changed = true;
+                }
+                has_active_requests = has_active_requests || request.is_active;
+            }
+
+            if (!has_active_requests)
+                break;
+        }
+
+        std::vector<ov::Tensor> images;
+        for (const Request& request : requests) {
+            images.push_back(request.is_active ? m_vae->decode(request.denoised, get_vae_tiling_config(request.config)) : ov::Tensor(ov::element::u8, {}));
+        }
+        return images;
     }
 
 protected:
+    // UNet and VAE models of a resolution bucket, m_unet and m_vae point to models of the current bucket
+    struct DenoisingModels {
+        std::shared_ptr<UNet2DConditionModel> unet;
+        std::shared_ptr<AutoencoderKL> vae;
+    };
+
     bool is_inpainting_model() const {
         assert(m_unet != nullptr);
         assert(m_vae != nullptr);
         return m_unet->get_config().in_channels == (m_vae->get_config().latent_channels * 2 + 1);
     }
 
+    // compiles UNet and VAE, or models of resolution buckets if the pipeline is reshaped to several resolutions
+    void compile_denoising_models(const std::string& device, const ov::AnyMap& properties) {
+        if (m_resolution_buckets.empty()) {
+            m_unet->compile(device, properties);
+            m_vae->compile(device, properties);
+            return;
+        }
+
+        m_resolution_buckets.compile([device, properties](DenoisingModels& models) {
+            models.unet->compile(device, properties);
+            models.vae->compile(device, properties);
+        });
+    }
+
+    // makes models of a bucket with the given resolution current ones, compiles them if needed and returns switch duration
+    MicroSeconds switch_resolution_bucket(int64_t height, int64_t width) {
+        MicroSeconds switch_duration{0};
+        const DenoisingModels& models = m_resolution_buckets.select(height, width, switch_duration);
+        m_unet = models.unet;
+        m_vae = models.vae;
+        return switch_duration;
+    }
+
     void compute_dim(int64_t & generation_config_value, ov::Tensor initial_image, int dim_idx) {
         const size_t vae_scale_factor = m_vae->get_vae_scale_factor();
         const auto& unet_config = m_unet->get_config();
@@ -505,6 +794,8 @@ protected:
     std::shared_ptr<AutoencoderKL> m_vae = nullptr;
     std::shared_ptr<IImageProcessor> m_image_processor = nullptr, m_mask_processor_rgb = nullptr, m_mask_processor_gray = nullptr;
     std::shared_ptr<ImageResizer> m_image_resizer = nullptr, m_mask_resizer = nullptr;
+
+    ResolutionBuckets<DenoisingModels> m_resolution_buckets;
 };
 
 }  // namespace genai
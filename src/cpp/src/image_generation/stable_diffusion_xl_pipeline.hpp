@@ -133,6 +133,16 @@ public:
         m_clip_text_encoder_with_projection->reshape(batch_size_multiplier);
         m_unet->reshape(num_images_per_prompt * batch_size_multiplier, height, width, m_clip_text_encoder->get_config().max_position_embeddings);
         m_vae->reshape(num_images_per_prompt, height, width);
+        m_resolution_buckets.clear();
+    }
+
+    void reshape_resolution_buckets(const int num_images_per_prompt,
+                                    const std::vector<std::pair<int, int>>& resolutions,
+                                    const float guidance_scale,
+                                    const bool compile_lazily) override {
+        const size_t batch_size_multiplier = m_unet->do_classifier_free_guidance(guidance_scale) ? 2 : 1;  // Unet accepts 2x batch in case of CFG
+        m_clip_text_encoder_with_projection->reshape(batch_size_multiplier);
+        StableDiffusionPipeline::reshape_resolution_buckets(num_images_per_prompt, resolutions, guidance_scale, compile_lazily);
     }
 
     void compile(const std::string& device, const ov::AnyMap& properties) override {
@@ -140,8 +150,7 @@ public:
 
         m_clip_text_encoder->compile(device, properties);
         m_clip_text_encoder_with_projection->compile(device, properties);
-        m_unet->compile(device, properties);
-        m_vae->compile(device, properties);
+        compile_denoising_models(device, properties);
     }
 
     void compute_hidden_states(const std::string& positive_prompt, const ImageGenerationConfig& generation_config) override {
@@ -293,6 +302,22 @@ public:
         m_unet->set_adapters(adapters);
     }
 
+    std::vector<ov::Tensor> generate_batch(const std::vector<std::string>& positive_prompts,
+                                           const std::vector<ov::AnyMap>& properties) override {
+        OPENVINO_THROW("Batched generation of several requests is not supported by Stable Diffusion XL pipeline yet");
+    }
+
+    void set_text_encoder_cache_capacity(size_t capacity) override {
+        m_clip_text_encoder->set_cache_capacity(capacity);
+        m_clip_text_encoder_with_projection->set_cache_capacity(capacity);
+    }
+
+    TextEncoderCacheStats get_text_encoder_cache_stats() const override {
+        TextEncoderCacheStats stats = m_clip_text_encoder->get_cache_stats();
+        stats += m_clip_text_encoder_with_projection->get_cache_stats();
+        return stats;
+    }
+
 private:
     void initialize_generation_config(const std::string& class_name) override {
         assert(m_unet != nullptr);
@@ -181,6 +181,13 @@ void Text2ImagePipeline::reshape(const int num_images_per_prompt, const int heig
     m_impl->reshape(num_images_per_prompt, height, width, guidance_scale);
 }
 
+void Text2ImagePipeline::reshape(const int num_images_per_prompt,
+                    const std::vector<std::pair<int, int>>& resolutions,
+                    const float guidance_scale,
+                    const bool compile_lazily) {
+    m_impl->reshape_resolution_buckets(num_images_per_prompt, resolutions, guidance_scale, compile_lazily);
+}
+
 void Text2ImagePipeline::compile(const std::string& device, const ov::AnyMap& properties) {
     m_impl->compile(device, properties);
 }
@@ -189,9 +196,29 @@ ov::Tensor Text2ImagePipeline::generate(const std::string& positive_prompt, cons
     return m_impl->generate(positive_prompt, {}, {}, properties);
 }
 
+std::vector<ov::Tensor> Text2ImagePipeline::generate_batch(const std::vector<std::string>& positive_prompts, const std::vector<ov::AnyMap>& properties) {
+    return m_impl->generate_batch(positive_prompts, properties);
+}
+
 ov::Tensor Text2ImagePipeline::decode(const ov::Tensor latent) {
     return m_impl->decode(latent);
 }
 
+ImageGenerationPerfMetrics Text2ImagePipeline::get_performance_metrics() const {
+    return m_impl->get_performance_metrics();
+}
+
+void Text2ImagePipeline::set_text_encoder_cache_capacity(size_t capacity) {
+    m_impl->set_text_encoder_cache_capacity(capacity);
+}
+
+TextEncoderCacheStats Text2ImagePipeline::get_text_encoder_cache_stats() const {
+    return m_impl->get_text_encoder_cache_stats();
+}
+
+std::vector<ResolutionBucketStats> Text2ImagePipeline::get_resolution_bucket_stats() const {
+    return m_impl->get_resolution_bucket_stats();
+}
+
 }  // namespace genai
 }  // namespace ov
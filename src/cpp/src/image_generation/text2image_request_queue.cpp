@@ -0,0 +1,128 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/image_generation/text2image_request_queue.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "image_generation/diffusion_pipeline.hpp"
+#include "image_generation/request_batching.hpp"
+
+namespace ov {
+namespace genai {
+
+class Text2ImageRequestQueue::Text2ImageRequestQueueImpl {
+    struct Request {
+        std::string positive_prompt;
+        ov::AnyMap properties;
+        // resolved generation config, it's used to find requests which can be batched together
+        ImageGenerationConfig config;
+        std::promise<ov::Tensor> promise;
+    };
+
+    Text2ImagePipeline m_pipeline;
+    // resolves and checks configs of added requests
+    std::shared_ptr<DiffusionPipeline> m_diffusion_pipeline;
+    const size_t m_max_batch_size;
+    const std::chrono::milliseconds m_max_wait_time;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Request> m_requests;
+    bool m_stop = false;
+    std::thread m_worker;
+
+    void run() {
+        while (true) {
+            std::vector<Request> batch;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this] { return m_stop || !m_requests.empty(); });
+                if (m_requests.empty())
+                    return;
+
+                // give concurrent clients a chance to join the batch
+                if (!m_stop && m_requests.size() < m_max_batch_size) {
+                    m_cv.wait_for(lock, m_max_wait_time, [this] { return m_stop || m_requests.size() >= m_max_batch_size; });
+                }
+                batch = take_batch(m_requests, m_max_batch_size);
+            }
+
+            generate_batch_isolating_errors(batch, [&](const std::vector<size_t>& request_indices) {
+                std::vector<std::string> prompts;
+                std::vector<ov::AnyMap> properties;
+                for (size_t index : request_indices) {
+                    prompts.push_back(batch[index].positive_prompt);
+                    properties.push_back(batch[index].properties);
+                }
+                return m_pipeline.generate_batch(prompts, properties);
+            });
+        }
+    }
+
+public:
+    Text2ImageRequestQueueImpl(const Text2ImagePipeline& pipeline,
+                               const std::shared_ptr<DiffusionPipeline>& diffusion_pipeline,
+                               size_t max_batch_size,
+                               std::chrono::milliseconds max_wait_time) :
+        m_pipeline(pipeline),
+        m_diffusion_pipeline(diffusion_pipeline),
+        m_max_batch_size(max_batch_size),
+        m_max_wait_time(max_wait_time) {
+        OPENVINO_ASSERT(max_batch_size > 0, "Max batch size must be positive");
+        m_worker = std::thread([this] { run(); });
+    }
+
+    ~Text2ImageRequestQueueImpl() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_worker.join();
+    }
+
+    std::future<ov::Tensor> add_request(const std::string& positive_prompt, const ov::AnyMap& properties) {
+        Request request;
+        request.positive_prompt = positive_prompt;
+        request.properties = properties;
+        // a request failing the checks of generate_batch would fail the whole batch it's taken to
+        request.config = m_diffusion_pipeline->resolve_batch_request_config(properties);
+        std::future<ov::Tensor> future = request.promise.get_future();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            OPENVINO_ASSERT(!m_stop, "Request queue is being destroyed");
+            m_requests.push_back(std::move(request));
+        }
+        m_cv.notify_all();
+        return future;
+    }
+
+    size_t get_num_waiting_requests() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_requests.size();
+    }
+};
+
+Text2ImageRequestQueue::Text2ImageRequestQueue(const Text2ImagePipeline& pipeline,
+                                               size_t max_batch_size,
+                                               std::chrono::milliseconds max_wait_time) :
+    m_impl(std::make_shared<Text2ImageRequestQueueImpl>(pipeline, pipeline.m_impl, max_batch_size, max_wait_time)) {
+}
+
+Text2ImageRequestQueue::~Text2ImageRequestQueue() = default;
+
+std::future<ov::Tensor> Text2ImageRequestQueue::add_request(const std::string& positive_prompt, const ov::AnyMap& properties) {
+    return m_impl->add_request(positive_prompt, properties);
+}
+
+size_t Text2ImageRequestQueue::get_num_waiting_requests() const {
+    return m_impl->get_num_waiting_requests();
+}
+
+} // namespace genai
+} // namespace ov
@@ -0,0 +1,130 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/vae_tiling.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+
+namespace ov {
+namespace genai {
+
+std::vector<TileRange> split_into_tiles(size_t length, size_t tile_size, size_t overlap) {
+    OPENVINO_ASSERT(tile_size > 0, "Tile size must be positive");
+    if (length <= tile_size) {
+        return {TileRange{0, length, 0, 0}};
+    }
+
+    OPENVINO_ASSERT(overlap < tile_size, "Tile overlap ", overlap, " must be less than tile size ", tile_size);
+    const size_t stride = tile_size - overlap;
+    const size_t num_tiles = (length - overlap + stride - 1) / stride;
+
+    // distribute the slack evenly, so all overlaps are almost the same
+    std::vector<TileRange> tiles(num_tiles);
+    const size_t last_begin = length - tile_size;
+    for (size_t i = 0; i < num_tiles; ++i) {
+        tiles[i].begin = (i * last_begin + (num_tiles - 1) / 2) / (num_tiles - 1);
+        tiles[i].size = tile_size;
+        if (i > 0) {
+            const size_t shared = tiles[i - 1].begin + tile_size - tiles[i].begin;
+            tiles[i].overlap_before = shared;
+            tiles[i - 1].overlap_after = shared;
+        }
+    }
+
+    return tiles;
+}
+
+std::vector<float> get_blending_weights(const TileRange& tile) {
+    std::vector<float> weights(tile.size, 1.0f);
+    for (size_t i = 0; i < tile.overlap_before && i < tile.size; ++i) {
+        weights[i] = (i + 0.5f) / tile.overlap_before;
+    }
+    for (size_t i = 0; i < tile.overlap_after && i < tile.size; ++i) {
+        float& weight = weights[tile.size - 1 - i];
+        weight = std::min(weight, (i + 0.5f) / tile.overlap_after);
+    }
+    return weights;
+}
+
+TileBlender::TileBlender(size_t batch, size_t channels, size_t height, size_t width, bool channels_last)
+    : m_batch(batch),
+      m_channels(channels),
+      m_height(height),
+      m_width(width),
+      m_channels_last(channels_last),
+      m_values(batch * channels * height * width, 0.0f),
+      m_weights(height * width, 0.0f) {
+}
+
+template <typename T>
+void TileBlender::add_tile(const T* tile, const TileRange& tile_y, const TileRange& tile_x) {
+    OPENVINO_ASSERT(tile_y.begin + tile_y.size <= m_height && tile_x.begin + tile_x.size <= m_width,
+                    "Tile is out of blended tensor bounds");
+
+    const std::vector<float> weights_y = get_blending_weights(tile_y), weights_x = get_blending_weights(tile_x);
+    const size_t tile_height = tile_y.size, tile_width = tile_x.size;
+
+    for (size_t y = 0; y < tile_height; ++y) {
+        float* weights = m_weights.data() + (tile_y.begin + y) * m_width + tile_x.begin;
+        for (size_t x = 0; x < tile_width; ++x) {
+            weights[x] += weights_y[y] * weights_x[x];
+        }
+    }
+
+    if (m_channels_last) {
+        ov::parallel_for(m_batch * tile_height, [&](size_t row) {
+            const size_t n = row / tile_height, y = row % tile_height;
+            const T* src = tile + row * tile_width * m_channels;
+            float* dst = m_values.data() + ((n * m_height + tile_y.begin + y) * m_width + tile_x.begin) * m_channels;
+            for (size_t x = 0; x < tile_width; ++x) {
+                const float weight = weights_y[y] * weights_x[x];
+                for (size_t c = 0; c < m_channels; ++c) {
+                    dst[x * m_channels + c] += weight * static_cast<float>(src[x * m_channels + c]);
+                }
+            }
+        });
+    } else {
+        ov::parallel_for(m_batch * m_channels * tile_height, [&](size_t row) {
+            const size_t plane = row / tile_height, y = row % tile_height;
+            const T* src = tile + row * tile_width;
+            float* dst = m_values.data() + (plane * m_height + tile_y.begin + y) * m_width + tile_x.begin;
+            for (size_t x = 0; x < tile_width; ++x) {
+                dst[x] += weights_y[y] * weights_x[x] * static_cast<float>(src[x]);
+            }
+        });
+    }
+}
+
+template <typename T>
+void TileBlender::get_result(T* dst) const {
+    const size_t plane_size = m_height * m_width;
+    ov::parallel_for(m_values.size() / plane_size, [&](size_t plane) {
+        for (size_t i = 0; i < plane_size; ++i) {
+            const size_t index = plane * plane_size + i;
+            const size_t spatial_index = m_channels_last ? (index / m_channels) % plane_size : i;
+            const float value = m_values[index] / m_weights[spatial_index];
+            if constexpr (std::is_integral_v<T>) {
+                const float rounded = std::round(value);
+                dst[index] = static_cast<T>(std::min<float>(std::max<float>(rounded, std::numeric_limits<T>::min()),
+                                                            std::numeric_limits<T>::max()));
+            } else {
+                dst[index] = static_cast<T>(value);
+            }
+        }
+    });
+}
+
+template void TileBlender::add_tile<float>(const float*, const TileRange&, const TileRange&);
+template void TileBlender::add_tile<uint8_t>(const uint8_t*, const TileRange&, const TileRange&);
+template void TileBlender::get_result<float>(float*) const;
+template void TileBlender::get_result<uint8_t>(uint8_t*) const;
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,59 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ov {
+namespace genai {
+
+// A range of elements along one spatial dimension processed by one VAE tile
+struct TileRange {
+    size_t begin = 0;
+    size_t size = 0;
+    // number of elements shared with the previous and the next tiles
+    size_t overlap_before = 0, overlap_after = 0;
+};
+
+/**
+ * Splits [0, length) into the minimal number of tiles of `tile_size` elements, so that neighbour tiles share
+ * at least `overlap` elements. Tiles are distributed evenly and all of them have the same size to reuse
+ * the same model shape. If `length` fits into one tile, a single tile of `length` elements is returned.
+ */
+std::vector<TileRange> split_into_tiles(size_t length, size_t tile_size, size_t overlap);
+
+/**
+ * Blending weights of tile elements: weights linearly ramp up across the overlap with the previous tile
+ * and ramp down across the overlap with the next tile. All weights are positive.
+ */
+std::vector<float> get_blending_weights(const TileRange& tile);
+
+/**
+ * Blends overlapping tiles of a 4D tensor in NCHW or NHWC layout: values of each tile are accumulated with
+ * blending weights of its rows and columns and normalized by the sum of weights of all tiles covering an element,
+ * so seams between tiles are smoothed independently of the order tiles are added in.
+ */
+class TileBlender {
+public:
+    TileBlender(size_t batch, size_t channels, size_t height, size_t width, bool channels_last);
+
+    // `tile` has the same layout and [tile_y.size, tile_x.size] spatial shape
+    template <typename T>
+    void add_tile(const T* tile, const TileRange& tile_y, const TileRange& tile_x);
+
+    // writes blended values to a buffer of the whole tensor size, integer values are rounded and saturated
+    template <typename T>
+    void get_result(T* dst) const;
+
+private:
+    size_t m_batch, m_channels, m_height, m_width;
+    bool m_channels_last;
+    std::vector<float> m_values;
+    // sum of weights of tiles covering each spatial element
+    std::vector<float> m_weights;
+};
+
+}  // namespace genai
+}  // namespace ov
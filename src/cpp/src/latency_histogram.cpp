@@ -0,0 +1,93 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ov::genai {
+
+LatencyHistogram::LatencyHistogram() : m_buckets(NUM_BUCKETS, 0) {
+}
+
+size_t LatencyHistogram::get_bucket(uint64_t microseconds) {
+    if (microseconds < LINEAR_BUCKETS)
+        return microseconds;
+
+    size_t exponent = 0;
+    while ((microseconds >> (exponent + 1)) != 0)
+        ++exponent;
+    if (exponent > MAX_EXPONENT)
+        return NUM_BUCKETS - 1;
+
+    // the leading SUB_BUCKET_BITS + 1 bits of a duration select its bucket within [2^exponent, 2^(exponent + 1))
+    const size_t sub_bucket = (microseconds >> (exponent - SUB_BUCKET_BITS)) - SUB_BUCKETS;
+    return LINEAR_BUCKETS + (exponent - SUB_BUCKET_BITS - 1) * SUB_BUCKETS + sub_bucket;
+}
+
+uint64_t LatencyHistogram::get_value(size_t bucket) {
+    if (bucket < LINEAR_BUCKETS)
+        return bucket;
+
+    const size_t exponent = (bucket - LINEAR_BUCKETS) / SUB_BUCKETS + SUB_BUCKET_BITS + 1;
+    const uint64_t bucket_width = uint64_t{1} << (exponent - SUB_BUCKET_BITS);
+    const uint64_t lower_bound = ((bucket - LINEAR_BUCKETS) % SUB_BUCKETS + SUB_BUCKETS) * bucket_width;
+    return lower_bound + bucket_width / 2;
+}
+
+void LatencyHistogram::record(std::chrono::microseconds duration) {
+    const uint64_t microseconds = static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0));
+    ++m_buckets[get_bucket(microseconds)];
+    ++m_count;
+    m_total += microseconds;
+    m_max = std::max(m_max, microseconds);
+}
+
+size_t LatencyHistogram::get_count() const {
+    return m_count;
+}
+
+std::chrono::microseconds LatencyHistogram::get_quantile(float q) const {
+    if (m_count == 0)
+        return std::chrono::microseconds(0);
+
+    const uint64_t rank = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(std::clamp(q, 0.0f, 1.0f) * m_count)), 1);
+    // the maximum is known exactly
+    if (rank >= m_count)
+        return std::chrono::microseconds(m_max);
+
+    uint64_t num_lower = 0;
+    for (size_t bucket = 0; bucket < NUM_BUCKETS; ++bucket) {
+        num_lower += m_buckets[bucket];
+        if (num_lower >= rank)
+            return std::chrono::microseconds(std::min(get_value(bucket), m_max));
+    }
+    return std::chrono::microseconds(m_max);
+}
+
+LatencyPercentiles LatencyHistogram::get_percentiles() const {
+    auto to_ms = [](std::chrono::microseconds duration) {
+        return std::chrono::duration<float, std::milli>(duration).count();
+    };
+
+    LatencyPercentiles percentiles;
+    percentiles.count = m_count;
+    if (m_count != 0) {
+        percentiles.mean = static_cast<float>(m_total) / m_count / 1000.0f;
+        percentiles.p50 = to_ms(get_quantile(0.5f));
+        percentiles.p90 = to_ms(get_quantile(0.9f));
+        percentiles.p99 = to_ms(get_quantile(0.99f));
+        percentiles.max = to_ms(std::chrono::microseconds(m_max));
+    }
+    return percentiles;
+}
+
+void LatencyHistogram::reset() {
+    std::fill(m_buckets.begin(), m_buckets.end(), 0);
+    m_count = 0;
+    m_total = 0;
+    m_max = 0;
+}
+
+}  // namespace ov::genai
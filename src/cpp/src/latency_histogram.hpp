@@ -0,0 +1,54 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+
+namespace ov::genai {
+
+/**
+ * Streaming estimator of latency quantiles with bounded relative error in the manner of HDR histograms: durations
+ * are counted in buckets which are exact below 32 microseconds and split each power of two range above into 16 equal
+ * buckets. A quantile is estimated by the middle of its bucket, so its relative error is at most 1/32. Recording is O(1)
+ * without allocations and memory is fixed. Not thread-safe.
+ */
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    void record(std::chrono::microseconds duration);
+
+    size_t get_count() const;
+
+    // `q` is in [0, 1], returns 0 if no durations are recorded
+    std::chrono::microseconds get_quantile(float q) const;
+
+    // count, mean, p50, p90, p99 and max in milliseconds
+    LatencyPercentiles get_percentiles() const;
+
+    void reset();
+
+private:
+    static constexpr size_t LINEAR_BUCKETS = 32;
+    static constexpr size_t SUB_BUCKET_BITS = 4;
+    static constexpr size_t SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    // durations above 2^40 microseconds (12 days) are counted in the last bucket
+    static constexpr size_t MAX_EXPONENT = 40;
+    static constexpr size_t NUM_BUCKETS = LINEAR_BUCKETS + (MAX_EXPONENT - SUB_BUCKET_BITS) * SUB_BUCKETS;
+
+    static size_t get_bucket(uint64_t microseconds);
+    // the middle of the bucket
+    static uint64_t get_value(size_t bucket);
+
+    std::vector<uint64_t> m_buckets;
+    uint64_t m_count = 0;
+    uint64_t m_total = 0;
+    uint64_t m_max = 0;
+};
+
+}  // namespace ov::genai
@@ -13,6 +13,7 @@
 #include "openvino/genai/perf_metrics.hpp"
 #include "llm_pipeline_base.hpp"
 #include "llm_pipeline_static.hpp"
+#include "chat_session.hpp"
 #include "utils.hpp"
 #include "text_callback_streamer.hpp"
 #include "openvino/genai/lora_adapter.hpp"
@@ -304,9 +305,13 @@ public:
                         "(input_ids, attention_mask, position_ids, beam_idx) "
                         "but you have '" + std::to_string(num_inputs) + "' inputs");
 
-        ov::genai::utils::trim_kv_cache(m_model_runner, m_kv_history_manager.num_tokens_to_remove_from_kv_cache, m_kv_cache_seq_length_axis, m_adapter_controller);
+        bool position_ids_available = (num_inputs == 4);
+        // With position_ids the removed tokens are only masked, as positions of the following tokens are counted by the attention mask.
+        // Without them the model derives positions from the KV cache length, so the states are trimmed, which copies every layer.
+        if (!position_ids_available)
+            ov::genai::utils::trim_kv_cache(m_model_runner, m_kv_history_manager.num_tokens_to_remove_from_kv_cache, m_kv_cache_seq_length_axis, m_adapter_controller);
 
-        size_t kv_cache_len = 0;
+        size_t kv_cache_len = 0, num_history_tokens = 0;
         ov::Tensor concatenated_attention_mask;
         if (is_chat_conversation && !m_tokenized_chat_history.empty()) {
             OPENVINO_ASSERT(batch_size == 1, "continuation of generation is possible only for batch 1");
@@ -315,10 +320,27 @@ public:
             auto atten_mask_history = m_model_runner.get_tensor("attention_mask");
             auto prompt_len = attention_mask.get_shape()[1];
 
+            const int64_t* start_atten_hst = atten_mask_history.data<int64_t>();
             kv_cache_len = atten_mask_history.get_shape()[1] - m_kv_history_manager.num_tokens_to_remove_from_kv_cache;
+            num_history_tokens = kv_cache_len;
+
+            ov::Tensor history_mask;
+            if (position_ids_available) {
+                // rows of all beams share the history, the first one is taken
+                history_mask = ov::Tensor{ov::element::i64, {1, atten_mask_history.get_shape()[1]}};
+                std::copy_n(atten_mask_history.data<int64_t>(), history_mask.get_size(), history_mask.data<int64_t>());
+                num_history_tokens = utils::mask_kv_cache_tail(history_mask, m_kv_history_manager.num_tokens_to_remove_from_kv_cache);
+                // masked tokens still take KV cache memory and attention compute, they are dropped once they outnumber the history
+                if (history_mask.get_size() - num_history_tokens > num_history_tokens) {
+                    utils::compact_kv_cache(m_model_runner, history_mask, m_kv_cache_seq_length_axis, m_adapter_controller);
+                    history_mask = ov::Tensor{ov::element::i64, {1, num_history_tokens}};
+                    std::fill_n(history_mask.data<int64_t>(), num_history_tokens, 1);
+                }
+                start_atten_hst = history_mask.data<int64_t>();
+                kv_cache_len = history_mask.get_size();
+            }
 
             ov::Tensor new_atten_mask = ov::Tensor{ov::element::i64, {batch_size, kv_cache_len + prompt_len}};
-            auto start_atten_hst = atten_mask_history.data<int64_t>();
 
             std::copy(start_atten_hst, start_atten_hst + kv_cache_len,
                     new_atten_mask.data<int64_t>());
@@ -331,11 +353,10 @@ public:
 
         size_t prev_attn_mask_size = concatenated_attention_mask.get_shape()[1];
 
-        bool position_ids_available = (num_inputs == 4);
         std::optional<ov::Tensor> position_ids = std::nullopt;
         if (position_ids_available) {
             position_ids = ov::Tensor{ov::element::i64, input_ids.get_shape()};
-            utils::initialize_position_ids(*position_ids, attention_mask, kv_cache_len);
+            utils::initialize_position_ids(*position_ids, attention_mask, num_history_tokens);
         }
 
         if(m_adapter_controller) {
@@ -438,6 +459,43 @@ public:
             m_tokenized_chat_history.clear();
         }
     }
+
+    ChatSession suspend_chat() override {
+        OPENVINO_ASSERT(is_chat_conversation, "suspend_chat() requires a chat started by start_chat() or resume_chat()");
+        auto session = std::make_shared<ChatSession::ChatSessionImpl>();
+        if (!m_tokenized_chat_history.empty())
+            session->kv_cache = KVCacheSnapshot::save(m_model_runner, m_adapter_controller);
+        session->trust_encoded_history = m_trust_encoded_history;
+        session->history = std::move(m_history);
+        session->templated_chat_history = std::move(m_templated_chat_history);
+        session->tokenized_chat_history = std::move(m_tokenized_chat_history);
+        session->chat_input_type = m_chat_input_type;
+        session->last_disappeared_token = m_last_disappeared_token;
+        session->kv_history_manager = m_kv_history_manager;
+
+        // history is moved out, so finish_chat() only resets the state
+        reset_kv_state();
+        m_history.clear();
+        m_templated_chat_history.clear();
+        m_tokenized_chat_history.clear();
+        finish_chat();
+        return ChatSession(session);
+    }
+
+    void resume_chat(const ChatSession& session) override {
+        finish_chat();
+        const ChatSession::ChatSessionImpl& state = *session.m_pimpl;
+        // restores the KV cache instead of processing the history, pending trimming is kept in m_kv_history_manager
+        state.kv_cache.restore(m_model_runner);
+        is_chat_conversation = true;
+        m_trust_encoded_history = state.trust_encoded_history;
+        m_history = state.history;
+        m_templated_chat_history = state.templated_chat_history;
+        m_tokenized_chat_history = state.tokenized_chat_history;
+        m_chat_input_type = state.chat_input_type;
+        m_last_disappeared_token = state.last_disappeared_token;
+        m_kv_history_manager = state.kv_history_manager;
+    }
 };
 
 DecodedResults LLMPipeline::generate(
@@ -698,6 +756,19 @@ std::pair<ov::AnyMap, ov::genai::ModelConfigDesc> split_model_descr(const ov::An
     
     return {main_properties, model_descr};
 }
+
+/*
+* Static pipeline is used for NPU, "STATIC_PIPELINE" property selects it for other devices as well,
+* e.g. to check it on CPU. The property is popped from the properties.
+*/
+bool use_static_pipeline(const std::string& device, ov::AnyMap& properties) {
+    bool static_pipeline = device == "NPU";
+    if (auto it = properties.find("STATIC_PIPELINE"); it != properties.end()) {
+        static_pipeline = it->second.as<bool>();
+        properties.erase(it);
+    }
+    return static_pipeline;
+}
 }
 
 ov::genai::LLMPipeline::LLMPipeline(
@@ -721,10 +792,10 @@ ov::genai::LLMPipeline::LLMPipeline(
     if (properties.find(ov::genai::scheduler_config.name()) != properties.end()) {
         auto [plugin_config, scheduler_config] = utils::split_scheduler_config(properties);
         m_pimpl = std::make_unique<ContinuousBatchingAdapter>(models_path, tokenizer, scheduler_config, device, plugin_config);
-    } else if (device == "NPU") {
-        m_pimpl = std::make_unique<StaticLLMPipeline>(models_path, tokenizer, device, properties);
+    } else if (auto pipeline_properties = properties; use_static_pipeline(device, pipeline_properties)) {
+        m_pimpl = std::make_unique<StaticLLMPipeline>(models_path, tokenizer, device, pipeline_properties);
     } else {
-        m_pimpl = std::make_unique<StatefulLLMPipeline>(models_path, tokenizer, device, properties);
+        m_pimpl = std::make_unique<StatefulLLMPipeline>(models_path, tokenizer, device, pipeline_properties);
     }
     auto stop_time = std::chrono::steady_clock::now();
     m_pimpl->m_load_time_ms = std::chrono::duration_cast<std::chrono::milliseconds>(stop_time - start_time).count();
@@ -740,10 +811,10 @@ ov::genai::LLMPipeline::LLMPipeline(
     if (config.find(ov::genai::scheduler_config.name()) != config.end()) {
         auto [plugin_config, scheduler_config] = utils::split_scheduler_config(config);
         m_pimpl = std::make_unique<ContinuousBatchingAdapter>(models_path, scheduler_config, device, plugin_config);
-    } else if (device == "NPU") {
-        m_pimpl = std::make_unique<StaticLLMPipeline>(models_path, device, config);
+    } else if (auto pipeline_config = config; use_static_pipeline(device, pipeline_config)) {
+        m_pimpl = std::make_unique<StaticLLMPipeline>(models_path, device, pipeline_config);
     } else {
-        m_pimpl = std::make_unique<StatefulLLMPipeline>(models_path, device, config);
+        m_pimpl = std::make_unique<StatefulLLMPipeline>(models_path, device, pipeline_config);
     }
     auto stop_time = std::chrono::steady_clock::now();
     m_pimpl->m_load_time_ms = std::chrono::duration_cast<std::chrono::milliseconds>(stop_time - start_time).count();
@@ -814,6 +885,14 @@ void ov::genai::LLMPipeline::finish_chat() {
     m_pimpl->finish_chat();
 }
 
+ov::genai::ChatSession ov::genai::LLMPipeline::suspend_chat() {
+    return m_pimpl->suspend_chat();
+}
+
+void ov::genai::LLMPipeline::resume_chat(const ChatSession& session) {
+    m_pimpl->resume_chat(session);
+}
+
 void ov::genai::LLMPipeline::set_generation_config(const GenerationConfig& config) {
     int64_t default_eos_token_id = m_pimpl->m_generation_config.eos_token_id;
     m_pimpl->m_generation_config = config;
@@ -32,6 +32,14 @@ public:
     virtual void start_chat(const std::string& system_message) = 0;
     virtual void finish_chat() = 0;
 
+    virtual ChatSession suspend_chat() {
+        OPENVINO_THROW("Chat sessions are supported only by LLMPipeline with a stateful model");
+    }
+
+    virtual void resume_chat(const ChatSession& session) {
+        OPENVINO_THROW("Chat sessions are supported only by LLMPipeline with a stateful model");
+    }
+
     virtual ~LLMPipelineImplBase() = default;
 
     Tokenizer m_tokenizer;
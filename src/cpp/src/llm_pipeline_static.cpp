@@ -632,6 +632,14 @@ void copy_columns_by_row_chunks(const ov::Tensor& src, ov::Tensor& dst) {
     }
 }
 
+void copy_kv_slice(const ov::Tensor& src, ov::Tensor& dst, size_t kv_dim) {
+    if (kv_dim == 3u) {
+        copy_columns_by_row_chunks(src, dst);
+    } else {
+        src.copy_to(dst);
+    }
+}
+
 } // anonymous namespace
 
 namespace ov {
@@ -720,9 +728,9 @@ void StaticLLMPipeline::setupAndCompileModels(
         2) Expose KV-cache input and output layers from kvcache model
         3) Align u4 ZP constants - TODO: get rid of this step in future
         4) Clone the model - this will be prefill
-        5) Reshape both models to static shape
+        5) Reshape both models to static shape, chunked prefill model takes past KV-cache of the prompt
         6) Apply layout optimization if applicable
-        7) Replace KV-cache tensors for the entire cache to tensors only for new token (before concat)
+        7) Replace KV-cache tensors for the entire cache to tensors only for new tokens (before concat)
         8) Convert kv-cache tensors to f16 precision
         9) Compile both models
     */
@@ -743,11 +751,25 @@ void StaticLLMPipeline::setupAndCompileModels(
     // (5) Reshape both models to static shape
     const uint32_t kMaxPromptLen = align_to(pop_int_and_cast(properties, "MAX_PROMPT_LEN").value_or(1024u), 64u);
     const uint32_t kMinResponseLen = align_to(pop_int_and_cast(properties, "MIN_RESPONSE_LEN").value_or(128u), 64u);
+    // Chunk which isn't smaller than the prompt window is the whole prompt
+    uint32_t kPrefillChunkSize = align_to(pop_int_and_cast(properties, "PREFILL_CHUNK_SIZE").value_or(0u), 64u);
+    if (kPrefillChunkSize >= kMaxPromptLen) {
+        kPrefillChunkSize = 0u;
+    }
 
     KVAxesPosition axes = get_kv_axes(model_desc.type);
-    m_kvcache_desc = KVCacheDesc { kMaxPromptLen, kMaxPromptLen + kMinResponseLen, 0u, axes.seq_len, false};
-    reshape_to_static(prefill_model, m_kvcache_desc.max_prompt_size, m_kvcache_desc.max_prompt_size, axes);
-    reshape_to_static(kvcache_model, 1u, m_kvcache_desc.total_size, axes);
+    const uint32_t kTotalSize = kMaxPromptLen + kMinResponseLen;
+    // NB: Chunked prefill model processes a chunk with past KV-cache of the rest of the prompt, which may take
+    // the whole KV-cache, so a prompt longer than MAX_PROMPT_LEN is prefilled in chunks as long as one token is left
+    // for generation. Otherwise prefill model processes the whole prompt of MAX_PROMPT_LEN without past KV-cache
+    const uint32_t kMaxPromptSize = kPrefillChunkSize != 0u ? kTotalSize - 1u : kMaxPromptLen;
+    m_kvcache_desc = KVCacheDesc { kMaxPromptSize, kTotalSize, 0u, axes.seq_len, false, kPrefillChunkSize };
+    if (kPrefillChunkSize != 0u) {
+        reshape_to_static(prefill_model, kPrefillChunkSize, kTotalSize, axes);
+    } else {
+        reshape_to_static(prefill_model, kMaxPromptLen, kMaxPromptLen, axes);
+    }
+    reshape_to_static(kvcache_model, 1u, kTotalSize, axes);
     // (6) Apply opt layout if applicable
     // NB: Try to apply opt transpose only for Llama-2-7b-chat-hf model
     if ( model_desc.name_or_path == "meta-llama/Llama-2-7b-chat-hf" ||
@@ -755,11 +777,20 @@ void StaticLLMPipeline::setupAndCompileModels(
         if (optimize_value_tensors(kvcache_model)) {
             // NB: Check if TransposeValueTensors transformation was applied
             m_kvcache_desc.v_tensors_transposed = true;
-            prefill_model = cvt_value_tensors_layout(prefill_model);
+            if (kPrefillChunkSize != 0u) {
+                // NB: Chunked prefill model takes past V-tensors in the layout of kvcache model
+                OPENVINO_ASSERT(optimize_value_tensors(prefill_model),
+                                "Failed to transpose V-tensors of chunked prefill model");
+            } else {
+                prefill_model = cvt_value_tensors_layout(prefill_model);
+            }
         }
     }
-    // (7) Replace KV-cache tensors for the entire cache to tensors only for new token (before concat)
+    // (7) Replace KV-cache tensors for the entire cache to tensors only for new tokens (before concat)
     kvcache_model = redirect_new_kv_to_output(kvcache_model);
+    if (kPrefillChunkSize != 0u) {
+        prefill_model = redirect_new_kv_to_output(prefill_model);
+    }
     // (8) Convert kvcache tensors to fp16 precision
     kvcache_model = cvt_kvcache_to_fp16(kvcache_model);
     prefill_model = cvt_kvcache_to_fp16(prefill_model);
@@ -831,6 +862,16 @@ void StaticLLMPipeline::setupAndImportModels(
 
     };
 
+    auto get_input_ids_size = [](ov::CompiledModel& model) {
+        for (auto input : model.inputs()) {
+            const auto& input_name = input.get_any_name();
+            if (input_name.find("input_ids") != std::string::npos) {
+                return static_cast<uint32_t>(input.get_shape()[1]);
+            }
+        }
+        OPENVINO_THROW("No input_ids input is found! Such model isn't supported.");
+    };
+
     auto get_kvcache_size = [](ov::CompiledModel& model) {
         for (auto input : model.inputs()) {
             const auto& input_name = input.get_any_name();
@@ -857,10 +898,15 @@ void StaticLLMPipeline::setupAndImportModels(
     auto generate_model = import_blob("generate", generate_config);
     m_kvcache_request = generate_model.create_infer_request();
     // (4) Fill in m_kvcache_desc
-    const uint32_t kMaxPromptLen = get_kvcache_size(prefill_model);
-    const uint32_t kMinResponseLen = get_kvcache_size(generate_model) - kMaxPromptLen;
+    const uint32_t kPrefillKVCacheSize = get_kvcache_size(prefill_model);
+    const uint32_t kTotalSize = get_kvcache_size(generate_model);
+    // NB: Prefill model is chunked if it takes less tokens than its KV-cache size,
+    // then the prompt is limited by the KV-cache of both models
+    const uint32_t kPrefillInputSize = get_input_ids_size(prefill_model);
+    const uint32_t kPrefillChunkSize = kPrefillInputSize < kPrefillKVCacheSize ? kPrefillInputSize : 0u;
+    const uint32_t kMaxPromptSize = kPrefillChunkSize != 0u ? std::min(kPrefillKVCacheSize, kTotalSize - 1u) : kPrefillKVCacheSize;
     // FIXME For some models KV-cache dim != 2u
-    m_kvcache_desc = KVCacheDesc { kMaxPromptLen, kMaxPromptLen + kMinResponseLen, 0u, 2u };
+    m_kvcache_desc = KVCacheDesc { kMaxPromptSize, kTotalSize, 0u, 2u, false, kPrefillChunkSize };
 }
 
 void StaticLLMPipeline::start_chat(const std::string& system_message) {
@@ -883,6 +929,79 @@ void StaticLLMPipeline::prepare_for_new_conversation() {
     m_kvcache_desc.num_stored_tokens = 0u;
 }
 
+void StaticLLMPipeline::infer_chunked_prefill(const ov::Tensor& input_ids) {
+    const uint32_t chunk_size = m_kvcache_desc.prefill_chunk_size;
+    auto* chunk_attention_mask_data = m_prefill_request.get_tensor("attention_mask").data<int64_t>();
+    const uint32_t past_size = static_cast<uint32_t>(m_prefill_request.get_tensor("attention_mask").get_size()) - chunk_size;
+    const uint32_t prompt_len = static_cast<uint32_t>(input_ids.get_size());
+    const int64_t* prompt_data = input_ids.data<const int64_t>();
+
+    auto* chunk_input_ids_data = m_prefill_request.get_tensor("input_ids").data<int64_t>();
+    auto* chunk_position_ids_data = m_prefill_request.get_tensor("position_ids").data<int64_t>();
+
+    // Outputs: logits, ...
+    const auto kStartOutputKVCacheLayers = 1u;
+    const auto& prefill_compiled = m_prefill_request.get_compiled_model();
+    const size_t num_kv_layers = prefill_compiled.outputs().size() - kStartOutputKVCacheLayers;
+
+    std::vector<std::string> output_names(num_kv_layers), input_names(num_kv_layers);
+    std::vector<size_t> kv_dims(num_kv_layers);
+    for (size_t i = 0; i < num_kv_layers; ++i) {
+        output_names[i] = prefill_compiled.outputs()[kStartOutputKVCacheLayers + i].get_any_name();
+        input_names[i] = std::regex_replace(output_names[i], std::regex("present"), "past_key_values");
+        kv_dims[i] = (output_names[i].find("value") != std::string::npos &&
+            m_kvcache_desc.v_tensors_transposed) ? 3u : m_kvcache_desc.seq_len;
+    }
+
+    // NB: Masked out KV-cache still takes part in attention matmuls, so it mustn't contain NaNs left by previous prompts
+    ov::parallel_for(num_kv_layers, [&](size_t i) {
+        fill_tensor<ov::float16>(m_prefill_request.get_tensor(input_names[i]), 0);
+        fill_tensor<ov::float16>(m_kvcache_request.get_tensor(input_names[i]), 0);
+    });
+
+    // NB: Only the first chunk is left-padded, so the last prompt token is the last token of the last chunk,
+    // which logits are returned
+    uint32_t num_chunk_tokens = prompt_len % chunk_size == 0u ? chunk_size : prompt_len % chunk_size;
+    while (m_kvcache_desc.num_stored_tokens < prompt_len) {
+        const uint32_t num_stored_tokens = m_kvcache_desc.num_stored_tokens;
+        const uint32_t offset = chunk_size - num_chunk_tokens;
+
+        std::fill_n(chunk_input_ids_data, offset, m_tokenizer.get_pad_token_id());
+        std::copy_n(prompt_data + num_stored_tokens, num_chunk_tokens, chunk_input_ids_data + offset);
+
+        std::fill_n(chunk_position_ids_data, offset, 0);
+        std::iota(chunk_position_ids_data + offset, chunk_position_ids_data + chunk_size, static_cast<int64_t>(num_stored_tokens));
+
+        // NB: Attention mask is [past KV-cache, chunk]
+        std::fill_n(chunk_attention_mask_data, num_stored_tokens, 1);
+        std::fill(chunk_attention_mask_data + num_stored_tokens, chunk_attention_mask_data + past_size + offset, 0);
+        std::fill(chunk_attention_mask_data + past_size + offset, chunk_attention_mask_data + past_size + chunk_size, 1);
+
+        m_prefill_request.infer();
+
+        // NB: Append KV-cache of the chunk to the kvcache model inputs and to the past KV-cache of the next chunk
+        const bool is_last_chunk = num_stored_tokens + num_chunk_tokens == prompt_len;
+        ov::parallel_for(num_kv_layers, [&](size_t i) {
+            auto chunk_out_slice = make_tensor_slice(
+                m_prefill_request.get_tensor(output_names[i]), kv_dims[i], offset, chunk_size
+            );
+            auto kvcache_in_slice = make_tensor_slice(
+                m_kvcache_request.get_tensor(input_names[i]), kv_dims[i], num_stored_tokens, num_stored_tokens + num_chunk_tokens
+            );
+            copy_kv_slice(chunk_out_slice, kvcache_in_slice, kv_dims[i]);
+            if (!is_last_chunk) {
+                auto past_in_slice = make_tensor_slice(
+                    m_prefill_request.get_tensor(input_names[i]), kv_dims[i], num_stored_tokens, num_stored_tokens + num_chunk_tokens
+                );
+                copy_kv_slice(chunk_out_slice, past_in_slice, kv_dims[i]);
+            }
+        });
+
+        m_kvcache_desc.num_stored_tokens += num_chunk_tokens;
+        num_chunk_tokens = chunk_size;
+    }
+}
+
 DecodedResults StaticLLMPipeline::generate(
     StringInputs inputs,
     OptionalGenerationConfig generation_config,
@@ -992,30 +1111,35 @@ EncodedResults StaticLLMPipeline::generate(
     if (prompt_len > m_kvcache_desc.max_prompt_size) {
         OPENVINO_THROW("Static LLM pipeline may only process prompts up to "
                        + std::to_string(m_kvcache_desc.max_prompt_size) + " tokens. "
-                       + "Set the \"MAX_PROMPT_LEN\" config option to increase the limit.");
+                       + "Set the \"MAX_PROMPT_LEN\" config option to increase the limit "
+                       + "or the \"PREFILL_CHUNK_SIZE\" one to prefill prompts up to the whole KV-cache in chunks.");
     }
 
     // NB: From the "generate" perspective, every call is treated as start of new conversation,
     // but if continuation is needed, prompt contains information about the entire conversation.
     prepare_for_new_conversation();
 
-    auto padded_input_ids = m_prefill_request.get_tensor("input_ids");
-    const size_t offset = padded_input_ids.get_size() - input_ids.get_size();
-    copy_with_offset(input_ids, offset, padded_input_ids);
+    if (m_kvcache_desc.prefill_chunk_size != 0u) {
+        infer_chunked_prefill(input_ids);
+    } else {
+        auto padded_input_ids = m_prefill_request.get_tensor("input_ids");
+        const size_t offset = padded_input_ids.get_size() - input_ids.get_size();
+        copy_with_offset(input_ids, offset, padded_input_ids);
 
-    auto padded_attention_mask = m_prefill_request.get_tensor("attention_mask");
-    fill_tensor<int64_t>(padded_attention_mask, 1u, offset);
+        auto padded_attention_mask = m_prefill_request.get_tensor("attention_mask");
+        fill_tensor<int64_t>(padded_attention_mask, 1u, offset);
 
-    auto padded_position_ids = m_prefill_request.get_tensor("position_ids");
-    auto* padded_pos_data = padded_position_ids.data<int64_t>();
-    std::iota(padded_pos_data + offset, padded_pos_data + padded_position_ids.get_size(), 0u);
+        auto padded_position_ids = m_prefill_request.get_tensor("position_ids");
+        auto* padded_pos_data = padded_position_ids.data<int64_t>();
+        std::iota(padded_pos_data + offset, padded_pos_data + padded_position_ids.get_size(), 0u);
 
-    m_prefill_request.infer();
+        m_prefill_request.infer();
+        // NB: Now there are prompt_len tokens in KV-cache
+        m_kvcache_desc.num_stored_tokens += static_cast<uint32_t>(prompt_len);
+    }
     raw_perf_counters.m_new_token_times.emplace_back(std::chrono::steady_clock::now());
     raw_perf_counters.m_batch_sizes.emplace_back(batch_size);
 
-    // NB: Now there are prompt_len tokens in KV-cache
-    m_kvcache_desc.num_stored_tokens += static_cast<uint32_t>(prompt_len);
     int64_t last_token = utils::argmax(m_prefill_request.get_tensor("logits"), 0);
     results.tokens[0].push_back(last_token);
     if (streamer_ptr && streamer_ptr->put(last_token)) {
@@ -1024,34 +1148,32 @@ EncodedResults StaticLLMPipeline::generate(
 
     // Outputs: logits, ...
     const auto kStartOutputKVCacheLayers = 1u;
-    // NB: Copy KV-cache tensors from prefill model to kvcache model
     const auto& kvcache_compiled = m_kvcache_request.get_compiled_model();
 
-    ov::parallel_for(kvcache_compiled.outputs().size() - 1, [&](size_t i) {
-        const auto& output_name = kvcache_compiled.outputs()[kStartOutputKVCacheLayers + i].get_any_name();
-        const auto  input_name = std::regex_replace(output_name, std::regex("present"), "past_key_values");
+    // NB: Copy KV-cache tensors from prefill model to kvcache model, chunked prefill has already written them
+    if (m_kvcache_desc.prefill_chunk_size == 0u) {
+        ov::parallel_for(kvcache_compiled.outputs().size() - 1, [&](size_t i) {
+            const auto& output_name = kvcache_compiled.outputs()[kStartOutputKVCacheLayers + i].get_any_name();
+            const auto  input_name = std::regex_replace(output_name, std::regex("present"), "past_key_values");
 
-        const auto kv_dim = (output_name.find("value") != std::string::npos &&
-            m_kvcache_desc.v_tensors_transposed) ? 3u : m_kvcache_desc.seq_len;
+            const auto kv_dim = (output_name.find("value") != std::string::npos &&
+                m_kvcache_desc.v_tensors_transposed) ? 3u : m_kvcache_desc.seq_len;
 
-        auto prefill_out_tensor = m_prefill_request.get_tensor(output_name);
-        auto prefill_out_slice = make_tensor_slice(
-            prefill_out_tensor, kv_dim, m_kvcache_desc.max_prompt_size - m_kvcache_desc.num_stored_tokens, m_kvcache_desc.max_prompt_size
-        );
+            auto prefill_out_tensor = m_prefill_request.get_tensor(output_name);
+            auto prefill_out_slice = make_tensor_slice(
+                prefill_out_tensor, kv_dim, m_kvcache_desc.max_prompt_size - m_kvcache_desc.num_stored_tokens, m_kvcache_desc.max_prompt_size
+            );
 
-        auto kvcache_in_tensor = m_kvcache_request.get_tensor(input_name);
-        fill_tensor<ov::float16>(kvcache_in_tensor, 0);
+            auto kvcache_in_tensor = m_kvcache_request.get_tensor(input_name);
+            fill_tensor<ov::float16>(kvcache_in_tensor, 0);
 
-        auto kvcache_in_slice = make_tensor_slice(
-            kvcache_in_tensor, kv_dim, 0u, m_kvcache_desc.num_stored_tokens
-        );
+            auto kvcache_in_slice = make_tensor_slice(
+                kvcache_in_tensor, kv_dim, 0u, m_kvcache_desc.num_stored_tokens
+            );
 
-        if (kv_dim == 3u) {
-            copy_columns_by_row_chunks(prefill_out_slice, kvcache_in_slice);
-        } else {
-            prefill_out_slice.copy_to(kvcache_in_slice);
-        }
-    });
+            copy_kv_slice(prefill_out_slice, kvcache_in_slice, kv_dim);
+        });
+    }
 
     auto* input_ids_data = m_kvcache_request.get_tensor("input_ids").data<int64_t>();
     auto* position_ids_data = m_kvcache_request.get_tensor("position_ids").data<int64_t>();
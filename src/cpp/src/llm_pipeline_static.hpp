@@ -67,6 +67,8 @@ public:
     void finish_chat() override;
 private:
     void prepare_for_new_conversation();
+    // processes the prompt by chunks of prefill_chunk_size tokens and writes its KV-cache to the kvcache model inputs
+    void infer_chunked_prefill(const ov::Tensor& input_ids);
 
 private:
     struct KVCacheDesc {
@@ -75,6 +77,8 @@ private:
         uint32_t num_stored_tokens;
         uint32_t seq_len;
         bool v_tensors_transposed;
+        // 0 if prefill model processes the whole prompt at once
+        uint32_t prefill_chunk_size;
     };
 
     KVCacheDesc m_kvcache_desc;
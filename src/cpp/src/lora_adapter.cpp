@@ -9,6 +9,10 @@
 #include <fstream>
 #include <regex>
 #include <optional>
+#include <chrono>
+#include <atomic>
+#include <cstring>
+#include <deque>
 
 #include "openvino/op/add.hpp"
 #include "openvino/op/multiply.hpp"
@@ -22,6 +26,10 @@
 #include "openvino/op/read_value.hpp"
 #include "openvino/op/assign.hpp"
 #include "openvino/op/transpose.hpp"
+#include "openvino/op/equal.hpp"
+#include "openvino/op/select.hpp"
+#include "openvino/op/shape_of.hpp"
+#include "openvino/op/unsqueeze.hpp"
 #include "openvino/op/util/variable.hpp"
 #include "openvino/pass/pattern/matcher.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
@@ -29,8 +37,10 @@
 #include "openvino/pass/manager.hpp"
 
 #include "openvino/genai/lora_adapter.hpp"
+#include "openvino/genai/perf_metrics.hpp"
 
 #include "utils.hpp"
+#include "utils/mapped_file.hpp"
 #include "lora_names_mapping.hpp"
 
 extern "C" {
@@ -50,9 +60,6 @@ using NodePtr = std::shared_ptr<ov::Node>;
 using ov::NodeVector;
 using namespace ov::op;
 
-// FIXME: Use ov::AlignedBuffer instead of std::vector. ov::AlignedBuffer is not available in public OV API
-using Buffer = std::vector<char>;
-using BufferPtr = std::shared_ptr<Buffer>;
 using ConstantVector = std::vector<std::shared_ptr<v0::Constant>>;
 
 
@@ -75,21 +82,11 @@ using LoRAPartsParser = LoRAParts<std::function<std::optional<std::string>(const
 using LoRATensors = std::map<std::string, LoRAWeight>;
 
 
-// Read binary file to memory.
-BufferPtr read_file_helper(const std::filesystem::path& filename) {
-    std::ifstream file(filename, std::ios::binary | std::ios::ate);
-    OPENVINO_ASSERT(file.is_open(), "Cannot open file with LoRA weights: ", filename);
-
-    size_t filesize = file.tellg();
-    auto buffer = std::make_shared<Buffer>(filesize);
-    file.seekg(0, std::ios::beg);
-    // TODO: Use mmapped AlignedBuffer as ov::Core::read_model can do, necessary functionality is not available in public OV API.
-    // LoRA files do not usually have huge size in comparison to the base models, but it can vary depending on adapter,
-    // and using mmap will help to optimize memory consumption and could be critical
-    // when the application at the edge of available memory that is not really uncommon for applications dealing with LLMs.
-    file.read(&(*buffer)[0], filesize);
-
-    return buffer;
+// Maps binary file to memory. LoRA files can be hundreds of megabytes, so their contents are not copied to heap:
+// pages are loaded on demand and shared with the page cache and with other adapters loaded from the same file.
+std::shared_ptr<ov::genai::utils::MappedFile> read_file_helper(const std::filesystem::path& filename) {
+    OPENVINO_ASSERT(std::filesystem::is_regular_file(filename), "Cannot open file with LoRA weights: ", filename);
+    return ov::genai::utils::MappedFile::open_shared(filename);
 }
 
 
@@ -122,16 +119,16 @@ struct AutoSafetensor: public safetensors_File {
 
 
 // Reads a file with a given filename expecting Safetensors file format.
-// The data is read to a solid memory block and the function returns a map of OV Constants allocated on top of that block.
-// The key in the map is a tensor name and the Constant uses a region of memory from the memory block.
-// Each Constant holds a shared pointer to the block in the runtime info.
-// The memory block will be deallocated when the last Constant is destroyed.
-ConstantMap read_safetensors(const std::filesystem::path& filename) {
-    auto buffer = read_file_helper(filename);
+// The file is mapped to memory and the function returns a map of OV Constants allocated on top of the mapping.
+// The key in the map is a tensor name and the Constant uses a region of memory from the mapping.
+// Each Constant holds a shared pointer to the mapping in the runtime info.
+// The file will be unmapped when the last Constant is destroyed.
+ConstantMap read_safetensors(const std::shared_ptr<ov::genai::utils::MappedFile>& buffer, const std::filesystem::path& filename) {
     AutoSafetensor safe_tensors_file{};
 
+    // the parser and Constants only read the read-only mapping, they take non-constant pointers by their API
     OPENVINO_ASSERT(
-        safetensors_file_init(&(*buffer)[0], buffer->size(), &safe_tensors_file) == nullptr,
+        safetensors_file_init(const_cast<char*>(buffer->data()), buffer->size(), &safe_tensors_file) == nullptr,
         "Cannot parse ", filename, " as a Safetensors file format. Safetensors file format is supported only"
     );
 
@@ -150,7 +147,7 @@ ConstantMap read_safetensors(const std::filesystem::path& filename) {
         auto type = safetensors_to_ov_element_type(tensor.dtype);
         auto constant =
             std::make_shared<v0::Constant>(type, shape, ptr, nullptr);      // wraps existing memory, no ownership
-        constant->get_rt_info()["__safetensors_buffer_holder"] = buffer;    // to automatically deallocate underlying memory buffer when last constant that holds it is destroyed
+        constant->get_rt_info()["__safetensors_buffer_holder"] = buffer;    // to automatically unmap the file when last constant that holds it is destroyed
         tensors[name] = constant;
     }
     return tensors;
@@ -577,22 +574,25 @@ NodePtr decompression_convert (NodePtr node) {
 
 
 // Cache of infer request for on-demand build and compiled helper models for weight modification.
-// It maps a model signature which is an arbitrary string to OpenVINO infer request.
-// Defines `evaluate` method that compute a model by a given signature and input tensors.
+// It maps a model signature which is an arbitrary string to OpenVINO compiled model with a pool of infer requests.
+// Defines `evaluate` method that compute a model by a given signature and input tensors,
+// and `evaluate_parallel` method that computes several models concurrently using asynchronous infer requests.
 class InferRequestSignatureCache {
 
-    // Infer request with additional input-output pairs that are bypassed from input to output to eliminate Parameter -> Result pairs from the OV model
+    // Infer requests with additional input-output pairs that are bypassed from input to output to eliminate Parameter -> Result pairs from the OV model
     struct RequestWithBypass {
-        ov::InferRequest request;
+        ov::CompiledModel compiled_model;
+        std::vector<ov::InferRequest> idle_requests;    // requests that are not running now, reused by next evaluations
         std::vector<std::pair<size_t, size_t>> bypass; // a set of index pairs [j, k], where j is an index of input tensor to be forwarded to k-th output tensor
         std::vector<size_t> inputs; // inputs[i] gives an index in the original input tensor vector to be set to i-th input of the request
         std::vector<size_t> outputs;  // outputs[i] gives an index in the original output tensor vector to be set as an i-th output of the request
+        size_t optimal_number_of_requests = 1;  // queried once when the model is compiled, it's not cheap for every evaluation
     };
 
 public:
     using Signature = std::string;
 
-    InferRequestSignatureCache (const std::string& device) : device(device) {}
+    InferRequestSignatureCache (const std::string& device, const ov::AnyMap& properties = {}) : device(device), properties(properties) {}
 
     bool exist (const Signature& signature) {
         return requests.count(signature);
@@ -637,21 +637,69 @@ public:
 
         ov::Core core = ov::genai::utils::singleton_core();
         auto model = std::make_shared<ov::Model>(request_results, request_parameters);
-        auto compiled_model = core.compile_model(model, device);
-        ov::genai::utils::print_compiled_model_properties(compiled_model, "Infer Request Signature Cache");
-        rwb.request = compiled_model.create_infer_request();
+        rwb.compiled_model = core.compile_model(model, device, properties);
+        rwb.optimal_number_of_requests = rwb.compiled_model.get_property(ov::optimal_number_of_infer_requests);
+        ov::genai::utils::print_compiled_model_properties(rwb.compiled_model, "Infer Request Signature Cache");
         requests.emplace(signature, rwb);
     }
 
     void evaluate(const Signature& signature, const ov::TensorVector& inputs, ov::TensorVector& outputs) {
         auto& rwb = at(signature);
-        auto request = rwb.request;
-        auto compiled_model = request.get_compiled_model();
+        auto request = acquire(rwb);
+        set_tensors(rwb, request, inputs, outputs);
+        request.infer();
+        rwb.idle_requests.push_back(request);
+    }
+
+    // Evaluates models by signatures[i] for inputs[i] and outputs[i] tensors for all i. Evaluations are started asynchronously,
+    // the number of evaluations run at the same time is limited by the optimal number of infer requests reported by the device.
+    void evaluate_parallel(const std::vector<Signature>& signatures, const std::vector<ov::TensorVector>& inputs, std::vector<ov::TensorVector>& outputs) {
+        OPENVINO_ASSERT(signatures.size() == inputs.size() && signatures.size() == outputs.size());
+        std::deque<std::pair<RequestWithBypass*, ov::InferRequest>> running;
+        size_t max_running = 1;
+        auto wait_first = [&running]() {
+            running.front().second.wait();
+            running.front().first->idle_requests.push_back(running.front().second);
+            running.pop_front();
+        };
+
+        for(size_t i = 0; i < signatures.size(); ++i) {
+            auto& rwb = at(signatures[i]);
+            max_running = std::max(max_running, rwb.optimal_number_of_requests);
+            if(running.size() >= max_running) {
+                wait_first();
+            }
+            auto request = acquire(rwb);
+            set_tensors(rwb, request, inputs[i], outputs[i]);
+            request.start_async();
+            running.emplace_back(&rwb, request);
+        }
+        while(!running.empty()) {
+            wait_first();
+        }
+    }
+
+private:
+
+    RequestWithBypass& at(const Signature& signature) {
+        return requests.at(signature);
+    }
+
+    static ov::InferRequest acquire(RequestWithBypass& rwb) {
+        if(rwb.idle_requests.empty()) {
+            return rwb.compiled_model.create_infer_request();
+        }
+        auto request = rwb.idle_requests.back();
+        rwb.idle_requests.pop_back();
+        return request;
+    }
+
+    static void set_tensors(RequestWithBypass& rwb, ov::InferRequest& request, const ov::TensorVector& inputs, ov::TensorVector& outputs) {
         for(size_t i = 0; i < rwb.inputs.size(); ++i) {
             request.set_input_tensor(i, inputs[rwb.inputs[i]]);
         }
         for(size_t i = 0; i < rwb.outputs.size(); ++i) {
-            auto target_shape = request.get_compiled_model().output(i).get_partial_shape();
+            auto target_shape = rwb.compiled_model.output(i).get_partial_shape();
             auto& output_tensor = outputs[rwb.outputs[i]];
             if(target_shape != output_tensor.get_shape() && target_shape.is_static()) {
                 // do it for static case only, because if target shape is dynamic, the plugin is allowed to set shape on its own
@@ -662,17 +710,11 @@ public:
         for(auto bypass: rwb.bypass) {
             outputs[bypass.second] = inputs[bypass.first];
         }
-        request.infer();    // TODO: Consider using async to increase throughput, requires more complicated archestration
-    }
-
-private:
-
-    RequestWithBypass& at(const Signature& signature) {
-        return requests.at(signature);
     }
 
     std::unordered_map<Signature, RequestWithBypass> requests;
     std::string device;
+    ov::AnyMap properties;
 };
 
 
@@ -682,10 +724,46 @@ private:
 // TODO: This transformation unpacks potentially compressed to f16/bf16 weights to f32,
 // we should pack it back into the original precision to maintain the same weight size.
 // But it will work well if all plugins equally support fp-compressed weights and can unpack them on-line.
+// Weights are fused in parallel: `apply` only replaces the weights by newly allocated constants and queues their evaluation,
+// queued evaluations are run together when there are enough of them, and the rest of them are run by `fuse` method
+// that should be called after the transformation is applied.
+// Weights allocated by a previous fusion are owned by the model, so they are updated in place instead of being replaced.
 class LoRAFuseTransform : public LoRATransformBase {
 
     InferRequestSignatureCache fusers;
 
+    // Marks constants allocated by the fusion, unlike original weights they are neither mapped from a file nor shared with other models.
+    // Constant doesn't tell whether its buffer is mapped or shared, so other weights are never written. Clones of a fused model share the
+    // marked weights, so a clone mustn't be fused again while the original model is in use.
+    static constexpr const char* OWNED_WEIGHTS = "lora_fused_weights";
+
+    // Queued evaluations keep original weights and LoRA constants alive until replacement constants are computed
+    struct PendingFusion {
+        InferRequestSignatureCache::Signature signature;
+        ov::TensorVector inputs, outputs;
+        ov::NodeVector keep_alive;
+        // weights updated in place, the output is a scratch tensor which is copied to them after evaluation,
+        // as a fusion model isn't guaranteed to read its input before it writes its output
+        ov::Tensor in_place_target;
+    };
+    std::vector<PendingFusion> pending_fusions;
+    // scratch outputs of in place fusions are reused by the next fusions of the same shape
+    std::map<std::pair<ov::element::Type, ov::Shape>, std::vector<ov::Tensor>> free_scratch_tensors;
+
+    ov::Tensor acquire_scratch_tensor(const ov::element::Type& type, const ov::Shape& shape) {
+        auto& tensors = free_scratch_tensors[{type, shape}];
+        if(tensors.empty()) {
+            return ov::Tensor(type, shape);
+        }
+        auto tensor = tensors.back();
+        tensors.pop_back();
+        return tensor;
+    }
+
+    // Original weights that are not memory mapped are released only when their fusion is done,
+    // so the queue length bounds the memory overhead of parallel fusion over the sequential one
+    static constexpr size_t MAX_PENDING_FUSIONS = 64;
+
     void signature_push_back(InferRequestSignatureCache::Signature& signature, ov::Output<ov::Node> input) const {
         // TODO: Define hash function on vector<tuple<element_type, PartialShape>> to make it C++ish
         signature += "(el: " + input.get_element_type().get_type_name() + ", shape: " + input.get_partial_shape().to_string() + ")";
@@ -697,9 +775,34 @@ public:
 
     LoRAFuseTransform(const LoRAWeightByNodeGetter& lora_weight_getter, const std::string& device_for_fusion = "CPU") :
         LoRATransformBase(lora_weight_getter),
-        fusers(device_for_fusion)
+        fusers(device_for_fusion, {ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT)})
     {}
 
+    // Computes all queued weights, the model has valid weights only after this call
+    void fuse() {
+        if(pending_fusions.empty()) {
+            return;
+        }
+        std::vector<InferRequestSignatureCache::Signature> signatures;
+        std::vector<ov::TensorVector> inputs, outputs;
+        signatures.reserve(pending_fusions.size());
+        inputs.reserve(pending_fusions.size());
+        outputs.reserve(pending_fusions.size());
+        for(auto& fusion: pending_fusions) {
+            signatures.push_back(fusion.signature);
+            inputs.push_back(fusion.inputs);
+            outputs.push_back(fusion.outputs);
+        }
+        fusers.evaluate_parallel(signatures, inputs, outputs);
+        for(auto& fusion: pending_fusions) {
+            if(fusion.in_place_target) {
+                fusion.outputs[0].copy_to(fusion.in_place_target);
+                free_scratch_tensors[{fusion.outputs[0].get_element_type(), fusion.outputs[0].get_shape()}].push_back(fusion.outputs[0]);
+            }
+        }
+        pending_fusions.clear();
+    }
+
     bool apply (NodePtr node, const LoRANode& lora_weight) override {
         auto weights_input = node->input_value(1);
         auto weights_input_type = weights_input.get_element_type();
@@ -733,26 +836,45 @@ public:
             fusers.insert(signature, results, parameters);
         }
 
-        // Newly created constants in the next line are not mmaped unlike original weights, so it will inflate required memory
-        // eventually allocating up to 2x of the base model size.
-        // 2X is due to usually applied compression in the base model that is not retained in the current version of this code.
-        // But even if the compression is used, then still a copy of all weights that affected by the LoRA adapters are allocated in memory.
-        // FIXME: Provide a way for postponed weight repacking that will be triggered by the plugin in compile_model call for the base model.
-        // Constant sub-expression can be a solution, but it requires improvements inside plugins, because currently it works extremely slow.
-        auto replacement_const = std::make_shared<v0::Constant>(weights_input.get_element_type(), weights_input.get_shape());
+        auto source_const = std::dynamic_pointer_cast<v0::Constant>(weights_constant.get_node_shared_ptr());
+        // Weights of a previous fusion have the fused element type, so they are written in place when there is no decompression
+        const bool in_place = !weights_convert && source_const->get_rt_info().count(OWNED_WEIGHTS);
 
-        ov::TensorVector outputs{replacement_const->get_tensor_view()};
+        PendingFusion fusion;
+        fusion.signature = signature;
         // set input constants
-        ov::TensorVector inputs;
-        inputs.reserve(1 + adapter.size());
-        inputs.push_back(std::dynamic_pointer_cast<v0::Constant>(weights_constant.get_node_shared_ptr())->get_tensor_view());
+        fusion.inputs.reserve(1 + adapter.size());
+        fusion.inputs.push_back(source_const->get_tensor_view());
+        fusion.keep_alive.push_back(source_const);
         for(size_t i = 0; i < adapter.size(); ++i) {
-            inputs.push_back(adapter[i]->get_tensor_view());
+            fusion.inputs.push_back(adapter[i]->get_tensor_view());
+            fusion.keep_alive.push_back(adapter[i]);
         }
-        fusers.evaluate(signature, inputs, outputs);
 
-        for (auto consumer : consumers) {
-            consumer.replace_source_output(replacement_const->output(0));
+        if(in_place) {
+            fusion.in_place_target = source_const->get_tensor_view();
+            fusion.outputs = {acquire_scratch_tensor(weights_input.get_element_type(), weights_input.get_shape())};
+            pending_fusions.push_back(std::move(fusion));
+        } else {
+            // Newly created constants in the next line are not mmaped unlike original weights, so it will inflate required memory
+            // eventually allocating up to 2x of the base model size.
+            // 2X is due to usually applied compression in the base model that is not retained in the current version of this code.
+            // But even if the compression is used, then still a copy of all weights that affected by the LoRA adapters are allocated in memory.
+            // FIXME: Provide a way for postponed weight repacking that will be triggered by the plugin in compile_model call for the base model.
+            // Constant sub-expression can be a solution, but it requires improvements inside plugins, because currently it works extremely slow.
+            // Original weights can't be updated in place instead: they are usually mapped read-only from the model file or shared with other models.
+            auto replacement_const = std::make_shared<v0::Constant>(weights_input.get_element_type(), weights_input.get_shape());
+            replacement_const->get_rt_info()[OWNED_WEIGHTS] = true;
+            fusion.outputs = {replacement_const->get_tensor_view()};
+            pending_fusions.push_back(std::move(fusion));
+
+            for (auto consumer : consumers) {
+                consumer.replace_source_output(replacement_const->output(0));
+            }
+        }
+
+        if(pending_fusions.size() >= MAX_PENDING_FUSIONS) {
+            fuse();
         }
         return true;
     }
@@ -802,6 +924,104 @@ public:
 };
 
 
+// Transformation that inserts LoRA matrix multiplications applying different adapters to different tokens of a batch in one inference.
+// LoRA tensors of all adapter configs used in a batch are concatenated along LoRA rank dimension, and each rank gets an index
+// of its config (slot) in an additional i32 [1, rank] tensor. A token is adapted by the ranks which slot is equal to the token slot given
+// in `token_slots` input of [number of tokens] shape, so requests with different adapters share the same dense matrix multiplications.
+// Applies only for MatMul nodes with activations of [..., input_dim] shape.
+class LoRASlotsTransform : public LoRATransformBase {
+public:
+
+    OPENVINO_RTTI("LoRASlotsTransform");
+
+    using RankSlotsGetter = std::function<NodePtr(NodePtr)>;
+
+    LoRASlotsTransform(const LoRAWeightByNodeGetter& lora_getter, const RankSlotsGetter& rank_slots_getter, const ov::Output<ov::Node>& token_slots) :
+        LoRATransformBase(lora_getter),
+        rank_slots_getter(rank_slots_getter),
+        token_slots(token_slots)
+    {}
+
+    bool apply (NodePtr node, const LoRANode& lora_weight) override {
+        auto target = node->output(0);
+        const auto target_type = target.get_element_type();
+        auto consumers = target.get_target_inputs();
+
+        ov::Dimension input_dim, output_dim;
+        deduce_input_output_dims(node, input_dim, output_dim);
+
+        // One row per token regardless of how the batch and sequence dimensions are laid out in the model
+        auto rows_shape = v0::Constant::create(ov::element::i64, ov::Shape{2}, std::vector<int64_t>{-1, input_dim.get_length()});
+        NodePtr activations = std::make_shared<v1::Reshape>(node->input_value(0), rows_shape, false);
+
+        auto normalize = [&target_type](NodePtr weight) -> NodePtr {
+            return weight->get_output_element_type(0) == target_type ? weight : std::make_shared<v0::Convert>(weight, target_type);
+        };
+
+        NodePtr lora_rows = std::make_shared<v0::MatMul>(activations, normalize(lora_weight.A), false, true);   // [tokens, rank]
+
+        // Zero scale for ranks of other slots, alpha for ranks of the token slot
+        auto slot_column = std::make_shared<v0::Unsqueeze>(token_slots, v0::Constant::create(ov::element::i32, ov::Shape{}, {1}));
+        auto slot_mask = std::make_shared<v1::Equal>(slot_column, rank_slots_getter(node));
+        NodePtr scale = std::make_shared<v1::Select>(slot_mask, lora_weight.alpha, v0::Constant::create(ov::element::f32, ov::Shape{}, {0}));
+        lora_rows = std::make_shared<v1::Multiply>(lora_rows, normalize(scale));
+
+        NodePtr delta = std::make_shared<v0::MatMul>(lora_rows, normalize(lora_weight.B), false, true);   // [tokens, output_dim]
+        delta = std::make_shared<v1::Reshape>(delta, std::make_shared<v3::ShapeOf>(target), false);
+        auto replacement = std::make_shared<v1::Add>(target, delta);
+
+        for (auto consumer : consumers) {
+            consumer.replace_source_output(replacement->output(0));
+        }
+
+        return true;
+    }
+
+private:
+
+    RankSlotsGetter rank_slots_getter;
+    ov::Output<ov::Node> token_slots;
+};
+
+
+// Concatenates LoRA tensors prepared for several adapter configs along LoRA rank dimension.
+// Expects alpha of [1, rank], A of [rank, input_dim] and B of [output_dim, rank] shapes of the same element types in all parts.
+LoRAParts<ov::Tensor> concat_lora_ranks(const std::vector<LoRAParts<ov::Tensor>>& parts) {
+    OPENVINO_ASSERT(!parts.empty());
+    if(parts.size() == 1) {
+        return parts.front();
+    }
+
+    size_t rank = 0;
+    for(const auto& part: parts) {
+        rank += part.A.get_shape()[0];
+    }
+    const auto& first = parts.front();
+    const size_t input_dim = first.A.get_shape()[1], output_dim = first.B.get_shape()[0];
+    LoRAParts<ov::Tensor> result(
+        ov::Tensor(first.alpha.get_element_type(), ov::Shape{1, rank}),
+        ov::Tensor(first.A.get_element_type(), ov::Shape{rank, input_dim}),
+        ov::Tensor(first.B.get_element_type(), ov::Shape{output_dim, rank})
+    );
+
+    const size_t alpha_size = first.alpha.get_element_type().size(), B_size = first.B.get_element_type().size();
+    auto alpha_data = static_cast<char*>(result.alpha.data()), A_data = static_cast<char*>(result.A.data()), B_data = static_cast<char*>(result.B.data());
+    size_t offset = 0;
+    for(const auto& part: parts) {
+        const size_t part_rank = part.A.get_shape()[0];
+        std::memcpy(alpha_data + offset * alpha_size, part.alpha.data(), part.alpha.get_byte_size());
+        std::memcpy(A_data, part.A.data(), part.A.get_byte_size());
+        A_data += part.A.get_byte_size();
+        auto part_B_data = static_cast<const char*>(part.B.data());
+        for(size_t row = 0; row < output_dim; ++row) {
+            std::memcpy(B_data + (row * rank + offset) * B_size, part_B_data + row * part_rank * B_size, part_rank * B_size);
+        }
+        offset += part_rank;
+    }
+    return result;
+}
+
+
 std::shared_ptr<v0::Constant> alpha_as_constant(float alpha) {
     return v0::Constant::create(ov::element::f32, ov::Shape{1}, {alpha});
 }
@@ -816,9 +1036,11 @@ namespace genai {
 
 class Adapter::Impl {
 public:
-    Impl(const std::filesystem::path& path) :
-        tensors(group_lora_tensors(read_safetensors(path), default_lora_patterns()))
-    {
+    Impl(const std::filesystem::path& path) {
+        const auto load_start = std::chrono::steady_clock::now();
+        file = read_file_helper(path);
+        tensors = group_lora_tensors(read_safetensors(file, path), default_lora_patterns());
+
         std::set<std::string> keys;
         for(const auto& kv: tensors) {
             keys.insert(kv.first);
@@ -838,9 +1060,14 @@ public:
             }
             tensors = new_tensors;
         }
+        load_duration = std::chrono::steady_clock::now() - load_start;
     }
 
     LoRATensors tensors;
+    std::shared_ptr<utils::MappedFile> file;
+    MicroSeconds load_duration;
+    // in microseconds, updated by adapter controllers that may be created in different threads
+    std::atomic<int64_t> fusion_duration{0};
 };
 
 
@@ -849,6 +1076,17 @@ Adapter::Adapter(const std::filesystem::path& path) :
 }
 
 
+AdapterLoadStats Adapter::get_load_stats() const {
+    OPENVINO_ASSERT(m_pimpl, "Adapter is not initialized");
+    AdapterLoadStats stats;
+    stats.load_duration = m_pimpl->load_duration.count() / 1000.0f;
+    stats.file_size = m_pimpl->file->size();
+    stats.resident_size = m_pimpl->file->get_resident_size();
+    stats.fusion_duration = m_pimpl->fusion_duration.load() / 1000.0f;
+    return stats;
+}
+
+
 bool operator== (const Adapter& a, const Adapter& b) {
     return a.m_pimpl == b.m_pimpl;
 }
@@ -866,7 +1104,13 @@ struct AdapterControllerImpl {
     bool need_full_apply = true;
     InferRequestSignatureCache lora_state_evaluators;
 
-    AdapterControllerImpl(std::shared_ptr<ov::Model> model, const AdapterConfig& config) :
+    // Per token adapters only: model input with a slot for each token, variables with a slot for each LoRA rank per adapted layer,
+    // and adapter configs which tensors are currently set to the state, the index in this vector is a slot
+    std::shared_ptr<v0::Parameter> token_slots;
+    std::map<std::string, ov::op::util::VariableInfo> slot_variable_ids;
+    std::vector<AdapterConfig> slot_configs;
+
+    AdapterControllerImpl(std::shared_ptr<ov::Model> model, const AdapterConfig& config, bool per_token_adapters = false) :
         current_config(config),  // FIXME: Compare current and passed configs and change incrementally
         lora_state_evaluators("CPU")    // FIXME: Try to run on the same device that is used for model inference
     {
@@ -915,8 +1159,37 @@ struct AdapterControllerImpl {
         };
 
         ov::pass::Manager pm;
+        std::shared_ptr<LoRAFuseTransform> fuse_pass;
         auto mode = current_config.get_mode();
-        if(mode == AdapterConfig::MODE_DYNAMIC || mode == AdapterConfig::MODE_STATIC_RANK || mode == AdapterConfig::MODE_AUTO) {
+        if(per_token_adapters) {
+            OPENVINO_ASSERT(mode == AdapterConfig::MODE_DYNAMIC || mode == AdapterConfig::MODE_AUTO,
+                "Only AdapterConfig::MODE_DYNAMIC is supported when different adapters are applied to different tokens of a batch");
+            current_config.set_mode(AdapterConfig::MODE_DYNAMIC);
+
+            token_slots = std::make_shared<v0::Parameter>(ov::element::i32, ov::PartialShape{ov::Dimension::dynamic()});
+            token_slots->set_friendly_name(AdapterController::ADAPTER_SLOTS_INPUT_NAME);
+            token_slots->output(0).set_names({AdapterController::ADAPTER_SLOTS_INPUT_NAME});
+            model->add_parameters({token_slots});
+
+            LoRAWeightStateGetter state_getter(params_getter, model, variable_ids);
+            auto matmul_state_getter = [state_getter](NodePtr node) -> std::optional<LoRANode> {
+                auto matmul = std::dynamic_pointer_cast<v0::MatMul>(node);
+                if(!matmul || matmul->get_transpose_a()) {
+                    return std::nullopt;
+                }
+                return state_getter(node);
+            };
+            auto rank_slots_getter = [this, state_getter, model](NodePtr node) {
+                ov::op::util::VariableInfo variable_info{
+                    ov::PartialShape{1, ov::Dimension::dynamic()},
+                    ov::element::i32,
+                    "lora_state_" + std::to_string(model->get_sinks().size()) + node->get_friendly_name() + ".slots"
+                };
+                slot_variable_ids.emplace(node->get_friendly_name(), variable_info);
+                return state_getter.add_variable(variable_info);
+            };
+            pm.register_pass<LoRASlotsTransform>(matmul_state_getter, rank_slots_getter, token_slots);
+        } else if(mode == AdapterConfig::MODE_DYNAMIC || mode == AdapterConfig::MODE_STATIC_RANK || mode == AdapterConfig::MODE_AUTO) {
             // State mode
             params_getter.dynamic_lora_rank = (mode != AdapterConfig::MODE_STATIC_RANK);
             pm.register_pass<LoRASeparateTransform>(LoRAWeightStateGetter(params_getter, model, variable_ids));
@@ -925,12 +1198,20 @@ struct AdapterControllerImpl {
             pm.register_pass<LoRASeparateTransform>(weight_as_constant);
         } else if(mode == AdapterConfig::MODE_FUSE) {
             // Fuse mode
-            pm.register_pass<LoRAFuseTransform>(weight_as_constant);
+            fuse_pass = pm.register_pass<LoRAFuseTransform>(weight_as_constant);
         } else {
             OPENVINO_THROW("Unrecognized AdapterConfig::Mode was used: ", mode);
         }
 
+        const auto transformation_start = std::chrono::steady_clock::now();
         pm.run_passes(model);
+        if(fuse_pass) {
+            fuse_pass->fuse();
+            const auto fusion_duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - transformation_start);
+            for(const auto& adapter : current_config.get_adapters()) {
+                get_adapter_impl(adapter)->fusion_duration += fusion_duration.count();
+            }
+        }
 
         // Collect all variable names to quickly detect which state tensor belongs to this adapter controller later
         for(const auto& var: variable_ids) {
@@ -938,6 +1219,9 @@ struct AdapterControllerImpl {
             variable_names.insert(var.second.B.variable_id);
             variable_names.insert(var.second.alpha.variable_id);
         }
+        for(const auto& var: slot_variable_ids) {
+            variable_names.insert(var.second.variable_id);
+        }
     }
 
     static std::shared_ptr<Adapter::Impl> get_adapter_impl(const Adapter& adapter) {
@@ -1003,6 +1287,117 @@ struct AdapterControllerImpl {
         return variable_names.count(name);
     }
 
+    static bool same_adapters(const AdapterConfig& config1, const AdapterConfig& config2) {
+        if(config1.get_adapters() != config2.get_adapters()) {
+            return false;
+        }
+        for(const auto& adapter: config1.get_adapters()) {
+            if(config1.get_alpha(adapter) != config2.get_alpha(adapter)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int32_t find_slot(const AdapterConfig& config) const {
+        auto it = std::find_if(slot_configs.begin(), slot_configs.end(), [&config](const AdapterConfig& slot_config) {
+            return same_adapters(config, slot_config);
+        });
+        return it == slot_configs.end() ? -1 : static_cast<int32_t>(it - slot_configs.begin());
+    }
+
+    std::vector<int32_t> apply_batched (ov::InferRequest& infer_request, const std::vector<AdapterConfig>& configs) {
+        OPENVINO_ASSERT(token_slots, "AdapterController::apply_batched requires the controller created with per_token_adapters flag");
+        const auto& registered_adapters = current_config.get_adapters();
+
+        bool new_config = need_full_apply;
+        for(const auto& config: configs) {
+            if(config && find_slot(config) < 0) {
+                for(const auto& adapter: config.get_adapters()) {
+                    OPENVINO_ASSERT(registered_adapters.end() != std::find(registered_adapters.begin(), registered_adapters.end(), adapter),
+                        "Adapter that wasn't registered at the pipeline construction is used. Pass all adapters used by requests in `adapters` property.");
+                }
+                new_config = true;
+            }
+        }
+
+        if(new_config) {
+            // Slots are rebuilt from configs of this batch only, so adapters of finished requests don't consume compute in next inferences.
+            // While the set of configs doesn't grow, state tensors are kept, even if some of the slots are not used anymore.
+            slot_configs.clear();
+            for(const auto& config: configs) {
+                if(config && find_slot(config) < 0) {
+                    slot_configs.push_back(config);
+                }
+            }
+            need_full_apply = false;
+            set_slot_tensors(infer_request);
+        }
+
+        std::vector<int32_t> slots;
+        slots.reserve(configs.size());
+        for(const auto& config: configs) {
+            slots.push_back(config ? find_slot(config) : -1);
+        }
+        return slots;
+    }
+
+    void set_slot_tensors (ov::InferRequest& infer_request) {
+        const auto prefix = current_config.get_tensor_name_prefix().value_or("");
+        std::vector<std::vector<LoRAWeightGetter>> slot_weight_getters(slot_configs.size());
+        for(size_t slot = 0; slot < slot_configs.size(); ++slot) {
+            for(const auto& adapter: slot_configs[slot].get_adapters()) {
+                slot_weight_getters[slot].emplace_back(LoRAWeightGetterDefault(&get_adapter_impl(adapter)->tensors, prefix));
+            }
+        }
+
+        auto state = infer_request.query_state();
+        std::map<std::string, size_t> state_name_to_index;
+        for(size_t i = 0; i < state.size(); ++i) {
+            state_name_to_index[state[i].get_name()] = i;
+        }
+
+        for(const auto& lora_var_ids : variable_ids) {
+            const auto& name = lora_var_ids.first;
+            const auto& var_ids = lora_var_ids.second;
+            auto make_state_tensors = [&var_ids, this]() {
+                return LoRAParts<ov::Tensor>(
+                    ov::Tensor(var_ids.alpha.data_type, dynamic_to_static(var_ids.alpha.data_shape)),
+                    ov::Tensor(var_ids.A.data_type, dynamic_to_static(var_ids.A.data_shape)),
+                    ov::Tensor(var_ids.B.data_type, dynamic_to_static(var_ids.B.data_shape))
+                );
+            };
+
+            // Each slot config is concatenated by the same evaluators as in a single config case, then slots are concatenated on host
+            std::vector<LoRAParts<ov::Tensor>> slot_tensors;
+            std::vector<int32_t> rank_slots;
+            for(size_t slot = 0; slot < slot_configs.size(); ++slot) {
+                auto lora_tensors = collect_applicable_tensors(name, slot_weight_getters[slot], slot_configs[slot]);
+                if(lora_tensors.empty()) {
+                    continue;
+                }
+                auto output = make_state_tensors();
+                slot_tensors.push_back(concat_adapters(lora_tensors, output, /*alpha_only=*/false));
+                rank_slots.insert(rank_slots.end(), slot_tensors.back().A.get_shape()[0], static_cast<int32_t>(slot));
+            }
+
+            LoRAParts<ov::Tensor> new_tensors;
+            if(slot_tensors.empty()) {
+                auto output = make_state_tensors();
+                new_tensors = empty_adapters({}, output);
+            } else {
+                new_tensors = concat_lora_ranks(slot_tensors);
+            }
+            ov::Tensor slots_tensor(ov::element::i32, ov::Shape{1, rank_slots.size()});
+            std::copy(rank_slots.begin(), rank_slots.end(), slots_tensor.data<int32_t>());
+
+            state[state_name_to_index.at(var_ids.alpha.variable_id)].set_state(new_tensors.alpha);
+            state[state_name_to_index.at(var_ids.A.variable_id)].set_state(new_tensors.A);
+            state[state_name_to_index.at(var_ids.B.variable_id)].set_state(new_tensors.B);
+            state[state_name_to_index.at(slot_variable_ids.at(name).variable_id)].set_state(slots_tensor);
+        }
+    }
+
     void set_new_adapter_alphas (ov::InferRequest& infer_request) {
         set_new_adapter_tensors(infer_request, /*alpha_only=*/true);
     }
@@ -1041,8 +1436,8 @@ struct AdapterControllerImpl {
         }
     }
 
-     std::vector<LoRAWeight> collect_applicable_tensors (const std::string& lora_name, const std::vector<LoRAWeightGetter>& weight_getters) {
-        const auto& adapters = current_config.get_adapters();
+    std::vector<LoRAWeight> collect_applicable_tensors (const std::string& lora_name, const std::vector<LoRAWeightGetter>& weight_getters, const AdapterConfig& config) {
+        const auto& adapters = config.get_adapters();
         OPENVINO_ASSERT(weight_getters.size() == adapters.size());
         std::vector<LoRAWeight> result;
         result.reserve(weight_getters.size());
@@ -1051,7 +1446,7 @@ struct AdapterControllerImpl {
                 // TODO: Is it practical to use alpha from the adapter file itself. In the current code it is ignored and only alpha from config is used.
                 OPENVINO_ASSERT(lora_tensors->A);
                 OPENVINO_ASSERT(lora_tensors->B);
-                lora_tensors->alpha = alpha_as_constant(current_config.get_alpha(adapters[i]));
+                lora_tensors->alpha = alpha_as_constant(config.get_alpha(adapters[i]));
                 result.push_back(LoRAWeight(
                     std::dynamic_pointer_cast<v0::Constant>(lora_tensors->alpha),
                     std::dynamic_pointer_cast<v0::Constant>(lora_tensors->A),
@@ -1256,7 +1651,7 @@ struct AdapterControllerImpl {
         bool set_empty_adapters,
         bool alpha_only
     ) {
-        auto lora_tensors = collect_applicable_tensors(name, weight_getters);  // request A and B regardless of alpha_only, because it is a way to get lora_rank later when alpha is broadcasted
+        auto lora_tensors = collect_applicable_tensors(name, weight_getters, current_config);  // request A and B regardless of alpha_only, because it is a way to get lora_rank later when alpha is broadcasted
         LoRAParts<ov::Tensor> new_tensors;
         if(!lora_tensors.empty()) {
             new_tensors = concat_adapters(lora_tensors, output, alpha_only);
@@ -1268,7 +1663,12 @@ struct AdapterControllerImpl {
 };
 
 
-AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device)
+AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device) :
+    AdapterController(model, config, device, /*per_token_adapters=*/false) {
+}
+
+
+AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device, bool per_token_adapters)
 {
     // If AdapterConfig::MODE_AUTO is used, then set real mode depending on the device capabilities
     // TODO: Remove this code when devices become aligned on their capabilities for LoRA adapters
@@ -1285,7 +1685,7 @@ AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const Ada
         if(default_mode != default_modes.end()) {
             AdapterConfig updated_config = config;
             updated_config.set_mode(default_mode->second);
-            m_pimpl = std::make_shared<AdapterControllerImpl>(model, updated_config);
+            m_pimpl = std::make_shared<AdapterControllerImpl>(model, updated_config, per_token_adapters);
             return;
         } else {
             std::string device_msg;
@@ -1300,7 +1700,7 @@ AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const Ada
                 << "To avoid this warning set one of the AdapterConfig::Mode values except MODE_AUTO.";
         }
     }
-    m_pimpl = std::make_shared<AdapterControllerImpl>(model, config);
+    m_pimpl = std::make_shared<AdapterControllerImpl>(model, config, per_token_adapters);
 }
 
 
@@ -1315,6 +1715,12 @@ void AdapterController::apply(ov::InferRequest& request, const std::optional<Ada
 }
 
 
+std::vector<int32_t> AdapterController::apply_batched(ov::InferRequest& request, const std::vector<AdapterConfig>& configs) {
+    OPENVINO_ASSERT(m_pimpl, "Adapters are used in a batch but AdapterController was not configured to use adapters.");
+    return m_pimpl->apply_batched(request, configs);
+}
+
+
 bool AdapterController::has_state_name(const std::string& name) {
     return m_pimpl->has_state_name(name);
 }
@@ -0,0 +1,71 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <utility>
+
+namespace ov::genai {
+
+/**
+ * Least recently used cache of at most `capacity` values, 0 capacity keeps nothing. It isn't thread-safe, caches shared
+ * by threads guard it by their own mutex together with their other state.
+ */
+template <typename Key, typename Value>
+class LRUCache {
+public:
+    explicit LRUCache(size_t capacity = 0) : m_capacity(capacity) {}
+
+    // evicts least recently used values if the cache is shrunk
+    void set_capacity(size_t capacity) {
+        m_capacity = capacity;
+        evict();
+    }
+
+    size_t get_capacity() const {
+        return m_capacity;
+    }
+
+    size_t size() const {
+        return m_entries.size();
+    }
+
+    // returns nullptr if `key` isn't cached, otherwise makes it the most recently used one
+    Value* find(const Key& key) {
+        auto it = m_index.find(key);
+        if (it == m_index.end()) {
+            return nullptr;
+        }
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return &it->second->second;
+    }
+
+    // replaces a value if `key` is cached already, e.g. by a concurrent computation, and makes it the most recently used one
+    void insert(const Key& key, Value value) {
+        if (Value* cached = find(key)) {
+            *cached = std::move(value);
+            return;
+        }
+        m_entries.emplace_front(key, std::move(value));
+        m_index.emplace(key, m_entries.begin());
+        evict();
+    }
+
+private:
+    void evict() {
+        while (m_entries.size() > m_capacity) {
+            m_index.erase(m_entries.back().first);
+            m_entries.pop_back();
+        }
+    }
+
+    size_t m_capacity;
+    // the most recently used value is in front
+    std::list<std::pair<Key, Value>> m_entries;
+    std::map<Key, typename std::list<std::pair<Key, Value>>::iterator> m_index;
+};
+
+}  // namespace ov::genai
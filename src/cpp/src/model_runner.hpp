@@ -8,12 +8,15 @@
 
 #include <openvino/runtime/infer_request.hpp>
 
+#include "openvino/genai/lora_adapter.hpp"
+
 #include "debug_utils.hpp"
 #include "sequence_group.hpp"
 #include "scheduler.hpp"
-#include "timer.hpp"
+#include "step_tracer.hpp"
 
 #include "attention_output.hpp"
+#include "visual_language/embedding_model.hpp"
 
 namespace ov::genai {
 
@@ -32,6 +35,11 @@ class ModelRunner {
     AttentionScoresForEachSubsequence m_last_attention_scores;
     size_t m_num_decoder_layers, m_block_size;
     bool m_collect_attention_scores;
+    std::optional<AdapterController> m_adapter_controller;
+    // computes embeddings of tokens if the model takes `inputs_embeds` instead of `input_ids`
+    std::optional<EmbeddingsModel> m_embedding;
+    size_t m_hidden_size = 0;
+    StepTracer m_tracer;
 public:
     /**
      * Constructs the ModelRunner.
@@ -49,6 +57,33 @@ public:
         OPENVINO_ASSERT(m_num_decoder_layers != 0, "num_decoder_layers must be non-zero");
     }
 
+    /**
+     * Enables per-request LoRA adapters: sequence groups scheduled in the same `forward` call may use different adapter configs
+     * from their sampling parameters, and each token is adapted by the config of its sequence group.
+     * @param adapter_controller Controller created with `per_token_adapters` flag for the model of the handled infer request.
+     */
+    void set_adapter_controller(const std::optional<AdapterController>& adapter_controller) {
+        m_adapter_controller = adapter_controller;
+    }
+
+    /**
+     * Switches the model input from token ids to `inputs_embeds` of shape [total_num_tokens, hidden_size]. Prompt positions of sequence
+     * groups with input embeddings take them as is, embeddings of other tokens are computed by `embedding` in one batch per `forward` call.
+     * @param embedding Text embeddings model, which is inferred only by this ModelRunner.
+     * @param hidden_size Size of a token embedding.
+     */
+    void set_embedding_model(const EmbeddingsModel& embedding, size_t hidden_size) {
+        m_embedding = embedding;
+        m_hidden_size = hidden_size;
+    }
+
+    /**
+     * Makes `forward` record input assembly, inference and attention scores collection spans by `tracer`.
+     */
+    void set_tracer(const StepTracer& tracer) {
+        m_tracer = tracer;
+    }
+
     /**
      * @return The ov::InferRequest this ModelRunner is handling.
      */
@@ -73,6 +108,7 @@ public:
      * @return An ov::Tensor with next-token logit scores for each sequence processed during this `forward` call.
      */
     ov::Tensor forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
+        StepTracer::Span input_assembly_span(m_tracer, "input assembly");
         size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
         size_t batch_size_in_sequences = 0;
         size_t total_num_tokens = 0, total_num_blocks = 0;
@@ -101,6 +137,31 @@ public:
 
         max_context_len.data<int32_t>()[0] = max_context_len_val;
 
+        ov::Tensor inputs_embeds;
+        float* inputs_embeds_data = nullptr;
+        // positions of tokens in the batch whose embeddings are computed by the embedding model
+        std::vector<size_t> embedded_token_positions;
+        if (m_embedding) {
+            inputs_embeds = ov::Tensor(ov::element::f32, {total_num_tokens, m_hidden_size});
+            inputs_embeds_data = inputs_embeds.data<float>();
+        }
+
+        // adapter slot of each scheduled sequence group, states are updated by the controller if a new adapter config is scheduled
+        std::vector<int32_t> group_adapter_slots(num_sequence_groups, -1);
+        ov::Tensor adapter_slots;
+        int32_t* adapter_slots_data = nullptr;
+        if (m_adapter_controller) {
+            std::vector<AdapterConfig> adapter_configs;
+            adapter_configs.reserve(num_sequence_groups);
+            for (size_t i = 0; i < num_sequence_groups; ++i) {
+                size_t seq_group_id = scheduler_output.m_scheduled_sequence_groups_ids[i];
+                adapter_configs.push_back(sequence_groups[seq_group_id]->get_sampling_parameters().adapters.value_or(AdapterConfig()));
+            }
+            group_adapter_slots = m_adapter_controller->apply_batched(m_request, adapter_configs);
+            adapter_slots = ov::Tensor(ov::element::i32, {total_num_tokens});
+            adapter_slots_data = adapter_slots.data<int32_t>();
+        }
+
         // get raw pointers to copy to
         int64_t
             * input_ids_data = input_ids.data<int64_t>(),
@@ -114,13 +175,14 @@ public:
         subsequence_begins_data[0] = 0;
         block_indices_begins_data[0] = 0;
 
-        for (size_t i = 0; i < num_sequence_groups; ++i) {
+        for (size_t i = 0, batch_position = 0; i < num_sequence_groups; ++i) {
             size_t seq_group_id = scheduler_output.m_scheduled_sequence_groups_ids[i];
             SequenceGroup::CPtr sequence_group = sequence_groups[seq_group_id];
             std::vector<Sequence::CPtr> running_sequences = sequence_group->get_running_sequences();
             size_t num_running_sequences = running_sequences.size();
             size_t num_scheduled_tokens = sequence_group->get_num_scheduled_tokens();
             size_t group_position_id = sequence_group->get_num_processed_tokens();
+            const ov::Tensor& prompt_embeds = sequence_group->get_input_embeds();
 
             // spec: In case of multiple input tokens for current sequence (prompt_len > 1),
             // context_len corresponds to first token within subgroup of scheduled tokens
@@ -136,6 +198,21 @@ public:
                         sequence->get_generated_ids()[position_id - sequence_group->get_prompt_len()];
 
                     position_ids_data[token_id] = position_id;
+
+                    if (inputs_embeds_data) {
+                        if (prompt_embeds && position_id < sequence_group->get_prompt_len()) {
+                            std::copy_n(prompt_embeds.data<const float>() + position_id * m_hidden_size, m_hidden_size,
+                                        inputs_embeds_data + (batch_position + token_id) * m_hidden_size);
+                        } else {
+                            embedded_token_positions.push_back(batch_position + token_id);
+                        }
+                    }
+                }
+                batch_position += num_scheduled_tokens;
+
+                if (adapter_slots_data) {
+                    std::fill_n(adapter_slots_data, num_scheduled_tokens, group_adapter_slots[i]);
+                    adapter_slots_data += num_scheduled_tokens;
                 }
 
                 size_t expected_kv_cache_size = sequence_group->get_num_processed_tokens() - sequence_group->get_num_evicted_tokens();
@@ -156,7 +233,12 @@ public:
         }
 
         // typical LLM parameters
-        m_request.set_tensor("input_ids", input_ids);
+        if (m_embedding) {
+            _embed_tokens(input_ids, embedded_token_positions, inputs_embeds);
+            m_request.set_tensor("inputs_embeds", inputs_embeds);
+        } else {
+            m_request.set_tensor("input_ids", input_ids);
+        }
         m_request.set_tensor("position_ids", position_ids);
 
         // PA specific parameters
@@ -168,6 +250,10 @@ public:
         m_request.set_tensor("block_indices_begins", block_indices_begins);
         m_request.set_tensor("max_context_len", max_context_len);
 
+        if (m_adapter_controller) {
+            m_request.set_tensor(AdapterController::ADAPTER_SLOTS_INPUT_NAME, adapter_slots);
+        }
+
         // print_tensor("input_ids", input_ids);
         // print_tensor("position_ids", position_ids);
 
@@ -177,14 +263,15 @@ public:
         // print_tensor("block_indices_begins", block_indices_begins);
         // print_tensor("max_context_len", max_context_len);
 
+        input_assembly_span.end();
+
         {
-            static ManualTimer timer("pure generate inference");
-            timer.start();
+            StepTracer::Span span(m_tracer, "infer");
             m_request.infer();
-            timer.end();
         }
 
         if (m_collect_attention_scores) {
+            StepTracer::Span span(m_tracer, "attention scores");
             _collect_attention_scores(sequence_groups, scheduler_output);
         }
 
@@ -193,6 +280,25 @@ public:
     }
 
 private:
+    void _embed_tokens(const ov::Tensor& input_ids, const std::vector<size_t>& positions, ov::Tensor& inputs_embeds) {
+        if (positions.empty())
+            return;
+
+        ov::Tensor token_ids(ov::element::i64, {1, positions.size()});
+        const int64_t* input_ids_data = input_ids.data<const int64_t>();
+        int64_t* token_ids_data = token_ids.data<int64_t>();
+        for (size_t i = 0; i < positions.size(); ++i)
+            token_ids_data[i] = input_ids_data[positions[i]];
+
+        const ov::Tensor token_embeds = m_embedding->infer(token_ids);
+        OPENVINO_ASSERT(token_embeds.get_size() == positions.size() * m_hidden_size,
+                        "Text embeddings model output shape ", token_embeds.get_shape(), " doesn't match hidden size ", m_hidden_size);
+        const float* token_embeds_data = token_embeds.data<const float>();
+        float* inputs_embeds_data = inputs_embeds.data<float>();
+        for (size_t i = 0; i < positions.size(); ++i)
+            std::copy_n(token_embeds_data + i * m_hidden_size, m_hidden_size, inputs_embeds_data + positions[i] * m_hidden_size);
+    }
+
     void _set_block_indices(ov::InferRequest& infer_request, const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output,
                             size_t total_num_blocks) {
         size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
@@ -0,0 +1,88 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+// Unbounded lock-free multi-producer / single-consumer queue (intrusive linked list by D. Vyukov).
+// push() may be called from any number of threads and is wait-free: one allocation and one atomic exchange.
+// try_pop() must be called from a single consumer thread at a time. size() and empty() may be called from any thread.
+template <typename T>
+class MPSCQueue {
+    struct Node {
+        T value{};
+        std::atomic<Node*> next{nullptr};
+    };
+
+    // the last pushed node, producers exchange it
+    alignas(64) std::atomic<Node*> m_head;
+    // the node before the first element, its value was already popped, owned by the consumer
+    alignas(64) Node* m_tail;
+    // counts pushed elements before they are linked, so empty() can't miss an element being pushed
+    alignas(64) std::atomic<size_t> m_size{0};
+
+public:
+    MPSCQueue() {
+        Node* stub = new Node;
+        m_head.store(stub, std::memory_order_relaxed);
+        m_tail = stub;
+    }
+
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+    ~MPSCQueue() {
+        while (m_tail) {
+            Node* next = m_tail->next.load(std::memory_order_relaxed);
+            delete m_tail;
+            m_tail = next;
+        }
+    }
+
+    void push(T value) {
+        Node* node = new Node;
+        node->value = std::move(value);
+        m_size.fetch_add(1, std::memory_order_seq_cst);
+        Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+        // until this store, the consumer sees the queue ending at `prev`
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    // returns false if the queue is empty or the first element is not linked by its producer yet
+    bool try_pop(T& value) {
+        Node* next = m_tail->next.load(std::memory_order_acquire);
+        if (!next) {
+            return false;
+        }
+        value = std::move(next->value);
+        next->value = T{};
+        delete m_tail;
+        m_tail = next;
+        m_size.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // pops all elements linked so far, preserves order; returns the number of popped elements
+    template <typename Container>
+    size_t drain_to(Container& container) {
+        size_t count = 0;
+        T value{};
+        while (try_pop(value)) {
+            container.push_back(std::move(value));
+            ++count;
+        }
+        return count;
+    }
+
+    // may be greater than the number of elements try_pop() returns while producers are inside push()
+    size_t size() const {
+        return m_size.load(std::memory_order_seq_cst);
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+};
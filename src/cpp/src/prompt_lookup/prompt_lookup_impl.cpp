@@ -3,6 +3,7 @@
 
 #include "prompt_lookup_impl.hpp"
 #include "text_callback_streamer.hpp"
+#include "timer.hpp"
 
 namespace ov::genai {
 template<class... Ts> struct overloaded : Ts... {using Ts::operator()...;};
@@ -28,10 +29,17 @@ bool ContinuousBatchingPipeline::PromptLookupImpl::has_non_finished_requests() {
     return m_pipeline->has_non_finished_requests();
 }
 
+void ContinuousBatchingPipeline::PromptLookupImpl::fail_requests(std::exception_ptr error) {
+    m_pipeline->fail_requests(error);
+}
+
 void ContinuousBatchingPipeline::PromptLookupImpl::step() {
     ManualTimer candidates_timer("prompt_lookup_decoding: generate_candidates()");
     candidates_timer.start();
-    m_pipeline->generate_candidates();
+    {
+        StepTracer::Span span(m_tracer, "generate candidates");
+        m_pipeline->generate_candidates();
+    }
     candidates_timer.end();
     m_sd_metrics.draft_duration += candidates_timer.get_duration();
     auto generated_len_before = m_pipeline->get_generated_request_len();
@@ -41,7 +49,6 @@ void ContinuousBatchingPipeline::PromptLookupImpl::step() {
     m_pipeline->step();
     main_timer.end();
     m_sd_metrics.main_duration += main_timer.get_duration();
-    m_pipeline_metrics = m_pipeline->get_metrics();
     auto generated_len_after = m_pipeline->get_generated_request_len();
 
     for (const auto request : generated_len_before) {
@@ -152,8 +159,16 @@ ContinuousBatchingPipeline::PromptLookupImpl::generate(const std::vector<ov::Ten
     return results;
 }
 
+PipelineMetrics ContinuousBatchingPipeline::PromptLookupImpl::get_metrics() const {
+    return m_pipeline->get_metrics();
+}
+
+PipelineMetrics ContinuousBatchingPipeline::PromptLookupImpl::reset_metrics() {
+    return m_pipeline->reset_metrics();
+}
+
 SpeculativeDecodingMetrics
-ContinuousBatchingPipeline::PromptLookupImpl::get_metrics() {
+ContinuousBatchingPipeline::PromptLookupImpl::get_speculative_decoding_metrics() {
     return m_sd_metrics;
 };
 }
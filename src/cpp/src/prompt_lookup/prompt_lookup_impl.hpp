@@ -25,6 +25,7 @@ public:
                      const ov::genai::GenerationConfig& generation_config) {
         m_tokenizer = tokenizer;
         m_pipeline = std::make_shared<ContinuousBatchingForPromptLookupImpl>(model, tokenizer, scheduler_config, device, properties, generation_config);
+        m_pipeline->set_tracer(m_tracer);
     };
 
     GenerationHandle add_request(uint64_t request_id,
@@ -36,6 +37,8 @@ public:
 
     bool has_non_finished_requests() override;
 
+    void fail_requests(std::exception_ptr error) override;
+
     void step() override;
 
     std::vector<EncodedGenerationResult>
@@ -43,7 +46,10 @@ public:
              const std::vector<GenerationConfig>& sampling_params,
              const StreamerVariant& streamer) override;
 
-    SpeculativeDecodingMetrics get_metrics();
+    PipelineMetrics get_metrics() const override;
+    PipelineMetrics reset_metrics() override;
+
+    SpeculativeDecodingMetrics get_speculative_decoding_metrics();
 };
 
 }
\ No newline at end of file
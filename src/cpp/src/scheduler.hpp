@@ -34,6 +34,9 @@ public:
         bool is_prompt = false;
         // current cache usage
         float m_cache_usage = 0.0;
+        // number of sequence groups preempted in this step and number of their processed tokens that were dropped
+        size_t m_num_preemptions = 0;
+        size_t m_num_preempted_tokens = 0;
     };
 
     explicit Scheduler(size_t block_size, const SchedulerConfig & config = {}, size_t num_layers = 1, bool can_use_partial_preemption = true) :
@@ -186,7 +189,7 @@ private:
         return std::numeric_limits<size_t>::max();
     }
 
-    void _apply_preemption(size_t sequence_group_id, const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+    void _apply_preemption(size_t sequence_group_id, const std::vector<SequenceGroup::Ptr>& sequence_groups, Output& scheduler_output) {
         SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
 
         // check whether current sequence requires a new slot / block
@@ -199,7 +202,12 @@ private:
                 break;
             }
             size_t blocks_needed = m_block_manager.required_blocks_count(sequence_group);
-            if (!_preempt_by_recompute(sequence_groups[evicted_sequence_group_id], blocks_needed)){
+            const SequenceGroup::Ptr& evicted_sequence_group = sequence_groups[evicted_sequence_group_id];
+            size_t processed_tokens = evicted_sequence_group->get_num_processed_tokens();
+            bool is_preempted = _preempt_by_recompute(evicted_sequence_group, blocks_needed);
+            ++scheduler_output.m_num_preemptions;
+            scheduler_output.m_num_preempted_tokens += processed_tokens - evicted_sequence_group->get_num_processed_tokens();
+            if (!is_preempted) {
                 break;
             }
         }
@@ -289,7 +297,7 @@ private:
                 size_t num_scheduled_tokens_per_seq = std::min(available_tokens_per_seq_in_megabatch, num_available_tokens_per_seq);
                 sequence_group->schedule_tokens(num_scheduled_tokens_per_seq);
 
-                _apply_preemption(sequence_group_id, sequence_groups);
+                _apply_preemption(sequence_group_id, sequence_groups, scheduler_output);
 
                 // if we can't preemt any more sequences, clear scheduled tokens and move to next sequence
                 if (!m_block_manager.can_append_slots(sequence_group)){
@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <string_view>
+
+#include "openvino/core/parallel.hpp"
+
 #include "sequence_group.hpp"
 
 namespace ov {
@@ -17,14 +20,14 @@ size_t Sequence::_make_hash(size_t content_length) {
             block_start_idx -= block_size;
         }
 
-        // hash of current block depends on prefix hashes
-        std::vector<int64_t> content;
+        // hash of current block depends on adapters of the request, because they change KV of the same tokens, and on prefix hashes
+        std::vector<int64_t> content = sequence_group->get_adapters_key();
         size_t prefix_hashes_needed_count = block_start_idx / block_size;
         OPENVINO_ASSERT(prefix_hashes_needed_count <= m_prefix_hashes.size()); 
         content.insert(content.end(), m_prefix_hashes.begin(), m_prefix_hashes.begin() + prefix_hashes_needed_count);
 
         // get tokens corresponding to current block
-        const auto prompt_ids = sequence_group->get_prompt_ids();
+        const auto& prompt_ids = sequence_group->get_prompt_content_ids();
         OPENVINO_ASSERT(content_length <= prompt_ids.size() + m_generated_ids.size());
         if (block_start_idx < prompt_ids.size()) {
             content.insert(content.end(), prompt_ids.begin() + block_start_idx, prompt_ids.begin() + std::min(prompt_ids.size(), content_length));
@@ -59,5 +62,28 @@ size_t Sequence::get_hash(size_t content_length) {
     
     return _make_hash(content_len);
 }
+
+void SequenceGroup::set_input_embeds(const ov::Tensor& input_embeds) {
+    const ov::Shape& shape = input_embeds.get_shape();
+    OPENVINO_ASSERT(input_embeds.get_element_type() == ov::element::f32, "Prompt embeddings are expected to be f32");
+    OPENVINO_ASSERT(shape.size() == 3 && shape[0] == 1 && shape[1] == get_prompt_len(),
+                    "Prompt embeddings shape ", shape, " doesn't match prompt length ", get_prompt_len());
+
+    m_input_embeds = ov::Tensor(input_embeds.get_element_type(), shape);
+    input_embeds.copy_to(m_input_embeds);
+
+    if (!m_enable_prefix_caching) {
+        return;
+    }
+
+    // embeddings of the same token are the same, so text positions are matched as by token ids and image positions by image features
+    const size_t hidden_size = shape[2];
+    const float* embeds_data = m_input_embeds.data<const float>();
+    m_prompt_content_ids.resize(get_prompt_len());
+    ov::parallel_for(get_prompt_len(), [&](size_t position) {
+        const char* row = reinterpret_cast<const char*>(embeds_data + position * hidden_size);
+        m_prompt_content_ids[position] = static_cast<int64_t>(std::hash<std::string_view>{}(std::string_view(row, hidden_size * sizeof(float))));
+    });
+}
 }  // namespace genai
 }  // namespace ov
\ No newline at end of file
@@ -5,7 +5,9 @@
 
 #include <vector>
 #include <set>
+#include <chrono>
 #include <cstdlib>
+#include <optional>
 #include <string_view>
 
 #include "openvino/genai/generation_handle.hpp"
@@ -204,6 +206,12 @@ class SequenceGroup {
     ov::genai::GenerationConfig m_sampling_params;
     std::size_t m_block_size;
     TokenIds m_prompt_ids;
+    // prompt embeddings [1, prompt_len, hidden_size] consumed by a model instead of embeddings of m_prompt_ids, empty for token prompts
+    ov::Tensor m_input_embeds;
+    // hashes of m_input_embeds rows identifying prompt positions for prefix caching, empty for token prompts
+    TokenIds m_prompt_content_ids;
+    // identifies LoRA adapters and alphas the request is generated with for prefix caching, empty without adapters
+    std::vector<int64_t> m_adapters_key;
     std::vector<float> m_prompt_log_probs;
     GenerationStream::Ptr m_generation_stream;
     bool m_enable_prefix_caching;
@@ -226,6 +234,9 @@ class SequenceGroup {
 
     size_t m_num_streamed_tokens = 0, m_stream_window_size = 0;
 
+    // time points of the request lifetime for latency metrics of a pipeline
+    std::chrono::steady_clock::time_point m_arrival_time = std::chrono::steady_clock::now();
+    std::optional<std::chrono::steady_clock::time_point> m_first_scheduled_time, m_first_token_time;
 
     SequenceGroup(uint64_t request_id, const ov::genai::GenerationConfig& sampling_params, std::size_t block_size, bool enable_prefix_caching)
         : m_request_id(request_id),
@@ -502,6 +513,65 @@ public:
         return m_prompt_ids;
     }
 
+    /**
+     * Makes a model consume `input_embeds` of shape [1, prompt_len, hidden_size] instead of embeddings of prompt ids, e.g. a prompt
+     * of a visual language model with image features. Prompt ids are still used by logit processors, so they must be valid
+     * token ids. The embeddings are copied. If prefix caching is enabled, prompt positions are identified by hashes of their
+     * embeddings instead of prompt ids, so KV blocks are shared only by prompts with the same text and images.
+     */
+    void set_input_embeds(const ov::Tensor& input_embeds);
+
+    // empty tensor if a prompt is given by token ids only
+    const ov::Tensor& get_input_embeds() const {
+        return m_input_embeds;
+    }
+
+    // ids used to compute hashes of prompt KV blocks in prefix caching
+    const TokenIds& get_prompt_content_ids() const {
+        return m_prompt_content_ids.empty() ? m_prompt_ids : m_prompt_content_ids;
+    }
+
+    /**
+     * Sets ids of LoRA adapters and alphas the request is generated with. They are mixed into hashes of all KV blocks of
+     * the request, so prefix caching doesn't share blocks between requests with different adapter configs.
+     */
+    void set_adapters_key(std::vector<int64_t> adapters_key) {
+        m_adapters_key = std::move(adapters_key);
+    }
+
+    const std::vector<int64_t>& get_adapters_key() const {
+        return m_adapters_key;
+    }
+
+    // the time the sequence group was created, i.e. the request was added to a pipeline
+    std::chrono::steady_clock::time_point get_arrival_time() const {
+        return m_arrival_time;
+    }
+
+    const std::optional<std::chrono::steady_clock::time_point>& get_first_scheduled_time() const {
+        return m_first_scheduled_time;
+    }
+
+    void set_first_scheduled_time(std::chrono::steady_clock::time_point time) {
+        m_first_scheduled_time = time;
+    }
+
+    const std::optional<std::chrono::steady_clock::time_point>& get_first_token_time() const {
+        return m_first_token_time;
+    }
+
+    void set_first_token_time(std::chrono::steady_clock::time_point time) {
+        m_first_token_time = time;
+    }
+
+    // the number of tokens generated by the longest sequence
+    size_t get_max_generated_len() const {
+        size_t max_generated_len = 0;
+        for (const auto& sequence : m_sequences)
+            max_generated_len = std::max(max_generated_len, sequence->get_generated_len());
+        return max_generated_len;
+    }
+
     void append_prompt_log_prob(float log_prob) {
         m_prompt_log_probs.push_back(log_prob);
     }
@@ -281,14 +281,12 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::update
 
 void
 ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::pull_awaiting_requests(bool is_pause_request) {
-    std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+    const size_t num_pulled = m_awaiting_requests.drain_to(m_requests);
     if (is_pause_request) {
-        for (auto& awaiting_request : m_awaiting_requests) {
-            awaiting_request->pause_generation(true);
+        for (auto it = m_requests.end() - num_pulled; it != m_requests.end(); ++it) {
+            (*it)->pause_generation(true);
         }
     }
-    m_requests.insert(m_requests.end(), m_awaiting_requests.begin(), m_awaiting_requests.end());
-    m_awaiting_requests.clear();
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::multistep() {
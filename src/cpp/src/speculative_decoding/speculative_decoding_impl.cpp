@@ -5,6 +5,7 @@
 #include "speculative_decoding_impl.hpp"
 #include "utils.hpp"
 #include "utils/paged_attention_transformations.hpp"
+#include "timer.hpp"
 
 
 namespace ov::genai {
@@ -87,6 +88,8 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(con
     m_draft_pipeline = std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(core,
         draft_model, draft_model_tokenizer, draft_model_desc.generation_config,
         draft_device_config, draft_scheduler_config, draft_device, draft_properties, false);
+    m_main_pipeline->set_tracer(m_tracer.child("main"));
+    m_draft_pipeline->set_tracer(m_tracer.child("draft"));
 }
 
 GenerationHandle
@@ -117,6 +120,13 @@ bool ContinuousBatchingPipeline::SpeculativeDecodingImpl::has_non_finished_reque
     return m_main_pipeline->has_non_finished_requests();
 }
 
+void ContinuousBatchingPipeline::SpeculativeDecodingImpl::fail_requests(std::exception_ptr error) {
+    m_main_pipeline->fail_requests(error);
+    m_draft_pipeline->fail_requests(error);
+    std::lock_guard<std::mutex> lock(m_draft_generations_mutex);
+    m_draft_generations.clear();
+}
+
 void print_generated_request(const ov::genai::GeneratedRequests& requests) {
     for (const auto& request : requests) {
         for (const auto& sequence : request.second) {
@@ -131,6 +141,7 @@ void print_generated_request(const ov::genai::GeneratedRequests& requests) {
 }
 
 void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
+    StepTracer::Span step_span(m_tracer, "step");
     // this blocks adding new requests during step as it may break coherence between main and draft models
     std::lock_guard<std::mutex> lock{m_draft_generations_mutex};
     m_draft_pipeline->pull_awaiting_requests(true);
@@ -139,10 +150,12 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
     // generate candidates by draft model
     ManualTimer draft_timer("speculative_decoding: draft_model: multistep()");
     draft_timer.start();
-    m_draft_pipeline->multistep();
+    {
+        StepTracer::Span span(m_tracer, "draft multistep");
+        m_draft_pipeline->multistep();
+    }
     draft_timer.end();
     m_sd_metrics.draft_duration += draft_timer.get_duration();
-    m_pipeline_metrics = m_main_pipeline->get_metrics();
 
     // to generate num_matches statistic
     std::map<int64_t, UpdateRequestResult> update_sequence_info;
@@ -158,7 +171,6 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
     m_main_pipeline->step();
     main_timer.end();
     m_sd_metrics.main_duration += main_timer.get_duration();
-    m_pipeline_metrics = m_main_pipeline->get_metrics();
 
     auto main_generated_requests = m_main_pipeline->get_generated_requests();
     for (const auto& checked_sequence : main_generated_requests) {
@@ -275,6 +287,15 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::generate(const std::vector<
     return results;
 }
 
+PipelineMetrics ContinuousBatchingPipeline::SpeculativeDecodingImpl::get_metrics() const {
+    return m_main_pipeline->get_metrics();
+}
+
+PipelineMetrics ContinuousBatchingPipeline::SpeculativeDecodingImpl::reset_metrics() {
+    m_draft_pipeline->reset_metrics();
+    return m_main_pipeline->reset_metrics();
+}
+
 SpeculativeDecodingMetrics
 ContinuousBatchingPipeline::SpeculativeDecodingImpl::get_speculative_decoding_metrics() {
     return m_sd_metrics;
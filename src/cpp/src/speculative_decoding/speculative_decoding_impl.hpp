@@ -54,6 +54,8 @@ public:
 
     bool has_non_finished_requests() override;
 
+    void fail_requests(std::exception_ptr error) override;
+
     void step() override;
 
     std::vector<EncodedGenerationResult>
@@ -61,6 +63,10 @@ public:
              const std::vector<GenerationConfig>& sampling_params,
              const StreamerVariant& streamer) override;
 
+    // metrics of the main pipeline, which generates tokens of requests
+    PipelineMetrics get_metrics() const override;
+    PipelineMetrics reset_metrics() override;
+
     SpeculativeDecodingMetrics get_speculative_decoding_metrics();
 };
 
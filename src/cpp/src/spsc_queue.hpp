@@ -0,0 +1,142 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+// Unbounded single-producer / single-consumer queue built of fixed-size ring segments.
+// push() is lock-free and takes a mutex only to wake a consumer sleeping in pull() or back().
+// The consumer methods (pull, back, try_pop, empty) must not run concurrently with each other;
+// they may be called from different threads if the calls are serialized by the caller.
+template <typename T, size_t SegmentCapacity = 32>
+class SPSCQueue {
+    static_assert(SegmentCapacity > 0, "SPSCQueue segment must have at least one slot");
+
+    struct Segment {
+        std::array<T, SegmentCapacity> slots;
+        // number of slots published by the producer
+        std::atomic<size_t> size{0};
+        std::atomic<Segment*> next{nullptr};
+    };
+
+    // consumer side: the segment being read and the next slot to read from it
+    alignas(64) Segment* m_head;
+    size_t m_read = 0;
+    // producer side, read by back() to find the last element
+    alignas(64) std::atomic<Segment*> m_tail;
+
+    // the consumer sets the flag before sleeping, so the producer takes the mutex only if somebody waits
+    alignas(64) std::atomic<bool> m_waiting{false};
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+
+    // the number of empty checks before the consumer goes to sleep in wait()
+    static constexpr size_t SPIN_COUNT = 128;
+
+    // moves the consumer to the next segment if the current one is fully read
+    bool advance_if_read() {
+        if (m_read < SegmentCapacity) {
+            return true;
+        }
+        Segment* next = m_head->next.load(std::memory_order_acquire);
+        if (!next) {
+            return false;
+        }
+        delete m_head;
+        m_head = next;
+        m_read = 0;
+        return true;
+    }
+
+    void wait() {
+        for (size_t i = 0; i < SPIN_COUNT; ++i) {
+            if (!empty()) {
+                return;
+            }
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_waiting.store(true, std::memory_order_relaxed);
+        // pairs with the fence in push(): either the producer sees the flag or the consumer sees the element
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        m_cv.wait(lock, [this] { return !empty(); });
+        m_waiting.store(false, std::memory_order_relaxed);
+    }
+
+public:
+    SPSCQueue() {
+        m_head = new Segment;
+        m_tail.store(m_head, std::memory_order_relaxed);
+    }
+
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    ~SPSCQueue() {
+        while (m_head) {
+            Segment* next = m_head->next.load(std::memory_order_relaxed);
+            delete m_head;
+            m_head = next;
+        }
+    }
+
+    void push(T item) {
+        Segment* tail = m_tail.load(std::memory_order_relaxed);
+        const size_t size = tail->size.load(std::memory_order_relaxed);
+        if (size < SegmentCapacity) {
+            tail->slots[size] = std::move(item);
+            tail->size.store(size + 1, std::memory_order_release);
+        } else {
+            Segment* segment = new Segment;
+            segment->slots[0] = std::move(item);
+            segment->size.store(1, std::memory_order_relaxed);
+            m_tail.store(segment, std::memory_order_release);
+            tail->next.store(segment, std::memory_order_release);
+        }
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiting.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cv.notify_one();
+        }
+    }
+
+    bool empty() {
+        if (m_read == SegmentCapacity) {
+            // a new segment is linked with its first element published
+            return m_head->next.load(std::memory_order_acquire) == nullptr;
+        }
+        return m_read == m_head->size.load(std::memory_order_acquire);
+    }
+
+    bool try_pop(T& item) {
+        if (!advance_if_read() || m_read == m_head->size.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = std::move(m_head->slots[m_read]);
+        m_head->slots[m_read] = T{};
+        ++m_read;
+        return true;
+    }
+
+    // waits for an element and pops it
+    T pull() {
+        wait();
+        T item{};
+        try_pop(item);
+        return item;
+    }
+
+    // waits for an element and returns a copy of the last pushed one, nothing is popped
+    T back() {
+        wait();
+        // the producer doesn't modify published slots and only the consumer frees segments
+        Segment* tail = m_tail.load(std::memory_order_acquire);
+        return tail->slots[tail->size.load(std::memory_order_acquire) - 1];
+    }
+};
@@ -0,0 +1,136 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "step_tracer.hpp"
+
+#include <algorithm>
+
+#include "json_utils.hpp"
+
+namespace ov::genai {
+
+namespace {
+
+size_t get_histogram_bucket(std::chrono::nanoseconds duration) {
+    // the bucket of n microseconds is the bit width of n
+    size_t bucket = 0;
+    for (auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count(); microseconds > 0; microseconds >>= 1)
+        ++bucket;
+    return std::min(bucket, TraceSpanStatistics::NUM_HISTOGRAM_BUCKETS - 1);
+}
+
+void merge(TraceSpanStatistics& to, const TraceSpanStatistics& from) {
+    to.min_ms = to.count == 0 ? from.min_ms : std::min(to.min_ms, from.min_ms);
+    to.max_ms = std::max(to.max_ms, from.max_ms);
+    to.count += from.count;
+    to.total_ms += from.total_ms;
+    for (size_t i = 0; i < to.histogram.size(); ++i)
+        to.histogram[i] += from.histogram[i];
+}
+
+double to_microseconds(StepTracer::Clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+}  // namespace
+
+StepTracer::Span::Span(const StepTracer& tracer, const char* name) : m_name(name) {
+    if (tracer.is_enabled()) {
+        m_tracer = &tracer;
+        m_start = Clock::now();
+    }
+}
+
+StepTracer::Span::~Span() {
+    end();
+}
+
+void StepTracer::Span::end() {
+    if (m_tracer) {
+        m_tracer->record(m_name, m_start, Clock::now());
+        m_tracer = nullptr;
+    }
+}
+
+StepTracer::StepTracer(size_t max_events) : m_trace(std::make_shared<Trace>(max_events)) {
+}
+
+StepTracer::StepTracer(std::shared_ptr<Trace> trace, size_t category_id) : m_trace(std::move(trace)), m_category_id(category_id) {
+}
+
+StepTracer StepTracer::child(const std::string& category) const {
+    OPENVINO_ASSERT(!category.empty(), "Category of a child tracer must not be empty");
+    std::lock_guard<std::mutex> lock(m_trace->mutex);
+    const std::string& parent_category = m_trace->categories[m_category_id];
+    m_trace->categories.push_back(parent_category.empty() ? category : parent_category + "/" + category);
+    return StepTracer(m_trace, m_trace->categories.size() - 1);
+}
+
+void StepTracer::set_enabled(bool enabled) {
+    m_trace->enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool StepTracer::is_enabled() const {
+    return m_trace->enabled.load(std::memory_order_relaxed);
+}
+
+void StepTracer::record(const char* name, Clock::time_point start, Clock::time_point end) const {
+    std::lock_guard<std::mutex> lock(m_trace->mutex);
+    const size_t thread_id = m_trace->thread_ids.emplace(std::this_thread::get_id(), m_trace->thread_ids.size()).first->second;
+    if (m_trace->events.size() < m_trace->max_events) {
+        m_trace->events.push_back({name, m_category_id, thread_id, start, end});
+    } else {
+        ++m_trace->num_dropped_events;
+    }
+
+    const float duration_ms = std::chrono::duration<float, std::milli>(end - start).count();
+    TraceSpanStatistics& statistics = m_trace->statistics[{m_category_id, name}];
+    statistics.min_ms = statistics.count == 0 ? duration_ms : std::min(statistics.min_ms, duration_ms);
+    statistics.max_ms = std::max(statistics.max_ms, duration_ms);
+    statistics.total_ms += duration_ms;
+    ++statistics.count;
+    ++statistics.histogram[get_histogram_bucket(end - start)];
+}
+
+std::string StepTracer::get_chrome_trace() const {
+    std::lock_guard<std::mutex> lock(m_trace->mutex);
+    nlohmann::json events = nlohmann::json::array();
+    for (const Event& event : m_trace->events) {
+        const std::string& category = m_trace->categories[event.category_id];
+        events.push_back({
+            {"name", event.name},
+            {"cat", category.empty() ? "pipeline" : category},
+            {"ph", "X"},
+            {"ts", to_microseconds(event.start - m_trace->origin)},
+            {"dur", to_microseconds(event.end - event.start)},
+            {"pid", 0},
+            {"tid", event.thread_id}
+        });
+    }
+
+    nlohmann::json trace = {
+        {"traceEvents", std::move(events)},
+        {"displayTimeUnit", "ms"},
+        {"otherData", {{"dropped_events", m_trace->num_dropped_events}}}
+    };
+    return trace.dump();
+}
+
+std::map<std::string, TraceSpanStatistics> StepTracer::get_statistics() const {
+    std::lock_guard<std::mutex> lock(m_trace->mutex);
+    std::map<std::string, TraceSpanStatistics> statistics;
+    for (const auto& [key, span_statistics] : m_trace->statistics) {
+        const std::string& category = m_trace->categories[key.first];
+        merge(statistics[category.empty() ? key.second : category + "/" + key.second], span_statistics);
+    }
+    return statistics;
+}
+
+void StepTracer::clear() {
+    std::lock_guard<std::mutex> lock(m_trace->mutex);
+    m_trace->events.clear();
+    m_trace->num_dropped_events = 0;
+    m_trace->statistics.clear();
+}
+
+}  // namespace ov::genai
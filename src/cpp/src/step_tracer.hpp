@@ -0,0 +1,106 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+
+namespace ov::genai {
+
+/**
+ * Records durations of named parts of pipeline steps (spans) into a trace, which can be exported in Chrome trace event format
+ * (chrome://tracing, Perfetto) or aggregated per span name. Tracing is disabled by default: a disabled tracer doesn't read the clock,
+ * so spans cost an atomic load. Spans may be recorded by different threads. Copies of a tracer and tracers created by child() write
+ * to the same trace, so pipelines composed of several pipelines (e.g. speculative decoding) have one trace.
+ */
+class StepTracer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Records the time between its construction and destruction or end() if the tracer is enabled at construction.
+     * Span names must outlive the tracer, string literals are expected.
+     */
+    class Span {
+    public:
+        Span(const StepTracer& tracer, const char* name);
+        ~Span();
+
+        // records the span before the end of its scope, later calls do nothing
+        void end();
+
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+
+    private:
+        const StepTracer* m_tracer = nullptr;
+        const char* m_name;
+        Clock::time_point m_start;
+    };
+
+    // number of events kept for get_chrome_trace(), later spans are aggregated by get_statistics() only
+    static constexpr size_t DEFAULT_MAX_EVENTS = 1 << 20;
+
+    explicit StepTracer(size_t max_events = DEFAULT_MAX_EVENTS);
+
+    // a tracer writing to the same trace, its spans are prefixed by `category`, e.g. "draft/scheduling"
+    StepTracer child(const std::string& category) const;
+
+    void set_enabled(bool enabled);
+    bool is_enabled() const;
+
+    void record(const char* name, Clock::time_point start, Clock::time_point end) const;
+
+    // JSON object in Chrome trace event format with complete ("X") events, timestamps are relative to the tracer creation
+    std::string get_chrome_trace() const;
+
+    // statistics of all spans recorded since the tracer creation or the last clear(), keyed by a prefixed span name
+    std::map<std::string, TraceSpanStatistics> get_statistics() const;
+
+    // removes recorded events and statistics, doesn't change whether tracing is enabled
+    void clear();
+
+private:
+    struct Event {
+        const char* name;
+        size_t category_id;
+        size_t thread_id;
+        Clock::time_point start;
+        Clock::time_point end;
+    };
+
+    struct Trace {
+        std::atomic<bool> enabled{false};
+        const size_t max_events;
+        const Clock::time_point origin = Clock::now();
+
+        std::mutex mutex;
+        std::vector<Event> events;
+        size_t num_dropped_events = 0;
+        // categories are registered by child(), 0 is the root tracer
+        std::vector<std::string> categories{""};
+        // small ids are more readable in a trace viewer than hashes of std::thread::id
+        std::unordered_map<std::thread::id, size_t> thread_ids;
+        // keyed by name pointers to avoid string construction, spans with equal names are merged by get_statistics()
+        std::map<std::pair<size_t, const char*>, TraceSpanStatistics> statistics;
+
+        explicit Trace(size_t max_events) : max_events(max_events) {}
+    };
+
+    StepTracer(std::shared_ptr<Trace> trace, size_t category_id);
+
+    std::shared_ptr<Trace> m_trace;
+    size_t m_category_id = 0;
+};
+
+}  // namespace ov::genai
@@ -29,7 +29,7 @@ public:
     T pull() {
         std::unique_lock<std::mutex> lock(m_mutex);
         m_cv.wait(lock, [this]{return !m_queue.empty();});
-        auto val = m_queue.front();
+        auto val = std::move(m_queue.front());
         m_queue.pop();
         return val;
     }
@@ -40,6 +40,12 @@ public:
         m_cv.notify_one();
     }
 
+    void push(T&& item) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_queue.push(std::move(item));
+        m_cv.notify_one();
+    }
+
     bool empty() {
         std::unique_lock<std::mutex> lock(m_mutex);
         return m_queue.empty();
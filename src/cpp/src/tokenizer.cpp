@@ -1,21 +1,25 @@
 // Copyright (C) 2023-2024 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <memory>
-#include <jinja2cpp/template.h>
-#include <jinja2cpp/template_env.h>
+#include <numeric>
+#include <unordered_map>
 #include <jinja2cpp/user_callable.h>
 #include <jinja2cpp/generic_list.h>
 #include <jinja2cpp/generic_list_iterator.h>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/runtime/core.hpp"
 #include "openvino/genai/tokenizer.hpp"
 
 #include "make_tokenizer_stateful.hpp"
 #include "tokenizers_path.hpp"
+#include "chat_template_cache.hpp"
 #include "circular_buffer_queue.hpp"
 #include "json_utils.hpp"
 #include "utils.hpp"
@@ -55,6 +59,54 @@ ov::genai::TokenizedInputs pad_left(ov::Tensor& input_ids, ov::Tensor& attention
     return {input_ids, attention_mask};
 }
 
+// batches of more items are split into sub-batches of items of similar lengths, so less padding is processed,
+// and sub-batches are processed in parallel by infer requests of a pool
+constexpr size_t MAX_SUB_BATCH_SIZE = 128;
+
+size_t get_num_sub_batches(size_t batch_size) {
+    return (batch_size + MAX_SUB_BATCH_SIZE - 1) / MAX_SUB_BATCH_SIZE;
+}
+
+// indices of items sorted by their sizes, contiguous ranges of the indices form sub-batches with little padding
+template <typename Items>
+std::vector<size_t> argsort_by_size(const Items& items) {
+    std::vector<size_t> order(items.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&items](size_t a, size_t b) {
+        return items[a].size() < items[b].size();
+    });
+    return order;
+}
+
+// Calls process(infer_request_guard, sub_batch, begin, end) for each sub-batch [begin, end) of a batch.
+// Sub-batches are taken by as many threads as the pool has infer requests, each thread holds one infer request.
+template <typename Process>
+void for_each_sub_batch(ov::genai::CircularBufferQueue<ov::InferRequest>& queue, size_t batch_size, const Process& process) {
+    const size_t num_sub_batches = get_num_sub_batches(batch_size);
+    const size_t num_workers = std::min(queue.size(), num_sub_batches);
+    std::atomic<size_t> next_sub_batch{0};
+
+    auto work = [&]() {
+        ov::genai::CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(&queue);
+        for (size_t sub_batch = next_sub_batch++; sub_batch < num_sub_batches; sub_batch = next_sub_batch++) {
+            size_t begin = 0, end = 0;
+            ov::splitter(batch_size, num_sub_batches, sub_batch, begin, end);
+            process(infer_request_guard, sub_batch, begin, end);
+        }
+    };
+
+    std::vector<std::future<void>> workers;
+    for (size_t worker = 1; worker < num_workers; ++worker) {
+        workers.push_back(std::async(std::launch::async, work));
+    }
+    if (num_workers > 0) {
+        work();
+    }
+    for (auto& worker : workers) {
+        worker.get();
+    }
+}
+
 void check_arguments(const ov::AnyMap& parameters, std::set<std::string> allowed_argnames) {
     for (const auto& [key, value] : parameters) {
         if (allowed_argnames.find(key) == allowed_argnames.end()) {
@@ -93,10 +145,18 @@ public:
     std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_ireq_queue_tokenizer;
     std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_ireq_queue_detokenizer;
     // To change the adding special tokens mode we use a statefull subgraph, 
-    // this flag holds the current state value of the CompiledModel.
-    bool m_add_special_tokens = true;
-    bool m_skip_special_tokens = true;
+    // these flags hold the last requested values, which are used by default by next calls.
+    std::atomic<bool> m_add_special_tokens{true};
+    std::atomic<bool> m_skip_special_tokens{true};
     bool m_older_than_24_5 = false;
+
+    struct SpecialTokensState {
+        bool add_special_tokens = true;
+        bool skip_special_tokens = true;
+    };
+    // State values of each infer request of the pools. Entries are created together with the pools,
+    // so concurrent calls holding different infer requests only update their own entries.
+    std::unordered_map<const ov::InferRequest*, SpecialTokensState> m_infer_request_states;
     
     int64_t m_pad_token_id = -1;
     int64_t m_bos_token_id = -1;
@@ -107,6 +167,8 @@ public:
     std::string m_eos_token = {};
 
     std::string m_chat_template = {};
+    // parsed m_chat_template and recently used custom templates
+    mutable ChatTemplateCache m_chat_template_cache;
 
     void set_state_if_necessary(CircularBufferQueueElementGuard<ov::InferRequest>& infer_request_guard, const ov::AnyMap& params) {
         bool add_special_tokens_flag = m_add_special_tokens;
@@ -114,19 +176,23 @@ public:
         ov::genai::utils::read_anymap_param(params, add_special_tokens.name(), add_special_tokens_flag);
         ov::genai::utils::read_anymap_param(params, skip_special_tokens.name(), skip_special_tokens_flag);
 
-        // If user requested add_special_tokens mode different from the current one,
-        // need to set state variable.
-        // If requested mode matches the stored state set, then don't touch states.
-        if (add_special_tokens_flag == m_add_special_tokens && skip_special_tokens_flag == m_skip_special_tokens) {
-            return;
-        }
         if (m_older_than_24_5) {
             // Changing add_special_tokens at runtime was introduced in
             // 24.5. Older tokenizers still allow manipulating their
             // state but the effect is incorrect.
             return;
         }
-        
+        m_add_special_tokens = add_special_tokens_flag;
+        m_skip_special_tokens = skip_special_tokens_flag;
+
+        // If user requested add_special_tokens mode different from the current one of the infer request,
+        // need to set state variable.
+        // If requested mode matches the stored state set, then don't touch states.
+        SpecialTokensState& request_state = m_infer_request_states.at(&infer_request_guard.get());
+        if (add_special_tokens_flag == request_state.add_special_tokens && skip_special_tokens_flag == request_state.skip_special_tokens) {
+            return;
+        }
+
         // add_special_tokens is managed by Select op with a bool input.
         ov::Tensor add_special_tensor = ov::Tensor(ov::element::boolean, {});
         *add_special_tensor.data<bool>() = add_special_tokens_flag;
@@ -142,8 +208,13 @@ public:
                 state.set_state(skip_special_tensor);
             }
         }
-        m_add_special_tokens = add_special_tokens_flag;
-        m_skip_special_tokens = skip_special_tokens_flag;
+        request_state = {add_special_tokens_flag, skip_special_tokens_flag};
+    }
+
+    void add_infer_request_states(CircularBufferQueue<ov::InferRequest>& queue) {
+        for (size_t i = 0; i < queue.size(); ++i) {
+            m_infer_request_states.emplace(&queue.get(static_cast<int>(i)), SpecialTokensState{});
+        }
     }
 
     TokenizerImpl() = default;
@@ -216,6 +287,7 @@ public:
                 [this]() -> ov::InferRequest {
                     return std::move(this->m_tokenizer.create_infer_request());
                 });
+            add_infer_request_states(*m_ireq_queue_tokenizer);
         }
 
         if (ov_detokenizer) {
@@ -230,6 +302,7 @@ public:
                 [this]() -> ov::InferRequest {
                     return std::move(this->m_detokenizer.create_infer_request());
                 });
+            add_infer_request_states(*m_ireq_queue_detokenizer);
         }
         
         // Initialize tokenizer's cache to save time later.
@@ -403,7 +476,9 @@ public:
         OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
                                                 "Tokenizer::encode is not available");
         TokenizedInputs unpadded;
-        {
+        if (prompts.size() > MAX_SUB_BATCH_SIZE) {
+            unpadded = encode_sub_batches(prompts, tokenization_params);
+        } else {
             CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_tokenizer.get());
             set_state_if_necessary(infer_request_guard, tokenization_params);
             infer_request_guard.get().set_input_tensor(ov::Tensor{ov::element::string, {prompts.size()}, prompts.data()});
@@ -419,6 +494,67 @@ public:
         return pad_left(unpadded.input_ids, unpadded.attention_mask);
     }
 
+    // Tokenizes sub-batches of prompts of similar lengths in parallel and gathers right padded results in the order of prompts.
+    TokenizedInputs encode_sub_batches(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params) {
+        // byte lengths of prompts approximate their lengths in tokens
+        const std::vector<size_t> order = argsort_by_size(prompts);
+        std::vector<TokenizedInputs> sub_batch_results(get_num_sub_batches(prompts.size()));
+
+        for_each_sub_batch(*m_ireq_queue_tokenizer, prompts.size(),
+            [&](CircularBufferQueueElementGuard<ov::InferRequest>& infer_request_guard, size_t sub_batch, size_t begin, size_t end) {
+                std::vector<std::string> sub_batch_prompts;
+                sub_batch_prompts.reserve(end - begin);
+                for (size_t i = begin; i < end; ++i) {
+                    sub_batch_prompts.push_back(prompts[order[i]]);
+                }
+
+                set_state_if_necessary(infer_request_guard, tokenization_params);
+                infer_request_guard.get().set_input_tensor(ov::Tensor{ov::element::string, {sub_batch_prompts.size()}, sub_batch_prompts.data()});
+                infer_request_guard.get().start_async();
+                infer_request_guard.get().wait();
+
+                sub_batch_results[sub_batch] = get_copied_results(
+                    infer_request_guard.get().get_tensor("input_ids"),
+                    infer_request_guard.get().get_tensor("attention_mask")
+                );
+            });
+
+        size_t max_length = 0;
+        int64_t pad_token_id = m_pad_token_id;
+        for (const TokenizedInputs& result : sub_batch_results) {
+            OPENVINO_ASSERT(result.input_ids.get_element_type() == ov::element::i64 && result.attention_mask.get_element_type() == ov::element::i64,
+                            "Tokenizer is expected to produce i64 input_ids and attention_mask");
+            const size_t length = result.input_ids.get_shape()[1];
+            max_length = std::max(max_length, length);
+            // shorter sub-batches are padded with the value the tokenizer uses
+            const int64_t* attention_mask_data = result.attention_mask.data<const int64_t>();
+            if (length > 0 && attention_mask_data[length - 1] == 0) {
+                pad_token_id = result.input_ids.data<const int64_t>()[length - 1];
+            }
+        }
+
+        ov::Tensor input_ids{ov::element::i64, {prompts.size(), max_length}};
+        ov::Tensor attention_mask{ov::element::i64, {prompts.size(), max_length}};
+        int64_t* input_ids_data = input_ids.data<int64_t>();
+        int64_t* attention_mask_data = attention_mask.data<int64_t>();
+        for (size_t sub_batch = 0; sub_batch < sub_batch_results.size(); ++sub_batch) {
+            size_t begin = 0, end = 0;
+            ov::splitter(prompts.size(), sub_batch_results.size(), sub_batch, begin, end);
+            const size_t length = sub_batch_results[sub_batch].input_ids.get_shape()[1];
+            const int64_t* sub_batch_input_ids = sub_batch_results[sub_batch].input_ids.data<const int64_t>();
+            const int64_t* sub_batch_attention_mask = sub_batch_results[sub_batch].attention_mask.data<const int64_t>();
+
+            for (size_t i = begin; i < end; ++i) {
+                const size_t src_offset = (i - begin) * length, dst_offset = order[i] * max_length;
+                std::copy_n(sub_batch_input_ids + src_offset, length, input_ids_data + dst_offset);
+                std::fill(input_ids_data + dst_offset + length, input_ids_data + dst_offset + max_length, pad_token_id);
+                std::copy_n(sub_batch_attention_mask + src_offset, length, attention_mask_data + dst_offset);
+                std::fill(attention_mask_data + dst_offset + length, attention_mask_data + dst_offset + max_length, 0);
+            }
+        }
+        return {input_ids, attention_mask};
+    }
+
     TokenizedInputs get_copied_results(ov::Tensor input_ids, ov::Tensor attention_mask) {
         ov::Tensor input_ids_ = ov::Tensor(input_ids.get_element_type(), input_ids.get_shape());
         ov::Tensor attention_mask_ = ov::Tensor(attention_mask.get_element_type(), attention_mask.get_shape());
@@ -459,29 +595,35 @@ public:
     std::vector<std::string> decode(std::vector<std::vector<int64_t>> lines, const ov::AnyMap& detokenization_params = {}) {
         OPENVINO_ASSERT(m_detokenizer, "Detokenize model has not been provided. Tokenizer::decode is not available");
 
-        auto compare_lengths = [](const std::vector<int64_t>& a, const std::vector<int64_t>& b) {
-            return a.size() < b.size();
-        };
-        size_t max_len = std::max_element(lines.begin(), lines.end(), compare_lengths)->size();
-
-        ov::Tensor tokens = ov::Tensor{ov::element::i64, {lines.size(), max_len}};
-        auto tokens_data = tokens.data<int64_t>();
-
-        for (size_t i = 0; i < lines.size(); ++i) {
-            const auto& line = lines[i];
-            size_t line_len = line.size();
-            std::copy(line.begin(), line.end(), tokens_data + i * max_len);
-            std::fill(tokens_data + i * max_len + line_len, tokens_data + (i + 1) * max_len, m_pad_token_id);
-        }
+        // Lines are sorted by length and padded within sub-batches only,
+        // sub-batches of large batches are detokenized in parallel.
+        const std::vector<size_t> order = argsort_by_size(lines);
+        std::vector<std::string> texts(lines.size());
+
+        for_each_sub_batch(*m_ireq_queue_detokenizer, lines.size(),
+            [&](CircularBufferQueueElementGuard<ov::InferRequest>& infer_request_guard, size_t, size_t begin, size_t end) {
+                // the last line of a sub-batch is the longest one
+                const size_t max_len = lines[order[end - 1]].size();
+                ov::Tensor tokens = ov::Tensor{ov::element::i64, {end - begin, max_len}};
+                auto tokens_data = tokens.data<int64_t>();
+
+                for (size_t i = begin; i < end; ++i) {
+                    const auto& line = lines[order[i]];
+                    int64_t* row = tokens_data + (i - begin) * max_len;
+                    std::copy(line.begin(), line.end(), row);
+                    std::fill(row + line.size(), row + max_len, m_pad_token_id);
+                }
 
-        CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_detokenizer.get());
-        set_state_if_necessary(infer_request_guard, detokenization_params);
-        infer_request_guard.get().set_input_tensor(tokens);
-        infer_request_guard.get().start_async();
-        infer_request_guard.get().wait();
-        auto res = infer_request_guard.get().get_output_tensor();
-        auto res_data = res.data<std::string>();
-        return std::vector<std::string>(res_data, res_data + res.get_shape()[0]);
+                set_state_if_necessary(infer_request_guard, detokenization_params);
+                infer_request_guard.get().set_input_tensor(tokens);
+                infer_request_guard.get().start_async();
+                infer_request_guard.get().wait();
+                auto res_data = infer_request_guard.get().get_output_tensor().data<std::string>();
+                for (size_t i = begin; i < end; ++i) {
+                    texts[order[i]] = res_data[i - begin];
+                }
+            });
+        return texts;
     }
 
     std::string patch_chat_template(std::string template_str) const {
@@ -532,13 +674,8 @@ public:
                         "Chat template wasn't found. This may indicate that the model wasn't trained for chat scenario."
                         " Please add 'chat_template' to tokenizer_config.json to use the model in chat scenario."
                         " For more information see the section Troubleshooting in README.md");
-        jinja2::TemplateEnv env;
-        env.GetSettings().lstripBlocks = true;
-        env.GetSettings().trimBlocks = true;
-        jinja2::Template tpl(&env);
-        tpl.Load(chat_tpl);
-        
-        jinja2::UserCallable slice_callable = jinja2::MakeCallable(
+
+        static const jinja2::UserCallable slice_callable = jinja2::MakeCallable(
             [](const jinja2::GenericList& messages, const size_t& start) {
                 jinja2::ValuesList result;
 
@@ -571,7 +708,7 @@ public:
         };
 
         try {
-            return tpl.RenderAsString(params).value();
+            return m_chat_template_cache.render(chat_tpl, params);
         } catch (const std::exception& error) {
             OPENVINO_THROW("Chat template for the current model is not supported by Jinja2Cpp. "
                            "Please apply template manually to your prompt before calling generate. "
@@ -3,6 +3,7 @@
 
 #include "utils.hpp"
 
+#include <algorithm>
 #include <fstream>
 
 #include "openvino/op/add.hpp"
@@ -374,6 +375,7 @@ void trim_kv_cache(ov::InferRequest request, uint64_t remove_from_end, size_t se
 
         auto trimmed_tensor = ov::Tensor(old_tensor, new_shape_begin, new_shape_end);
 
+        // the ROI aliases plugin memory of the state, so it is copied before the state is reset
         ov::Tensor new_tensor(old_tensor.get_element_type(), shape);
         trimmed_tensor.copy_to(new_tensor);
 
@@ -381,6 +383,61 @@ void trim_kv_cache(ov::InferRequest request, uint64_t remove_from_end, size_t se
     }
 }
 
+size_t mask_kv_cache_tail(ov::Tensor& attention_mask, uint64_t remove_from_end) {
+    OPENVINO_ASSERT(attention_mask.get_shape().size() == 2 && attention_mask.get_shape()[0] == 1,
+                    "KV cache can be masked for a single sequence only");
+    int64_t* mask = attention_mask.data<int64_t>();
+    size_t num_tokens = std::count(mask, mask + attention_mask.get_size(), 1);
+    OPENVINO_ASSERT(remove_from_end <= num_tokens, "Can't remove ", remove_from_end, " tokens from KV cache of ", num_tokens, " tokens");
+
+    // tokens masked by previous calls are skipped
+    for (size_t i = attention_mask.get_size(); i > 0 && remove_from_end > 0; --i) {
+        if (mask[i - 1] == 1) {
+            mask[i - 1] = 0;
+            --remove_from_end;
+            --num_tokens;
+        }
+    }
+    return num_tokens;
+}
+
+void compact_kv_cache(ov::InferRequest request, const ov::Tensor& attention_mask, size_t seq_length_axis, std::optional<AdapterController> adapter_controller) {
+    const int64_t* mask = attention_mask.data<const int64_t>();
+    // [begin, end) ranges of unmasked tokens
+    std::vector<std::pair<size_t, size_t>> ranges;
+    for (size_t i = 0; i < attention_mask.get_size(); ++i) {
+        if (mask[i] == 1 && (ranges.empty() || ranges.back().second != i))
+            ranges.emplace_back(i, i);
+        if (mask[i] == 1)
+            ranges.back().second = i + 1;
+    }
+
+    for (auto& state : request.query_state()) {
+        if (adapter_controller && adapter_controller->has_state_name(state.get_name()))
+            continue;
+
+        ov::Tensor old_tensor = state.get_state();
+        ov::Shape shape = old_tensor.get_shape();
+        OPENVINO_ASSERT(shape[seq_length_axis] == attention_mask.get_size(), "KV cache state '", state.get_name(),
+                        "' doesn't match the attention mask");
+        shape[seq_length_axis] = 0;
+        for (const auto& range : ranges)
+            shape[seq_length_axis] += range.second - range.first;
+
+        ov::Tensor new_tensor(old_tensor.get_element_type(), shape);
+        ov::Coordinate src_begin(shape.size(), 0), src_end(old_tensor.get_shape()), dst_begin(shape.size(), 0), dst_end(shape);
+        for (const auto& range : ranges) {
+            src_begin[seq_length_axis] = range.first;
+            src_end[seq_length_axis] = range.second;
+            dst_end[seq_length_axis] = dst_begin[seq_length_axis] + range.second - range.first;
+            ov::Tensor src_roi(old_tensor, src_begin, src_end), dst_roi(new_tensor, dst_begin, dst_end);
+            src_roi.copy_to(dst_roi);
+            dst_begin[seq_length_axis] = dst_end[seq_length_axis];
+        }
+        state.set_state(new_tensor);
+    }
+}
+
 ov::Tensor push_front_inputs(const ov::Tensor& base_tensor, int64_t add_to_front) {
     ov::Tensor new_tensor = ov::Tensor{ov::element::i64, {base_tensor.get_shape().at(0), base_tensor.get_shape().at(1) + 1}};
     auto new_tensor_data = new_tensor.data<int64_t>();
@@ -117,8 +117,24 @@ size_t get_first_history_difference(const ov::Tensor& encoded_history, const std
 
 size_t get_seq_len_axis(std::shared_ptr<const ov::Model> model);
 
+/**
+ * Removes the last `remove_from_end` tokens from KV cache states. It costs a copy of every state: OpenVINO states are set by copying
+ * and a ROI of a state may alias the plugin memory being overwritten. Pipelines with models taking position_ids use mask_kv_cache_tail() instead.
+ */
 void trim_kv_cache(ov::InferRequest request, uint64_t remove_from_end, size_t seq_length_axis, std::optional<AdapterController> adapter_controller);
 
+/**
+ * Removes the last `remove_from_end` tokens from KV cache by zeroing them in `attention_mask` of [1, kv_cache_len] shape, states aren't changed.
+ * Positions of the following tokens are counted by the mask, so it's valid for models taking position_ids only. Returns the number of unmasked tokens.
+ */
+size_t mask_kv_cache_tail(ov::Tensor& attention_mask, uint64_t remove_from_end);
+
+/**
+ * Removes tokens masked in `attention_mask` of [1, kv_cache_len] shape from KV cache states, so masked tokens don't accumulate.
+ * Like trim_kv_cache(), it copies every state.
+ */
+void compact_kv_cache(ov::InferRequest request, const ov::Tensor& attention_mask, size_t seq_length_axis, std::optional<AdapterController> adapter_controller);
+
 ov::Tensor push_front_inputs(const ov::Tensor& base_tensor, int64_t add_to_front);
 
 void print_compiled_model_properties(ov::CompiledModel& compiled_Model, const char* model_title);
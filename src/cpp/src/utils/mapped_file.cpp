@@ -0,0 +1,130 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "utils/mapped_file.hpp"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+namespace utils {
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+    // the time is taken before mapping, so a concurrent modification makes the mapping look outdated rather than fresh
+    m_last_write_time = std::filesystem::last_write_time(path);
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    OPENVINO_ASSERT(file != INVALID_HANDLE_VALUE, "Cannot open file ", path);
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        OPENVINO_THROW("Cannot map empty file ", path);
+    }
+    m_size = static_cast<size_t>(file_size.QuadPart);
+
+    // the view keeps the file mapping alive after handles are closed
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping != nullptr) {
+        m_data = static_cast<char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+    OPENVINO_ASSERT(m_data != nullptr, "Cannot map file ", path);
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    OPENVINO_ASSERT(fd != -1, "Cannot open file ", path);
+
+    struct stat file_stat = {};
+    if (fstat(fd, &file_stat) == -1 || file_stat.st_size == 0) {
+        close(fd);
+        OPENVINO_THROW("Cannot map empty file ", path);
+    }
+    m_size = static_cast<size_t>(file_stat.st_size);
+
+    // the mapping keeps the file alive after the descriptor is closed
+    void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    OPENVINO_ASSERT(data != MAP_FAILED, "Cannot map file ", path);
+    m_data = static_cast<char*>(data);
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+#else
+    munmap(m_data, m_size);
+#endif
+}
+
+size_t MappedFile::get_resident_size() const {
+#ifdef _WIN32
+    return 0;
+#else
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    std::vector<unsigned char> pages((m_size + page_size - 1) / page_size);
+#    ifdef __APPLE__
+    using PageVector = char*;
+#    else
+    using PageVector = unsigned char*;
+#    endif
+    if (mincore(m_data, m_size, reinterpret_cast<PageVector>(pages.data())) != 0) {
+        return 0;
+    }
+
+    size_t resident_pages = 0;
+    for (unsigned char page : pages) {
+        resident_pages += page & 1;
+    }
+    return std::min(resident_pages * page_size, m_size);
+#endif
+}
+
+std::shared_ptr<MappedFile> MappedFile::open_shared(const std::filesystem::path& path) {
+    static std::mutex mutex;
+    static std::map<std::filesystem::path, std::weak_ptr<MappedFile>> mapped_files;
+
+    const std::filesystem::path key = std::filesystem::absolute(path).lexically_normal();
+    const auto last_write_time = std::filesystem::last_write_time(key);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    // forget mappings released by all holders
+    for (auto it = mapped_files.begin(); it != mapped_files.end();) {
+        it = it->second.expired() ? mapped_files.erase(it) : std::next(it);
+    }
+
+    if (auto it = mapped_files.find(key); it != mapped_files.end()) {
+        std::shared_ptr<MappedFile> mapped_file = it->second.lock();
+        if (mapped_file && mapped_file->last_write_time() == last_write_time) {
+            return mapped_file;
+        }
+    }
+
+    auto mapped_file = std::make_shared<MappedFile>(key);
+    mapped_files[key] = mapped_file;
+    return mapped_file;
+}
+
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
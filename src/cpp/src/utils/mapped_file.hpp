@@ -0,0 +1,56 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+
+namespace ov {
+namespace genai {
+namespace utils {
+
+/**
+ * Memory mapping of a whole file opened for reading. Pages are loaded on demand by the OS and are shared with the page
+ * cache, so mapping a file doesn't allocate heap memory for its contents. The mapping is read-only, so its pages are never
+ * copied to private memory. The mapping is released by the destructor.
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::filesystem::path& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * Returns a mapping of the file shared with other callers which mapped the same file and still hold the mapping.
+     * The file is mapped again if it was modified after the existing mapping was created.
+     */
+    static std::shared_ptr<MappedFile> open_shared(const std::filesystem::path& path);
+
+    const char* data() const {
+        return m_data;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+    const std::filesystem::file_time_type& last_write_time() const {
+        return m_last_write_time;
+    }
+
+    // returns number of bytes of the mapping which are resident in physical memory, 0 if it can't be queried on this OS
+    size_t get_resident_size() const;
+
+private:
+    char* m_data = nullptr;
+    size_t m_size = 0;
+    std::filesystem::file_time_type m_last_write_time;
+};
+
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
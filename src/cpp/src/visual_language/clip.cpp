@@ -4,116 +4,119 @@
 // Based on clip.cpp
 
 #include "clip.hpp"
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
-// Linear interpolation between two points
-static float clip_lerp(float s, float e, float t) {
-    return s + (e - s) * t;
-}
+#include "openvino/core/parallel.hpp"
 
-// Bilinear resize function
-static void bilinear_resize(const clip_image_u8& src, clip_image_u8& dst, int target_width, int target_height) {
-    dst.nx = target_width;
-    dst.ny = target_height;
-    dst.buf.resize(3 * target_width * target_height);
+namespace {
 
-    float x_ratio = static_cast<float>(src.nx - 1) / target_width;
-    float y_ratio = static_cast<float>(src.ny - 1) / target_height;
-
-    for (int y = 0; y < target_height; y++) {
-        for (int x = 0; x < target_width; x++) {
-            float px = x_ratio * x;
-            float py = y_ratio * y;
-            int x_floor = static_cast<int>(px);
-            int y_floor = static_cast<int>(py);
-            float x_lerp = px - x_floor;
-            float y_lerp = py - y_floor;
-
-            for (int c = 0; c < 3; c++) {
-                float top = clip_lerp(
-                    static_cast<float>(src.buf[3 * (y_floor * src.nx + x_floor) + c]),
-                    static_cast<float>(src.buf[3 * (y_floor * src.nx + (x_floor + 1)) + c]),
-                    x_lerp
-                );
-                float bottom = clip_lerp(
-                    static_cast<float>(src.buf[3 * ((y_floor + 1) * src.nx + x_floor) + c]),
-                    static_cast<float>(src.buf[3 * ((y_floor + 1) * src.nx + (x_floor + 1)) + c]),
-                    x_lerp
-                );
-                dst.buf[3 * (y * target_width + x) + c] = static_cast<uint8_t>(clip_lerp(top, bottom, y_lerp));
-            }
-        }
-    }
-}
+constexpr int RESIZE_TAPS = 4;
+
+// source pixels of each output pixel along one dimension and their weights
+struct resize_taps {
+    std::vector<int> index;
+    std::vector<float> weight;
+};
 
 template<typename NUM>
 NUM clip(NUM x, NUM lower, NUM upper) {
     return std::max(lower, std::min(x, upper));
 }
 
-void bicubic_resize(const clip_image_u8 &img, clip_image_u8 &dst, int target_width, int target_height) {
-    const int nx = img.nx;
-    const int ny = img.ny;
+// cubic convolution of ViT.cpp expressed as weights of pixels x - 1, x, x + 1 and x + 2
+resize_taps bicubic_taps(int src_size, int dst_size) {
+    resize_taps taps{std::vector<int>(RESIZE_TAPS * dst_size), std::vector<float>(RESIZE_TAPS * dst_size)};
+    const float scale = (float)src_size / (float)dst_size;
+    for (int i = 0; i < dst_size; ++i) {
+        const int x = (int)(scale * i);
+        const float t = scale * i - x, t2 = t * t, t3 = t2 * t;
+        const float weights[RESIZE_TAPS] = {
+            -t / 3.0f + t2 / 2.0f - t3 / 6.0f,
+            1.0f - t / 2.0f - t2 + t3 / 2.0f,
+            t + t2 / 2.0f - t3 / 2.0f,
+            -t / 6.0f + t3 / 6.0f
+        };
+        for (int k = 0; k < RESIZE_TAPS; ++k) {
+            taps.index[RESIZE_TAPS * i + k] = clip(x - 1 + k, 0, src_size - 1);
+            taps.weight[RESIZE_TAPS * i + k] = weights[k];
+        }
+    }
+    return taps;
+}
+
+// linear interpolation between pixels at floor((src_size - 1) / dst_size * i) and the next one
+resize_taps bilinear_taps(int src_size, int dst_size) {
+    resize_taps taps{std::vector<int>(RESIZE_TAPS * dst_size), std::vector<float>(RESIZE_TAPS * dst_size, 0.0f)};
+    const float ratio = static_cast<float>(src_size - 1) / dst_size;
+    for (int i = 0; i < dst_size; ++i) {
+        const float p = ratio * i;
+        const int floor = static_cast<int>(p);
+        const float t = p - floor;
+        for (int k = 0; k < RESIZE_TAPS; ++k) {
+            taps.index[RESIZE_TAPS * i + k] = clip(floor + k / 2, 0, src_size - 1);
+        }
+        taps.weight[RESIZE_TAPS * i + 1] = 1.0f - t;
+        taps.weight[RESIZE_TAPS * i + 2] = t;
+    }
+    return taps;
+}
 
+// rounds results if `round` is true, truncates them otherwise
+void separable_resize(const clip_image_u8& src, clip_image_u8& dst, int target_width, int target_height,
+                      const resize_taps& taps_x, const resize_taps& taps_y, bool round) {
     dst.nx = target_width;
     dst.ny = target_height;
     dst.buf.resize(3 * target_width * target_height);
 
-    float Cc;
-    float C[5];
-    float d0, d2, d3, a0, a1, a2, a3;
-    int i, j, k, jj;
-    int x, y;
-    float dx, dy;
-    float tx, ty;
-
-    tx = (float)nx / (float)target_width;
-    ty = (float)ny / (float)target_height;
-
-    // Bicubic interpolation; adapted from ViT.cpp, inspired from :
-    //    -> https://github.com/yglukhov/bicubic-interpolation-image-processing/blob/master/libimage.c#L36
-    //    -> https://en.wikipedia.org/wiki/Bicubic_interpolation
-
-    for (i = 0; i < target_height; i++) {
-        for (j = 0; j < target_width; j++) {
-            x = (int)(tx * j);
-            y = (int)(ty * i);
-
-            dx = tx * j - x;
-            dy = ty * i - y;
-
-            for (k = 0; k < 3; k++) {
-                for (jj = 0; jj <= 3; jj++) {
-                    d0 = img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x - 1, 0, nx - 1)) * 3 + k] - img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x, 0, nx - 1)) * 3 + k];
-                    d2 = img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x + 1, 0, nx - 1)) * 3 + k] - img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x, 0, nx - 1)) * 3 + k];
-                    d3 = img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x + 2, 0, nx - 1)) * 3 + k] - img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x, 0, nx - 1)) * 3 + k];
-                    a0 = img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x, 0, nx - 1)) * 3 + k];
-
-                    a1 = -1.0 / 3 * d0 + d2 - 1.0 / 6 * d3;
-                    a2 =  1.0 / 2 * d0 +      1.0 / 2 * d2;
-                    a3 = -1.0 / 6 * d0 -      1.0 / 2 * d2 + 1.0 / 6 * d3;
-
-                    C[jj] = a0 + a1 * dx + a2 * dx * dx + a3 * dx * dx * dx;
-
-                    d0 = C[0] - C[1];
-                    d2 = C[2] - C[1];
-                    d3 = C[3] - C[1];
-                    a0 = C[1];
-                    a1 = -1.0 / 3 * d0 + d2 - 1.0 / 6 * d3;
-                    a2 =  1.0 / 2 * d0 +      1.0 / 2 * d2;
-                    a3 = -1.0 / 6 * d0 -      1.0 / 2 * d2 + 1.0 / 6 * d3;
-                    Cc = a0 + a1 * dy + a2 * dy * dy + a3 * dy * dy * dy;
-
-                    const uint8_t Cc2 = std::min(std::max(std::round(Cc), 0.0f), 255.0f);
-                    dst.buf[(i * target_width + j) * 3 + k] = float(Cc2);
+    // only source rows referenced by output rows are resized horizontally
+    const auto [first_row, last_row] = std::minmax_element(taps_y.index.begin(), taps_y.index.end());
+    const int row_begin = *first_row, num_rows = *last_row - *first_row + 1;
+    const size_t row_size = 3 * size_t(target_width);
+
+    std::vector<float> rows(num_rows * row_size);
+    ov::parallel_for(num_rows, [&](int row) {
+        const uint8_t* src_row = src.buf.data() + 3 * size_t(row_begin + row) * src.nx;
+        float* dst_row = rows.data() + row * row_size;
+        for (int x = 0; x < target_width; ++x) {
+            const int* index = taps_x.index.data() + RESIZE_TAPS * x;
+            const float* weight = taps_x.weight.data() + RESIZE_TAPS * x;
+            for (int c = 0; c < 3; ++c) {
+                float value = 0.0f;
+                for (int k = 0; k < RESIZE_TAPS; ++k) {
+                    value += weight[k] * src_row[3 * index[k] + c];
                 }
+                dst_row[3 * x + c] = value;
             }
         }
-    }
+    });
+
+    ov::parallel_for(target_height, [&](int y) {
+        const int* index = taps_y.index.data() + RESIZE_TAPS * y;
+        const float* weight = taps_y.weight.data() + RESIZE_TAPS * y;
+        const float* row0 = rows.data() + (index[0] - row_begin) * row_size;
+        const float* row1 = rows.data() + (index[1] - row_begin) * row_size;
+        const float* row2 = rows.data() + (index[2] - row_begin) * row_size;
+        const float* row3 = rows.data() + (index[3] - row_begin) * row_size;
+        const float bias = round ? 0.5f : 0.0f;
+        uint8_t* dst_row = dst.buf.data() + y * row_size;
+        // contiguous loop without branches, it's vectorized by a compiler
+        for (size_t i = 0; i < row_size; ++i) {
+            const float value = weight[0] * row0[i] + weight[1] * row1[i] + weight[2] * row2[i] + weight[3] * row3[i];
+            dst_row[i] = static_cast<uint8_t>(std::min(std::max(value, 0.0f), 255.0f) + bias);
+        }
+    });
+}
+
+// Bilinear resize function
+void bilinear_resize(const clip_image_u8& src, clip_image_u8& dst, int target_width, int target_height) {
+    separable_resize(src, dst, target_width, target_height,
+                     bilinear_taps(src.nx, target_width), bilinear_taps(src.ny, target_height), false);
 }
 
 // llava-1.6 type of resize_and_pad (black)
-static clip_image_u8 resize_and_pad_image(const clip_image_u8& image, const std::pair<int, int>& target_resolution) {
+clip_image_u8 resize_and_pad_image(const clip_image_u8& image, const std::pair<int, int>& target_resolution) {
     int target_width = target_resolution.first;
     int target_height = target_resolution.second;
 
@@ -143,14 +146,45 @@ static clip_image_u8 resize_and_pad_image(const clip_image_u8& image, const std:
     int pad_y = (target_height - new_height) / 2;
 
     // Copy the resized image into the center of the padded buffer
-    for (int y = 0; y < new_height; ++y) {
-        for (int x = 0; x < new_width; ++x) {
-            for (int c = 0; c < 3; ++c) {
-                padded_image.buf[3 * ((y + pad_y) * target_width + (x + pad_x)) + c] = resized_image.buf[3 * (y * new_width + x) + c];
-            }
+    ov::parallel_for(new_height, [&](int y) {
+        std::copy_n(resized_image.buf.data() + 3 * y * new_width, 3 * new_width,
+                    padded_image.buf.data() + 3 * ((y + pad_y) * target_width + pad_x));
+    });
+    return padded_image;
+}
+
+}  // namespace
+
+void bicubic_resize(const clip_image_u8 &img, clip_image_u8 &dst, int target_width, int target_height) {
+    if (img.nx == target_width && img.ny == target_height) {
+        // interpolation weights are {0, 1, 0, 0}, so pixels are kept as is
+        dst = img;
+        return;
+    }
+
+    // Bicubic interpolation; adapted from ViT.cpp, inspired from :
+    //    -> https://github.com/yglukhov/bicubic-interpolation-image-processing/blob/master/libimage.c#L36
+    //    -> https://en.wikipedia.org/wiki/Bicubic_interpolation
+    separable_resize(img, dst, target_width, target_height,
+                     bicubic_taps(img.nx, target_width), bicubic_taps(img.ny, target_height), true);
+}
+
+clip_normalizer::clip_normalizer(const clip_ctx& ctx) {
+    for (int c = 0; c < 3; ++c) {
+        for (int value = 0; value < 256; ++value) {
+            table[c][value] = ((float(value) / 255.0f) - ctx.image_mean[c]) / ctx.image_std[c];
+        }
+    }
+}
+
+void clip_normalizer::normalize_row(const uint8_t* src, size_t width, float* dst, size_t channel_stride) const {
+    for (size_t c = 0; c < 3; ++c) {
+        const float* channel_table = table[c];
+        float* dst_channel = dst + c * channel_stride;
+        for (size_t x = 0; x < width; ++x) {
+            dst_channel[x] = channel_table[src[3 * x + c]];
         }
     }
-    return padded_image;
 }
 
 /**
@@ -188,72 +222,19 @@ std::pair<int, int> select_best_resolution(const std::pair<int, int> & original_
 
 // returns the normalized float tensor for llava-1.5, for spatial_unpad with anyres processing for llava-1.6 it returns the normalized image patch tensors as a vector
 clip_image_f32 clip_image_preprocess(clip_ctx& ctx, const clip_image_u8& img) {
-    bool pad_to_square = true;
-
-    clip_image_u8 temp;  // we will keep the input image data here temporarily
-    temp.nx = img.nx;
-    temp.ny = img.ny;
-    temp.buf.resize(img.buf.size());
-    memcpy(temp.buf.data(), img.buf.data(), temp.buf.size());
-
-
-    const int nx = temp.nx;
-    const int ny = temp.ny;
-
-    const int nx2 = temp.nx;
-    const int ny2 = temp.ny;
+    const int nx = img.nx;
+    const int ny = img.ny;
 
     clip_image_f32 res;
-    res.nx = nx2;
-    res.ny = ny2;
-    res.buf.resize(3 * nx2 * ny2);
-
-    const int nx3 = nx;
-    const int ny3 = ny;
-
-    const auto& m3 = ctx.image_mean; // {0.48145466f, 0.4578275f, 0.40821073f};
-    const auto& s3 = ctx.image_std;  // {0.26862954f, 0.26130258f, 0.27577711f};
-
-    for (int y = 0; y < ny3; y++) {
-        for (int x = 0; x < nx3; x++) {
-            for (int c = 0; c < 3; c++) {
-                // linear interpolation
-                const float sx = x;
-                const float sy = y;
-
-                const int x0 = std::max(0, (int)std::floor(sx));
-                const int y0 = std::max(0, (int)std::floor(sy));
-
-                const int x1 = std::min(x0 + 1, nx - 1);
-                const int y1 = std::min(y0 + 1, ny - 1);
-
-                const float dx = sx - x0;
-                const float dy = sy - y0;
-
-                const int j00 = 3 * (y0 * nx + x0) + c;
-                const int j01 = 3 * (y0 * nx + x1) + c;
-                const int j10 = 3 * (y1 * nx + x0) + c;
-                const int j11 = 3 * (y1 * nx + x1) + c;
-
-                const float v00 = temp.buf[j00];
-                const float v01 = temp.buf[j01];
-                const float v10 = temp.buf[j10];
-                const float v11 = temp.buf[j11];
-
-                const float v0 = v00 * (1.0f - dx) + v01 * dx;
-                const float v1 = v10 * (1.0f - dx) + v11 * dx;
-
-                const float v = v0 * (1.0f - dy) + v1 * dy;
-
-                const uint8_t v2 = std::min(std::max(std::round(v), 0.0f), 255.0f);
-
-                //rgb hwc ->chw
-                const int i = (y * nx3 + x) + c * nx3 * ny3;
-
-                res.buf[i] = ((float(v2) / 255.0f) - m3[c]) / s3[c];
-            }
-        }
-    }
+    res.nx = nx;
+    res.ny = ny;
+    res.buf.resize(3 * nx * ny);
+
+    //rgb hwc ->chw
+    const clip_normalizer normalizer(ctx);
+    ov::parallel_for(ny, [&](int y) {
+        normalizer.normalize_row(img.buf.data() + 3 * size_t(y) * nx, nx, res.buf.data() + size_t(y) * nx, size_t(nx) * ny);
+    });
     return res;
 }
 
@@ -275,7 +256,7 @@ std::vector<clip_image_u8> get_image_patches(
     clip_image_u8 base_patch;
     bicubic_resize(image, base_patch, base_patch_width, base_patch_height);
     
-    patches.push_back(base_patch);
+    patches.push_back(std::move(base_patch));
 
     // Select best resolution for patching
     auto best_resolution = select_best_resolution({orig_width, orig_height}, image_grid_pinpoints);
@@ -290,27 +271,20 @@ std::vector<clip_image_u8> get_image_patches(
     int patches_h = height / patch_size;
 
     // Extract patches
-    for (int h = 0; h < patches_h; ++h) {
-        for (int w = 0; w < patches_w; ++w) {
-            clip_image_u8 patch;
-            patch.nx = patch_size;
-            patch.ny = patch_size;
-            patch.buf.resize(3 * patch_size * patch_size);
-
-            for (int y = 0; y < patch_size; ++y) {
-                for (int x = 0; x < patch_size; ++x) {
-                    for (int c = 0; c < 3; ++c) {
-                        int src_y = h * patch_size + y;
-                        int src_x = w * patch_size + x;
-                        int src_idx = (src_y * width + src_x) * 3 + c;
-                        int dst_idx = (y * patch_size + x) * 3 + c;
-                        patch.buf[dst_idx] = resized_image.buf[src_idx];
-                    }
-                }
-            }
-            patches.push_back(patch);
+    patches.resize(1 + patches_h * patches_w);
+    ov::parallel_for(patches_h * patches_w, [&](int patch_idx) {
+        const int h = patch_idx / patches_w, w = patch_idx % patches_w;
+        clip_image_u8& patch = patches[1 + patch_idx];
+        patch.nx = patch_size;
+        patch.ny = patch_size;
+        patch.buf.resize(3 * patch_size * patch_size);
+
+        for (int y = 0; y < patch_size; ++y) {
+            const int src_y = h * patch_size + y;
+            std::copy_n(resized_image.buf.data() + 3 * (src_y * width + w * patch_size), 3 * patch_size,
+                        patch.buf.data() + 3 * y * patch_size);
         }
-    }
+    });
 
     return patches;
 }
@@ -30,6 +30,17 @@ struct clip_image_f32 {
     std::vector<float> buf;
 };
 
+// normalized values of each channel for every uint8 value, so normalization of an image is a table lookup
+struct clip_normalizer {
+    float table[3][256];
+
+    explicit clip_normalizer(const clip_ctx& ctx);
+
+    // writes channels of `width` RGB pixels to `dst`, `dst + channel_stride` and `dst + 2 * channel_stride`
+    void normalize_row(const uint8_t* src, size_t width, float* dst, size_t channel_stride) const;
+};
+
+/** separable resize: rows are resized horizontally and then combined vertically, both passes are split between threads */
 void bicubic_resize(const clip_image_u8& img, clip_image_u8& dst, int target_width, int target_height);
 
 /** preprocess img and store the result in res_imgs, pad_to_square may be overridden to false depending on model configuration */
@@ -5,46 +5,116 @@
 #include <memory>
 
 #include "openvino/runtime/core.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
+#include "openvino/op/convert.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/util/gather_base.hpp"
 
 #include "utils.hpp"
 
 #include "embedding_model.hpp"
 
+namespace {
+
+// rows are copied by one thread if there are less elements, e.g. for a decoding step
+constexpr size_t PARALLEL_GATHER_GRAIN_SIZE = 16384;
+
+std::shared_ptr<ov::Node> skip_converts(std::shared_ptr<ov::Node> node) {
+    while (ov::is_type<ov::op::v0::Convert>(node)) {
+        node = node->get_input_node_shared_ptr(0);
+    }
+    return node;
+}
+
+// values of a scalar or per row [vocab_size, 1] decompression constant
+bool read_row_parameters(const std::shared_ptr<ov::Node>& node, size_t vocab_size, std::vector<float>& values) {
+    auto constant = ov::as_type_ptr<ov::op::v0::Constant>(skip_converts(node));
+    if (!constant) {
+        return false;
+    }
+    const size_t size = ov::shape_size(constant->get_shape());
+    if (size != 1 && (size != vocab_size || constant->get_shape().at(0) != vocab_size)) {
+        return false;
+    }
+    values = constant->cast_vector<float>();
+    return true;
+}
+
+template <typename T>
+void gather_rows(const T* weights, const int64_t* ids, size_t num_ids, size_t vocab_size, size_t hidden_size,
+                 const std::vector<float>& zero_points, const std::vector<float>& scales, float scale_emb, float* embeds) {
+    auto gather_row = [&](size_t i) {
+        const int64_t id = ids[i];
+        OPENVINO_ASSERT(id >= 0 && static_cast<size_t>(id) < vocab_size, "Token id ", id, " is out of vocabulary of size ", vocab_size);
+        const T* src = weights + id * hidden_size;
+        float* dst = embeds + i * hidden_size;
+        const float zero_point = zero_points.empty() ? 0.0f : zero_points[zero_points.size() == 1 ? 0 : id];
+        const float scale = (scales.empty() ? 1.0f : scales[scales.size() == 1 ? 0 : id]) * scale_emb;
+        for (size_t j = 0; j < hidden_size; ++j) {
+            dst[j] = (static_cast<float>(src[j]) - zero_point) * scale;
+        }
+    };
+
+    if (num_ids * hidden_size < PARALLEL_GATHER_GRAIN_SIZE) {
+        for (size_t i = 0; i < num_ids; ++i)
+            gather_row(i);
+    } else {
+        ov::parallel_for(num_ids, gather_row);
+    }
+}
+
+} // namespace
+
 namespace ov {
 namespace genai {
 
 EmbeddingsModel::EmbeddingsModel(const std::filesystem::path& model_dir,
                                  const float scale_emb,
                                  const std::string& device,
-                                 const ov::AnyMap& properties) {
-    ov::Core core = utils::singleton_core();
-    std::shared_ptr<ov::Model> m_model = core.read_model((model_dir / "openvino_text_embeddings_model.xml").string());
-    // apply embedding postprocessing step by merging them into the model
-    merge_postprocess(m_model, scale_emb);
-
-    ov::CompiledModel compiled_model = core.compile_model(m_model, device, properties);
-    ov::genai::utils::print_compiled_model_properties(compiled_model, "text embeddings model");
-    m_request = compiled_model.create_infer_request();
+                                 const ov::AnyMap& properties)
+    : EmbeddingsModel(utils::singleton_core().read_model((model_dir / "openvino_text_embeddings_model.xml").string()), scale_emb, device, properties) {
 }
 
 EmbeddingsModel::EmbeddingsModel(const std::string& model,
                                  const ov::Tensor& weights,
+                                 const float scale_emb,
+                                 const std::string& device,
+                                 const ov::AnyMap& properties)
+    : EmbeddingsModel(utils::singleton_core().read_model(model, weights), scale_emb, device, properties) {
+}
+
+EmbeddingsModel::EmbeddingsModel(const std::shared_ptr<ov::Model>& model,
                                  const float scale_emb,
                                  const std::string& device,
                                  const ov::AnyMap& properties) {
-    ov::Core core = utils::singleton_core();
-    std::shared_ptr<ov::Model> m_model = core.read_model(model, weights);
+    // a lookup of weights kept by the read model doesn't need a compiled model copying them
+    m_table = find_embedding_table(model, scale_emb);
+    if (m_table) {
+        return;
+    }
+
     // apply embedding postprocessing step by merging them into the model
-    merge_postprocess(m_model, scale_emb);
+    merge_postprocess(model, scale_emb);
 
-    ov::CompiledModel compiled_model = core.compile_model(m_model, device, properties);
+    ov::CompiledModel compiled_model = utils::singleton_core().compile_model(model, device, properties);
+    ov::genai::utils::print_compiled_model_properties(compiled_model, "text embeddings model");
     m_request = compiled_model.create_infer_request();
 }
 
 ov::Tensor EmbeddingsModel::infer(ov::Tensor input_idx) {
+    if (m_table) {
+        OPENVINO_ASSERT(input_idx.get_element_type() == ov::element::i64, "Token ids are expected to be i64, got ", input_idx.get_element_type());
+        ov::Shape embeds_shape = input_idx.get_shape();
+        embeds_shape.push_back(m_table->weights->get_shape().at(1));
+        ov::Tensor embeds(ov::element::f32, embeds_shape);
+        m_table->gather(input_idx.data<const int64_t>(), input_idx.get_size(), embeds.data<float>());
+        return embeds;
+    }
+
     OPENVINO_ASSERT(m_request, "Text embeddings decoder model must be compiled first. Cannot infer non-compiled model");
 
     m_request.set_input_tensor(input_idx);
@@ -52,6 +122,86 @@ ov::Tensor EmbeddingsModel::infer(ov::Tensor input_idx) {
     return m_request.get_output_tensor();
 }
 
+EmbeddingsModel EmbeddingsModel::clone() const {
+    EmbeddingsModel cloned;
+    if (m_table) {
+        cloned.m_table = m_table;
+        return cloned;
+    }
+
+    OPENVINO_ASSERT(m_request, "Text embeddings decoder model must be compiled first. Cannot clone non-compiled model");
+    cloned.m_request = m_request.get_compiled_model().create_infer_request();
+    return cloned;
+}
+
+std::shared_ptr<const EmbeddingsModel::EmbeddingTable> EmbeddingsModel::find_embedding_table(const std::shared_ptr<ov::Model>& model, float scale_emb) {
+    // Parameter -> Gather(weights, ids, axis 0) -> Result, element type conversions are allowed
+    if (model->get_parameters().size() != 1 || model->get_results().size() != 1) {
+        return nullptr;
+    }
+    auto gather = ov::as_type_ptr<ov::op::util::GatherBase>(skip_converts(model->get_results().at(0)->get_input_node_shared_ptr(0)));
+    if (!gather || !ov::is_type<ov::op::v0::Constant>(gather->get_input_node_shared_ptr(2)) ||
+        gather->get_axis() != 0 || gather->get_batch_dims() != 0 ||
+        skip_converts(gather->get_input_node_shared_ptr(1)) != model->get_parameters().at(0)) {
+        return nullptr;
+    }
+
+    auto table = std::make_shared<EmbeddingTable>();
+    table->scale_emb = scale_emb;
+
+    // weights are either a constant or an int8 constant decompressed as (weights - zero_points) * scales
+    std::shared_ptr<ov::Node> weights = skip_converts(gather->get_input_node_shared_ptr(0));
+    auto multiply = ov::as_type_ptr<ov::op::v1::Multiply>(weights);
+    std::shared_ptr<ov::op::v1::Subtract> subtract;
+    if (multiply) {
+        weights = skip_converts(multiply->get_input_node_shared_ptr(0));
+        if ((subtract = ov::as_type_ptr<ov::op::v1::Subtract>(weights))) {
+            weights = skip_converts(subtract->get_input_node_shared_ptr(0));
+        }
+    }
+    table->weights = ov::as_type_ptr<ov::op::v0::Constant>(weights);
+    if (!table->weights || table->weights->get_shape().size() != 2) {
+        return nullptr;
+    }
+
+    const ov::element::Type type = table->weights->get_element_type();
+    const size_t vocab_size = table->weights->get_shape().at(0);
+    if (multiply) {
+        if ((type != ov::element::u8 && type != ov::element::i8) ||
+            !read_row_parameters(multiply->get_input_node_shared_ptr(1), vocab_size, table->scales) ||
+            (subtract && !read_row_parameters(subtract->get_input_node_shared_ptr(1), vocab_size, table->zero_points))) {
+            return nullptr;
+        }
+    } else if (type != ov::element::f32 && type != ov::element::f16 && type != ov::element::bf16) {
+        return nullptr;
+    }
+
+    return table;
+}
+
+void EmbeddingsModel::EmbeddingTable::gather(const int64_t* ids, size_t num_ids, float* embeds) const {
+    const size_t vocab_size = weights->get_shape().at(0), hidden_size = weights->get_shape().at(1);
+    switch (weights->get_element_type()) {
+    case ov::element::f32:
+        gather_rows(weights->get_data_ptr<float>(), ids, num_ids, vocab_size, hidden_size, zero_points, scales, scale_emb, embeds);
+        break;
+    case ov::element::f16:
+        gather_rows(weights->get_data_ptr<ov::float16>(), ids, num_ids, vocab_size, hidden_size, zero_points, scales, scale_emb, embeds);
+        break;
+    case ov::element::bf16:
+        gather_rows(weights->get_data_ptr<ov::bfloat16>(), ids, num_ids, vocab_size, hidden_size, zero_points, scales, scale_emb, embeds);
+        break;
+    case ov::element::u8:
+        gather_rows(weights->get_data_ptr<uint8_t>(), ids, num_ids, vocab_size, hidden_size, zero_points, scales, scale_emb, embeds);
+        break;
+    case ov::element::i8:
+        gather_rows(weights->get_data_ptr<int8_t>(), ids, num_ids, vocab_size, hidden_size, zero_points, scales, scale_emb, embeds);
+        break;
+    default:
+        OPENVINO_THROW("Unsupported embedding weights type ", weights->get_element_type());
+    }
+}
+
 void EmbeddingsModel::merge_postprocess(std::shared_ptr<ov::Model> model, float scale_emb) const {
     ov::preprocess::PrePostProcessor ppp(model);
 
@@ -12,6 +12,7 @@
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/infer_request.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/op/constant.hpp"
 
 #include "visual_language/vlm_config.hpp"
 
@@ -35,13 +36,40 @@ public:
                     const std::string& device,
                     const ov::AnyMap& properties);
 
+    EmbeddingsModel(const std::shared_ptr<ov::Model>& model,
+                    const float scale_emb,
+                    const std::string& device,
+                    const ov::AnyMap& properties);
+
     EmbeddingsModel() = default;
 
+    // returns f32 embeddings of shape [input_idx shape..., hidden_size]
     ov::Tensor infer(ov::Tensor input_idx);
 
+    // shares the model, but has its own infer request, so both instances can be inferred from different threads
+    EmbeddingsModel clone() const;
+
 private:
+    // Rows of the embedding weights constant of a model, which is a plain lookup of f32, f16 or bf16 weights
+    // or int8 weights with per row decompression. Rows are gathered on host, which avoids a fixed cost of inference
+    // for a few tokens of a decoding step.
+    struct EmbeddingTable {
+        // [vocab_size, hidden_size]
+        std::shared_ptr<ov::op::v0::Constant> weights;
+        // per row or scalar decompression parameters, empty if weights aren't compressed
+        std::vector<float> zero_points, scales;
+        float scale_emb = 1.0f;
+
+        void gather(const int64_t* ids, size_t num_ids, float* embeds) const;
+    };
+
+    // returns nullptr if the model is not a plain lookup
+    static std::shared_ptr<const EmbeddingTable> find_embedding_table(const std::shared_ptr<ov::Model>& model, float scale_emb);
+
     void merge_postprocess(std::shared_ptr<ov::Model> model, float scale_emb) const;
 
+    // set instead of m_request if the model is a plain lookup, it's read only and shared between clones
+    std::shared_ptr<const EmbeddingTable> m_table;
     ov::InferRequest m_request;
 };
 
@@ -0,0 +1,175 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "visual_language/image_embedding_cache.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov::genai {
+
+namespace {
+
+// images are hashed by blocks of a fixed size in parallel, so a hash doesn't depend on the number of threads
+constexpr size_t HASH_BLOCK_SIZE = 1 << 20;
+
+uint64_t mix(uint64_t value) {
+    // splitmix64 finalizer
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+uint64_t hash_combine(uint64_t seed, uint64_t value) {
+    return mix(seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)));
+}
+
+uint64_t hash_float(uint64_t seed, float value) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return hash_combine(seed, bits);
+}
+
+uint64_t hash_bytes(const uint8_t* data, size_t size) {
+    // multiply-xorshift over 8 byte words, it's fast enough to be negligible compared to a vision encoder
+    uint64_t hash = size;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * 0x9e3779b97f4a7c15ULL;
+        hash ^= hash >> 29;
+    }
+    uint64_t tail = 0;
+    std::memcpy(&tail, data + i, size - i);
+    return mix(hash ^ tail);
+}
+
+uint64_t hash_config(const ProcessorConfig& config) {
+    uint64_t hash = 0;
+    for (size_t value : {config.image_size, config.patch_size, config.scale_resolution, config.max_slice_nums,
+                         config.crop_size_height, config.crop_size_width, config.size_shortest_edge}) {
+        hash = hash_combine(hash, value);
+    }
+    for (const auto* values : {&config.norm_mean, &config.norm_std, &config.image_mean, &config.image_std}) {
+        for (float value : *values) {
+            hash = hash_float(hash, value);
+        }
+    }
+    for (const auto& [height, width] : config.image_grid_pinpoints) {
+        hash = hash_combine(hash_combine(hash, height), width);
+    }
+    return hash;
+}
+
+bool is_same_image(const ov::Tensor& lhs, const ov::Tensor& rhs) {
+    if (lhs.get_element_type() != rhs.get_element_type() || lhs.get_shape() != rhs.get_shape()) {
+        return false;
+    }
+    const size_t byte_size = lhs.get_byte_size();
+    const uint8_t* lhs_data = static_cast<const uint8_t*>(lhs.data());
+    const uint8_t* rhs_data = static_cast<const uint8_t*>(rhs.data());
+
+    const size_t num_blocks = (byte_size + HASH_BLOCK_SIZE - 1) / HASH_BLOCK_SIZE;
+    std::vector<uint8_t> block_differs(num_blocks);
+    ov::parallel_for(num_blocks, [&](size_t block) {
+        const size_t begin = block * HASH_BLOCK_SIZE;
+        block_differs[block] = std::memcmp(lhs_data + begin, rhs_data + begin, std::min(HASH_BLOCK_SIZE, byte_size - begin)) != 0;
+    });
+    return std::none_of(block_differs.begin(), block_differs.end(), [](uint8_t differs) { return differs != 0; });
+}
+
+ov::Tensor copy_tensor(const ov::Tensor& tensor) {
+    if (!tensor) {
+        return tensor;
+    }
+    ov::Tensor copy(tensor.get_element_type(), tensor.get_shape());
+    tensor.copy_to(copy);
+    return copy;
+}
+
+}  // namespace
+
+ImageEmbeddingCache::ImageEmbeddingCache(size_t capacity) : m_entries(capacity) {
+}
+
+void ImageEmbeddingCache::set_capacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.set_capacity(capacity);
+}
+
+size_t ImageEmbeddingCache::get_capacity() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.get_capacity();
+}
+
+size_t ImageEmbeddingCache::get_size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+std::shared_ptr<const ImageEmbeddingCache::Entry> ImageEmbeddingCache::find(const Key& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::shared_ptr<const Entry>* entry = m_entries.find(key);
+    return entry ? *entry : nullptr;
+}
+
+std::shared_ptr<const ImageEmbeddingCache::Entry> ImageEmbeddingCache::insert(const Key& key, const ov::Tensor& image, Entry entry) {
+    entry.image = copy_tensor(image);
+    // encoder outputs may alias infer request tensors
+    entry.encoded_image.resized_source = copy_tensor(entry.encoded_image.resized_source);
+    entry.encoded_image.slices = copy_tensor(entry.encoded_image.slices);
+    for (ov::Tensor& resampled : entry.resampled) {
+        resampled = copy_tensor(resampled);
+    }
+    auto cached = std::make_shared<const Entry>(std::move(entry));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // the same image may be encoded concurrently, the last result is kept
+    m_entries.insert(key, cached);
+    return cached;
+}
+
+std::shared_ptr<const ImageEmbeddingCache::Entry> ImageEmbeddingCache::encode(const Key& key, const ov::Tensor& image, const Encoder& encoder, bool& hit) {
+    hit = false;
+    if (get_capacity() == 0) {
+        return std::make_shared<const Entry>(encoder());
+    }
+
+    // an entry of another image with a colliding key is replaced
+    if (auto entry = find(key); entry && is_same_image(entry->image, image)) {
+        hit = true;
+        return entry;
+    }
+    return insert(key, image, encoder());
+}
+
+ImageEmbeddingCache::Key get_image_embedding_key(const ov::Tensor& image, const ProcessorConfig& config) {
+    const size_t byte_size = image.get_byte_size();
+    const uint8_t* data = static_cast<const uint8_t*>(image.data());
+
+    const size_t num_blocks = (byte_size + HASH_BLOCK_SIZE - 1) / HASH_BLOCK_SIZE;
+    std::vector<uint64_t> block_hashes(num_blocks);
+    ov::parallel_for(num_blocks, [&](size_t block) {
+        const size_t begin = block * HASH_BLOCK_SIZE;
+        block_hashes[block] = hash_bytes(data + begin, std::min(HASH_BLOCK_SIZE, byte_size - begin));
+    });
+
+    uint64_t hash = hash_config(config);
+    hash = hash_combine(hash, std::hash<std::string>{}(image.get_element_type().get_type_name()));
+    for (size_t dim : image.get_shape()) {
+        hash = hash_combine(hash, dim);
+    }
+    for (uint64_t block_hash : block_hashes) {
+        hash = hash_combine(hash, block_hash);
+    }
+    return {hash, byte_size};
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,68 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+#include "lru_cache.hpp"
+#include "visual_language/processor_config.hpp"
+#include "visual_language/vision_encoder.hpp"
+
+namespace ov::genai {
+
+/**
+ * Thread-safe LRU cache of image embeddings. An entry is keyed by a hash of image bytes, shape and preprocessing config,
+ * so the same image passed to several requests or chat turns is encoded once. A cache belongs to a single vision
+ * encoder, so a model isn't a part of a key. Entries own copies of their tensors and are never modified.
+ * The hash isn't cryptographic and images can be crafted to collide, so an entry keeps its source image,
+ * which is compared with the requested one on a hit.
+ */
+class ImageEmbeddingCache {
+public:
+    struct Entry {
+        EncodedImage encoded_image;
+        // embeddings after a resampler model for models which have it (MiniCPM): the resized source followed by slices
+        std::vector<ov::Tensor> resampled;
+        // image the entry is encoded from, empty if the cache is disabled
+        ov::Tensor image;
+    };
+    // content hash and byte size of an image
+    using Key = std::pair<uint64_t, size_t>;
+    // runs vision encoder and resampler for an image
+    using Encoder = std::function<Entry()>;
+
+    explicit ImageEmbeddingCache(size_t capacity = 0);
+
+    // evicts least recently used entries if the cache is shrunk, 0 disables the cache
+    void set_capacity(size_t capacity);
+
+    size_t get_capacity() const;
+
+    size_t get_size() const;
+
+    /**
+     * Returns an entry for `key` and sets `hit` if it's found in the cache and is encoded from the same `image`,
+     * otherwise calls `encoder` and stores a copy of its result. If the cache is disabled, the result of `encoder`
+     * is returned as is, so it may refer to model output tensors, which are overwritten by the next inference.
+     */
+    std::shared_ptr<const Entry> encode(const Key& key, const ov::Tensor& image, const Encoder& encoder, bool& hit);
+
+private:
+    std::shared_ptr<const Entry> find(const Key& key);
+    std::shared_ptr<const Entry> insert(const Key& key, const ov::Tensor& image, Entry entry);
+
+    mutable std::mutex m_mutex;
+    LRUCache<Key, std::shared_ptr<const Entry>> m_entries;
+};
+
+// hashes image bytes, element type and shape together with preprocessing parameters which affect embeddings
+ImageEmbeddingCache::Key get_image_embedding_key(const ov::Tensor& image, const ProcessorConfig& config);
+
+}  // namespace ov::genai
@@ -7,6 +7,7 @@
 #include "visual_language/clip.hpp"
 #include "visual_language/vision_encoder.hpp"
 #include "visual_language/embedding_model.hpp"
+#include "visual_language/image_embedding_cache.hpp"
 
 #include "utils.hpp"
 
@@ -48,6 +49,8 @@ protected:
     // If we use beam search sampling with chat mode we need to remove last answer of the model from kv cache and add best answer to history 
     // so, let's keep info about amount of tokens to trim from kv cache and amount of tokens to keep in history
     ov::genai::utils::HistoryRemoveManager m_kv_history_manager = {0, 0};
+    // Embeddings of recently encoded images, disabled by default.
+    ImageEmbeddingCache m_image_embedding_cache;
 
 public:
     virtual ov::Tensor get_inputs_embeds(const std::string& prompt, const std::vector<ov::Tensor>& images, ov::genai::VLMPerfMetrics& metrics) = 0;
@@ -104,6 +107,10 @@ public:
         m_history.push_back({{"role", "assistant"}, {"content", decoded_results}});
     }
 
+    void set_image_embedding_cache_capacity(size_t capacity) {
+        m_image_embedding_cache.set_capacity(capacity);
+    }
+
     virtual void finish_chat() {
         m_is_chat_conversation = false;
         m_kv_history_manager.reset();
@@ -149,6 +156,35 @@ protected:
         ),
         m_tokenizer(tokenizer) { }
 
+    // Encodes an image by the vision encoder or takes its embeddings from the cache. `resample` computes
+    // ImageEmbeddingCache::Entry::resampled for models with a resampler.
+    std::shared_ptr<const ImageEmbeddingCache::Entry> encode_image(
+        const ov::Tensor& image,
+        ov::genai::VLMPerfMetrics& metrics,
+        const std::function<std::vector<ov::Tensor>(const EncodedImage&)>& resample = nullptr
+    ) {
+        auto encoder = [&]() {
+            ImageEmbeddingCache::Entry entry{m_vision_encoder.encode(image)};
+            if (resample) {
+                entry.resampled = resample(entry.encoded_image);
+            }
+            return entry;
+        };
+        bool hit = false;
+        if (m_image_embedding_cache.get_capacity() == 0) {
+            // an image isn't hashed if the cache is disabled
+            return m_image_embedding_cache.encode({}, image, encoder, hit);
+        }
+
+        auto entry = m_image_embedding_cache.encode(get_image_embedding_key(image, m_vision_encoder.m_processor_config), image, encoder, hit);
+        if (hit) {
+            ++metrics.vlm_raw_metrics.image_embedding_cache_hits;
+        } else {
+            ++metrics.vlm_raw_metrics.image_embedding_cache_misses;
+        }
+        return entry;
+    }
+
     ov::Tensor get_encoded_input_ids(const std::string& prompt, ov::genai::VLMPerfMetrics& metrics, const std::string& chat_template_fallback = "") {
         ov::Tensor encoded_input_ids;
         if (m_is_chat_conversation) {
@@ -316,12 +352,15 @@ public:
 
     virtual ov::Tensor get_inputs_embeds(const std::string& prompt, const std::vector<ov::Tensor>& images, ov::genai::VLMPerfMetrics& metrics) override {
         std::string images_prompt;
-        std::vector<EncodedImage> embeds;
+        std::vector<std::shared_ptr<const ImageEmbeddingCache::Entry>> embeds;
 
         std::vector<ov::Tensor> single_images = to_single_image_tensors(images);
 
         for (const ov::Tensor& image : single_images) {
-            EncodedImage encoded_image = m_vision_encoder.encode(image);
+            auto embedded_image = encode_image(image, metrics, [this](const EncodedImage& encoded_image) {
+                return resample_image(encoded_image);
+            });
+            const EncodedImage& encoded_image = embedded_image->encoded_image;
             if (m_vlm_config.use_image_id) {
                 images_prompt += m_vlm_config.im_id_start + std::to_string(m_image_id) + m_vlm_config.im_id_end;
                 ++m_image_id;
@@ -345,7 +384,7 @@ public:
                 // Strangely, \n isn't placed between </image><slice>.
                 images_prompt += '\n';
             }
-            embeds.push_back(std::move(encoded_image));
+            embeds.push_back(std::move(embedded_image));
         }
         images_prompt += prompt;
 
@@ -380,30 +419,23 @@ public:
         size_t encoded_input_size = encoded_input.get_size();
         int64_t* end = ids + encoded_input_size;
         float* inputs_embeds_data = inputs_embeds.data<float>();
-        for (const EncodedImage& encoded_image : embeds) {
-            const ov::Tensor& resampled_source = resample(encoded_image.resized_source, {encoded_image.resized_source_size});
+        for (const auto& embedded_image : embeds) {
+            // resampled embeddings of the source image are followed by embeddings of its slices in row-major order
+            const std::vector<ov::Tensor>& resampled = embedded_image->resampled;
+            const ov::Tensor& resampled_source = resampled.at(0);
             float* emb = resampled_source.data<float>();
             ids = std::find(ids, end, im_start_id);
             OPENVINO_ASSERT(end != ids);
             ++ids;
             std::copy_n(emb, resampled_source.get_size(), inputs_embeds_data + std::distance(begin, ids) * m_vlm_config.hidden_size);
             ids += m_vlm_config.query_num;
-            if (encoded_image.slices) {
-                size_t token_idx = 0;
-                const ov::Shape& slices_shape = encoded_image.slices.get_shape();
-                for (size_t i = 0; i < slices_shape.at(0); ++i) {
-                    for (size_t ja = 0; ja < slices_shape.at(1); ++ja) {
-                        size_t d2 = slices_shape.at(2);
-                        size_t d3 = slices_shape.at(3);
-                        ov::Tensor encoded_view{ov::element::f32, {1, d2, d3}, encoded_image.slices.data<float>() + (i * slices_shape.at(1) + ja) * d2 * d3};
-                        const ov::Tensor& vision_embed_tensor_i_j = resample(encoded_view, {encoded_image.slices_size});
-                        ids = std::find(ids, end, slice_start_id);
-                        OPENVINO_ASSERT(end != ids);
-                        ++ids;
-                        std::copy_n(vision_embed_tensor_i_j.data<float>(), vision_embed_tensor_i_j.get_size(), inputs_embeds_data + std::distance(begin, ids) * m_vlm_config.hidden_size);
-                        ids += m_vlm_config.query_num;
-                    }
-                }
+            for (size_t slice_idx = 1; slice_idx < resampled.size(); ++slice_idx) {
+                const ov::Tensor& vision_embed_tensor_i_j = resampled[slice_idx];
+                ids = std::find(ids, end, slice_start_id);
+                OPENVINO_ASSERT(end != ids);
+                ++ids;
+                std::copy_n(vision_embed_tensor_i_j.data<float>(), vision_embed_tensor_i_j.get_size(), inputs_embeds_data + std::distance(begin, ids) * m_vlm_config.hidden_size);
+                ids += m_vlm_config.query_num;
             }
         }
 
@@ -424,6 +456,29 @@ public:
     }
 
 private:
+    // resamples the resized source and each slice, outputs are copied because the resampler overwrites them
+    std::vector<ov::Tensor> resample_image(const EncodedImage& encoded_image) {
+        auto copy_output = [](const ov::Tensor& output) {
+            ov::Tensor copy(output.get_element_type(), output.get_shape());
+            output.copy_to(copy);
+            return copy;
+        };
+
+        std::vector<ov::Tensor> resampled;
+        resampled.push_back(copy_output(resample(encoded_image.resized_source, {encoded_image.resized_source_size})));
+        if (encoded_image.slices) {
+            const ov::Shape& slices_shape = encoded_image.slices.get_shape();
+            const size_t d2 = slices_shape.at(2), d3 = slices_shape.at(3);
+            for (size_t i = 0; i < slices_shape.at(0); ++i) {
+                for (size_t ja = 0; ja < slices_shape.at(1); ++ja) {
+                    ov::Tensor encoded_view{ov::element::f32, {1, d2, d3}, encoded_image.slices.data<float>() + (i * slices_shape.at(1) + ja) * d2 * d3};
+                    resampled.push_back(copy_output(resample(encoded_view, {encoded_image.slices_size})));
+                }
+            }
+        }
+        return resampled;
+    }
+
     ov::Tensor resample(const ov::Tensor& encoded_image, const std::vector<ImageSize>& target_sizes) {
         size_t bs = encoded_image.get_shape().at(0);
         std::vector<size_t> patch_len{target_sizes.size()};
@@ -624,8 +679,8 @@ public:
         image_embeds.reserve(single_images.size());
 
         for (const auto& image : single_images) {
-            EncodedImage encoded_image = m_vision_encoder.encode(image);
-            image_embeds.push_back(std::move(encoded_image.resized_source));
+            auto embedded_image = encode_image(image, metrics);
+            image_embeds.push_back(embedded_image->encoded_image.resized_source);
             formatted_prompt += image_token + "\n";
         }
         formatted_prompt += prompt;
@@ -739,7 +794,8 @@ public:
         ov::Tensor image_newline;
 
         for (const auto& image : single_images) {
-            EncodedImage encoded_image = m_vision_encoder.encode(image);
+            auto embedded_image = encode_image(image, metrics);
+            const EncodedImage& encoded_image = embedded_image->encoded_image;
 
             if (!image_newline) {
                 size_t embed_dim = encoded_image.resized_source.get_shape().at(2);
@@ -1064,8 +1120,8 @@ public:
         image_embeds.reserve(single_images.size());
         
         for (const auto& image : single_images) {
-            EncodedImage encoded_image = m_vision_encoder.encode(image);
-            ov::Tensor single_image_embeds = encoded_image.resized_source;
+            auto embedded_image = encode_image(image, metrics);
+            ov::Tensor single_image_embeds = embedded_image->encoded_image.resized_source;
 
             const size_t num_patches = single_image_embeds.get_shape().at(0);
             const size_t num_image_tokens = single_image_embeds.get_shape().at(1);
@@ -1229,4 +1285,8 @@ void InputsEmbedder::finish_chat() {
     return m_impl->finish_chat();
 }
 
+void InputsEmbedder::set_image_embedding_cache_capacity(size_t capacity) {
+    return m_impl->set_image_embedding_cache_capacity(capacity);
+}
+
 } // namespace ov::genai
@@ -57,6 +57,9 @@ public:
 
     // finishes chat and clears a chat history 
     void finish_chat();
+
+    // sets max number of images whose embeddings are kept between calls, 0 disables the cache
+    void set_image_embedding_cache_capacity(size_t capacity);
 private:
     class IInputsEmbedder;
     std::shared_ptr<IInputsEmbedder> m_impl;
@@ -11,12 +11,21 @@ MeanStdPair VLMPerfMetrics::get_prepare_embeddings_duration() {
     return prepare_embeddings_duration;
 }
 
+float VLMPerfMetrics::get_image_embedding_cache_hit_rate() {
+    evaluate_statistics();
+    return image_embedding_cache_hit_rate;
+}
+
 void VLMPerfMetrics::evaluate_statistics(std::optional<TimePoint> start_time) {
     if (m_evaluated) {
         return;
     }
 
     prepare_embeddings_duration = ov::genai::calc_mean_and_std(vlm_raw_metrics.prepare_embeddings_durations);
+    const size_t image_embedding_cache_lookups = vlm_raw_metrics.image_embedding_cache_hits + vlm_raw_metrics.image_embedding_cache_misses;
+    image_embedding_cache_hit_rate = image_embedding_cache_lookups > 0
+        ? static_cast<float>(vlm_raw_metrics.image_embedding_cache_hits) / image_embedding_cache_lookups
+        : 0.0f;
     PerfMetrics::evaluate_statistics(start_time);
 };
 
@@ -31,6 +40,8 @@ VLMPerfMetrics VLMPerfMetrics::operator+(const VLMPerfMetrics& right) const {
     result_prepare_embeddings_durations.insert(result_prepare_embeddings_durations.end(),
                                                 right_prepare_embeddings_durations.begin(),
                                                 right_prepare_embeddings_durations.end());
+    result.vlm_raw_metrics.image_embedding_cache_hits += right.vlm_raw_metrics.image_embedding_cache_hits;
+    result.vlm_raw_metrics.image_embedding_cache_misses += right.vlm_raw_metrics.image_embedding_cache_misses;
     return result;
 }
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 // Copyright (C) 2023-2024 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <atomic>
+#include <mutex>
 #include <optional>
 #include <random>
 
@@ -12,6 +14,7 @@
 #include "visual_language/inputs_embedder.hpp"
 #include "visual_language/embedding_model.hpp"
 
+#include "continuous_batching_impl.hpp"
 #include "sampler.hpp"
 #include "text_callback_streamer.hpp"
 #include "utils.hpp"
@@ -69,6 +72,14 @@ public:
     size_t m_kv_cache_seq_length_axis = 2;
     // Component for applying sampling to lm outputs
     Sampler m_sampler;
+    // Serves generate() calls from several threads in one batch instead of m_language if the pipeline
+    // is created with scheduler_config. Its model takes inputs_embeds and is transformed to paged attention.
+    std::shared_ptr<ContinuousBatchingPipeline::ContinuousBatchingImpl> m_continuous_batching;
+    // Serializes prompt embedding, m_inputs_embedder isn't thread safe
+    std::mutex m_embedder_mutex;
+    // Held by a thread running a step of m_continuous_batching
+    std::mutex m_step_mutex;
+    std::atomic<uint64_t> m_next_request_id{0};
 
     VLMPipelineImpl(
         const std::filesystem::path& models_dir,
@@ -86,14 +97,26 @@ public:
             )
         },
         m_is_chat_conversation{false} {
+        auto [plugin_config, scheduler_config] = utils::split_scheduler_config(properties);
         m_inputs_embedder = std::make_shared<InputsEmbedder>(
-            m_vlm_config, models_dir, device, properties);
+            m_vlm_config, models_dir, device, plugin_config);
 
         m_tokenizer = m_inputs_embedder->get_tokenizer();
         m_embedding = m_inputs_embedder->get_embedding_model();
 
+        // If eos_token_id was not provided, take value
+        if (m_generation_config.eos_token_id == -1) {
+            m_generation_config.set_eos_token_id(m_tokenizer.get_eos_token_id());
+        }
+
+        if (properties.find(ov::genai::scheduler_config.name()) != properties.end()) {
+            auto language_model = utils::singleton_core().read_model(models_dir / "openvino_language_model.xml");
+            init_continuous_batching(language_model, scheduler_config, device, plugin_config);
+            return;
+        }
+
         auto compiled_language_model = utils::singleton_core().compile_model(
-            models_dir / "openvino_language_model.xml", device, properties
+            models_dir / "openvino_language_model.xml", device, plugin_config
         );
         ov::genai::utils::print_compiled_model_properties(compiled_language_model, "VLM language model");
         auto language_model = compiled_language_model.get_runtime_model();
@@ -103,11 +126,6 @@ public:
 
         m_language.get_tensor("attention_mask").set_shape({1, 0});
 
-        // If eos_token_id was not provided, take value
-        if (m_generation_config.eos_token_id == -1) {
-            m_generation_config.set_eos_token_id(m_tokenizer.get_eos_token_id());
-        }
-
         m_sampler = Sampler(m_tokenizer);
         m_sampler.set_seed(m_generation_config.rng_seed);
     }
@@ -127,25 +145,31 @@ public:
         },
         m_generation_config{generation_config},
         m_is_chat_conversation{false} {
-        
+        auto [plugin_config, scheduler_config] = utils::split_scheduler_config(properties);
         m_inputs_embedder = std::make_shared<InputsEmbedder>(
-            m_vlm_config, models_map, tokenizer, config_dir_path, device, properties);
+            m_vlm_config, models_map, tokenizer, config_dir_path, device, plugin_config);
 
         m_tokenizer = m_inputs_embedder->get_tokenizer();
         m_embedding = m_inputs_embedder->get_embedding_model();
 
+        // If eos_token_id was not provided, take value
+        if (m_generation_config.eos_token_id == -1) {
+            m_generation_config.set_eos_token_id(m_tokenizer.get_eos_token_id());
+        }
+
         auto m_language_pair = get_model_weights_pair(models_map, "language");
+        if (properties.find(ov::genai::scheduler_config.name()) != properties.end()) {
+            auto language_model = utils::singleton_core().read_model(m_language_pair.first, m_language_pair.second);
+            init_continuous_batching(language_model, scheduler_config, device, plugin_config);
+            return;
+        }
+
         m_language = utils::singleton_core().compile_model(
-            m_language_pair.first, m_language_pair.second, device, properties
+            m_language_pair.first, m_language_pair.second, device, plugin_config
         ).create_infer_request();
 
         m_language.get_tensor("attention_mask").set_shape({1, 0});
 
-        // If eos_token_id was not provided, take value
-        if (m_generation_config.eos_token_id == -1) {
-            m_generation_config.set_eos_token_id(m_tokenizer.get_eos_token_id());
-        }
-
         m_sampler = Sampler(m_tokenizer);
         m_sampler.set_seed(m_generation_config.rng_seed);
     }
@@ -156,6 +180,10 @@ public:
         GenerationConfig generation_config,
         const StreamerVariant& streamer
     ) {
+        if (m_continuous_batching) {
+            return generate_continuous_batching(prompt, rgbs, generation_config, streamer);
+        }
+
         auto generate_start_time = std::chrono::steady_clock::now();
         VLMPerfMetrics perf_metrics;
         auto& raw_counters = perf_metrics.raw_metrics;
@@ -170,6 +198,7 @@ public:
         auto end_get_inputs_embeds = std::chrono::steady_clock::now();
 
         auto to_remove_from_hist = m_inputs_embedder->get_num_tokens_to_remove_from_hist();
+        // positions of the language model are counted from the KV cache length, so masking the removed tokens would shift them and the states are trimmed (copied)
         ov::genai::utils::trim_kv_cache(m_language, to_remove_from_hist, m_kv_cache_seq_length_axis, std::nullopt);
 
         std::vector<SequenceGroup::Ptr> requests;
@@ -189,19 +218,7 @@ public:
         sequence_group->set_sequence_group_ptr(sequence_group);
         requests.push_back(sequence_group);
 
-        std::shared_ptr<StreamerBase> streamer_ptr = std::visit(overloaded{
-            [&m_tokenizer = m_tokenizer](
-                const std::function<bool(std::string)>& callback
-            ) -> std::shared_ptr<StreamerBase> {
-                return std::make_shared<TextCallbackStreamer>(m_tokenizer, callback);
-            },
-            [](const std::shared_ptr<StreamerBase>& ptr) {
-                return ptr;
-            },
-            [](std::monostate) {
-                return std::shared_ptr<StreamerBase>{nullptr};
-            },
-        }, streamer);
+        std::shared_ptr<StreamerBase> streamer_ptr = create_streamer(streamer);
 
         OPENVINO_ASSERT(streamer_ptr == nullptr || generation_config.num_return_sequences == 1 &&
             (generation_config.is_greedy_decoding() || generation_config.is_multinomial()),
@@ -290,7 +307,129 @@ public:
         );
     }
 
+    VLMDecodedResults generate_continuous_batching(
+        const std::string& prompt,
+        const std::vector<ov::Tensor>& rgbs,
+        GenerationConfig generation_config,
+        const StreamerVariant& streamer
+    ) {
+        auto generate_start_time = std::chrono::steady_clock::now();
+        VLMPerfMetrics perf_metrics;
+        auto& raw_counters = perf_metrics.raw_metrics;
+        // If eos_token_id was not provided, take value from default m_generation_config
+        if (generation_config.eos_token_id == -1)
+            generation_config.set_eos_token_id(m_generation_config.eos_token_id);
+        generation_config.validate();
+
+        std::shared_ptr<StreamerBase> streamer_ptr = create_streamer(streamer);
+        OPENVINO_ASSERT(streamer_ptr == nullptr || generation_config.num_return_sequences == 1 &&
+            (generation_config.is_greedy_decoding() || generation_config.is_multinomial()),
+            "Currently streaming is possible only with batch size=1 and only for greedy or multinomial decoding");
+
+        GenerationHandle handle;
+        size_t prompt_len = 0;
+        auto start_get_inputs_embeds = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock{m_embedder_mutex};
+            ov::Tensor inputs_embeds = m_inputs_embedder->get_inputs_embeds(prompt, rgbs, perf_metrics);
+            prompt_len = inputs_embeds.get_shape().at(1);
+
+            // prompt ids are used by logit processors only, the model consumes the embeddings
+            auto tokenized_history = m_inputs_embedder->get_tokenized_history();
+            ov::Tensor prompt_ids(ov::element::i64, {1, prompt_len});
+            std::fill_n(prompt_ids.data<int64_t>(), prompt_ids.get_size(), m_tokenizer.get_pad_token_id());
+            std::copy_n(tokenized_history.begin(), std::min(tokenized_history.size(), prompt_len), prompt_ids.data<int64_t>());
+
+            // the embeddings are copied by the request, so the embedder can overwrite them; adding a request may restore
+            // prefix cache blocks, which must not interleave with scheduling
+            std::lock_guard<std::mutex> step_lock{m_step_mutex};
+            handle = m_continuous_batching->add_request(m_next_request_id++, prompt_ids, inputs_embeds, generation_config);
+        }
+        auto end_get_inputs_embeds = std::chrono::steady_clock::now();
+
+        std::unordered_map<uint64_t, GenerationOutput> outputs;
+        bool continue_generation = true;
+        while (continue_generation && (handle->get_status() == GenerationStatus::RUNNING || handle->can_read())) {
+            if (!handle->can_read()) {
+                // a step advances requests of all threads, so a thread waiting for its request runs it if no other thread does
+                std::lock_guard<std::mutex> lock{m_step_mutex};
+                if (handle->get_status() == GenerationStatus::RUNNING && !handle->can_read())
+                    m_continuous_batching->step();
+                continue;
+            }
+
+            GenerationOutputs step_outputs = handle->read();
+            size_t num_new_tokens = 0;
+            for (auto& [sequence_id, step_output] : step_outputs) {
+                num_new_tokens = std::max(num_new_tokens, step_output.generated_ids.size());
+                if (streamer_ptr) {
+                    for (int64_t token : step_output.generated_ids) {
+                        if (streamer_ptr->put(token)) {
+                            handle->drop();
+                            continue_generation = false;
+                            break;
+                        }
+                    }
+                }
+
+                auto [output_it, inserted] = outputs.emplace(sequence_id, step_output);
+                if (!inserted) {
+                    GenerationOutput& output = output_it->second;
+                    output.generated_ids.insert(output.generated_ids.end(), step_output.generated_ids.begin(), step_output.generated_ids.end());
+                    output.generated_log_probs.insert(output.generated_log_probs.end(), step_output.generated_log_probs.begin(), step_output.generated_log_probs.end());
+                    output.score = step_output.score;
+                    output.finish_reason = step_output.finish_reason;
+                }
+            }
+            if (num_new_tokens > 0) {
+                raw_counters.m_new_token_times.emplace_back(std::chrono::steady_clock::now());
+                raw_counters.m_batch_sizes.emplace_back(num_new_tokens);
+            }
+        }
+
+        if (streamer_ptr) {
+            streamer_ptr->end();
+        }
+
+        std::vector<GenerationOutput> sorted_outputs;
+        for (auto& [sequence_id, output] : outputs) {
+            sorted_outputs.push_back(std::move(output));
+        }
+        std::sort(sorted_outputs.begin(), sorted_outputs.end(), [](const GenerationOutput& lhs, const GenerationOutput& rhs) {
+            return lhs.score > rhs.score;
+        });
+        sorted_outputs.resize(std::min(generation_config.num_return_sequences, sorted_outputs.size()));
+
+        auto decode_start_time = std::chrono::steady_clock::now();
+        VLMDecodedResults decoded;
+        for (const GenerationOutput& output : sorted_outputs) {
+            decoded.texts.push_back(m_tokenizer.decode(output.generated_ids));
+            decoded.scores.push_back(output.score);
+        }
+        auto decode_end_time = std::chrono::steady_clock::now();
+        auto generate_end_time = std::chrono::steady_clock::now();
+
+        decoded.perf_metrics = perf_metrics;
+        auto& res_raw_counters = decoded.perf_metrics.raw_metrics;
+        decoded.perf_metrics.num_input_tokens = prompt_len;
+        decoded.perf_metrics.load_time = m_load_time_ms;
+        res_raw_counters.generate_durations.emplace_back(PerfMetrics::get_microsec(generate_end_time - generate_start_time));
+        res_raw_counters.detokenization_durations.emplace_back(PerfMetrics::get_microsec(decode_end_time - decode_start_time));
+        decoded.perf_metrics.vlm_raw_metrics.prepare_embeddings_durations.emplace_back(PerfMetrics::get_microsec(end_get_inputs_embeds - start_get_inputs_embeds));
+
+        // a request may finish without tokens if it didn't fit into KV cache
+        decoded.perf_metrics.m_evaluated = false;
+        if (res_raw_counters.m_new_token_times.empty()) {
+            decoded.perf_metrics.evaluate_statistics();
+        } else {
+            decoded.perf_metrics.evaluate_statistics(generate_start_time);
+        }
+
+        return decoded;
+    }
+
     void start_chat(const std::string& system_message) {
+        OPENVINO_ASSERT(!m_continuous_batching, "Chat mode is not supported by VLMPipeline created with scheduler_config");
         m_is_chat_conversation = true;
         bool have_state = 0 != m_language.get_tensor("attention_mask").get_size();
         if (have_state) {
@@ -304,6 +443,10 @@ public:
 
     void finish_chat() {
         m_is_chat_conversation = false;
+        if (m_continuous_batching) {
+            m_inputs_embedder->finish_chat();
+            return;
+        }
         // Resetting state may be slow.
         m_language.reset_state();
         // clear all chat history
@@ -326,6 +469,40 @@ public:
     void set_generation_config(const GenerationConfig& new_config) {
         m_generation_config = new_config;
     }
+
+    void set_image_embedding_cache_capacity(size_t capacity) {
+        std::lock_guard<std::mutex> lock{m_embedder_mutex};
+        m_inputs_embedder->set_image_embedding_cache_capacity(capacity);
+    }
+
+private:
+    void init_continuous_batching(
+        const std::shared_ptr<ov::Model>& language_model,
+        const SchedulerConfig& scheduler_config,
+        const std::string& device,
+        const ov::AnyMap& properties
+    ) {
+        m_continuous_batching = std::make_shared<ContinuousBatchingPipeline::ContinuousBatchingImpl>(
+            language_model, m_tokenizer, scheduler_config, device, properties, m_generation_config);
+        // a separate infer request embeds generated tokens during a step, while other threads embed their prompts
+        m_continuous_batching->set_embedding_model(m_embedding.clone());
+    }
+
+    std::shared_ptr<StreamerBase> create_streamer(const StreamerVariant& streamer) const {
+        return std::visit(overloaded{
+            [&m_tokenizer = m_tokenizer](
+                const std::function<bool(std::string)>& callback
+            ) -> std::shared_ptr<StreamerBase> {
+                return std::make_shared<TextCallbackStreamer>(m_tokenizer, callback);
+            },
+            [](const std::shared_ptr<StreamerBase>& ptr) {
+                return ptr;
+            },
+            [](std::monostate) {
+                return std::shared_ptr<StreamerBase>{nullptr};
+            },
+        }, streamer);
+    }
 };
 
 VLMPipeline::VLMPipeline(
@@ -403,3 +580,7 @@ GenerationConfig VLMPipeline::get_generation_config() const {
 void VLMPipeline::set_generation_config(const GenerationConfig& new_config) {
     m_pimpl->set_generation_config(new_config);
 }
+
+void VLMPipeline::set_image_embedding_cache_capacity(size_t capacity) {
+    m_pimpl->set_image_embedding_cache_capacity(capacity);
+}
@@ -5,6 +5,10 @@
 #include "visual_language/clip.hpp"
 #include "utils.hpp"
 
+#include <optional>
+
+#include "openvino/core/parallel.hpp"
+
 using namespace ov::genai;
 
 namespace {
@@ -23,21 +27,6 @@ clip_image_u8 tensor_to_clip_image_u8(const ov::Tensor& image_tensor) {
     return image;
 }
 
-/**
- * @brief Converts a clip_image_f32 structure to an OpenVINO image tensor (1CHW).
- *
- * @param image A clip_image_f32 structure containing the image data.
- * @return An OpenVINO tensor containing the image data (1CHW).
- */
-ov::Tensor clip_image_f32_to_tensor(const clip_image_f32& image) {
-    ov::Tensor image_tensor{
-        ov::element::f32,
-        {1, 3, static_cast<size_t>(image.ny), static_cast<size_t>(image.nx)}
-    };
-    std::memcpy(image_tensor.data<float>(), image.buf.data(), image.buf.size() * sizeof(float));
-    return image_tensor;
-}
-
 int ensure_divide(int length, int patch_size) {
     return std::max(static_cast<int>(std::round(static_cast<float>(length) / patch_size) * patch_size), patch_size);
 }
@@ -75,7 +64,27 @@ std::pair<int, int> get_refine_size(std::pair<int, int> original_size, std::pair
     return refine_size;
 }
 
-std::vector<std::vector<clip_image_u8>> slice_image(const clip_image_u8& img, const int max_slice_nums, const int scale_resolution, const int patch_size, const bool never_split) {
+// A source image resized for the encoder and, if the image is large, its refined copy cut into a grid of slices
+struct SlicedImage {
+    clip_image_u8 resized_source;
+    clip_image_u8 refine_image;
+    // number of slices along width and height, {0, 0} if the image isn't sliced
+    std::pair<int, int> grid{0, 0};
+
+    size_t get_num_slices() const {
+        return size_t(grid.first) * grid.second;
+    }
+
+    int get_slice_width() const {
+        return refine_image.nx / grid.first;
+    }
+
+    int get_slice_height() const {
+        return refine_image.ny / grid.second;
+    }
+};
+
+SlicedImage slice_image(const clip_image_u8& img, const int max_slice_nums, const int scale_resolution, const int patch_size, const bool never_split) {
     const std::pair<int, int> original_size{img.nx, img.ny};
     const int original_width = img.nx;
     const int original_height = img.ny;
@@ -83,13 +92,11 @@ std::vector<std::vector<clip_image_u8>> slice_image(const clip_image_u8& img, co
     const float ratio = 1.0f * original_width * original_height / (scale_resolution * scale_resolution);
     const int multiple = std::min(int(ceil(ratio)), max_slice_nums);
 
-    std::vector<std::vector<clip_image_u8>> images;
-    images.push_back(std::vector<clip_image_u8>{});
+    SlicedImage sliced;
 
     if (multiple <= 1) {
         auto best_size = find_best_resize(original_size, scale_resolution, patch_size, true);
-        images.back().push_back(clip_image_u8{});
-        bicubic_resize(img, images.back().back(), best_size.first, best_size.second);
+        bicubic_resize(img, sliced.resized_source, best_size.first, best_size.second);
     }
     else if (multiple > 1) {
 
@@ -102,8 +109,7 @@ std::vector<std::vector<clip_image_u8>> slice_image(const clip_image_u8& img, co
         }
 
         auto best_size = find_best_resize(original_size, scale_resolution, patch_size);
-        images.back().push_back(clip_image_u8{});
-        bicubic_resize(img, images.back().back(), best_size.first, best_size.second);
+        bicubic_resize(img, sliced.resized_source, best_size.first, best_size.second);
 
         std::vector<std::pair<int, int>> candidate_grids;
 
@@ -128,122 +134,29 @@ std::vector<std::vector<clip_image_u8>> slice_image(const clip_image_u8& img, co
             }
         }
         auto refine_size = get_refine_size(original_size, best_grid, scale_resolution, patch_size, true);
-        clip_image_u8 refine_image;
-        bicubic_resize(img, refine_image, refine_size.first, refine_size.second);
-
-        // split_to_patches
-        int width = refine_image.nx;
-        int height = refine_image.ny;
-        int grid_x = int(width / best_grid.first);
-        int grid_y = int(height / best_grid.second);
-        for (int patches_i = 0, ic = 0; patches_i < height && ic < best_grid.second; patches_i += grid_y, ic += 1) {
-            images.push_back(std::vector<clip_image_u8>{});
-            for (int patches_j = 0, jc = 0; patches_j < width && jc < best_grid.first; patches_j += grid_x, jc += 1) {
-                images.back().push_back(clip_image_u8{});
-                clip_image_u8& patch = images.back().back();
-                patch.nx = grid_x;
-                patch.ny = grid_y;
-                patch.buf.resize(3 * patch.nx * patch.ny);
-                for (int y = patches_i; y < patches_i + grid_y; ++y) {
-                    for (int x = patches_j; x < patches_j + grid_x; ++x) {
-                        const int i = 3 * (y * refine_image.nx + x);
-                        const int j = 3 * ((y - patches_i) * patch.nx + (x - patches_j));
-                        patch.buf[j] = refine_image.buf[i];
-                        patch.buf[j + 1] = refine_image.buf[i + 1];
-                        patch.buf[j + 2] = refine_image.buf[i + 2];
-                    }
-                }
-            }
-        }
+        // slices aren't copied out of the refined image, they are normalized right into encoder inputs
+        bicubic_resize(img, sliced.refine_image, refine_size.first, refine_size.second);
+        sliced.grid = best_grid;
     }
 
-    return images;
-}
-
-// Reimplemented https://pytorch.org/docs/stable/generated/torch.nn.Unfold.html#torch.nn.Unfold
-// in shape [NCHW], out shape: [N, C*kernel*kernel, H*W/kernel/kernel]
-ov::Tensor unfold(const ov::Tensor& images_tensor, size_t kernel) {
-    ov::Shape images_shape = images_tensor.get_shape();
-
-    OPENVINO_ASSERT(4 == images_shape.size(), "Input tensor must be 4D (NCHW).");
-
-    const size_t bs = images_shape.at(0);
-    const size_t images_c = images_shape.at(1);
-    const size_t images_h = images_shape.at(2);
-    const size_t images_w = images_shape.at(3);
-
-    OPENVINO_ASSERT(images_h >= kernel && images_w >= kernel, "Input height and width must be greater than or equal to kernel size.");
-
-    const size_t new_c = images_c * kernel * kernel;
-    const size_t output_h = (images_h - kernel) / kernel + 1;
-    const size_t output_w = (images_w - kernel) / kernel + 1;
-    const size_t kernels_per_plane = output_h * output_w;
-
-    ov::Tensor unfolded_tensor(ov::element::f32, {bs, new_c, kernels_per_plane});
-    const float* images = images_tensor.data<float>();
-    float* unfolded = unfolded_tensor.data<float>();
-    for (size_t batch_idx = 0; batch_idx < bs; ++batch_idx) {
-        for (size_t c_idx = 0; c_idx < images_c; ++c_idx) {
-            for (size_t h_out = 0; h_out < output_h; ++h_out) {
-                for (size_t w_out = 0; w_out < output_w; ++w_out) {
-                    size_t h_idx = h_out * kernel;  // Calculate input height index
-                    size_t w_idx = w_out * kernel;  // Calculate input width index
-
-                    for (size_t kh = 0; kh < kernel; ++kh) {
-                        for (size_t kw = 0; kw < kernel; ++kw) {
-                            size_t input_idx = (batch_idx * images_c * images_h * images_w) +
-                                               (c_idx * images_h * images_w) +
-                                               ((h_idx + kh) * images_w) +
-                                               (w_idx + kw);
-
-                            size_t unfolded_c_idx = (c_idx * kernel * kernel) + (kh * kernel) + kw;
-                            size_t unfolded_idx = (batch_idx * new_c * kernels_per_plane) +
-                                                  unfolded_c_idx * kernels_per_plane +
-                                                  (h_out * output_w + w_out);
-
-                            unfolded[unfolded_idx] = images[input_idx];
-                        }
-                    }
-                }
-            }
-        }
-    }
-    return unfolded_tensor;
+    return sliced;
 }
 
-ov::Tensor preprocess_for_encoder(const ov::Tensor& images, size_t kernel) {
-    ov::Shape images_shape = images.get_shape();
-    OPENVINO_ASSERT(4 == images_shape.size());
-    ov::Tensor unfolded_tensor = unfold(images, kernel);
-    const ov::Shape& unfolded_shape = unfolded_tensor.get_shape();  // [N, C*kernel*kernel, H*W/kernel/kernel]
-    const size_t bs = unfolded_shape[0];
-    const size_t d1 = unfolded_shape[1];
-    const size_t d2 = unfolded_shape[2];
-    const size_t channels = 3;
-    const size_t new_len = d2 * kernel;
-
-    ov::Tensor permuted_tensor{ov::element::f32, {bs, channels, kernel, new_len}};
-    const float* unfolded = unfolded_tensor.data<float>();
-    float* permuted = permuted_tensor.data<float>();
-    for (size_t b_idx = 0; b_idx < bs; ++b_idx) {
-        for (size_t c_idx = 0; c_idx < channels; ++c_idx) {
-            for (size_t k1_idx = 0; k1_idx < kernel; ++k1_idx) {
-                for (size_t d2_idx = 0; d2_idx < d2; ++d2_idx) {
-                    for (size_t k2_idx = 0; k2_idx < kernel; ++k2_idx) {
-                        size_t unfolded_idx = b_idx * d1 * d2 +
-                                            (c_idx * kernel * kernel + k1_idx * kernel + k2_idx) * d2 +
-                                            d2_idx;
-                        size_t permuted_idx = b_idx * channels * kernel * new_len +
-                                            c_idx * kernel * new_len +
-                                            k1_idx * new_len +
-                                            d2_idx * kernel + k2_idx;
-                        permuted[permuted_idx] = unfolded[unfolded_idx];
-                    }
-                }
-            }
-        }
-    }
-    return permuted_tensor;
+/**
+ * Normalizes a `width` x `height` region of `img` at (x0, y0) and writes it to one batch element of pixel values
+ * with [3, patch_size, row_length] layout, which is torch.nn.Unfold by patches followed by a permutation:
+ * image row y goes to the kernel row y % patch_size at y / patch_size * width offset. Rows and columns not filling
+ * a whole patch are dropped, the rest of a kernel row is padding.
+ */
+void patchify(const clip_image_u8& img, int x0, int y0, int width, int height, const clip_normalizer& normalizer,
+              size_t patch_size, float* dst, size_t row_length) {
+    const size_t used_width = width / patch_size * patch_size, used_height = height / patch_size * patch_size;
+    OPENVINO_ASSERT(used_width * used_height / patch_size <= row_length, "Image doesn't fit into pixel values");
+    ov::parallel_for(used_height, [&](size_t y) {
+        const uint8_t* src = img.buf.data() + 3 * ((y0 + y) * img.nx + x0);
+        float* dst_row = dst + (y % patch_size) * row_length + y / patch_size * used_width;
+        normalizer.normalize_row(src, used_width, dst_row, patch_size * row_length);
+    });
 }
 
 // torch.bucketize(fractional_coords, boundaries, right=True)
@@ -273,139 +186,89 @@ ov::Tensor prepare_vis_position_ids(
     size_t position_ids_batch_elem = max_nb_patches_h * max_nb_patches_w;
     ov::Tensor position_ids{ov::element::i64, {batch_size, position_ids_batch_elem}};
     int64_t* res_data = position_ids.data<int64_t>();
-    std::fill_n(res_data, position_ids.get_size(), 0);
 
-    for (size_t batch_idx = 0; batch_idx < batch_size; ++batch_idx) {
-        size_t nb_patches_h = tgt_sizes.at(batch_idx).height;
-        size_t nb_patches_w = tgt_sizes.at(batch_idx).width;
-
-        std::vector<float> fractional_coords_h(nb_patches_h);
-        std::generate(fractional_coords_h.begin(), fractional_coords_h.end(), [nb_patches_h, val = -1.0f / nb_patches_h]() mutable {
-            val += 1.0f / nb_patches_h;
-            return val;
-        });
-        std::vector<float> fractional_coords_w(nb_patches_w);
-        std::generate(fractional_coords_w.begin(), fractional_coords_w.end(), [nb_patches_w, val = -1.0f / nb_patches_w]() mutable {
-            val += 1.0f / nb_patches_w;
+    auto fractional_coords = [](size_t nb_patches) {
+        std::vector<float> coords(nb_patches);
+        std::generate(coords.begin(), coords.end(), [nb_patches, val = -1.0f / nb_patches]() mutable {
+            val += 1.0f / nb_patches;
             return val;
         });
+        return coords;
+    };
 
-        std::vector<int64_t> bucket_coords_h = bucket_size_right(fractional_coords_h, boundaries);
-        std::vector<int64_t> bucket_coords_w = bucket_size_right(fractional_coords_w, boundaries);
-
-        std::vector<int64_t> pos_ids(bucket_coords_h.size() * bucket_coords_w.size());
-        for (size_t col = 0; col < bucket_coords_h.size(); ++col) {
-            for (size_t row = 0; row < bucket_coords_w.size(); ++row) {;
-                pos_ids.at(col * bucket_coords_w.size() + row) = bucket_coords_h.at(col) * num_patches_per_side + bucket_coords_w.at(row);
+    for (size_t batch_idx = 0; batch_idx < batch_size; ++batch_idx) {
+        const size_t nb_patches_h = tgt_sizes.at(batch_idx).height;
+        const size_t nb_patches_w = tgt_sizes.at(batch_idx).width;
+        OPENVINO_ASSERT(nb_patches_h * nb_patches_w <= position_ids_batch_elem, "Image has more patches than position ids");
+
+        const std::vector<int64_t> bucket_coords_h = bucket_size_right(fractional_coords(nb_patches_h), boundaries);
+        const std::vector<int64_t> bucket_coords_w = bucket_size_right(fractional_coords(nb_patches_w), boundaries);
+
+        int64_t* batch_data = res_data + batch_idx * position_ids_batch_elem;
+        for (size_t h = 0; h < nb_patches_h; ++h) {
+            const int64_t row_id = bucket_coords_h[h] * num_patches_per_side;
+            for (size_t w = 0; w < nb_patches_w; ++w) {
+                batch_data[h * nb_patches_w + w] = row_id + bucket_coords_w[w];
             }
         }
-        std::copy(pos_ids.begin(), pos_ids.end(), res_data + batch_idx * position_ids_batch_elem);
+        std::fill(batch_data + nb_patches_h * nb_patches_w, batch_data + position_ids_batch_elem, 0);
     }
     return position_ids;
 }
 
 EncodedImage llava_image_embed_make_with_bytes_slice(clip_ctx& ctx_clip, const ov::Tensor& img, ov::InferRequest& encoder, int max_slice_nums, int scale_resolution, size_t patch_size, bool never_split) {
     clip_image_u8 source = tensor_to_clip_image_u8(img);
-    std::vector<std::vector<clip_image_u8>> imgs = ::slice_image(source, max_slice_nums, scale_resolution, patch_size, never_split);
-    std::vector<std::vector<ov::Tensor>> results;
-    std::vector<std::vector<ImageSize>> sizes;
+    SlicedImage sliced = ::slice_image(source, max_slice_nums, scale_resolution, patch_size, never_split);
+    const clip_image_u8& resized_source = sliced.resized_source;
+    const size_t n_slices = sliced.get_num_slices();
+    const size_t n_images = 1 + n_slices;
     const size_t channels = 3;
 
-    std::vector<std::vector<clip_image_f32>> preprocessed{imgs.size()};
-    size_t max_h = 0, max_w = 0, n_images = 0, max_size = 0;
-    std::transform(imgs.begin(), imgs.end(), preprocessed.begin(), [&ctx_clip, &max_h, &max_w, &max_size, &n_images](const std::vector<clip_image_u8>& row) {
-        std::vector<clip_image_f32> processed_row{row.size()};
-        std::transform(row.begin(), row.end(), processed_row.begin(), [&ctx_clip, &max_h, &max_w, &max_size, &n_images](const clip_image_u8& raw) {
-            clip_image_f32 im = clip_image_preprocess(ctx_clip, raw);
-            if (size_t(im.ny) * size_t(im.nx) > max_size) {
-                max_size = size_t(im.ny) * size_t(im.nx);
-                max_h = size_t(im.ny);
-                max_w = size_t(im.nx);
-            }
-            ++n_images;
-            return im;
-        });
-        return processed_row;
-    });
-
-    ov::Tensor pixel_values{ov::element::f32, {n_images, channels, patch_size, max_size / patch_size}};
-    size_t d3_all_pixel = pixel_values.get_shape().at(3);
-    float* pixel_value_data = pixel_values.data<float>();
-    
-    //image chw to 1*c*kernel*hw/kernel and padding zero
-    clip_image_f32& resized_preprocessed = preprocessed.at(0).at(0);
-    size_t img_h = resized_preprocessed.ny;
-    size_t img_w = resized_preprocessed.nx;
-    ov::Tensor clip_img{ov::element::f32, {1, channels, img_h, img_w}, resized_preprocessed.buf.data()};
-    ov::Tensor clip_pixel_values = preprocess_for_encoder(clip_img, patch_size);
-
-    float* clip_value_data = clip_pixel_values.data<float>();
-    size_t batch_pixel = 1;
-    size_t d3_clip_pixel = clip_pixel_values.get_shape().at(3);
-    for (size_t c_idx = 0; c_idx < channels; ++c_idx) {
-        for (size_t k_idx = 0; k_idx < patch_size; k_idx++) {
-            std::copy(clip_value_data, clip_value_data + d3_clip_pixel, pixel_value_data);
-            clip_value_data += d3_clip_pixel;
-            pixel_value_data += d3_all_pixel; 
-        }
+    // all images are padded to the largest one
+    size_t max_h = resized_source.ny, max_w = resized_source.nx;
+    if (n_slices > 0 && size_t(sliced.get_slice_height()) * sliced.get_slice_width() > max_h * max_w) {
+        max_h = sliced.get_slice_height();
+        max_w = sliced.get_slice_width();
     }
 
-    if (1 < preprocessed.size()) {
-        for (size_t row = 1; row < preprocessed.size(); ++row) {
-            size_t n_slices = preprocessed.at(row).size();
-            for (size_t col = 0; col < n_slices; ++col) {
-                clip_image_f32& elem = preprocessed.at(row).at(col);
-                img_h = elem.ny;
-                img_w = elem.nx;
-                ov::Tensor clip_img{ov::element::f32, {1, channels, img_h, img_w}, elem.buf.data()};
-                ov::Tensor clip_pixel_values = preprocess_for_encoder(clip_img, patch_size);
-                
-                d3_clip_pixel = clip_pixel_values.get_shape().at(3);
-                clip_value_data = clip_pixel_values.data<float>();
-                pixel_value_data = pixel_values.data<float>() + batch_pixel * channels * patch_size * d3_all_pixel;
-                for (size_t c_idx = 0; c_idx < channels; ++c_idx) {
-                    for (size_t k_idx = 0; k_idx < patch_size; k_idx++) {
-                        std::copy(clip_value_data, clip_value_data + d3_clip_pixel, pixel_value_data);
-                        clip_value_data += d3_clip_pixel;
-                        pixel_value_data += d3_all_pixel;
-                    }
-                }
-                batch_pixel++;
-            }
-        }
+    ov::Tensor pixel_values{ov::element::f32, {n_images, channels, patch_size, max_h * max_w / patch_size}};
+    const size_t d3_all_pixel = pixel_values.get_shape().at(3);
+    const size_t batch_pixel_size = channels * patch_size * d3_all_pixel;
+    float* pixel_value_data = pixel_values.data<float>();
+    std::fill_n(pixel_value_data, pixel_values.get_size(), 0.0f);
+
+    const clip_normalizer normalizer(ctx_clip);
+    patchify(resized_source, 0, 0, resized_source.nx, resized_source.ny, normalizer, patch_size, pixel_value_data, d3_all_pixel);
+    for (size_t slice_idx = 0; slice_idx < n_slices; ++slice_idx) {
+        const int slice_x = int(slice_idx % sliced.grid.first) * sliced.get_slice_width();
+        const int slice_y = int(slice_idx / sliced.grid.first) * sliced.get_slice_height();
+        patchify(sliced.refine_image, slice_x, slice_y, sliced.get_slice_width(), sliced.get_slice_height(), normalizer,
+                 patch_size, pixel_value_data + (1 + slice_idx) * batch_pixel_size, d3_all_pixel);
     }
     encoder.set_tensor("pixel_values", pixel_values);
 
-    ov::Tensor patch_attention_mask{ov::element::f32, {pixel_values.get_shape().at(0), 1, max_h / patch_size * max_w / patch_size}};
+    const size_t max_patches = max_h / patch_size * max_w / patch_size;
+    ov::Tensor patch_attention_mask{ov::element::f32, {pixel_values.get_shape().at(0), 1, max_patches}};
     float* attention_data = patch_attention_mask.data<float>();
     std::fill_n(attention_data, patch_attention_mask.get_size(), 0.0f);
-    std::fill_n(attention_data, resized_preprocessed.ny / patch_size * resized_preprocessed.nx / patch_size, 1.0f);
-    if (1 < preprocessed.size()) {
-        for (size_t row = 1; row < preprocessed.size(); ++row) {
-            size_t n_slices = preprocessed.at(row).size();
-            for (size_t col = 0; col < n_slices; ++col) {
-                const clip_image_f32& elem = preprocessed.at(row).at(col);
-                std::fill_n(attention_data + ((row - 1) * n_slices + col + 1) * max_h / patch_size * max_w / patch_size, elem.ny / patch_size * elem.nx / patch_size, 1.0f);
-            }
-        }
+    std::fill_n(attention_data, resized_source.ny / patch_size * resized_source.nx / patch_size, 1.0f);
+    for (size_t slice_idx = 0; slice_idx < n_slices; ++slice_idx) {
+        std::fill_n(attention_data + (slice_idx + 1) * max_patches, sliced.get_slice_height() / patch_size * sliced.get_slice_width() / patch_size, 1.0f);
     }
     encoder.set_tensor("patch_attention_mask", patch_attention_mask);
 
-    ImageSize resized_source_size{resized_preprocessed.ny / patch_size, resized_preprocessed.nx / patch_size};
+    ImageSize resized_source_size{resized_source.ny / patch_size, resized_source.nx / patch_size};
     std::vector<ImageSize> tgt_sizes{resized_source_size};
-    if (1 < preprocessed.size()) {
-        for (const std::vector<clip_image_f32>& row : preprocessed) {
-            for (const clip_image_f32& elem : row) {
-                tgt_sizes.push_back({elem.ny / patch_size, elem.nx / patch_size});
-            }
-        }
+    if (n_slices > 0) {
+        tgt_sizes.push_back(resized_source_size);
+        tgt_sizes.insert(tgt_sizes.end(), n_slices, ImageSize{size_t(sliced.get_slice_height()) / patch_size, size_t(sliced.get_slice_width()) / patch_size});
     }
     ov::Tensor position_ids = prepare_vis_position_ids(pixel_values, patch_attention_mask, tgt_sizes, patch_size, ctx_clip.image_size / patch_size);
     encoder.set_tensor("position_ids", position_ids);
     encoder.infer();
     const ov::Tensor& output_tensor = encoder.get_output_tensor();
 
-    if (1 == preprocessed.size()) {
+    if (0 == n_slices) {
         ov::Tensor resized_source{ov::element::f32, output_tensor.get_shape()};
         output_tensor.copy_to(resized_source);
         return {std::move(resized_source), resized_source_size};
@@ -417,11 +280,9 @@ EncodedImage llava_image_embed_make_with_bytes_slice(clip_ctx& ctx_clip, const o
     std::copy_n(out, resized_source.get_size(), resized_source.data<float>());
 
     size_t n_patches = tgt_sizes.at(1).height * tgt_sizes.at(1).width;
-    ov::Tensor encoded_slices{ov::element::f32, {preprocessed.size() - 1, preprocessed.at(1).size(), n_patches, old_hidden_size}};
-    for (size_t col = 0; col < preprocessed.size() - 1; ++col) {
-        for (size_t row = 0; row < preprocessed.at(1).size(); ++row) {
-            std::copy_n(out + (col * preprocessed.at(1).size() + row + 1) * n_patches * old_hidden_size, n_patches * old_hidden_size, encoded_slices.data<float>() + (col * preprocessed.at(1).size() + row) * n_patches * old_hidden_size);
-        }
+    ov::Tensor encoded_slices{ov::element::f32, {size_t(sliced.grid.second), size_t(sliced.grid.first), n_patches, old_hidden_size}};
+    for (size_t slice_idx = 0; slice_idx < n_slices; ++slice_idx) {
+        std::copy_n(out + (slice_idx + 1) * n_patches * old_hidden_size, n_patches * old_hidden_size, encoded_slices.data<float>() + slice_idx * n_patches * old_hidden_size);
     }
     return {resized_source, resized_source_size, encoded_slices, tgt_sizes.at(1)};
 }
@@ -442,59 +303,38 @@ ProcessorConfig from_any_map(
     return extracted_config;
 }
 
-clip_image_f32 preprocess_clip_image_llava(const clip_image_u8& image, const ProcessorConfig& config) {
-    bool do_resize = true;
-    bool do_center_crop = true;
-
+// resizes the shortest edge of an image, center crops it and writes normalized [3, crop_size_height, crop_size_width] to `dst`
+void preprocess_clip_image_llava(const clip_image_u8& image, const ProcessorConfig& config, float* dst) {
     // Resize
     clip_image_u8 resized_image;
-    if (do_resize) {
-        int target_size = config.size_shortest_edge;
-        float scale = static_cast<float>(target_size) / std::min(image.nx, image.ny);
-        int new_width = static_cast<int>(image.nx * scale);
-        int new_height = static_cast<int>(image.ny * scale);
-        bicubic_resize(image, resized_image, new_width, new_height);
-    } else {
-        resized_image = image;
-    }
-
-    // Center crop
-    clip_image_u8 cropped_image;
-    if (do_center_crop) {
-        int crop_height = config.crop_size_height;
-        int crop_width = config.crop_size_width;
-        int start_x = (resized_image.nx - crop_width) / 2;
-        int start_y = (resized_image.ny - crop_height) / 2;
-
-        cropped_image.nx = crop_width;
-        cropped_image.ny = crop_height;
-        cropped_image.buf.resize(3 * crop_width * crop_height);
-
-        for (int y = 0; y < crop_height; ++y) {
-            for (int x = 0; x < crop_width; ++x) {
-                for (int c = 0; c < 3; ++c) {
-                    cropped_image.buf[(y * crop_width + x) * 3 + c] = 
-                        resized_image.buf[((start_y + y) * resized_image.nx + (start_x + x)) * 3 + c];
-                }
-            }
-        }
-    } else {
-        cropped_image = resized_image;
-    }
+    int target_size = config.size_shortest_edge;
+    float scale = static_cast<float>(target_size) / std::min(image.nx, image.ny);
+    int new_width = static_cast<int>(image.nx * scale);
+    int new_height = static_cast<int>(image.ny * scale);
+    bicubic_resize(image, resized_image, new_width, new_height);
+
+    // Center crop and normalize without an intermediate copy of the cropped image
+    const int crop_height = config.crop_size_height;
+    const int crop_width = config.crop_size_width;
+    const int start_x = (resized_image.nx - crop_width) / 2;
+    const int start_y = (resized_image.ny - crop_height) / 2;
 
-    // Normalize
     clip_ctx ctx;
     std::copy(config.image_mean.begin(), config.image_mean.end(), ctx.image_mean);
     std::copy(config.image_std.begin(), config.image_std.end(), ctx.image_std);
+    const clip_normalizer normalizer(ctx);
 
-    clip_image_f32 normalized_image = clip_image_preprocess(ctx, cropped_image);
-    return normalized_image;
+    ov::parallel_for(crop_height, [&](int y) {
+        const uint8_t* src = resized_image.buf.data() + 3 * ((start_y + y) * resized_image.nx + start_x);
+        normalizer.normalize_row(src, crop_width, dst + size_t(y) * crop_width, size_t(crop_height) * crop_width);
+    });
 }
 
 ov::Tensor get_pixel_values_llava(const ov::Tensor& image, const ProcessorConfig& config) {
     clip_image_u8 input_image = tensor_to_clip_image_u8(image);
-    clip_image_f32 preprocessed_image = preprocess_clip_image_llava(input_image, config);
-    return clip_image_f32_to_tensor(preprocessed_image);
+    ov::Tensor pixel_values(ov::element::f32, {1, 3, config.crop_size_height, config.crop_size_width});
+    preprocess_clip_image_llava(input_image, config, pixel_values.data<float>());
+    return pixel_values;
 }
 
 ov::Tensor get_pixel_values_llava_next(const ov::Tensor& image, const ProcessorConfig& config) {
@@ -504,32 +344,29 @@ ov::Tensor get_pixel_values_llava_next(const ov::Tensor& image, const ProcessorC
     auto patch_size = config.crop_size_height;
     auto image_patches = get_image_patches(input_image, config.image_grid_pinpoints, size, patch_size);
 
-    // Preprocess image patches
-    std::vector<clip_image_f32> processed_patches;
-    processed_patches.reserve(image_patches.size());
-
-    for (const auto& patch : image_patches) {
-        processed_patches.push_back(preprocess_clip_image_llava(patch, config));
-    }
-
-    size_t num_patches = processed_patches.size();
+    size_t num_patches = image_patches.size();
     size_t channels = 3;
-    size_t height = processed_patches[0].ny;
-    size_t width = processed_patches[0].nx;
+    size_t height = config.crop_size_height;
+    size_t width = config.crop_size_width;
 
+    // Preprocess image patches right into the tensor (each patch layout is [C * H * W])
     ov::Tensor concatenated_tensor(ov::element::f32, {num_patches, channels, height, width});
     float* tensor_data = concatenated_tensor.data<float>();
-
-    // Fill the tensor with the preprocessed patches data (each patch layout is [C * H * W])
     for (size_t i = 0; i < num_patches; ++i) {
-        const auto& img = processed_patches[i];
-        std::copy(img.buf.begin(), img.buf.end(), tensor_data + i * channels * height * width);
+        preprocess_clip_image_llava(image_patches[i], config, tensor_data + i * channels * height * width);
     }
 
     return concatenated_tensor;
 }
 
-std::vector<clip_image_u8> split_image_internvl(
+// An image resized to a grid of image_size x image_size blocks and an optional thumbnail of the whole image
+struct InternVLBlocks {
+    clip_image_u8 resized_image;
+    int num_blocks = 0;
+    std::optional<clip_image_u8> thumbnail;
+};
+
+InternVLBlocks split_image_internvl(
     const clip_image_u8& image,
     int image_size,
     int min_num = 1,
@@ -577,39 +414,17 @@ std::vector<clip_image_u8> split_image_internvl(
     int target_height = image_size * target_aspect_ratio.second;
     int blocks = target_aspect_ratio.first * target_aspect_ratio.second;
 
-    clip_image_u8 resized_img;
-    bicubic_resize(image, resized_img, target_width, target_height);
-
-    std::vector<clip_image_u8> processed_images;
-    for (int i = 0; i < blocks; ++i) {
-        int x = (i % (target_width / image_size)) * image_size;
-        int y = (i / (target_width / image_size)) * image_size;
-
-        clip_image_u8 split_img;
-        split_img.nx = image_size;
-        split_img.ny = image_size;
-        split_img.buf.resize(3 * image_size * image_size);
-
-        for (int dy = 0; dy < image_size; ++dy) {
-            for (int dx = 0; dx < image_size; ++dx) {
-                for (int c = 0; c < 3; ++c) {
-                    int src_idx = ((y + dy) * target_width + (x + dx)) * 3 + c;
-                    int dst_idx = (dy * image_size + dx) * 3 + c;
-                    split_img.buf[dst_idx] = resized_img.buf[src_idx];
-                }
-            }
-        }
-
-        processed_images.push_back(std::move(split_img));
-    }
+    // blocks aren't copied out of the resized image, they are normalized right into encoder inputs
+    InternVLBlocks split;
+    bicubic_resize(image, split.resized_image, target_width, target_height);
+    split.num_blocks = blocks;
 
-    if (use_thumbnail && processed_images.size() != 1) {
-        clip_image_u8 thumbnail_img;
-        bicubic_resize(image, thumbnail_img, image_size, image_size);
-        processed_images.push_back(std::move(thumbnail_img));
+    if (use_thumbnail && blocks != 1) {
+        split.thumbnail.emplace();
+        bicubic_resize(image, *split.thumbnail, image_size, image_size);
     }
 
-    return processed_images;
+    return split;
 }
 
 ov::Tensor get_pixel_values_internvl(const ov::Tensor& image, const ProcessorConfig& config) {
@@ -622,25 +437,32 @@ ov::Tensor get_pixel_values_internvl(const ov::Tensor& image, const ProcessorCon
     std::copy(config.image_mean.begin(), config.image_mean.end(), ctx.image_mean);
     std::copy(config.image_std.begin(), config.image_std.end(), ctx.image_std);
 
-    std::vector<clip_image_u8> splitted_images = split_image_internvl(input_image, image_size);
+    InternVLBlocks split = split_image_internvl(input_image, image_size);
+    const clip_image_u8& resized_image = split.resized_image;
+    const clip_normalizer normalizer(ctx);
 
-    std::vector<clip_image_f32> processed_images;
-    processed_images.reserve(splitted_images.size());
-    for (const auto& image : splitted_images) {
-        processed_images.push_back(clip_image_preprocess(ctx, image));
-    }
-
-    size_t batch_size = processed_images.size();
+    size_t batch_size = split.num_blocks + (split.thumbnail ? 1 : 0);
     size_t channels = 3;
-    size_t height = processed_images[0].ny;
-    size_t width = processed_images[0].nx;
+    size_t height = image_size;
+    size_t width = image_size;
+    const size_t image_area = height * width;
 
     ov::Tensor output_tensor(ov::element::f32, {batch_size, channels, height, width});
     float* output_data = output_tensor.data<float>();
 
-    for (size_t i = 0; i < batch_size; ++i) {
-        const auto& img = processed_images[i];
-        std::copy(img.buf.begin(), img.buf.end(), output_data + i * channels * height * width);
+    const size_t blocks_per_row = resized_image.nx / image_size;
+    ov::parallel_for(split.num_blocks * height, [&](size_t row) {
+        const size_t block = row / height, dy = row % height;
+        const size_t x = block % blocks_per_row * image_size, y = block / blocks_per_row * image_size;
+        const uint8_t* src = resized_image.buf.data() + 3 * ((y + dy) * resized_image.nx + x);
+        normalizer.normalize_row(src, width, output_data + block * channels * image_area + dy * width, image_area);
+    });
+
+    if (split.thumbnail) {
+        float* thumbnail_data = output_data + split.num_blocks * channels * image_area;
+        ov::parallel_for(height, [&](size_t dy) {
+            normalizer.normalize_row(split.thumbnail->buf.data() + 3 * dy * width, width, thumbnail_data + dy * width, image_area);
+        });
     }
     return output_tensor;
 }
@@ -13,12 +13,24 @@ MeanStdPair WhisperPerfMetrics::get_features_extraction_duration() {
     return features_extraction_duration;
 }
 
+MeanStdPair WhisperPerfMetrics::get_encode_inference_duration() {
+    evaluate_statistics();
+    return encode_inference_duration;
+}
+
+MeanStdPair WhisperPerfMetrics::get_decode_duration() {
+    evaluate_statistics();
+    return decode_duration;
+}
+
 void WhisperPerfMetrics::evaluate_statistics(std::optional<TimePoint> start_time) {
     if (m_evaluated) {
         return;
     }
 
     features_extraction_duration = ov::genai::calc_mean_and_std(whisper_raw_metrics.features_extraction_durations);
+    encode_inference_duration = ov::genai::calc_mean_and_std(whisper_raw_metrics.encode_inference_durations);
+    decode_duration = ov::genai::calc_mean_and_std(whisper_raw_metrics.decode_durations);
     PerfMetrics::evaluate_statistics(start_time);
 };
 
@@ -35,6 +47,18 @@ WhisperPerfMetrics WhisperPerfMetrics::operator+(const WhisperPerfMetrics& right
     result_features_extraction_durations.insert(result_features_extraction_durations.end(),
                                                 right_features_extraction_durations.begin(),
                                                 right_features_extraction_durations.end());
+
+    auto& result_encode_inference_durations = result.whisper_raw_metrics.encode_inference_durations;
+    auto& right_encode_inference_durations = right.whisper_raw_metrics.encode_inference_durations;
+    result_encode_inference_durations.insert(result_encode_inference_durations.end(),
+                                             right_encode_inference_durations.begin(),
+                                             right_encode_inference_durations.end());
+
+    auto& result_decode_durations = result.whisper_raw_metrics.decode_durations;
+    auto& right_decode_durations = right.whisper_raw_metrics.decode_durations;
+    result_decode_durations.insert(result_decode_durations.end(),
+                                   right_decode_durations.begin(),
+                                   right_decode_durations.end());
     return result;
 }
 
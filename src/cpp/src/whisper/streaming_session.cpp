@@ -0,0 +1,255 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "streaming_session.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "timestamps.hpp"
+
+namespace {
+
+size_t seconds_to_frames(const float seconds, const ov::genai::WhisperFeatureExtractor& feature_extractor) {
+    return static_cast<size_t>(std::lround(seconds * feature_extractor.sampling_rate / feature_extractor.hop_length));
+}
+
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+WhisperStreamingSession::WhisperStreamingSession(const WhisperGenerationConfig& config,
+                                                 const WhisperContextTokens& context_tokens,
+                                                 const float time_precision,
+                                                 const float step,
+                                                 WhisperFeatureExtractor& feature_extractor,
+                                                 WhisperInitializedModels& models)
+    : m_config{config},
+      m_context_tokens{context_tokens},
+      m_time_precision{time_precision},
+      m_step_frames{std::max<size_t>(1, seconds_to_frames(step, feature_extractor))},
+      m_feature_extractor{feature_extractor},
+      m_models{models} {
+    OPENVINO_ASSERT(step > 0.0f, "Live transcription step should be positive, got ", step);
+}
+
+WhisperStreamingStep WhisperStreamingSession::push_audio(const RawSpeechInput& audio_frames) {
+    WhisperStreamingStep step;
+    step.perf_metrics.num_input_tokens = 0;
+    step.perf_metrics.raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+
+    m_audio.insert(m_audio.end(), audio_frames.begin(), audio_frames.end());
+    m_received_samples += audio_frames.size();
+
+    extend_log_mel(false, step.perf_metrics.whisper_raw_metrics);
+
+    // windows overfilled by a large piece of audio are finalized right away
+    while (m_n_frames - m_window_start > m_feature_extractor.nb_max_frames) {
+        transcribe_window(false, step);
+    }
+
+    if (m_n_frames - m_last_transcribed_frame >= m_step_frames) {
+        transcribe_window(false, step);
+    }
+
+    step.partial_tokens = m_partial_tokens;
+    return step;
+}
+
+WhisperStreamingStep WhisperStreamingSession::finish() {
+    WhisperStreamingStep step;
+    step.perf_metrics.num_input_tokens = 0;
+    step.perf_metrics.raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+
+    extend_log_mel(true, step.perf_metrics.whisper_raw_metrics);
+
+    while (m_window_start < m_n_frames) {
+        transcribe_window(true, step);
+    }
+
+    m_partial_tokens.clear();
+    return step;
+}
+
+void WhisperStreamingSession::extend_log_mel(const bool flush, WhisperRawPerfMetrics& whisper_raw_metrics) {
+    const auto extraction_start = std::chrono::steady_clock::now();
+    const size_t n_fft = m_feature_extractor.n_fft;
+    const size_t hop_length = m_feature_extractor.hop_length;
+    const size_t feature_size = m_feature_extractor.feature_size;
+    const size_t reflect_pad_size = n_fft / 2;
+
+    if (!m_is_padded) {
+        if (m_audio.size() <= reflect_pad_size) {
+            if (!flush || m_audio.empty()) {
+                return;
+            }
+            // too short stream to be reflected
+            m_audio.resize(reflect_pad_size + 1, 0.0f);
+        }
+
+        // reflect padding of the stream beginning, the same as in WhisperFeatureExtractor::extract
+        std::vector<float> reflected(m_audio.rbegin() + (m_audio.size() - reflect_pad_size - 1), m_audio.rend() - 1);
+        m_audio.insert(m_audio.begin(), reflected.begin(), reflected.end());
+        m_is_padded = true;
+    }
+
+    if (flush) {
+        m_audio.resize(m_audio.size() + n_fft, 0.0f);
+    }
+
+    const size_t padded_size = m_audio_offset + m_audio.size();
+    size_t n_frames = padded_size >= n_fft ? (padded_size - n_fft) / hop_length + 1 : 0;
+    if (flush) {
+        // the same number of frames as for the whole audio at once
+        n_frames = std::min(n_frames, m_received_samples / hop_length);
+    }
+
+    if (n_frames > m_n_frames) {
+        const size_t n_new_frames = n_frames - m_n_frames;
+        const size_t first_sample = m_n_frames * hop_length - m_audio_offset;
+        WhisperFeatures features = m_feature_extractor.extract_log_mel_frames(m_audio.data() + first_sample,
+                                                                              m_audio.size() - first_sample,
+                                                                              n_new_frames);
+
+        const size_t cached_size = m_log_mel.size();
+        m_log_mel.resize(cached_size + n_new_frames * feature_size);
+        for (size_t f = 0; f < n_new_frames; f++) {
+            float* frame = m_log_mel.data() + cached_size + f * feature_size;
+            for (size_t j = 0; j < feature_size; j++) {
+                frame[j] = features.data[j * n_new_frames + f];
+            }
+        }
+        m_n_frames = n_frames;
+
+        // samples before the next frame are not needed anymore
+        const size_t consumed = m_n_frames * hop_length - m_audio_offset;
+        m_audio.erase(m_audio.begin(), m_audio.begin() + consumed);
+        m_audio_offset += consumed;
+    }
+
+    whisper_raw_metrics.features_extraction_durations.emplace_back(
+        PerfMetrics::get_microsec(std::chrono::steady_clock::now() - extraction_start));
+}
+
+std::vector<float> WhisperStreamingSession::get_window_features(const size_t n_window_frames) const {
+    const size_t feature_size = m_feature_extractor.feature_size;
+    const size_t nb_max_frames = m_feature_extractor.nb_max_frames;
+
+    // frames after the end of the window are frames of zero samples
+    const float zero_frame_value = log10(1e-10);
+    std::vector<float> features(feature_size * nb_max_frames, zero_frame_value);
+    float max_value = n_window_frames < nb_max_frames ? zero_frame_value : std::numeric_limits<float>::lowest();
+
+    for (size_t f = 0; f < n_window_frames; f++) {
+        const float* frame = m_log_mel.data() + f * feature_size;
+        for (size_t j = 0; j < feature_size; j++) {
+            features[j * nb_max_frames + f] = frame[j];
+            max_value = std::max(max_value, frame[j]);
+        }
+    }
+
+    // clamping and normalization, the same as in WhisperFeatureExtractor::extract but within the window
+    const float min_value = max_value - 8.0f;
+    for (float& value : features) {
+        value = (std::max(value, min_value) + 4.0f) / 4.0f;
+    }
+
+    return features;
+}
+
+void WhisperStreamingSession::transcribe_window(const bool flush, WhisperStreamingStep& step) {
+    const size_t nb_max_frames = m_feature_extractor.nb_max_frames;
+    const size_t n_available_frames = m_n_frames - m_window_start;
+    if (n_available_frames == 0) {
+        return;
+    }
+
+    const bool is_full = n_available_frames >= nb_max_frames;
+    const size_t n_window_frames = std::min(n_available_frames, nb_max_frames);
+
+    auto window_features = get_window_features(n_window_frames);
+    auto tokens = whisper_decode_window(m_config,
+                                        m_context_tokens,
+                                        window_features,
+                                        m_window_start,
+                                        m_models,
+                                        m_feature_extractor,
+                                        m_init_tokens,
+                                        step.perf_metrics);
+    m_last_transcribed_frame = m_n_frames;
+
+    auto extracted_segments = extract_segments(tokens, m_config, nb_max_frames, m_time_precision);
+    const auto& segments = extracted_segments.segments;
+
+    size_t n_closed = 0;
+    while (n_closed < segments.size() && segments[n_closed].m_end >= 0.0f) {
+        n_closed++;
+    }
+
+    // tokens after the last closing timestamp, the model has not decided on their segment end yet
+    const int64_t timestamp_begin = m_config.no_timestamps_token_id + 1;
+    const size_t tail_begin = n_closed > 0 ? extracted_segments.segment_ranges[n_closed - 1].second + 1 : 0;
+    std::vector<int64_t> tail_tokens;
+    for (size_t i = tail_begin; i < tokens.size(); i++) {
+        if (tokens[i] < timestamp_begin) {
+            tail_tokens.push_back(tokens[i]);
+        }
+    }
+
+    // the last closed segment may be still revised by the next audio, unless the window can't grow anymore
+    size_t n_final = n_closed;
+    if (!flush && !is_full && n_closed > 0) {
+        n_final = n_closed - 1;
+    }
+
+    const float window_start_ts =
+        static_cast<float>(m_window_start * m_feature_extractor.hop_length) / m_feature_extractor.sampling_rate;
+    const float window_end_ts = window_start_ts + static_cast<float>(n_window_frames * m_feature_extractor.hop_length) /
+                                                      m_feature_extractor.sampling_rate;
+
+    for (size_t i = 0; i < n_final; i++) {
+        Segment segment = segments[i];
+        segment.m_start += window_start_ts;
+        segment.m_end += window_start_ts;
+        step.final_segments.push_back(std::move(segment));
+    }
+
+    size_t window_advance = n_final > 0 ? seconds_to_frames(segments[n_final - 1].m_end, m_feature_extractor) : 0;
+
+    m_partial_tokens.clear();
+    const bool finalize_tail = (flush && !is_full) || (is_full && n_closed == 0);
+    if (finalize_tail) {
+        if (!tail_tokens.empty()) {
+            Segment segment;
+            segment.m_start = window_start_ts;
+            if (n_closed > 0) {
+                segment.m_start += segments[n_closed - 1].m_end;
+            } else if (!segments.empty()) {
+                segment.m_start += segments.front().m_start;
+            }
+            segment.m_end = window_end_ts;
+            segment.m_tokens = std::move(tail_tokens);
+            step.final_segments.push_back(std::move(segment));
+        }
+        window_advance = n_window_frames;
+    } else {
+        for (size_t i = n_final; i < n_closed; i++) {
+            m_partial_tokens.insert(m_partial_tokens.end(), segments[i].m_tokens.begin(), segments[i].m_tokens.end());
+        }
+        m_partial_tokens.insert(m_partial_tokens.end(), tail_tokens.begin(), tail_tokens.end());
+    }
+
+    // full window has to move forward anyway
+    if (is_full && window_advance == 0) {
+        window_advance = n_window_frames;
+    }
+    window_advance = std::min(window_advance, n_window_frames);
+
+    m_window_start += window_advance;
+    m_log_mel.erase(m_log_mel.begin(), m_log_mel.begin() + window_advance * m_feature_extractor.feature_size);
+}
+
+}  // namespace genai
+}  // namespace ov
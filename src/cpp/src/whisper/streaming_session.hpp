@@ -0,0 +1,78 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "context_tokens.hpp"
+#include "openvino/genai/whisper_generation_config.hpp"
+#include "openvino/genai/whisper_pipeline.hpp"
+#include "whisper.hpp"
+#include "whisper_feature_extractor.hpp"
+#include "whisper_models.hpp"
+
+namespace ov {
+namespace genai {
+
+struct WhisperStreamingStep {
+    // segments which will not change anymore, timestamps are relative to the beginning of the stream
+    std::vector<Segment> final_segments;
+    // tokens of the transcribed but not finalized part of the window
+    std::vector<int64_t> partial_tokens;
+    WhisperPerfMetrics perf_metrics;
+};
+
+/**
+ * Live transcription of an audio stream.
+ *
+ * Log-mel frames are computed once when enough audio is received and cached till the sliding window passes them.
+ * Each `step` seconds of new audio the window of up to nb_max_frames frames is re-encoded and decoded with
+ * timestamps. All closed segments but the last one are finalized and the window start moves to the end of the last
+ * final segment. Full window finalizes all closed segments, so the latency of final results is bounded by the window.
+ */
+class WhisperStreamingSession {
+public:
+    WhisperStreamingSession(const WhisperGenerationConfig& config,
+                            const WhisperContextTokens& context_tokens,
+                            const float time_precision,
+                            const float step,
+                            WhisperFeatureExtractor& feature_extractor,
+                            WhisperInitializedModels& models);
+
+    WhisperStreamingStep push_audio(const RawSpeechInput& audio_frames);
+
+    // transcribes the rest of the stream, all segments of the result are final
+    WhisperStreamingStep finish();
+
+private:
+    void extend_log_mel(const bool flush, WhisperRawPerfMetrics& whisper_raw_metrics);
+    void transcribe_window(const bool flush, WhisperStreamingStep& step);
+    std::vector<float> get_window_features(const size_t n_window_frames) const;
+
+    const WhisperGenerationConfig m_config;
+    const WhisperContextTokens m_context_tokens;
+    const float m_time_precision;
+    const size_t m_step_frames;
+    WhisperFeatureExtractor& m_feature_extractor;
+    WhisperInitializedModels& m_models;
+
+    std::vector<int64_t> m_init_tokens;
+    // partial result of the last transcribed window
+    std::vector<int64_t> m_partial_tokens;
+
+    // reflect padded audio which is not covered by computed log-mel frames yet,
+    // m_audio[0] is a sample with m_audio_offset index in the padded stream
+    std::vector<float> m_audio;
+    size_t m_audio_offset = 0;
+    size_t m_received_samples = 0;
+    bool m_is_padded = false;
+
+    // not normalized log-mel frames [n_frames, feature_size] starting from the window start frame
+    std::vector<float> m_log_mel;
+    size_t m_window_start = 0;
+    // number of frames computed since the beginning of the stream
+    size_t m_n_frames = 0;
+    size_t m_last_transcribed_frame = 0;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -5,7 +5,6 @@
 
 #include <iostream>
 #include <openvino/openvino.hpp>
-#include <regex>
 #include <thread>
 
 #include "context_tokens.hpp"
@@ -28,9 +27,13 @@ ov::Tensor encode(ov::InferRequest& request,
                   std::vector<float>& mel_data,
                   const size_t feature_size,
                   const size_t nb_max_frames,
-                  ov::genai::RawPerfMetrics& raw_metrics) {
-    OPENVINO_ASSERT(mel_data.size() == feature_size * nb_max_frames,
+                  ov::genai::RawPerfMetrics& raw_metrics,
+                  ov::genai::WhisperRawPerfMetrics& whisper_raw_metrics,
+                  const size_t batch_size = 1) {
+    OPENVINO_ASSERT(mel_data.size() == batch_size * feature_size * nb_max_frames,
                     "Mel spectrogram required size: ",
+                    batch_size,
+                    " * ",
                     feature_size,
                     " * ",
                     nb_max_frames,
@@ -38,7 +41,7 @@ ov::Tensor encode(ov::InferRequest& request,
                     mel_data.size(),
                     ".");
 
-    ov::Tensor input_tensor(ov::element::f32, {1, feature_size, nb_max_frames}, mel_data.data());
+    ov::Tensor input_tensor(ov::element::f32, {batch_size, feature_size, nb_max_frames}, mel_data.data());
 
     request.set_tensor("input_features", input_tensor);
 
@@ -46,6 +49,7 @@ ov::Tensor encode(ov::InferRequest& request,
     request.infer();
     const auto infer_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
     raw_metrics.m_inference_durations[0] += MicroSeconds(infer_ms);
+    whisper_raw_metrics.encode_inference_durations.emplace_back(infer_ms);
 
     // reset input tensor
     request.set_tensor("input_features", ov::Tensor(ov::element::f32, {0, feature_size, nb_max_frames}));
@@ -53,33 +57,6 @@ ov::Tensor encode(ov::InferRequest& request,
     return request.get_tensor("last_hidden_state");
 }
 
-void set_past_key_value(ov::InferRequest& source, ov::InferRequest& dest) {
-    // source outputs:
-    // present.0.decoder.key
-    // present.0.decoder.value
-    // present.0.encoder.key
-    // present.0.encoder.value
-
-    // dest inputs:
-    // past_key_values.0.decoder.key
-    // past_key_values.0.decoder.value
-    // past_key_values.0.encoder.key
-    // past_key_values.0.encoder.value
-
-    for (auto& source_output : source.get_compiled_model().outputs()) {
-        std::string source_output_name = source_output.get_any_name();
-        if (source_output_name.find("logits") != std::string::npos) {
-            continue;
-        }
-
-        std::string with_past_input_name =
-            std::regex_replace(source_output_name, std::regex("present"), "past_key_values");
-
-        auto kv_tensor = source.get_tensor(source_output_name);
-        dest.set_tensor(with_past_input_name, ov::Tensor{kv_tensor});
-    }
-}
-
 int64_t decode(ov::Tensor& encoder_hidden_state,
                ov::InferRequest& decoder,
                std::vector<int64_t>& input_ids,
@@ -225,7 +202,7 @@ std::pair<bool, std::vector<int64_t>> full_decode(ov::Tensor& encoder_hidden_sta
         return {false, output_tokens};
     }
 
-    set_past_key_value(models.decoder, models.decoder_with_past);
+    ov::genai::utils::set_past_key_value(models.decoder, models.decoder_with_past);
 
     for (size_t i = 0; i < max_new_tokens - 1; i++) {
         auto output_token = decode_with_past(encoder_hidden_state,
@@ -238,7 +215,7 @@ std::pair<bool, std::vector<int64_t>> full_decode(ov::Tensor& encoder_hidden_sta
                                              output_tokens);
 
         if (i == 0) {
-            set_past_key_value(models.decoder_with_past, models.decoder_with_past);
+            ov::genai::utils::set_past_key_value(models.decoder_with_past, models.decoder_with_past);
         }
 
         if (output_token == config.eos_token_id) {
@@ -255,6 +232,223 @@ std::pair<bool, std::vector<int64_t>> full_decode(ov::Tensor& encoder_hidden_sta
     return {false, output_tokens};
 }
 
+/**
+ * Greedy decoding of a batch of chunks sharing the same init_ids.
+ * Rows which generated eos are kept in the batch until all rows finish, their outputs are ignored.
+ */
+std::vector<std::vector<int64_t>> batch_full_decode(ov::Tensor& encoder_hidden_state,
+                                                    const ov::genai::WhisperGenerationConfig& config,
+                                                    ov::genai::WhisperInitializedModels& models,
+                                                    const std::vector<int64_t>& init_ids,
+                                                    const size_t max_new_tokens,
+                                                    const bool return_timestamps,
+                                                    ov::genai::RawPerfMetrics& raw_metrics) {
+    const size_t batch_size = encoder_hidden_state.get_shape().at(0);
+
+    models.decoder.set_tensor("encoder_hidden_states", ov::Tensor{encoder_hidden_state});
+
+    ov::Tensor input_ids_tensor(ov::element::i64, {batch_size, init_ids.size()});
+    for (size_t batch = 0; batch < batch_size; batch++) {
+        std::copy(init_ids.begin(), init_ids.end(), input_ids_tensor.data<int64_t>() + batch * init_ids.size());
+    }
+    models.decoder.set_tensor("input_ids", input_ids_tensor);
+
+    ov::genai::utils::infer_with_perf_metrics(models.decoder, raw_metrics, batch_size);
+
+    auto logits = models.decoder.get_tensor("logits");
+
+    std::vector<std::vector<int64_t>> output_tokens(batch_size);
+    std::vector<bool> finished(batch_size, false);
+    size_t num_finished = 0;
+    for (size_t batch = 0; batch < batch_size; batch++) {
+        ov::genai::do_suppress_tokens(logits, batch, config.begin_suppress_tokens);
+        ov::genai::do_suppress_tokens(logits, batch, config.suppress_tokens);
+        if (return_timestamps) {
+            ov::genai::process_whisper_timestamp_logits(logits, batch, config, {}, true);
+        }
+
+        const int64_t output_token = ov::genai::utils::argmax(logits, batch);
+        if (output_token == config.eos_token_id) {
+            // chunk without speech, greedy decoding for the row isn't continued
+            finished[batch] = true;
+            num_finished++;
+            continue;
+        }
+        output_tokens[batch].push_back(output_token);
+    }
+
+    if (max_new_tokens == 1 || num_finished == batch_size) {
+        return output_tokens;
+    }
+
+    ov::genai::utils::set_past_key_value(models.decoder, models.decoder_with_past);
+    models.decoder_with_past.set_tensor("encoder_hidden_states", ov::Tensor{encoder_hidden_state});
+
+    ov::Tensor step_input_ids(ov::element::i64, {batch_size, 1});
+    for (size_t i = 0; i < max_new_tokens - 1 && num_finished < batch_size; i++) {
+        for (size_t batch = 0; batch < batch_size; batch++) {
+            // rows of chunks without speech have no tokens, outputs of finished rows are ignored
+            step_input_ids.data<int64_t>()[batch] = finished[batch] ? config.eos_token_id : output_tokens[batch].back();
+        }
+        models.decoder_with_past.set_tensor("input_ids", step_input_ids);
+
+        ov::Tensor cache_position_tensor = models.decoder_with_past.get_tensor("cache_position");
+        cache_position_tensor.set_shape({1});
+        cache_position_tensor.data<int64_t>()[0] = init_ids.size() + i;
+
+        ov::genai::utils::infer_with_perf_metrics(models.decoder_with_past, raw_metrics, batch_size - num_finished);
+
+        if (i == 0) {
+            ov::genai::utils::set_past_key_value(models.decoder_with_past, models.decoder_with_past);
+        }
+
+        auto step_logits = models.decoder_with_past.get_tensor("logits");
+        for (size_t batch = 0; batch < batch_size; batch++) {
+            if (finished[batch]) {
+                continue;
+            }
+
+            ov::genai::do_suppress_tokens(step_logits, batch, config.suppress_tokens);
+            if (return_timestamps) {
+                ov::genai::process_whisper_timestamp_logits(step_logits, batch, config, output_tokens[batch]);
+            }
+
+            const int64_t output_token = ov::genai::utils::argmax(step_logits, batch);
+            if (output_token == config.eos_token_id) {
+                finished[batch] = true;
+                num_finished++;
+                continue;
+            }
+            output_tokens[batch].push_back(output_token);
+        }
+    }
+
+    return output_tokens;
+}
+
+/**
+ * Long-form audio is split into fixed nb_max_frames chunks, config.chunks_batch_size chunks are encoded by one encoder
+ * inference and decoded together. Results of a batch are appended to output tokens and segments in chunks order.
+ */
+void batched_long_form_generate(const ov::genai::WhisperGenerationConfig& config,
+                                const ov::genai::WhisperContextTokens& context_tokens,
+                                ov::genai::WhisperFeatures& input_features,
+                                ov::genai::WhisperInitializedModels& models,
+                                const ov::genai::WhisperFeatureExtractor& feature_extractor,
+                                const bool return_timestamps,
+                                const float time_precision,
+                                const std::shared_ptr<ov::genai::ChunkStreamerBase> streamer,
+                                ov::genai::WhisperGenerateResult& result,
+                                std::vector<ov::genai::Segment>& segments) {
+    const size_t max_new_tokens = config.get_max_new_tokens();
+    const size_t nb_max_frames = feature_extractor.nb_max_frames;
+    const size_t n_chunks = (input_features.n_frames + nb_max_frames - 1) / nb_max_frames;
+
+    ov::genai::RawPerfMetrics& raw_metrics = result.perf_metrics.raw_metrics;
+    ov::genai::WhisperRawPerfMetrics& whisper_raw_metrics = result.perf_metrics.whisper_raw_metrics;
+    std::vector<int64_t>& output_tokens = result.output_tokens;
+    std::vector<int64_t> init_tokens;
+
+    for (size_t batch_start = 0; batch_start < n_chunks; batch_start += config.chunks_batch_size) {
+        if (output_tokens.size() >= max_new_tokens) {
+            break;
+        }
+
+        const size_t batch_size = std::min(config.chunks_batch_size, n_chunks - batch_start);
+
+        std::vector<float> input_features_batch;
+        input_features_batch.reserve(batch_size * feature_extractor.feature_size * nb_max_frames);
+        for (size_t chunk = batch_start; chunk < batch_start + batch_size; chunk++) {
+            auto input_features_chunk = input_features.get_data_with_offset(chunk * nb_max_frames, nb_max_frames);
+            input_features_batch.insert(input_features_batch.end(),
+                                        input_features_chunk.begin(),
+                                        input_features_chunk.end());
+        }
+
+        ov::Tensor hidden_state_tensor = encode(models.encoder,
+                                                input_features_batch,
+                                                feature_extractor.feature_size,
+                                                nb_max_frames,
+                                                raw_metrics,
+                                                whisper_raw_metrics,
+                                                batch_size);
+        const ov::Shape hidden_state_shape = hidden_state_tensor.get_shape();
+
+        // prepare init_ids just once for whole input, language is detected by the first chunk
+        if (init_tokens.empty()) {
+            ov::Tensor first_chunk_hidden_state(hidden_state_tensor,
+                                                {0, 0, 0},
+                                                {1, hidden_state_shape[1], hidden_state_shape[2]});
+            init_tokens =
+                prepare_init_tokens(first_chunk_hidden_state, models.decoder, config, return_timestamps, raw_metrics);
+        }
+
+        const auto decode_start = std::chrono::steady_clock::now();
+
+        // decoder has no attention mask, so rows of a decoded batch must have prompts of the same length:
+        // the first chunk with initial prompt is decoded separately
+        std::vector<std::vector<int64_t>> batch_output_tokens;
+        for (size_t row_begin = 0; row_begin < batch_size;) {
+            const size_t chunk_offset = (batch_start + row_begin) * nb_max_frames;
+            const bool has_initial_prompt = chunk_offset == 0 && !context_tokens.initial_prompt.empty();
+            const size_t row_end = has_initial_prompt ? row_begin + 1 : batch_size;
+
+            std::vector<int64_t> rows_init_tokens = ov::genai::get_prompt_tokens(context_tokens, config, chunk_offset);
+            rows_init_tokens.insert(rows_init_tokens.end(), init_tokens.begin(), init_tokens.end());
+
+            ov::Tensor rows_hidden_state(hidden_state_tensor,
+                                         {row_begin, 0, 0},
+                                         {row_end, hidden_state_shape[1], hidden_state_shape[2]});
+            auto rows_output_tokens = batch_full_decode(rows_hidden_state,
+                                                        config,
+                                                        models,
+                                                        rows_init_tokens,
+                                                        max_new_tokens - output_tokens.size(),
+                                                        return_timestamps,
+                                                        raw_metrics);
+            models.decoder_with_past.reset_state();
+
+            batch_output_tokens.insert(batch_output_tokens.end(),
+                                       std::make_move_iterator(rows_output_tokens.begin()),
+                                       std::make_move_iterator(rows_output_tokens.end()));
+            row_begin = row_end;
+        }
+
+        whisper_raw_metrics.decode_durations.emplace_back(
+            ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - decode_start));
+
+        for (size_t row = 0; row < batch_size; row++) {
+            std::vector<int64_t> chunk_tokens = std::move(batch_output_tokens[row]);
+
+            if (return_timestamps) {
+                auto extracted_segments = ov::genai::extract_segments(chunk_tokens, config, nb_max_frames, time_precision);
+
+                // chunk boundaries are fixed, so segments are shifted by the chunk start time
+                const float chunk_start_time = static_cast<float>((batch_start + row) * feature_extractor.chunk_length);
+                for (auto& segment : extracted_segments.segments) {
+                    segment.m_start += chunk_start_time;
+                    if (segment.m_end >= 0.0f) {
+                        segment.m_end += chunk_start_time;
+                    }
+                }
+
+                segments.insert(segments.end(), extracted_segments.segments.begin(), extracted_segments.segments.end());
+                chunk_tokens = std::move(extracted_segments.non_timestamp_tokens);
+            }
+
+            const size_t tokens_left = max_new_tokens - output_tokens.size();
+            if (chunk_tokens.size() > tokens_left) {
+                chunk_tokens.resize(tokens_left);
+            }
+            output_tokens.insert(output_tokens.end(), chunk_tokens.begin(), chunk_tokens.end());
+
+            if (streamer && streamer->put_chunk(chunk_tokens)) {
+                return;
+            }
+        }
+    }
+}
+
 }  // namespace
 
 namespace ov {
@@ -283,8 +477,10 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
     result.perf_metrics.whisper_raw_metrics.features_extraction_durations.emplace_back(infer_ms);
 
     const bool is_shortform = input_features.n_frames <= feature_extractor.nb_max_frames;
-    // long-form audio processing requires timestamps to be enabled
-    const bool return_timestamps = config.return_timestamps || !is_shortform;
+    // batched long-form processing uses fixed chunk boundaries
+    const bool is_batched = !is_shortform && config.chunks_batch_size > 1;
+    // sequential long-form audio processing requires timestamps to be enabled
+    const bool return_timestamps = config.return_timestamps || (!is_shortform && !is_batched);
 
     std::vector<int64_t> init_tokens;
     std::vector<int64_t>& output_tokens = result.output_tokens;
@@ -294,69 +490,86 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
     const float time_precision = static_cast<float>(feature_extractor.chunk_length) / model_config.max_source_positions;
     size_t segment_offset = 0;
 
-    for (size_t chunk_offset = 0; chunk_offset < input_features.n_frames; chunk_offset += segment_offset) {
-        if (output_tokens.size() >= max_new_tokens) {
-            break;
-        }
-
-        auto input_features_chunk = input_features.get_data_with_offset(chunk_offset, feature_extractor.nb_max_frames);
-
-        ov::Tensor hidden_state_tensor = encode(models.encoder,
-                                                input_features_chunk,
-                                                feature_extractor.feature_size,
-                                                feature_extractor.nb_max_frames,
-                                                raw_metrics);
-
-        // prepare init_ids just once for whole input
-        if (init_tokens.empty()) {
-            init_tokens =
-                prepare_init_tokens(hidden_state_tensor, models.decoder, config, return_timestamps, raw_metrics);
-        }
-
-        std::vector<int64_t> chunk_init_tokens = ov::genai::get_prompt_tokens(context_tokens, config, chunk_offset);
-        chunk_init_tokens.insert(chunk_init_tokens.end(), init_tokens.begin(), init_tokens.end());
+    if (is_batched) {
+        batched_long_form_generate(config,
+                                   context_tokens,
+                                   input_features,
+                                   models,
+                                   feature_extractor,
+                                   return_timestamps,
+                                   time_precision,
+                                   streamer,
+                                   result,
+                                   segments);
+    } else {
+        for (size_t chunk_offset = 0; chunk_offset < input_features.n_frames; chunk_offset += segment_offset) {
+            if (output_tokens.size() >= max_new_tokens) {
+                break;
+            }
 
-        auto [cancelled, chunk_output_tokens] = full_decode(hidden_state_tensor,
-                                                            config,
-                                                            models,
-                                                            chunk_init_tokens,
-                                                            max_new_tokens - output_tokens.size(),
-                                                            return_timestamps,
-                                                            raw_metrics,
-                                                            streamer);
+            auto input_features_chunk = input_features.get_data_with_offset(chunk_offset, feature_extractor.nb_max_frames);
 
-        models.decoder_with_past.reset_state();
+            ov::Tensor hidden_state_tensor = encode(models.encoder,
+                                                    input_features_chunk,
+                                                    feature_extractor.feature_size,
+                                                    feature_extractor.nb_max_frames,
+                                                    raw_metrics,
+                                                    result.perf_metrics.whisper_raw_metrics);
 
-        if (return_timestamps) {
-            auto extracted_segments = ov::genai::extract_segments(chunk_output_tokens,
-                                                                  config,
-                                                                  feature_extractor.nb_max_frames,
-                                                                  time_precision);
-
-            ov::genai::utils::filter_non_segment_metrics(raw_metrics, output_tokens.size(), extracted_segments.segment_ranges);
+            // prepare init_ids just once for whole input
+            if (init_tokens.empty()) {
+                init_tokens =
+                    prepare_init_tokens(hidden_state_tensor, models.decoder, config, return_timestamps, raw_metrics);
+            }
 
-            segments.insert(segments.end(), extracted_segments.segments.begin(), extracted_segments.segments.end());
+            std::vector<int64_t> chunk_init_tokens = ov::genai::get_prompt_tokens(context_tokens, config, chunk_offset);
+            chunk_init_tokens.insert(chunk_init_tokens.end(), init_tokens.begin(), init_tokens.end());
+
+            const auto decode_start = std::chrono::steady_clock::now();
+            auto [cancelled, chunk_output_tokens] = full_decode(hidden_state_tensor,
+                                                                config,
+                                                                models,
+                                                                chunk_init_tokens,
+                                                                max_new_tokens - output_tokens.size(),
+                                                                return_timestamps,
+                                                                raw_metrics,
+                                                                streamer);
+            result.perf_metrics.whisper_raw_metrics.decode_durations.emplace_back(
+                ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - decode_start));
+
+            models.decoder_with_past.reset_state();
+
+            if (return_timestamps) {
+                auto extracted_segments = ov::genai::extract_segments(chunk_output_tokens,
+                                                                      config,
+                                                                      feature_extractor.nb_max_frames,
+                                                                      time_precision);
+
+                ov::genai::utils::filter_non_segment_metrics(raw_metrics, output_tokens.size(), extracted_segments.segment_ranges);
+
+                segments.insert(segments.end(), extracted_segments.segments.begin(), extracted_segments.segments.end());
+
+                output_tokens.insert(output_tokens.end(),
+                                     extracted_segments.non_timestamp_tokens.begin(),
+                                     extracted_segments.non_timestamp_tokens.end());
+
+                if (streamer && streamer->put_chunk(extracted_segments.non_timestamp_tokens)) {
+                    cancelled = true;
+                    break;
+                }
+
+                segment_offset = extracted_segments.last_offset;
+            } else {
+                output_tokens.insert(output_tokens.end(), chunk_output_tokens.begin(), chunk_output_tokens.end());
+            }
 
-            output_tokens.insert(output_tokens.end(),
-                                 extracted_segments.non_timestamp_tokens.begin(),
-                                 extracted_segments.non_timestamp_tokens.end());
+            if (is_shortform) {
+                segment_offset = input_features.n_frames;
+            }
 
-            if (streamer && streamer->put_chunk(extracted_segments.non_timestamp_tokens)) {
-                cancelled = true;
+            if (cancelled) {
                 break;
             }
-
-            segment_offset = extracted_segments.last_offset;
-        } else {
-            output_tokens.insert(output_tokens.end(), chunk_output_tokens.begin(), chunk_output_tokens.end());
-        }
-
-        if (is_shortform) {
-            segment_offset = input_features.n_frames;
-        }
-
-        if (cancelled) {
-            break;
         }
     }
 
@@ -373,5 +586,48 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
 
     return result;
 }
+
+std::vector<int64_t> whisper_decode_window(const ov::genai::WhisperGenerationConfig& config,
+                                           const WhisperContextTokens& context_tokens,
+                                           std::vector<float>& input_features,
+                                           const size_t frame_offset,
+                                           ov::genai::WhisperInitializedModels& models,
+                                           const ov::genai::WhisperFeatureExtractor& feature_extractor,
+                                           std::vector<int64_t>& init_tokens,
+                                           WhisperPerfMetrics& perf_metrics) {
+    RawPerfMetrics& raw_metrics = perf_metrics.raw_metrics;
+
+    ov::Tensor hidden_state_tensor = encode(models.encoder,
+                                            input_features,
+                                            feature_extractor.feature_size,
+                                            feature_extractor.nb_max_frames,
+                                            raw_metrics,
+                                            perf_metrics.whisper_raw_metrics);
+
+    // language detection is done once per stream
+    if (init_tokens.empty()) {
+        init_tokens = prepare_init_tokens(hidden_state_tensor, models.decoder, config, true, raw_metrics);
+    }
+
+    std::vector<int64_t> window_init_tokens = ov::genai::get_prompt_tokens(context_tokens, config, frame_offset);
+    window_init_tokens.insert(window_init_tokens.end(), init_tokens.begin(), init_tokens.end());
+
+    const auto decode_start = std::chrono::steady_clock::now();
+    auto [cancelled, output_tokens] = full_decode(hidden_state_tensor,
+                                                  config,
+                                                  models,
+                                                  window_init_tokens,
+                                                  config.get_max_new_tokens(),
+                                                  true,
+                                                  raw_metrics,
+                                                  nullptr);
+    perf_metrics.whisper_raw_metrics.decode_durations.emplace_back(
+        ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - decode_start));
+
+    models.decoder_with_past.reset_state();
+
+    return output_tokens;
+}
+
 }  // namespace genai
 }  // namespace ov
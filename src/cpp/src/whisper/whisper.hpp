@@ -35,5 +35,20 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
                                        ov::genai::WhisperFeatureExtractor& feature_extractor,
                                        const std::shared_ptr<ChunkStreamerBase> streamer);
 
+/**
+ * @brief Transcribe single window of normalized log-mel features [feature_size, nb_max_frames] with timestamps.
+ * init_tokens are prepared on the first call and reused for the next windows of the same audio stream.
+ *
+ * @return generated tokens including timestamp tokens
+ */
+std::vector<int64_t> whisper_decode_window(const ov::genai::WhisperGenerationConfig& config,
+                                           const WhisperContextTokens& context_tokens,
+                                           std::vector<float>& input_features,
+                                           const size_t frame_offset,
+                                           ov::genai::WhisperInitializedModels& models,
+                                           const ov::genai::WhisperFeatureExtractor& feature_extractor,
+                                           std::vector<int64_t>& init_tokens,
+                                           WhisperPerfMetrics& perf_metrics);
+
 }  // namespace genai
 }  // namespace ov
@@ -16,10 +16,10 @@
 #include <openvino/core/except.hpp>
 #include <openvino/openvino.hpp>
 #include <string>
-#include <thread>
 #include <vector>
 
 #include "json_utils.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/genai/visibility.hpp"
 
 namespace {
@@ -40,161 +40,310 @@ static bool hann_window(const size_t length, const bool periodic, std::vector<fl
     return true;
 }
 
-// naive Discrete Fourier Transform
-// input is real-valued
-// output is complex-valued
-static void dft(const std::vector<float>& in,
-                std::vector<float>& out,
-                const std::vector<float>& sin_vals,
-                const std::vector<float>& cos_vals,
-                const size_t n_fft) {
-    int N = in.size();
-
-    out.resize(N * 2);
-    const int sin_cos_step = n_fft / N;
-
-    for (int k = 0; k < N; k++) {
-        float re = 0;
-        float im = 0;
-
-        for (int n = 0; n < N; n++) {
-            int idx = (k * n * sin_cos_step) % (n_fft);  // t = 2*M_PI*k*n/N
-            re += in[n] * cos_vals[idx];                 // cos(t)
-            im -= in[n] * sin_vals[idx];                 // sin(t)
+// Number of frames processed together by the mel filter bank multiplication.
+// Spectra of a block are stored transposed ([n_bins, block]), so the innermost loop
+// runs over contiguous frames and is vectorized by the compiler.
+constexpr size_t MEL_FRAMES_BLOCK = 16;
+
+// Largest radix handled by the generic O(radix^2) butterfly with twiddles on stack,
+// larger prime factors are transformed by a plain DFT reading twiddles from the tables
+constexpr size_t MAX_GENERIC_RADIX = 64;
+
+// Split n into radix factors. Radix 4 goes first as the cheapest butterfly per element.
+std::vector<size_t> fft_factorize(size_t n) {
+    std::vector<size_t> factors;
+    for (size_t radix : {4, 2, 3, 5}) {
+        while (n % radix == 0) {
+            factors.push_back(radix);
+            n /= radix;
+        }
+    }
+    for (size_t radix = 7; n > 1; radix += 2) {
+        while (n % radix == 0) {
+            factors.push_back(radix);
+            n /= radix;
         }
-
-        out[k * 2 + 0] = re;
-        out[k * 2 + 1] = im;
     }
+    return factors;
 }
 
-// Cooley-Tukey FFT
-// input is real-valued
-// output is complex-valued
-static void fft(const std::vector<float>& in,
-                std::vector<float>& out,
-                const std::vector<float>& sin_vals,
-                const std::vector<float>& cos_vals,
-                const size_t n_fft) {
-    out.resize(in.size() * 2);
-
-    int N = in.size();
-
-    if (N == 1) {
-        out[0] = in[0];
-        out[1] = 0;
-        return;
-    }
+// Iterative mixed-radix Stockham FFT (decimation in frequency), result is in natural order.
+// data and work are interleaved complex buffers of n elements, result is written to data.
+// Twiddle W_n^t is taken from the n_fft sized tables as cos_vals[t * twiddle_step] - i * sin_vals[t * twiddle_step]
+static void complex_fft(float* data,
+                        float* work,
+                        const size_t n,
+                        const std::vector<size_t>& factors,
+                        const std::vector<float>& sin_vals,
+                        const std::vector<float>& cos_vals,
+                        const size_t twiddle_step) {
+    // cos(2 * pi / 5), cos(4 * pi / 5), sin(2 * pi / 5), sin(4 * pi / 5)
+    constexpr float c5_1 = 0.309016994374947f, c5_2 = -0.809016994374947f;
+    constexpr float s5_1 = 0.951056516295154f, s5_2 = 0.587785252292473f;
+
+    float* x = data;
+    float* y = work;
+    size_t len = n;
+    size_t stride = 1;
+
+    for (const size_t radix : factors) {
+        const size_t m = len / radix;
+        // W_radix^1 and W_len^1 expressed as steps in the twiddle tables
+        const size_t radix_step = twiddle_step * (n / radix);
+        const size_t len_step = twiddle_step * (n / len);
+
+        for (size_t k = 0; k < m; k++) {
+            const float* in = x + 2 * stride * k;
+            float* out = y + 2 * stride * radix * k;
+
+            if (radix == 2) {
+                const float tw_re = cos_vals[len_step * k], tw_im = -sin_vals[len_step * k];
+                for (size_t q = 0; q < 2 * stride; q += 2) {
+                    const float* a = in + q;
+                    const float* b = in + q + 2 * stride * m;
+                    const float d_re = a[0] - b[0], d_im = a[1] - b[1];
+                    out[q] = a[0] + b[0];
+                    out[q + 1] = a[1] + b[1];
+                    out[q + 2 * stride] = d_re * tw_re - d_im * tw_im;
+                    out[q + 2 * stride + 1] = d_re * tw_im + d_im * tw_re;
+                }
+            } else if (radix == 4) {
+                float tw_re[4], tw_im[4];
+                for (size_t u = 1; u < 4; u++) {
+                    tw_re[u] = cos_vals[len_step * u * k];
+                    tw_im[u] = -sin_vals[len_step * u * k];
+                }
+                for (size_t q = 0; q < 2 * stride; q += 2) {
+                    const float* a0 = in + q;
+                    const float* a1 = a0 + 2 * stride * m;
+                    const float* a2 = a1 + 2 * stride * m;
+                    const float* a3 = a2 + 2 * stride * m;
+                    // radix-4 butterfly, W_4 = -i
+                    const float t0_re = a0[0] + a2[0], t0_im = a0[1] + a2[1];
+                    const float t1_re = a0[0] - a2[0], t1_im = a0[1] - a2[1];
+                    const float t2_re = a1[0] + a3[0], t2_im = a1[1] + a3[1];
+                    const float t3_re = a1[1] - a3[1], t3_im = a3[0] - a1[0];
+                    const float v_re[4] = {t0_re + t2_re, t1_re + t3_re, t0_re - t2_re, t1_re - t3_re};
+                    const float v_im[4] = {t0_im + t2_im, t1_im + t3_im, t0_im - t2_im, t1_im - t3_im};
+                    out[q] = v_re[0];
+                    out[q + 1] = v_im[0];
+                    for (size_t u = 1; u < 4; u++) {
+                        out[q + 2 * stride * u] = v_re[u] * tw_re[u] - v_im[u] * tw_im[u];
+                        out[q + 2 * stride * u + 1] = v_re[u] * tw_im[u] + v_im[u] * tw_re[u];
+                    }
+                }
+            } else if (radix == 5) {
+                float tw_re[5], tw_im[5];
+                for (size_t u = 1; u < 5; u++) {
+                    tw_re[u] = cos_vals[len_step * u * k];
+                    tw_im[u] = -sin_vals[len_step * u * k];
+                }
+                for (size_t q = 0; q < 2 * stride; q += 2) {
+                    const float* a0 = in + q;
+                    const float* a1 = a0 + 2 * stride * m;
+                    const float* a2 = a1 + 2 * stride * m;
+                    const float* a3 = a2 + 2 * stride * m;
+                    const float* a4 = a3 + 2 * stride * m;
+                    // radix-5 butterfly using symmetry W_5^(5 - j) = conj(W_5^j)
+                    const float b1_re = a1[0] + a4[0], b1_im = a1[1] + a4[1];
+                    const float b2_re = a2[0] + a3[0], b2_im = a2[1] + a3[1];
+                    const float d1_re = a1[0] - a4[0], d1_im = a1[1] - a4[1];
+                    const float d2_re = a2[0] - a3[0], d2_im = a2[1] - a3[1];
+                    const float t1_re = a0[0] + c5_1 * b1_re + c5_2 * b2_re;
+                    const float t1_im = a0[1] + c5_1 * b1_im + c5_2 * b2_im;
+                    const float t2_re = a0[0] + c5_2 * b1_re + c5_1 * b2_re;
+                    const float t2_im = a0[1] + c5_2 * b1_im + c5_1 * b2_im;
+                    const float u1_re = s5_1 * d1_re + s5_2 * d2_re, u1_im = s5_1 * d1_im + s5_2 * d2_im;
+                    const float u2_re = s5_2 * d1_re - s5_1 * d2_re, u2_im = s5_2 * d1_im - s5_1 * d2_im;
+                    const float v_re[5] = {a0[0] + b1_re + b2_re, t1_re + u1_im, t2_re + u2_im, t2_re - u2_im, t1_re - u1_im};
+                    const float v_im[5] = {a0[1] + b1_im + b2_im, t1_im - u1_re, t2_im - u2_re, t2_im + u2_re, t1_im + u1_re};
+                    out[q] = v_re[0];
+                    out[q + 1] = v_im[0];
+                    for (size_t u = 1; u < 5; u++) {
+                        out[q + 2 * stride * u] = v_re[u] * tw_re[u] - v_im[u] * tw_im[u];
+                        out[q + 2 * stride * u + 1] = v_re[u] * tw_im[u] + v_im[u] * tw_re[u];
+                    }
+                }
+            } else if (radix > MAX_GENERIC_RADIX) {
+                // plain DFT over the radix elements
+                for (size_t u = 0; u < radix; u++) {
+                    const float tw_re = cos_vals[len_step * u * k], tw_im = -sin_vals[len_step * u * k];
+                    for (size_t q = 0; q < 2 * stride; q += 2) {
+                        float re = 0.0f, im = 0.0f;
+                        for (size_t r = 0, ru = 0; r < radix; r++, ru = (ru + u) % radix) {
+                            const float* a = in + q + 2 * stride * m * r;
+                            const float w_re = cos_vals[radix_step * ru], w_im = -sin_vals[radix_step * ru];
+                            re += a[0] * w_re - a[1] * w_im;
+                            im += a[0] * w_im + a[1] * w_re;
+                        }
+                        out[q + 2 * stride * u] = re * tw_re - im * tw_im;
+                        out[q + 2 * stride * u + 1] = re * tw_im + im * tw_re;
+                    }
+                }
+            } else {
+                for (size_t u = 0; u < radix; u++) {
+                    const float tw_re = cos_vals[len_step * u * k], tw_im = -sin_vals[len_step * u * k];
+                    // W_radix^(r * u), r = 0..radix-1
+                    float w_re[MAX_GENERIC_RADIX], w_im[MAX_GENERIC_RADIX];
+                    for (size_t r = 0, ru = 0; r < radix; r++, ru = (ru + u) % radix) {
+                        w_re[r] = cos_vals[radix_step * ru];
+                        w_im[r] = -sin_vals[radix_step * ru];
+                    }
+                    for (size_t q = 0; q < 2 * stride; q += 2) {
+                        float re = 0.0f, im = 0.0f;
+                        for (size_t r = 0; r < radix; r++) {
+                            const float* a = in + q + 2 * stride * m * r;
+                            re += a[0] * w_re[r] - a[1] * w_im[r];
+                            im += a[0] * w_im[r] + a[1] * w_re[r];
+                        }
+                        out[q + 2 * stride * u] = re * tw_re - im * tw_im;
+                        out[q + 2 * stride * u + 1] = re * tw_im + im * tw_re;
+                    }
+                }
+            }
+        }
 
-    if (N % 2 == 1) {
-        dft(in, out, sin_vals, cos_vals, n_fft);
-        return;
+        std::swap(x, y);
+        len = m;
+        stride *= radix;
     }
 
-    std::vector<float> even;
-    std::vector<float> odd;
+    if (x != data) {
+        std::copy(x, x + 2 * n, data);
+    }
+}
 
-    even.reserve(N / 2);
-    odd.reserve(N / 2);
+// Power spectrum |X[k]|^2, k = 0..N/2 of a real-valued frame of N samples.
+// For even N the frame is packed as N/2 complex values z[k] = in[2k] + i * in[2k + 1] and transformed with a half size
+// FFT, then even/odd spectra are separated. For odd N a full size complex FFT is used.
+// fft_buf and work must hold at least 2 * N floats, power must hold N/2 + 1 floats. No allocations are made.
+static void real_fft_power(const float* in,
+                           const size_t N,
+                           float* fft_buf,
+                           float* work,
+                           float* power,
+                           const size_t power_stride,
+                           const std::vector<size_t>& factors,
+                           const std::vector<float>& sin_vals,
+                           const std::vector<float>& cos_vals) {
+    const size_t n_bins = N / 2 + 1;
 
-    for (int i = 0; i < N; i++) {
-        if (i % 2 == 0) {
-            even.push_back(in[i]);
-        } else {
-            odd.push_back(in[i]);
+    if (N % 2 == 1) {
+        for (size_t i = 0; i < N; i++) {
+            fft_buf[2 * i] = in[i];
+            fft_buf[2 * i + 1] = 0.0f;
+        }
+        complex_fft(fft_buf, work, N, factors, sin_vals, cos_vals, 1);
+        for (size_t k = 0; k < n_bins; k++) {
+            power[k * power_stride] = fft_buf[2 * k] * fft_buf[2 * k] + fft_buf[2 * k + 1] * fft_buf[2 * k + 1];
         }
+        return;
     }
 
-    std::vector<float> even_fft;
-    std::vector<float> odd_fft;
-
-    fft(even, even_fft, sin_vals, cos_vals, n_fft);
-    fft(odd, odd_fft, sin_vals, cos_vals, n_fft);
-
-    const int sin_cos_step = n_fft / N;
-    for (int k = 0; k < N / 2; k++) {
-        int idx = k * sin_cos_step;  // t = 2*M_PI*k/N
-        float re = cos_vals[idx];    // cos(t)
-        float im = -sin_vals[idx];   // sin(t)
-
-        float re_odd = odd_fft[2 * k + 0];
-        float im_odd = odd_fft[2 * k + 1];
-
-        out[2 * k + 0] = even_fft[2 * k + 0] + re * re_odd - im * im_odd;
-        out[2 * k + 1] = even_fft[2 * k + 1] + re * im_odd + im * re_odd;
-
-        out[2 * (k + N / 2) + 0] = even_fft[2 * k + 0] - re * re_odd + im * im_odd;
-        out[2 * (k + N / 2) + 1] = even_fft[2 * k + 1] - re * im_odd - im * re_odd;
+    const size_t M = N / 2;
+    std::copy(in, in + N, fft_buf);
+    complex_fft(fft_buf, work, M, factors, sin_vals, cos_vals, 2);
+
+    for (size_t k = 0; k < n_bins; k++) {
+        const size_t k1 = k % M;
+        const size_t k2 = (M - k) % M;
+        const float z1_re = fft_buf[2 * k1], z1_im = fft_buf[2 * k1 + 1];
+        const float z2_re = fft_buf[2 * k2], z2_im = -fft_buf[2 * k2 + 1];
+
+        // E = (Z[k] + conj(Z[M - k])) / 2, O = (Z[k] - conj(Z[M - k])) / 2i
+        const float e_re = 0.5f * (z1_re + z2_re);
+        const float e_im = 0.5f * (z1_im + z2_im);
+        const float o_re = 0.5f * (z1_im - z2_im);
+        const float o_im = -0.5f * (z1_re - z2_re);
+
+        // X[k] = E + W_N^k * O
+        const float w_re = cos_vals[k];
+        const float w_im = -sin_vals[k];
+        const float re = e_re + w_re * o_re - w_im * o_im;
+        const float im = e_im + w_re * o_im + w_im * o_re;
+
+        power[k * power_stride] = re * re + im * im;
     }
 }
 
-static void log_mel_spectrogram_worker_thread(int ith,
-                                              const std::vector<float>& hann,
-                                              const std::vector<float>& samples,
-                                              int n_samples,
-                                              int frame_size,
-                                              int frame_step,
-                                              int n_threads,
-                                              const std::vector<float>& mel_filter,
-                                              WhisperFeatures& features,
-                                              const std::vector<float>& sin_vals,
-                                              const std::vector<float>& cos_vals) {
-    std::vector<float> fft_in(frame_size, 0.0);
-    std::vector<float> fft_out(2 * frame_size);
-    int n_fft = 1 + (frame_size / 2);
-    int i = ith;
+struct MelSpectrogramContext {
+    const std::vector<float>& hann;
+    const float* samples;
+    size_t n_samples;
+    size_t frame_size;
+    size_t frame_step;
+    const std::vector<float>& mel_filter;
+    const std::vector<std::pair<size_t, size_t>>& mel_filter_ranges;
+    const std::vector<size_t>& fft_factors;
+    const std::vector<float>& sin_vals;
+    const std::vector<float>& cos_vals;
+};
 
-    OPENVINO_ASSERT(mel_filter.size() == n_fft * features.feature_size);
+// Computes log mel frames [frame_begin, frame_end) using thread-local scratch buffers
+static void log_mel_spectrogram_frames(const MelSpectrogramContext& ctx,
+                                       const size_t frame_begin,
+                                       const size_t frame_end,
+                                       WhisperFeatures& features) {
+    const size_t frame_size = ctx.frame_size;
+    const size_t n_bins = 1 + (frame_size / 2);
 
-    // calculate FFT only when fft_in are not all zero
-    for (; i < std::min(n_samples / frame_step + 1, int(features.n_frames)); i += n_threads) {
-        const int offset = i * frame_step;
+    OPENVINO_ASSERT(ctx.mel_filter.size() == n_bins * features.feature_size);
 
-        // apply Hanning window (~10% faster)
-        for (int j = 0; j < std::min(frame_size, n_samples - offset); j++) {
-            fft_in[j] = hann[j] * samples[offset + j];
-        }
-        // fill the rest with zeros
-        if (n_samples - offset < frame_size) {
-            std::fill(fft_in.begin() + (n_samples - offset), fft_in.end(), 0.0);
-        }
+    std::vector<float> fft_in(frame_size, 0.0f);
+    std::vector<float> fft_buf(2 * frame_size);
+    std::vector<float> work(2 * frame_size);
+    // power spectra of a frames block, [n_bins, MEL_FRAMES_BLOCK]
+    std::vector<float> power(n_bins * MEL_FRAMES_BLOCK);
+    float mel_acc[MEL_FRAMES_BLOCK];
 
-        // FFT
-        fft(fft_in, fft_out, sin_vals, cos_vals, frame_size);
+    // calculate FFT only when fft_in are not all zero
+    const size_t n_nonzero_frames = std::min(ctx.n_samples / ctx.frame_step + 1, features.n_frames);
+    const float zero_frame_value = log10(1e-10);
 
-        // Calculate modulus^2 of complex numbers
-        // Use pow(fft_out[2 * j + 0], 2) + pow(fft_out[2 * j + 1], 2) causes inference quality problem? Interesting.
-        for (int j = 0; j < n_fft; j++) {
-            fft_out[j] = (fft_out[2 * j + 0] * fft_out[2 * j + 0] + fft_out[2 * j + 1] * fft_out[2 * j + 1]);
-        }
+    for (size_t block_begin = frame_begin; block_begin < frame_end; block_begin += MEL_FRAMES_BLOCK) {
+        const size_t block_size = std::min(MEL_FRAMES_BLOCK, frame_end - block_begin);
+        const size_t block_nonzero =
+            block_begin < n_nonzero_frames ? std::min(block_size, n_nonzero_frames - block_begin) : 0;
 
-        // mel spectrogram
-        for (int j = 0; j < features.feature_size; j++) {
-            double sum = 0.0;
+        for (size_t f = 0; f < block_nonzero; f++) {
+            const size_t offset = (block_begin + f) * ctx.frame_step;
+            const size_t n_valid = std::min(frame_size, ctx.n_samples - offset);
 
-            // unroll loop (suggested by GH user @lunixbochs)
-            int k = 0;
-            for (k = 0; k < n_fft - 3; k += 4) {
-                sum += fft_out[k + 0] * mel_filter[j * n_fft + k + 0] + fft_out[k + 1] * mel_filter[j * n_fft + k + 1] +
-                       fft_out[k + 2] * mel_filter[j * n_fft + k + 2] + fft_out[k + 3] * mel_filter[j * n_fft + k + 3];
+            // apply Hanning window and fill the rest with zeros
+            for (size_t j = 0; j < n_valid; j++) {
+                fft_in[j] = ctx.hann[j] * ctx.samples[offset + j];
             }
+            std::fill(fft_in.begin() + n_valid, fft_in.end(), 0.0f);
+
+            real_fft_power(fft_in.data(),
+                           frame_size,
+                           fft_buf.data(),
+                           work.data(),
+                           power.data() + f,
+                           MEL_FRAMES_BLOCK,
+                           ctx.fft_factors,
+                           ctx.sin_vals,
+                           ctx.cos_vals);
+        }
 
-            // handle n_fft remainder
-            for (; k < n_fft; k++) {
-                sum += fft_out[k] * mel_filter[j * n_fft + k];
+        // mel spectrogram, only non-zero part of each triangular filter contributes
+        for (size_t j = 0; j < features.feature_size; j++) {
+            std::fill_n(mel_acc, MEL_FRAMES_BLOCK, 0.0f);
+            const float* mel_row = ctx.mel_filter.data() + j * n_bins;
+            for (size_t k = ctx.mel_filter_ranges[j].first; k < ctx.mel_filter_ranges[j].second; k++) {
+                const float weight = mel_row[k];
+                const float* power_row = power.data() + k * MEL_FRAMES_BLOCK;
+                for (size_t f = 0; f < MEL_FRAMES_BLOCK; f++) {
+                    mel_acc[f] += weight * power_row[f];
+                }
             }
 
-            sum = log10(std::max(sum, 1e-10));
-
-            features.data[j * features.n_frames + i] = sum;
-        }
-    }
-
-    // Otherwise fft_out are all zero
-    double sum = log10(1e-10);
-    for (; i < features.n_frames; i += n_threads) {
-        for (int j = 0; j < features.feature_size; j++) {
-            features.data[j * features.n_frames + i] = sum;
+            float* out = features.data.data() + j * features.n_frames + block_begin;
+            for (size_t f = 0; f < block_nonzero; f++) {
+                out[f] = log10(std::max(mel_acc[f], 1e-10f));
+            }
+            // Otherwise fft_out are all zero
+            std::fill(out + block_nonzero, out + block_size, zero_frame_value);
         }
     }
 }
@@ -337,13 +486,32 @@ std::vector<float> pad(const std::vector<float>& raw_speech,
     return padded_raw_speech;
 }
 
+// Computes all log mel frames of features
+static void log_mel_spectrogram(const MelSpectrogramContext& ctx, WhisperFeatures& features) {
+    // Frames are split between threads of the OpenVINO threading pool in whole blocks,
+    // so no two threads write to the same block of the output.
+    const size_t n_blocks = (features.n_frames + MEL_FRAMES_BLOCK - 1) / MEL_FRAMES_BLOCK;
+    ov::parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t block_start = 0, block_end = 0;
+        ov::splitter(n_blocks, nthr, ithr, block_start, block_end);
+        if (block_start >= block_end) {
+            return;
+        }
+        log_mel_spectrogram_frames(ctx,
+                                   block_start * MEL_FRAMES_BLOCK,
+                                   std::min(block_end * MEL_FRAMES_BLOCK, features.n_frames),
+                                   features);
+    });
+}
+
 WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_speech,
                                               const size_t sampling_rate,
                                               const size_t feature_size,
                                               const size_t n_fft,
                                               const size_t hop_length,
-                                              const size_t n_threads,
                                               const std::vector<float>& mel_filter,
+                                              const std::vector<std::pair<size_t, size_t>>& mel_filter_ranges,
+                                              const std::vector<size_t>& fft_factors,
                                               const std::vector<float>& sin_vals,
                                               const std::vector<float>& cos_vals) {
     // Hanning window (Use cosf to eliminate difference)
@@ -362,40 +530,18 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
     features.n_frames = (padded_raw_speech.size() - n_fft) / hop_length;
     features.data.resize(features.feature_size * features.n_frames);
 
-    {
-        std::vector<std::thread> workers(n_threads - 1);
-        for (int iw = 0; iw < n_threads - 1; ++iw) {
-            workers[iw] = std::thread(log_mel_spectrogram_worker_thread,
-                                      iw + 1,
-                                      std::cref(hann),
-                                      padded_raw_speech,
-                                      raw_speech.size() + reflect_pad_size,
-                                      n_fft,
-                                      hop_length,
-                                      n_threads,
-                                      std::cref(mel_filter),
-                                      std::ref(features),
-                                      std::cref(sin_vals),
-                                      std::cref(cos_vals));
-        }
+    const MelSpectrogramContext ctx{hann,
+                                    padded_raw_speech.data(),
+                                    raw_speech.size() + reflect_pad_size,
+                                    n_fft,
+                                    hop_length,
+                                    mel_filter,
+                                    mel_filter_ranges,
+                                    fft_factors,
+                                    sin_vals,
+                                    cos_vals};
 
-        // main thread
-        log_mel_spectrogram_worker_thread(0,
-                                          hann,
-                                          padded_raw_speech,
-                                          raw_speech.size() + reflect_pad_size,
-                                          n_fft,
-                                          hop_length,
-                                          n_threads,
-                                          mel_filter,
-                                          features,
-                                          sin_vals,
-                                          cos_vals);
-
-        for (int iw = 0; iw < n_threads - 1; ++iw) {
-            workers[iw].join();
-        }
-    }
+    log_mel_spectrogram(ctx, features);
 
     // clamping and normalization
     double mmax = -1e20;
@@ -428,6 +574,7 @@ std::vector<float> WhisperFeatures::get_data_with_offset(const size_t frame_offs
 
     size_t copy_size = std::min(n_frames - frame_offset, min_frames);
     std::vector<float> offset_data;
+    offset_data.reserve(feature_size * std::max(copy_size, min_frames));
 
     for (size_t i = 0; i < feature_size; i++) {
         size_t offset = frame_offset + (i * n_frames);
@@ -443,6 +590,7 @@ std::vector<float> WhisperFeatures::get_data_with_offset(const size_t frame_offs
 WhisperFeatureExtractor::WhisperFeatureExtractor(const std::filesystem::path& preprocessor_json_path) {
     init_parameters(preprocessor_json_path);
     fill_sin_cos_table(sin_vals, cos_vals, n_fft);
+    fft_factors = fft_factorize(n_fft % 2 == 0 ? n_fft / 2 : n_fft);
     init_mel_filter();
 }
 
@@ -477,20 +625,73 @@ void WhisperFeatureExtractor::init_mel_filter() {
             mel_filter[col * mel_data.size() + row] = mel_data[row][col];
         }
     }
+
+    // triangular filters are non-zero only in a narrow band of frequency bins
+    const size_t n_bins = mel_data.size();
+    mel_filter_ranges.assign(feature_size, {0, 0});
+    for (size_t col = 0; col < feature_size; col++) {
+        const auto row_begin = mel_filter.begin() + col * n_bins;
+        const auto row_end = row_begin + n_bins;
+        auto first = std::find_if(row_begin, row_end, [](float value) {
+            return value != 0.0f;
+        });
+        if (first == row_end) {
+            continue;
+        }
+        auto last = std::find_if(std::make_reverse_iterator(row_end), std::make_reverse_iterator(first), [](float value) {
+            return value != 0.0f;
+        });
+        mel_filter_ranges[col] = {static_cast<size_t>(std::distance(row_begin, first)),
+                                  static_cast<size_t>(std::distance(row_begin, last.base()))};
+    }
 }
 
 WhisperFeatures WhisperFeatureExtractor::extract(const std::vector<float>& raw_speech) {
-    size_t n_threads = std::min(4, (int32_t)std::thread::hardware_concurrency());
     return mel_spectrogram_convert_audio(raw_speech,
                                          sampling_rate,
                                          feature_size,
                                          n_fft,
                                          hop_length,
-                                         n_threads,
                                          mel_filter,
+                                         mel_filter_ranges,
+                                         fft_factors,
                                          sin_vals,
                                          cos_vals);
 }
 
+WhisperFeatures WhisperFeatureExtractor::extract_log_mel_frames(const float* padded_samples,
+                                                               const size_t n_samples,
+                                                               const size_t n_frames) const {
+    OPENVINO_ASSERT(n_frames == 0 || (n_frames - 1) * hop_length + n_fft <= n_samples,
+                    "Not enough samples to compute ",
+                    n_frames,
+                    " log-mel frames: ",
+                    n_samples,
+                    ".");
+
+    std::vector<float> hann;
+    hann_window(n_fft, true, hann);
+
+    WhisperFeatures features;
+    features.feature_size = feature_size;
+    features.n_frames = n_frames;
+    features.data.resize(feature_size * n_frames);
+
+    const MelSpectrogramContext ctx{hann,
+                                    padded_samples,
+                                    n_samples,
+                                    n_fft,
+                                    hop_length,
+                                    mel_filter,
+                                    mel_filter_ranges,
+                                    fft_factors,
+                                    sin_vals,
+                                    cos_vals};
+
+    log_mel_spectrogram(ctx, features);
+
+    return features;
+}
+
 }  // namespace genai
 }  // namespace ov
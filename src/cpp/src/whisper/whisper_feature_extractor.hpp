@@ -4,6 +4,7 @@
 #pragma once
 
 #include <filesystem>
+#include <utility>
 #include <vector>
 
 #include "openvino/genai/visibility.hpp"
@@ -51,10 +52,25 @@ public:
      */
     WhisperFeatures extract(const std::vector<float>& raw_speech);
 
+    /**
+     * @brief Create a flattened 2d log10 mel spectrogram [feature_size, n_frames] without clamping and normalization
+     * from already padded audio. Frame i covers samples [i * hop_length, i * hop_length + n_fft).
+     * Used to extend the spectrogram of an audio stream without recomputing already known frames.
+     */
+    WhisperFeatures extract_log_mel_frames(const float* padded_samples,
+                                           const size_t n_samples,
+                                           const size_t n_frames) const;
+
 private:
+    // precomputed FFT twiddles, W_n_fft^t = cos_vals[t] - i * sin_vals[t]
     std::vector<float> sin_vals;
     std::vector<float> cos_vals;
+    // radix factors of the complex FFT size: n_fft / 2 for even n_fft (real FFT packing), n_fft otherwise
+    std::vector<size_t> fft_factors;
+    // flattened 2d array with shape [feature_size, n_fft / 2 + 1]
     std::vector<float> mel_filter;
+    // [begin, end) range of non-zero frequency bins for each mel filter
+    std::vector<std::pair<size_t, size_t>> mel_filter_ranges;
 
     void init_mel_filter();
     void init_parameters(const std::filesystem::path& preprocessor_json_path);
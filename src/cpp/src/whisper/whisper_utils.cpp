@@ -3,6 +3,8 @@
 
 #include "whisper_utils.hpp"
 
+#include <regex>
+
 namespace {
 
 template <typename T>
@@ -22,7 +24,9 @@ namespace ov {
 namespace genai {
 namespace utils {
 
-void infer_with_perf_metrics(ov::InferRequest& request, ov::genai::RawPerfMetrics& raw_metrics) {
+void infer_with_perf_metrics(ov::InferRequest& request,
+                             ov::genai::RawPerfMetrics& raw_metrics,
+                             const size_t batch_size) {
     const auto infer_start = std::chrono::steady_clock::now();
     request.infer();
     const auto infer_end = std::chrono::steady_clock::now();
@@ -30,7 +34,7 @@ void infer_with_perf_metrics(ov::InferRequest& request, ov::genai::RawPerfMetric
     raw_metrics.m_inference_durations[0] += MicroSeconds(infer_ms);
     raw_metrics.m_token_infer_durations.emplace_back(infer_ms);
     raw_metrics.m_new_token_times.emplace_back(infer_end);
-    raw_metrics.m_batch_sizes.emplace_back(1);
+    raw_metrics.m_batch_sizes.emplace_back(batch_size);
 }
 
 void filter_non_segment_metrics(ov::genai::RawPerfMetrics& raw_metrics,
@@ -41,6 +45,33 @@ void filter_non_segment_metrics(ov::genai::RawPerfMetrics& raw_metrics,
     filter_by_ranges(raw_metrics.m_batch_sizes, offset, ranges);
 }
 
+void set_past_key_value(ov::InferRequest& source, ov::InferRequest& dest) {
+    // source outputs:
+    // present.0.decoder.key
+    // present.0.decoder.value
+    // present.0.encoder.key
+    // present.0.encoder.value
+
+    // dest inputs:
+    // past_key_values.0.decoder.key
+    // past_key_values.0.decoder.value
+    // past_key_values.0.encoder.key
+    // past_key_values.0.encoder.value
+
+    for (auto& source_output : source.get_compiled_model().outputs()) {
+        std::string source_output_name = source_output.get_any_name();
+        if (source_output_name.find("logits") != std::string::npos) {
+            continue;
+        }
+
+        std::string with_past_input_name =
+            std::regex_replace(source_output_name, std::regex("present"), "past_key_values");
+
+        auto kv_tensor = source.get_tensor(source_output_name);
+        dest.set_tensor(with_past_input_name, ov::Tensor{kv_tensor});
+    }
+}
+
 }  // namespace utils
 }  // namespace genai
 }  // namespace ov
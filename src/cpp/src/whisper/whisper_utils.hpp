@@ -11,12 +11,17 @@ namespace ov {
 namespace genai {
 namespace utils {
 
-void infer_with_perf_metrics(ov::InferRequest& request, ov::genai::RawPerfMetrics& raw_metrics);
+void infer_with_perf_metrics(ov::InferRequest& request,
+                             ov::genai::RawPerfMetrics& raw_metrics,
+                             const size_t batch_size = 1);
 
 void filter_non_segment_metrics(ov::genai::RawPerfMetrics& raw_metrics,
                                 size_t offset,
                                 std::vector<std::pair<size_t, size_t>>& ranges);
 
+// Passes present key/values of the source outputs to past_key_values inputs of the dest
+void set_past_key_value(ov::InferRequest& source, ov::InferRequest& dest);
+
 }  // namespace utils
 }  // namespace genai
 }  // namespace ov
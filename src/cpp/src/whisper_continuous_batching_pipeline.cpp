@@ -0,0 +1,738 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/whisper_continuous_batching_pipeline.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include "generation_stream.hpp"
+#include "utils.hpp"
+#include "whisper/context_tokens.hpp"
+#include "whisper/logit_processor.hpp"
+#include "whisper/timestamps.hpp"
+#include "whisper/whisper_config.hpp"
+#include "whisper/whisper_feature_extractor.hpp"
+#include "whisper/whisper_utils.hpp"
+
+namespace {
+
+struct TranscriptionRequest {
+    uint64_t request_id;
+    ov::genai::WhisperGenerationConfig config;
+    ov::genai::WhisperContextTokens context_tokens;
+    ov::genai::WhisperFeatures input_features;
+    ov::genai::GenerationStream::Ptr stream;
+    std::chrono::steady_clock::time_point start_time;
+
+    bool is_shortform;
+    // long-form audio processing requires timestamps to be enabled
+    bool return_timestamps;
+    bool keep_result;
+
+    size_t chunk_offset = 0;
+    // start of transcript tokens, language detection is done once per request
+    std::vector<int64_t> init_tokens;
+    // tokens generated for the current chunk
+    std::vector<int64_t> chunk_tokens;
+    size_t chunk_max_new_tokens = 0;
+
+    std::vector<int64_t> output_tokens;
+    std::vector<ov::genai::Segment> segments;
+    ov::genai::WhisperPerfMetrics perf_metrics;
+};
+
+using TranscriptionRequestPtr = std::shared_ptr<TranscriptionRequest>;
+
+// decoder infer requests are created from the shared compiled models, one pair per decoding batch
+struct DecoderSlot {
+    ov::InferRequest decoder;
+    ov::InferRequest decoder_with_past;
+};
+
+// requests decoded as one batch, all of them have the same number of tokens in KV cache
+struct DecodingBatch {
+    std::vector<TranscriptionRequestPtr> requests;
+    DecoderSlot slot;
+    size_t cache_position = 0;
+};
+
+// Copies rows of a tensor batched by the first dimension
+ov::Tensor gather_rows(const ov::Tensor& tensor, const std::vector<size_t>& rows) {
+    ov::Shape shape = tensor.get_shape();
+    const size_t row_size = tensor.get_byte_size() / shape[0];
+    shape[0] = rows.size();
+
+    ov::Tensor result(tensor.get_element_type(), shape);
+    const auto* src = static_cast<const uint8_t*>(tensor.data());
+    auto* dst = static_cast<uint8_t*>(result.data());
+    for (size_t i = 0; i < rows.size(); i++) {
+        std::memcpy(dst + i * row_size, src + rows[i] * row_size, row_size);
+    }
+    return result;
+}
+
+enum class InferType {
+    ENCODER,
+    // decoder inference which doesn't generate a token of the transcription, e.g. language detection
+    DECODER,
+    GENERATED_TOKEN
+};
+
+void record_infer(const std::vector<TranscriptionRequestPtr>& requests,
+                  const std::chrono::steady_clock::time_point infer_start,
+                  const std::chrono::steady_clock::time_point infer_end,
+                  const InferType infer_type) {
+    const auto infer_ms = ov::genai::PerfMetrics::get_microsec(infer_end - infer_start);
+    for (const auto& request : requests) {
+        auto& raw_metrics = request->perf_metrics.raw_metrics;
+        raw_metrics.m_inference_durations[0] += ov::genai::MicroSeconds(infer_ms);
+        if (infer_type == InferType::GENERATED_TOKEN) {
+            raw_metrics.m_token_infer_durations.emplace_back(infer_ms);
+            raw_metrics.m_new_token_times.emplace_back(infer_end);
+            raw_metrics.m_batch_sizes.emplace_back(1);
+        } else if (infer_type == InferType::ENCODER) {
+            request->perf_metrics.whisper_raw_metrics.encode_inference_durations.emplace_back(infer_ms);
+        }
+    }
+}
+
+void push_tokens(const TranscriptionRequestPtr& request,
+                 const std::vector<int64_t>& tokens,
+                 ov::genai::GenerationFinishReason finish_reason = ov::genai::GenerationFinishReason::NONE) {
+    ov::genai::GenerationOutput output;
+    output.generated_ids = tokens;
+    output.generated_log_probs.assign(tokens.size(), 0.0f);
+    output.score = 0.0f;
+    output.finish_reason = finish_reason;
+    request->stream->push({{request->request_id, std::move(output)}});
+}
+
+}  // namespace
+
+namespace ov::genai {
+
+class WhisperContinuousBatchingPipeline::WhisperContinuousBatchingImpl {
+public:
+    WhisperContinuousBatchingImpl(const std::filesystem::path& models_path,
+                                  const SchedulerConfig& scheduler_config,
+                                  const std::string& device,
+                                  const ov::AnyMap& properties)
+        : m_generation_config(utils::from_config_json_if_exists<WhisperGenerationConfig>(models_path)),
+          m_tokenizer{models_path},
+          m_feature_extractor{models_path / "preprocessor_config.json"},
+          m_model_config{models_path / "config.json"},
+          m_max_num_requests{scheduler_config.max_num_seqs},
+          m_max_num_encoder_requests{scheduler_config.max_num_encoder_seqs} {
+        OPENVINO_ASSERT(m_max_num_requests > 0, "max_num_seqs should be positive");
+        OPENVINO_ASSERT(m_max_num_encoder_requests > 0, "max_num_encoder_seqs should be positive");
+
+        ov::Core core = utils::singleton_core();
+        auto [core_properties, compile_properties] = utils::split_core_compile_config(properties);
+        core.set_property(core_properties);
+
+        ov::CompiledModel compiled_model =
+            core.compile_model(models_path / "openvino_encoder_model.xml", device, compile_properties);
+        utils::print_compiled_model_properties(compiled_model, "whisper encoder model");
+        m_encoder = compiled_model.create_infer_request();
+
+        m_decoder_model = core.compile_model(models_path / "openvino_decoder_model.xml", device, compile_properties);
+        utils::print_compiled_model_properties(m_decoder_model, "whisper decoder model");
+        m_decoder_with_past_model =
+            core.compile_model(models_path / "openvino_decoder_with_past_model.xml", device, compile_properties);
+        utils::print_compiled_model_properties(m_decoder_with_past_model, "whisper decoder with past model");
+
+        for (const auto& input : m_decoder_with_past_model.inputs()) {
+            if (input.get_any_name().find("past_key_values") != std::string::npos) {
+                m_past_inputs.push_back(input.get_any_name());
+            }
+        }
+        for (const auto& output : m_decoder_with_past_model.outputs()) {
+            const std::string& name = output.get_any_name();
+            if (name.find("present") != std::string::npos) {
+                std::string input_name = name;
+                input_name.replace(input_name.find("present"), std::string("present").size(), "past_key_values");
+                m_present_to_past.emplace_back(name, input_name);
+            }
+        }
+
+        // If eos_token_id was not provided, take value
+        if (m_generation_config.eos_token_id == -1) {
+            m_generation_config.set_eos_token_id(m_tokenizer.get_eos_token_id());
+        }
+
+        // 0.02 by default
+        m_time_precision = static_cast<float>(m_feature_extractor.chunk_length) / m_model_config.max_source_positions;
+    }
+
+    Tokenizer get_tokenizer() {
+        return m_tokenizer;
+    }
+
+    WhisperGenerationConfig get_generation_config() const {
+        return m_generation_config;
+    }
+
+    PipelineMetrics get_metrics() const {
+        std::lock_guard<std::mutex> lock{m_pipeline_metrics_mutex};
+        return m_pipeline_metrics;
+    }
+
+    GenerationHandle add_request(uint64_t request_id,
+                                 const RawSpeechInput& raw_speech_input,
+                                 WhisperGenerationConfig config,
+                                 const bool keep_result = false) {
+        if (config.eos_token_id == -1) {
+            config.set_eos_token_id(m_generation_config.eos_token_id);
+        }
+        config.validate();
+        OPENVINO_ASSERT(config.chunks_batch_size == 1,
+                        "'chunks_batch_size' is not supported by WhisperContinuousBatchingPipeline, chunks of "
+                        "different requests are batched instead");
+        if (config.language.has_value()) {
+            OPENVINO_ASSERT(config.lang_to_id.count(*config.language), "Unsupported language: ", *config.language);
+        }
+
+        auto request = std::make_shared<TranscriptionRequest>();
+        request->request_id = request_id;
+        request->start_time = std::chrono::steady_clock::now();
+        request->keep_result = keep_result;
+        request->stream = GenerationStream::create();
+        request->perf_metrics.num_input_tokens = 0;
+        request->perf_metrics.load_time = m_load_time_ms;
+        request->perf_metrics.raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+
+        auto [context_tokens, tokenization_duration_microseconds] = prepare_context_tokens(config, m_tokenizer);
+        request->context_tokens = std::move(context_tokens);
+        request->perf_metrics.raw_metrics.tokenization_durations.emplace_back(tokenization_duration_microseconds);
+
+        // feature extraction is done by the caller thread, so step() is not blocked by it
+        const auto extraction_start = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock{m_feature_extractor_mutex};
+            request->input_features = m_feature_extractor.extract(raw_speech_input);
+        }
+        request->perf_metrics.whisper_raw_metrics.features_extraction_durations.emplace_back(
+            PerfMetrics::get_microsec(std::chrono::steady_clock::now() - extraction_start));
+
+        request->is_shortform = request->input_features.n_frames <= m_feature_extractor.nb_max_frames;
+        request->return_timestamps = config.return_timestamps || !request->is_shortform;
+        request->config = std::move(config);
+
+        GenerationHandle handle = std::make_shared<GenerationHandleImpl>(request->stream, GenerationConfig{});
+
+        std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+        m_awaiting_requests.push_back(std::move(request));
+        return handle;
+    }
+
+    bool has_non_finished_requests() {
+        std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+        return !m_awaiting_requests.empty() || !m_waiting_requests.empty() || !m_requests_to_encode.empty() ||
+               !m_decoding_batches.empty();
+    }
+
+    void step() {
+        pull_awaiting_requests();
+
+        // finished rows of the batches are removed by decode_step(), dropped ones are removed here
+        for (auto& batch : m_decoding_batches) {
+            remove_rows(batch, [](const TranscriptionRequestPtr& request) {
+                return request->stream->get_status() == GenerationStatus::DROPPED_BY_HANDLE;
+            });
+        }
+        release_empty_batches();
+
+        // chunks which were finished at the previous step go first, new requests fill the rest of the limit
+        size_t num_active = m_requests_to_encode.size();
+        for (const auto& batch : m_decoding_batches) {
+            num_active += batch.requests.size();
+        }
+        while (!m_waiting_requests.empty() && num_active < m_max_num_requests) {
+            m_requests_to_encode.push_back(std::move(m_waiting_requests.front()));
+            m_waiting_requests.pop_front();
+            num_active++;
+        }
+
+        m_requests_to_encode.erase(std::remove_if(m_requests_to_encode.begin(),
+                                                  m_requests_to_encode.end(),
+                                                  [](const TranscriptionRequestPtr& request) {
+                                                      return request->stream->get_status() ==
+                                                             GenerationStatus::DROPPED_BY_HANDLE;
+                                                  }),
+                                   m_requests_to_encode.end());
+
+        {
+            // metrics may be read by another thread
+            std::lock_guard<std::mutex> lock{m_pipeline_metrics_mutex};
+            m_pipeline_metrics.requests = num_active + m_waiting_requests.size();
+            m_pipeline_metrics.scheduled_requests = num_active;
+        }
+
+        // batches started at this step already generated the first token
+        const size_t num_running_batches = m_decoding_batches.size();
+        if (!m_requests_to_encode.empty()) {
+            // the rest of chunks stays in the queue for the next steps, so running batches aren't stalled by the encoder
+            const size_t num_to_encode = std::min(m_requests_to_encode.size(), m_max_num_encoder_requests);
+            std::vector<TranscriptionRequestPtr> requests(m_requests_to_encode.begin(),
+                                                          m_requests_to_encode.begin() + num_to_encode);
+            m_requests_to_encode.erase(m_requests_to_encode.begin(), m_requests_to_encode.begin() + num_to_encode);
+            encode_and_prefill(requests);
+        }
+
+        for (size_t i = 0; i < num_running_batches; i++) {
+            decode_step(m_decoding_batches[i]);
+        }
+        release_empty_batches();
+    }
+
+    std::vector<WhisperDecodedResults> generate(const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                const std::vector<WhisperGenerationConfig>& generation_configs) {
+        OPENVINO_ASSERT(!has_non_finished_requests(),
+                        "Generate cannot be called while WhisperContinuousBatchingPipeline is already in running state. "
+                        "Use WhisperContinuousBatchingPipeline::add_request");
+        OPENVINO_ASSERT(raw_speech_inputs.size() == generation_configs.size());
+
+        std::vector<GenerationHandle> handles;
+        for (size_t request_id = 0; request_id < raw_speech_inputs.size(); request_id++) {
+            handles.push_back(add_request(request_id, raw_speech_inputs[request_id], generation_configs[request_id], true));
+        }
+
+        while (has_non_finished_requests()) {
+            step();
+        }
+
+        std::vector<WhisperDecodedResults> results;
+        results.reserve(handles.size());
+        for (size_t request_id = 0; request_id < handles.size(); request_id++) {
+            auto finished = m_finished_requests.find(request_id);
+            OPENVINO_ASSERT(finished != m_finished_requests.end(), "Request ", request_id, " was not finished");
+            TranscriptionRequest& request = *finished->second;
+
+            auto decode_start_time = std::chrono::steady_clock::now();
+            WhisperDecodedResults result{std::vector{m_tokenizer.decode(request.output_tokens)}, std::vector{1.f}};
+            request.perf_metrics.raw_metrics.detokenization_durations.emplace_back(
+                PerfMetrics::get_microsec(std::chrono::steady_clock::now() - decode_start_time));
+
+            if (request.config.return_timestamps) {
+                std::vector<WhisperDecodedResultChunk> chunks;
+                chunks.reserve(request.segments.size());
+                for (auto& segment : request.segments) {
+                    decode_start_time = std::chrono::steady_clock::now();
+                    chunks.push_back(
+                        WhisperDecodedResultChunk{segment.m_start, segment.m_end, m_tokenizer.decode(segment.m_tokens)});
+                    request.perf_metrics.raw_metrics.detokenization_durations.emplace_back(
+                        PerfMetrics::get_microsec(std::chrono::steady_clock::now() - decode_start_time));
+                }
+                result.chunks = chunks;
+            }
+
+            auto& raw_metrics = request.perf_metrics.raw_metrics;
+            raw_metrics.generate_durations.emplace_back(
+                PerfMetrics::get_microsec(std::chrono::steady_clock::now() - request.start_time));
+            if (raw_metrics.m_new_token_times.empty()) {
+                request.perf_metrics.evaluate_statistics();
+            } else {
+                request.perf_metrics.evaluate_statistics(request.start_time);
+            }
+            result.perf_metrics = request.perf_metrics;
+
+            results.push_back(std::move(result));
+        }
+        m_finished_requests.clear();
+
+        return results;
+    }
+
+    float m_load_time_ms = 0;
+
+private:
+    WhisperGenerationConfig m_generation_config;
+    Tokenizer m_tokenizer;
+    WhisperFeatureExtractor m_feature_extractor;
+    WhisperConfig m_model_config;
+    float m_time_precision;
+    const size_t m_max_num_requests;
+    const size_t m_max_num_encoder_requests;
+
+    ov::InferRequest m_encoder;
+    ov::CompiledModel m_decoder_model;
+    ov::CompiledModel m_decoder_with_past_model;
+    std::vector<DecoderSlot> m_free_slots;
+    // decoder_with_past inputs with decoder and encoder key/values
+    std::vector<std::string> m_past_inputs;
+    // decoder_with_past outputs and corresponding inputs
+    std::vector<std::pair<std::string, std::string>> m_present_to_past;
+
+    std::mutex m_feature_extractor_mutex;
+    std::mutex m_awaiting_requests_mutex;
+    std::vector<TranscriptionRequestPtr> m_awaiting_requests;
+    // requests over max_num_seqs limit
+    std::deque<TranscriptionRequestPtr> m_waiting_requests;
+    // requests which need encoding of the next chunk
+    std::vector<TranscriptionRequestPtr> m_requests_to_encode;
+    std::vector<DecodingBatch> m_decoding_batches;
+    // results of generate() requests
+    std::unordered_map<uint64_t, TranscriptionRequestPtr> m_finished_requests;
+
+    mutable std::mutex m_pipeline_metrics_mutex;
+    PipelineMetrics m_pipeline_metrics;
+
+    void pull_awaiting_requests() {
+        std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+        m_waiting_requests.insert(m_waiting_requests.end(), m_awaiting_requests.begin(), m_awaiting_requests.end());
+        m_awaiting_requests.clear();
+    }
+
+    DecoderSlot acquire_slot() {
+        if (m_free_slots.empty()) {
+            return DecoderSlot{m_decoder_model.create_infer_request(), m_decoder_with_past_model.create_infer_request()};
+        }
+        DecoderSlot slot = std::move(m_free_slots.back());
+        m_free_slots.pop_back();
+        return slot;
+    }
+
+    void release_empty_batches() {
+        for (auto& batch : m_decoding_batches) {
+            if (batch.requests.empty()) {
+                m_free_slots.push_back(std::move(batch.slot));
+            }
+        }
+        m_decoding_batches.erase(std::remove_if(m_decoding_batches.begin(),
+                                                m_decoding_batches.end(),
+                                                [](const DecodingBatch& batch) {
+                                                    return batch.requests.empty();
+                                                }),
+                                 m_decoding_batches.end());
+    }
+
+    template <typename Predicate>
+    void remove_rows(DecodingBatch& batch, Predicate should_remove) {
+        std::vector<size_t> kept_rows;
+        for (size_t row = 0; row < batch.requests.size(); row++) {
+            if (!should_remove(batch.requests[row])) {
+                kept_rows.push_back(row);
+            }
+        }
+        if (kept_rows.size() == batch.requests.size()) {
+            return;
+        }
+
+        std::vector<TranscriptionRequestPtr> kept_requests;
+        for (size_t row : kept_rows) {
+            kept_requests.push_back(batch.requests[row]);
+        }
+        batch.requests = std::move(kept_requests);
+        if (batch.requests.empty()) {
+            return;
+        }
+
+        // KV cache and encoder hidden states of the remaining rows are compacted
+        ov::InferRequest& decoder_with_past = batch.slot.decoder_with_past;
+        for (const auto& past_name : m_past_inputs) {
+            decoder_with_past.set_tensor(past_name, gather_rows(decoder_with_past.get_tensor(past_name), kept_rows));
+        }
+        decoder_with_past.set_tensor("encoder_hidden_states",
+                                     gather_rows(decoder_with_past.get_tensor("encoder_hidden_states"), kept_rows));
+    }
+
+    std::vector<int64_t> get_init_tokens(const TranscriptionRequest& request, const int64_t language_token_id) {
+        const auto& config = request.config;
+        if (!config.is_multilingual) {
+            if (request.return_timestamps) {
+                return std::vector<int64_t>{config.decoder_start_token_id};
+            }
+            return std::vector<int64_t>{config.decoder_start_token_id, config.no_timestamps_token_id};
+        }
+
+        int64_t task_token_id = config.transcribe_token_id;
+        if (config.task.has_value() && *config.task == "translate") {
+            task_token_id = config.translate_token_id;
+        }
+
+        if (request.return_timestamps) {
+            return std::vector<int64_t>{config.decoder_start_token_id, language_token_id, task_token_id};
+        }
+        return std::vector<int64_t>{config.decoder_start_token_id,
+                                    language_token_id,
+                                    task_token_id,
+                                    config.no_timestamps_token_id};
+    }
+
+    // language of all requests which need detection is detected by one decoder inference
+    void prepare_init_tokens(const std::vector<TranscriptionRequestPtr>& requests, const ov::Tensor& hidden_states) {
+        std::vector<size_t> detection_rows;
+        for (size_t row = 0; row < requests.size(); row++) {
+            auto& request = *requests[row];
+            if (!request.init_tokens.empty()) {
+                continue;
+            }
+            if (request.config.is_multilingual && !request.config.language.has_value()) {
+                detection_rows.push_back(row);
+            } else {
+                const int64_t language_token_id =
+                    request.config.is_multilingual ? request.config.lang_to_id.at(*request.config.language) : 0;
+                request.init_tokens = get_init_tokens(request, language_token_id);
+            }
+        }
+
+        if (detection_rows.empty()) {
+            return;
+        }
+
+        DecoderSlot slot = acquire_slot();
+        ov::Tensor input_ids(ov::element::i64, {detection_rows.size(), 1});
+        std::vector<TranscriptionRequestPtr> detection_requests;
+        for (size_t i = 0; i < detection_rows.size(); i++) {
+            detection_requests.push_back(requests[detection_rows[i]]);
+            input_ids.data<int64_t>()[i] = requests[detection_rows[i]]->config.decoder_start_token_id;
+        }
+        slot.decoder.set_tensor("encoder_hidden_states", gather_rows(hidden_states, detection_rows));
+        slot.decoder.set_tensor("input_ids", input_ids);
+
+        const auto infer_start = std::chrono::steady_clock::now();
+        slot.decoder.infer();
+        record_infer(detection_requests, infer_start, std::chrono::steady_clock::now(), InferType::DECODER);
+
+        auto logits = slot.decoder.get_tensor("logits");
+        for (size_t i = 0; i < detection_requests.size(); i++) {
+            auto& request = *detection_requests[i];
+            request.init_tokens = get_init_tokens(request, utils::argmax(logits, i));
+        }
+        m_free_slots.push_back(std::move(slot));
+    }
+
+    void encode_and_prefill(const std::vector<TranscriptionRequestPtr>& requests) {
+        const size_t feature_size = m_feature_extractor.feature_size;
+        const size_t nb_max_frames = m_feature_extractor.nb_max_frames;
+        const size_t chunk_size = feature_size * nb_max_frames;
+
+        ov::Tensor input_features(ov::element::f32, {requests.size(), feature_size, nb_max_frames});
+        for (size_t row = 0; row < requests.size(); row++) {
+            auto& request = *requests[row];
+            auto chunk = request.input_features.get_data_with_offset(request.chunk_offset, nb_max_frames);
+            std::copy(chunk.begin(), chunk.end(), input_features.data<float>() + row * chunk_size);
+        }
+
+        m_encoder.set_tensor("input_features", input_features);
+        const auto infer_start = std::chrono::steady_clock::now();
+        m_encoder.infer();
+        record_infer(requests, infer_start, std::chrono::steady_clock::now(), InferType::ENCODER);
+        ov::Tensor hidden_states = m_encoder.get_tensor("last_hidden_state");
+
+        prepare_init_tokens(requests, hidden_states);
+
+        // decoder has no attention mask, so only prompts of the same length can be prefilled together
+        std::map<size_t, std::vector<size_t>> rows_by_prompt_size;
+        std::vector<std::vector<int64_t>> prompts(requests.size());
+        for (size_t row = 0; row < requests.size(); row++) {
+            auto& request = *requests[row];
+            prompts[row] = get_prompt_tokens(request.context_tokens, request.config, request.chunk_offset);
+            prompts[row].insert(prompts[row].end(), request.init_tokens.begin(), request.init_tokens.end());
+            rows_by_prompt_size[prompts[row].size()].push_back(row);
+        }
+
+        for (const auto& [prompt_size, rows] : rows_by_prompt_size) {
+            DecodingBatch batch;
+            batch.slot = acquire_slot();
+            batch.cache_position = prompt_size;
+
+            ov::Tensor input_ids(ov::element::i64, {rows.size(), prompt_size});
+            for (size_t i = 0; i < rows.size(); i++) {
+                batch.requests.push_back(requests[rows[i]]);
+                std::copy(prompts[rows[i]].begin(), prompts[rows[i]].end(), input_ids.data<int64_t>() + i * prompt_size);
+            }
+            ov::Tensor batch_hidden_states = gather_rows(hidden_states, rows);
+
+            ov::InferRequest& decoder = batch.slot.decoder;
+            decoder.set_tensor("encoder_hidden_states", batch_hidden_states);
+            decoder.set_tensor("input_ids", input_ids);
+
+            const auto prefill_start = std::chrono::steady_clock::now();
+            decoder.infer();
+            record_infer(batch.requests, prefill_start, std::chrono::steady_clock::now(), InferType::GENERATED_TOKEN);
+
+            auto logits = decoder.get_tensor("logits");
+            for (size_t i = 0; i < batch.requests.size(); i++) {
+                auto& request = *batch.requests[i];
+                request.chunk_tokens.clear();
+                request.chunk_max_new_tokens = request.config.get_max_new_tokens() - request.output_tokens.size();
+
+                do_suppress_tokens(logits, i, request.config.begin_suppress_tokens);
+                do_suppress_tokens(logits, i, request.config.suppress_tokens);
+                if (request.return_timestamps) {
+                    process_whisper_timestamp_logits(logits, i, request.config, {}, true);
+                }
+                process_token(batch.requests[i], utils::argmax(logits, i));
+            }
+
+            utils::set_past_key_value(decoder, batch.slot.decoder_with_past);
+            batch.slot.decoder_with_past.set_tensor("encoder_hidden_states", batch_hidden_states);
+
+            remove_rows(batch, [this](const TranscriptionRequestPtr& request) {
+                return finish_chunk_if_done(request);
+            });
+
+            if (batch.requests.empty()) {
+                m_free_slots.push_back(std::move(batch.slot));
+            } else {
+                m_decoding_batches.push_back(std::move(batch));
+            }
+        }
+    }
+
+    void decode_step(DecodingBatch& batch) {
+        ov::InferRequest& decoder_with_past = batch.slot.decoder_with_past;
+        const size_t batch_size = batch.requests.size();
+
+        ov::Tensor input_ids(ov::element::i64, {batch_size, 1});
+        for (size_t i = 0; i < batch_size; i++) {
+            input_ids.data<int64_t>()[i] = batch.requests[i]->chunk_tokens.back();
+        }
+        decoder_with_past.set_tensor("input_ids", input_ids);
+
+        ov::Tensor cache_position = decoder_with_past.get_tensor("cache_position");
+        cache_position.set_shape({1});
+        cache_position.data<int64_t>()[0] = batch.cache_position;
+
+        const auto infer_start = std::chrono::steady_clock::now();
+        decoder_with_past.infer();
+        record_infer(batch.requests, infer_start, std::chrono::steady_clock::now(), InferType::GENERATED_TOKEN);
+        batch.cache_position++;
+
+        // present key/values are used as past ones by the next step
+        for (const auto& [present_name, past_name] : m_present_to_past) {
+            decoder_with_past.set_tensor(past_name, decoder_with_past.get_tensor(present_name));
+        }
+
+        auto logits = decoder_with_past.get_tensor("logits");
+        for (size_t i = 0; i < batch_size; i++) {
+            auto& request = *batch.requests[i];
+            do_suppress_tokens(logits, i, request.config.suppress_tokens);
+            if (request.return_timestamps) {
+                process_whisper_timestamp_logits(logits, i, request.config, request.chunk_tokens);
+            }
+            process_token(batch.requests[i], utils::argmax(logits, i));
+        }
+
+        remove_rows(batch, [this](const TranscriptionRequestPtr& request) {
+            return finish_chunk_if_done(request);
+        });
+    }
+
+    void process_token(const TranscriptionRequestPtr& request, const int64_t token) {
+        if (token == request->config.eos_token_id) {
+            // eos token is not added, the chunk is finished
+            request->chunk_max_new_tokens = request->chunk_tokens.size();
+            return;
+        }
+
+        request->chunk_tokens.push_back(token);
+        if (!request->return_timestamps) {
+            push_tokens(request, {token});
+        }
+    }
+
+    bool finish_chunk_if_done(const TranscriptionRequestPtr& request) {
+        if (request->stream->get_status() == GenerationStatus::DROPPED_BY_HANDLE) {
+            return true;
+        }
+        if (request->chunk_tokens.size() < request->chunk_max_new_tokens) {
+            return false;
+        }
+
+        const size_t nb_max_frames = m_feature_extractor.nb_max_frames;
+        size_t segment_offset = request->input_features.n_frames;
+        if (request->return_timestamps) {
+            auto extracted_segments = extract_segments(request->chunk_tokens, request->config, nb_max_frames, m_time_precision);
+
+            const float chunk_start_ts = request->chunk_offset * m_time_precision / 2;
+            for (auto& segment : extracted_segments.segments) {
+                segment.m_start += chunk_start_ts;
+                if (segment.m_end >= 0.0f) {
+                    segment.m_end += chunk_start_ts;
+                }
+                request->segments.push_back(std::move(segment));
+            }
+
+            request->output_tokens.insert(request->output_tokens.end(),
+                                          extracted_segments.non_timestamp_tokens.begin(),
+                                          extracted_segments.non_timestamp_tokens.end());
+            push_tokens(request, extracted_segments.non_timestamp_tokens);
+
+            if (!request->is_shortform) {
+                // chunk has to move forward even if the model predicted zero offset
+                segment_offset = std::max<size_t>(extracted_segments.last_offset, 1);
+            }
+        } else {
+            request->output_tokens.insert(request->output_tokens.end(),
+                                          request->chunk_tokens.begin(),
+                                          request->chunk_tokens.end());
+        }
+
+        request->chunk_offset += segment_offset;
+        const bool is_length_limit = request->output_tokens.size() >= request->config.get_max_new_tokens();
+        if (request->chunk_offset < request->input_features.n_frames && !is_length_limit) {
+            m_requests_to_encode.push_back(request);
+            return true;
+        }
+
+        push_tokens(request, {}, is_length_limit ? GenerationFinishReason::LENGTH : GenerationFinishReason::STOP);
+        request->stream->set_generation_status(GenerationStatus::FINISHED);
+        if (request->keep_result) {
+            m_finished_requests.emplace(request->request_id, request);
+        }
+        return true;
+    }
+};
+
+WhisperContinuousBatchingPipeline::WhisperContinuousBatchingPipeline(const std::filesystem::path& models_path,
+                                                                     const SchedulerConfig& scheduler_config,
+                                                                     const std::string& device,
+                                                                     const ov::AnyMap& properties) {
+    auto start_time = std::chrono::steady_clock::now();
+    m_impl = std::make_shared<WhisperContinuousBatchingImpl>(models_path, scheduler_config, device, properties);
+    auto stop_time = std::chrono::steady_clock::now();
+    m_impl->m_load_time_ms = std::chrono::duration_cast<std::chrono::milliseconds>(stop_time - start_time).count();
+}
+
+WhisperContinuousBatchingPipeline::~WhisperContinuousBatchingPipeline() = default;
+
+Tokenizer WhisperContinuousBatchingPipeline::get_tokenizer() {
+    return m_impl->get_tokenizer();
+}
+
+WhisperGenerationConfig WhisperContinuousBatchingPipeline::get_generation_config() const {
+    return m_impl->get_generation_config();
+}
+
+PipelineMetrics WhisperContinuousBatchingPipeline::get_metrics() const {
+    return m_impl->get_metrics();
+}
+
+GenerationHandle WhisperContinuousBatchingPipeline::add_request(uint64_t request_id,
+                                                                const RawSpeechInput& raw_speech_input,
+                                                                const WhisperGenerationConfig& generation_config) {
+    return m_impl->add_request(request_id, raw_speech_input, generation_config);
+}
+
+void WhisperContinuousBatchingPipeline::step() {
+    m_impl->step();
+}
+
+bool WhisperContinuousBatchingPipeline::has_non_finished_requests() {
+    return m_impl->has_non_finished_requests();
+}
+
+std::vector<WhisperDecodedResults> WhisperContinuousBatchingPipeline::generate(
+    const std::vector<RawSpeechInput>& raw_speech_inputs,
+    const std::vector<WhisperGenerationConfig>& generation_configs) {
+    return m_impl->generate(raw_speech_inputs, generation_configs);
+}
+
+}  // namespace ov::genai
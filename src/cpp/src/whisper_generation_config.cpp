@@ -76,6 +76,7 @@ void WhisperGenerationConfig::update_generation_config(const ov::AnyMap& config_
     read_anymap_param(config_map, "return_timestamps", return_timestamps);
     read_anymap_param(config_map, "initial_prompt", initial_prompt);
     read_anymap_param(config_map, "hotwords", hotwords);
+    read_anymap_param(config_map, "chunks_batch_size", chunks_batch_size);
 }
 
 size_t WhisperGenerationConfig::get_max_new_tokens(size_t prompt_length) const {
@@ -98,6 +99,8 @@ void WhisperGenerationConfig::validate() const {
     OPENVINO_ASSERT(eos_token_id != -1 || max_new_tokens != SIZE_MAX || max_length != SIZE_MAX,
                     "Either 'eos_token_id', or 'max_new_tokens', or 'max_length' should be defined.");
 
+    OPENVINO_ASSERT(chunks_batch_size > 0, "'chunks_batch_size' must be greater than 0");
+
     if (is_multilingual && language.has_value()) {
         OPENVINO_ASSERT(lang_to_id.count(*language),
                         "'language' " + *language + " must be provided in generation_config.json 'lang_to_id' map.");
@@ -11,6 +11,7 @@
 #include "utils.hpp"
 #include "whisper/context_tokens.hpp"
 #include "whisper/streamer.hpp"
+#include "whisper/streaming_session.hpp"
 #include "whisper/whisper.hpp"
 #include "whisper/whisper_config.hpp"
 #include "whisper/whisper_feature_extractor.hpp"
@@ -135,6 +136,75 @@ public:
 
         return result;
     }
+
+    void start_stream(OptionalWhisperGenerationConfig generation_config, float step) override {
+        WhisperGenerationConfig config = (generation_config.has_value()) ? *generation_config : m_generation_config;
+        config.validate();
+
+        auto [context_tokens, tokenization_duration_microseconds] = prepare_context_tokens(config, m_tokenizer);
+
+        // 0.02 by default
+        const float time_precision =
+            static_cast<float>(m_feature_extractor.chunk_length) / m_model_config.max_source_positions;
+
+        m_stream_session = std::make_unique<WhisperStreamingSession>(config,
+                                                                     context_tokens,
+                                                                     time_precision,
+                                                                     step,
+                                                                     m_feature_extractor,
+                                                                     m_models);
+    }
+
+    WhisperStreamingResult push_audio(const RawSpeechInput& audio_frames) override {
+        OPENVINO_ASSERT(m_stream_session, "Live transcription is not started. Call start_stream() first.");
+        auto start_time = std::chrono::steady_clock::now();
+        return decode_streaming_step(m_stream_session->push_audio(audio_frames), start_time);
+    }
+
+    WhisperStreamingResult finish_stream() override {
+        OPENVINO_ASSERT(m_stream_session, "Live transcription is not started. Call start_stream() first.");
+        auto start_time = std::chrono::steady_clock::now();
+        auto step = m_stream_session->finish();
+        m_stream_session.reset();
+        return decode_streaming_step(std::move(step), start_time);
+    }
+
+private:
+    std::unique_ptr<WhisperStreamingSession> m_stream_session;
+
+    WhisperStreamingResult decode_streaming_step(WhisperStreamingStep step,
+                                                 std::chrono::steady_clock::time_point start_time) {
+        WhisperStreamingResult result;
+        result.perf_metrics = step.perf_metrics;
+        auto& raw_metrics = result.perf_metrics.raw_metrics;
+
+        for (auto& segment : step.final_segments) {
+            auto decode_start_time = std::chrono::steady_clock::now();
+            result.final_chunks.push_back(
+                WhisperDecodedResultChunk{segment.m_start, segment.m_end, m_tokenizer.decode(segment.m_tokens)});
+            raw_metrics.detokenization_durations.emplace_back(
+                PerfMetrics::get_microsec(std::chrono::steady_clock::now() - decode_start_time));
+        }
+
+        auto decode_start_time = std::chrono::steady_clock::now();
+        result.partial_text = m_tokenizer.decode(step.partial_tokens);
+        raw_metrics.detokenization_durations.emplace_back(
+            PerfMetrics::get_microsec(std::chrono::steady_clock::now() - decode_start_time));
+
+        auto& metrics = result.perf_metrics;
+        metrics.load_time = this->m_load_time_ms;
+        auto stop_time = std::chrono::steady_clock::now();
+        raw_metrics.generate_durations.emplace_back(PerfMetrics::get_microsec(stop_time - start_time));
+        raw_metrics.tokenization_durations.emplace_back(MicroSeconds(0.0f));
+        // steps without transcription have no generated tokens
+        if (raw_metrics.m_new_token_times.empty()) {
+            metrics.evaluate_statistics();
+        } else {
+            metrics.evaluate_statistics(start_time);
+        }
+
+        return result;
+    }
 };
 
 std::pair<std::string, Any> streamer(ChunkStreamerVariant func) {
@@ -181,6 +251,18 @@ ov::genai::WhisperDecodedResults ov::genai::WhisperPipeline::generate(const RawS
     return m_impl->generate(raw_speech_input, config, get_chunk_streamer_from_map(config_map));
 }
 
+void ov::genai::WhisperPipeline::start_stream(OptionalWhisperGenerationConfig generation_config, float step) {
+    m_impl->start_stream(generation_config, step);
+}
+
+ov::genai::WhisperStreamingResult ov::genai::WhisperPipeline::push_audio(const RawSpeechInput& audio_frames) {
+    return m_impl->push_audio(audio_frames);
+}
+
+ov::genai::WhisperStreamingResult ov::genai::WhisperPipeline::finish_stream() {
+    return m_impl->finish_stream();
+}
+
 ov::genai::WhisperGenerationConfig ov::genai::WhisperPipeline::get_generation_config() const {
     return m_impl->m_generation_config;
 }
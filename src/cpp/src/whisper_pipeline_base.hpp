@@ -32,6 +32,12 @@ public:
                                            OptionalWhisperGenerationConfig generation_config,
                                            ChunkStreamerVariant streamer) = 0;
 
+    virtual void start_stream(OptionalWhisperGenerationConfig generation_config, float step) = 0;
+
+    virtual WhisperStreamingResult push_audio(const RawSpeechInput& audio_frames) = 0;
+
+    virtual WhisperStreamingResult finish_stream() = 0;
+
     virtual ~WhisperPipelineImplBase() = default;
 };
 
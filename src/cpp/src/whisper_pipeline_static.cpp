@@ -600,6 +600,7 @@ WhisperDecodedResults WhisperPipeline::StaticWhisperPipeline::generate(
 
     OPENVINO_ASSERT(!config.initial_prompt.has_value(), "'initial_prompt' parameter is not supported on NPU device.");
     OPENVINO_ASSERT(!config.hotwords.has_value(), "'hotwords' parameter is not supported on NPU device.");
+    OPENVINO_ASSERT(config.chunks_batch_size == 1, "'chunks_batch_size' parameter is not supported on NPU device.");
 
     std::shared_ptr<ChunkStreamerBase> streamer_ptr;
     if (auto streamer_obj = std::get_if<std::monostate>(&streamer)) {
@@ -739,5 +740,18 @@ WhisperDecodedResults WhisperPipeline::StaticWhisperPipeline::generate(
     return result;
 }
 
+void WhisperPipeline::StaticWhisperPipeline::start_stream(OptionalWhisperGenerationConfig generation_config,
+                                                         float step) {
+    OPENVINO_THROW("Live transcription is not supported on NPU device.");
+}
+
+WhisperStreamingResult WhisperPipeline::StaticWhisperPipeline::push_audio(const RawSpeechInput& audio_frames) {
+    OPENVINO_THROW("Live transcription is not supported on NPU device.");
+}
+
+WhisperStreamingResult WhisperPipeline::StaticWhisperPipeline::finish_stream() {
+    OPENVINO_THROW("Live transcription is not supported on NPU device.");
+}
+
 }  // namespace genai
 }  // namespace ov
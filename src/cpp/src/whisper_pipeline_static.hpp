@@ -23,6 +23,12 @@ public:
                                    OptionalWhisperGenerationConfig generation_config,
                                    ChunkStreamerVariant streamer) override;
 
+    void start_stream(OptionalWhisperGenerationConfig generation_config, float step) override;
+
+    WhisperStreamingResult push_audio(const RawSpeechInput& audio_frames) override;
+
+    WhisperStreamingResult finish_stream() override;
+
 private:
     WhisperInitializedModels m_models;
 };
@@ -28,13 +28,15 @@ from .py_openvino_genai import (
 # LLM pipeline
 from .py_openvino_genai import (
     LLMPipeline, 
+    ChatSession,
     draft_model,
 )
 
 # LoRA
 from .py_openvino_genai import (
     Adapter,
-    AdapterConfig
+    AdapterConfig,
+    AdapterLoadStats
 )
 
 # Generation config
@@ -53,9 +55,11 @@ from .py_openvino_genai import (
 from .py_openvino_genai import (
     WhisperGenerationConfig,
     WhisperPipeline,
+    WhisperContinuousBatchingPipeline,
     ChunkStreamerBase,
     WhisperRawPerfMetrics,
-    WhisperPerfMetrics
+    WhisperPerfMetrics,
+    WhisperStreamingResult
 )
 
 # Image generation
@@ -72,8 +76,13 @@ from .py_openvino_genai import (
     InpaintingPipeline,
     Scheduler,
     ImageGenerationConfig,
+    ImageGenerationPerfMetrics,
+    RawImageGenerationPerfMetrics,
+    TextEncoderCacheStats,
+    ResolutionBucketStats,
     Generator,
     CppStdGenerator,
+    PhiloxGenerator,
     TorchGenerator,
 )
 
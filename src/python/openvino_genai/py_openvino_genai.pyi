@@ -5,7 +5,7 @@ from __future__ import annotations
 import openvino._pyopenvino
 import os
 import typing
-__all__ = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedGenerationResult', 'EncodedResults', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'InpaintingPipeline', 'LLMPipeline', 'MeanStdPair', 'PerfMetrics', 'PipelineMetrics', 'RawPerfMetrics', 'SD3Transformer2DModel', 'Scheduler', 'SchedulerConfig', 'StopCriteria', 'StreamerBase', 'T5EncoderModel', 'Text2ImagePipeline', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'draft_model']
+__all__ = ['Adapter', 'AdapterConfig', 'AdapterLoadStats', 'AggregationMode', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChatSession', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedGenerationResult', 'EncodedResults', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationOutputsFuture', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'InpaintingPipeline', 'LLMPipeline', 'LatencyPercentiles', 'MeanStdPair', 'PerfMetrics', 'PhiloxGenerator', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'ResolutionBucketStats', 'SD3Transformer2DModel', 'Scheduler', 'SchedulerConfig', 'StopCriteria', 'StreamerBase', 'T5EncoderModel', 'Text2ImagePipeline', 'TextEncoderCacheStats', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'TraceSpanStatistics', 'UNet2DConditionModel', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'WhisperContinuousBatchingPipeline', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'WhisperStreamingResult', 'draft_model']
 class Adapter:
     """
     Immutable LoRA Adapter that carries the adaptation matrices and serves as unique adapter identifier.
@@ -21,6 +21,8 @@ class Adapter:
                     Immutable LoRA Adapter that carries the adaptation matrices and serves as unique adapter identifier.
                     path (os.PathLike): Path to adapter file in safetensors format.
         """
+    def get_load_stats(self) -> AdapterLoadStats:
+        ...
 class AdapterConfig:
     """
     Adapter config that defines a combination of LoRA adapters with blending parameters.
@@ -102,6 +104,32 @@ class AdapterConfig:
         ...
     def set_alpha(self, adapter: Adapter, alpha: float) -> AdapterConfig:
         ...
+class AdapterLoadStats:
+    """
+    Loading statistics of LoRA adapter file.
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def file_size(self) -> int:
+        """
+        Size of the adapter file in bytes.
+        """
+    @property
+    def fusion_duration(self) -> float:
+        """
+        Total duration of fusing the adapter into model weights with MODE_FUSE in milliseconds, summed over all models the adapter was fused to.
+        """
+    @property
+    def load_duration(self) -> float:
+        """
+        Duration of mapping and parsing of the adapter file in milliseconds.
+        """
+    @property
+    def resident_size(self) -> int:
+        """
+        Number of bytes of the memory mapped file currently resident in physical memory, 0 if the OS doesn't allow to query it.
+        """
 class AggregationMode:
     """
     Represents the mode of per-token score aggregation when determining least important tokens for eviction from cache
@@ -158,6 +186,15 @@ class AutoencoderKL:
         scaling_factor: float
         def __init__(self, config_path: os.PathLike) -> None:
             ...
+    class TilingConfig:
+        """
+        This class is used for storing AutoencoderKL tiled encoding / decoding parameters.
+        """
+        max_concurrent_tiles: int
+        tile_overlap: float
+        tile_size: int
+        def __init__(self) -> None:
+            ...
     @typing.overload
     def __init__(self, vae_decoder_path: os.PathLike) -> None:
         """
@@ -202,10 +239,18 @@ class AutoencoderKL:
                         device (str): Device to run the model on (e.g., CPU, GPU).
                         kwargs: Device properties.
         """
+    @typing.overload
     def decode(self, latent: openvino._pyopenvino.Tensor) -> openvino._pyopenvino.Tensor:
         ...
+    @typing.overload
+    def decode(self, latent: openvino._pyopenvino.Tensor, tiling: AutoencoderKL.TilingConfig) -> openvino._pyopenvino.Tensor:
+        ...
+    @typing.overload
     def encode(self, image: openvino._pyopenvino.Tensor, generator: Generator) -> openvino._pyopenvino.Tensor:
         ...
+    @typing.overload
+    def encode(self, image: openvino._pyopenvino.Tensor, generator: Generator, tiling: AutoencoderKL.TilingConfig) -> openvino._pyopenvino.Tensor:
+        ...
     def get_config(self) -> AutoencoderKL.Config:
         ...
     def get_vae_scale_factor(self) -> int:
@@ -251,6 +296,8 @@ class CLIPTextModel:
                         device (str): Device to run the model on (e.g., CPU, GPU).
                         kwargs: Device properties.
         """
+    def get_cache_stats(self) -> TextEncoderCacheStats:
+        ...
     def get_config(self) -> CLIPTextModel.Config:
         ...
     def get_output_tensor(self, idx: int) -> openvino._pyopenvino.Tensor:
@@ -261,6 +308,10 @@ class CLIPTextModel:
         ...
     def set_adapters(self, adapters: AdapterConfig | None) -> None:
         ...
+    def set_cache_capacity(self, capacity: int) -> CLIPTextModel:
+        """
+        Enables LRU cache of text encoder outputs for up to 'capacity' prompts, 0 disables the cache. The cache is shared by copies of the model.
+        """
 class CLIPTextModelWithProjection:
     """
     CLIPTextModelWithProjection class.
@@ -300,6 +351,8 @@ class CLIPTextModelWithProjection:
                         device (str): Device to run the model on (e.g., CPU, GPU).
                         kwargs: Device properties.
         """
+    def get_cache_stats(self) -> TextEncoderCacheStats:
+        ...
     def get_config(self) -> CLIPTextModelWithProjection.Config:
         ...
     def get_output_tensor(self, idx: int) -> openvino._pyopenvino.Tensor:
@@ -310,6 +363,10 @@ class CLIPTextModelWithProjection:
         ...
     def set_adapters(self, adapters: AdapterConfig | None) -> None:
         ...
+    def set_cache_capacity(self, capacity: int) -> CLIPTextModelWithProjection:
+        """
+        Enables LRU cache of text encoder outputs for up to 'capacity' prompts, 0 disables the cache. The cache is shared by copies of the model.
+        """
 class CacheEvictionConfig:
     """
     
@@ -337,6 +394,29 @@ class CacheEvictionConfig:
         ...
     def get_start_size(self) -> int:
         ...
+class ChatSession:
+    """
+    
+            Chat detached from LLMPipeline by LLMPipeline.suspend_chat(): chat history and KV cache of the model saved
+            in host memory or in a file. LLMPipeline.resume_chat() restores the KV cache instead of processing the chat history again,
+            so one pipeline can serve chats of many users. Copies of a session share its state.
+        
+    """
+    def get_kv_cache_length(self) -> int:
+        """
+        Number of tokens in the saved KV cache.
+        """
+    def get_memory_size(self) -> int:
+        """
+        Size of the saved KV cache in host memory in bytes, 0 if the session is offloaded.
+        """
+    def is_offloaded(self) -> bool:
+        ...
+    def offload(self, path: os.PathLike) -> None:
+        """
+                    Moves the saved KV cache to a file and releases its host memory. The file is read when the session is resumed,
+                    the session stays offloaded, so it can be resumed again. The file must be kept while the session is in use.
+        """
 class ChunkStreamerBase:
     """
     
@@ -372,22 +452,50 @@ class ContinuousBatchingPipeline:
     @typing.overload
     def add_request(self, request_id: int, prompt: str, sampling_params: GenerationConfig) -> GenerationHandle:
         ...
+    def clear_trace(self) -> None:
+        """
+        Removes traced spans and their statistics.
+        """
+    def enable_tracing(self, enabled: bool = True) -> None:
+        """
+        Enables or disables tracing of pipeline steps.
+        """
     @typing.overload
     def generate(self, input_ids: list[openvino._pyopenvino.Tensor], sampling_params: list[GenerationConfig], streamer: typing.Callable[[str], bool] | StreamerBase | None = None) -> list[EncodedGenerationResult]:
         ...
     @typing.overload
     def generate(self, prompts: list[str], sampling_params: list[GenerationConfig], streamer: typing.Callable[[str], bool] | StreamerBase | None = None) -> list[GenerationResult]:
         ...
+    def get_chrome_trace(self) -> str:
+        """
+        Returns traced spans as a JSON string in Chrome trace event format.
+        """
     def get_config(self) -> GenerationConfig:
         ...
     def get_metrics(self) -> PipelineMetrics:
         ...
     def get_tokenizer(self) -> Tokenizer:
         ...
+    def get_trace_statistics(self) -> dict[str, TraceSpanStatistics]:
+        """
+        Returns statistics of traced spans keyed by span names.
+        """
     def has_non_finished_requests(self) -> bool:
         ...
+    def reset_metrics(self) -> PipelineMetrics:
+        """
+        Resets aggregated metrics and returns the metrics before the reset.
+        """
+    def start_engine(self) -> None:
+        """
+        Starts a background thread, which calls step() while there are unfinished requests.
+        """
     def step(self) -> None:
         ...
+    def stop_engine(self) -> None:
+        """
+        Stops the thread started by start_engine() after the current step.
+        """
 class CppStdGenerator(Generator):
     """
     This class wraps std::mt19937 pseudo-random generator.
@@ -664,11 +772,31 @@ class GenerationHandle:
         ...
     def read_all(self) -> list[GenerationOutput]:
         ...
+    def read_async(self) -> GenerationOutputsFuture:
+        """
+        Returns a future of the next chunk of outputs, which becomes ready as soon as the pipeline generates the chunk.
+        """
+    def set_callback(self, callback: typing.Callable[[dict[int, GenerationOutput]], None]) -> None:
+        """
+        Passes each next chunk of outputs to the callback, which is called from the pipeline thread. The last call gets an empty dict once generation is over.
+        """
 class GenerationOutput:
     finish_reason: GenerationFinishReason
     generated_ids: list[int]
     generated_log_probs: list[float]
     score: float
+class GenerationOutputsFuture:
+    """
+    Next chunk of outputs returned by GenerationHandle.read_async().
+    """
+    def done(self) -> bool:
+        """
+        Checks if the chunk is generated, doesn't wait.
+        """
+    def result(self) -> dict[int, GenerationOutput]:
+        """
+        Waits for the chunk and returns it, an empty dict means that generation is over. Raises an error which stopped generation.
+        """
 class GenerationResult:
     """
     
@@ -810,22 +938,41 @@ class Image2ImagePipeline:
             width: int - width of resulting images,
             num_inference_steps: int - number of inference steps,
             rng_seed: int - a seed for random numbers generator,
-            generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
+            generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator, openvino_genai.PhiloxGenerator or class inherited from openvino_genai.Generator - random generator,
             adapters: LoRA adapters,
             strength: strength for image to image generation. 1.0f means initial image is fully noised,
-            max_sequence_length: int - length of t5_encoder_model input
+            max_sequence_length: int - length of t5_encoder_model input,
+            vae_tile_size: int - VAE tile size in pixels, 0 disables tiled VAE encoding / decoding,
+            vae_tile_overlap: float - fraction of a VAE tile shared with each neighbour tile,
+            vae_max_concurrent_tiles: int - max number of VAE tiles inferred at the same time
         
             :return: ov.Tensor with resulting images
             :rtype: ov.Tensor
         """
     def get_generation_config(self) -> ImageGenerationConfig:
         ...
+    def get_performance_metrics(self) -> ImageGenerationPerfMetrics:
+        ...
+    def get_resolution_bucket_stats(self) -> list[ResolutionBucketStats]:
+        ...
+    def get_text_encoder_cache_stats(self) -> TextEncoderCacheStats:
+        ...
+    @typing.overload
     def reshape(self, num_images_per_prompt: int, height: int, width: int, guidance_scale: float) -> None:
         ...
+    @typing.overload
+    def reshape(self, num_images_per_prompt: int, resolutions: list[tuple[int, int]], guidance_scale: float, compile_lazily: bool = False) -> None:
+        """
+        Reshapes models to several static resolutions given as (height, width) pairs, so requests with any of them run without recompilation.
+        """
     def set_generation_config(self, generation_config: ImageGenerationConfig) -> None:
         ...
     def set_scheduler(self, scheduler: Scheduler) -> None:
         ...
+    def set_text_encoder_cache_capacity(self, capacity: int) -> None:
+        """
+        Enables LRU cache of text encoder outputs for up to 'capacity' prompts per text encoder, 0 disables the cache.
+        """
 class ImageGenerationConfig:
     """
     This class is used for storing generation config for image generation pipeline.
@@ -844,6 +991,9 @@ class ImageGenerationConfig:
     prompt_3: str | None
     rng_seed: int
     strength: float
+    vae_max_concurrent_tiles: int
+    vae_tile_overlap: float
+    vae_tile_size: int
     width: int
     def __init__(self) -> None:
         ...
@@ -851,6 +1001,34 @@ class ImageGenerationConfig:
         ...
     def validate(self) -> None:
         ...
+class ImageGenerationPerfMetrics:
+    """
+    
+        Holds performance metrics of the last generate call of an image generation pipeline.
+    
+        :param get_step_inference_duration: Returns mean and standard deviation of denoising model inference duration per step in milliseconds
+        :type get_step_inference_duration: MeanStdPair
+    
+        :param get_step_host_duration: Returns mean and standard deviation of host work duration per step in milliseconds
+        :type get_step_host_duration: MeanStdPair
+    
+        :param get_model_switch_duration: Returns mean and standard deviation of resolution bucket switch duration in milliseconds
+        :type get_model_switch_duration: MeanStdPair
+    
+        :param raw_metrics: Raw image generation performance metrics
+        :type RawImageGenerationPerfMetrics:
+    """
+    def __init__(self) -> None:
+        ...
+    def get_model_switch_duration(self) -> MeanStdPair:
+        ...
+    def get_step_host_duration(self) -> MeanStdPair:
+        ...
+    def get_step_inference_duration(self) -> MeanStdPair:
+        ...
+    @property
+    def raw_metrics(self) -> RawImageGenerationPerfMetrics:
+        ...
 class InpaintingPipeline:
     """
     This class is used for generation with inpainting models.
@@ -911,22 +1089,41 @@ class InpaintingPipeline:
             width: int - width of resulting images,
             num_inference_steps: int - number of inference steps,
             rng_seed: int - a seed for random numbers generator,
-            generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
+            generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator, openvino_genai.PhiloxGenerator or class inherited from openvino_genai.Generator - random generator,
             adapters: LoRA adapters,
             strength: strength for image to image generation. 1.0f means initial image is fully noised,
-            max_sequence_length: int - length of t5_encoder_model input
+            max_sequence_length: int - length of t5_encoder_model input,
+            vae_tile_size: int - VAE tile size in pixels, 0 disables tiled VAE encoding / decoding,
+            vae_tile_overlap: float - fraction of a VAE tile shared with each neighbour tile,
+            vae_max_concurrent_tiles: int - max number of VAE tiles inferred at the same time
         
             :return: ov.Tensor with resulting images
             :rtype: ov.Tensor
         """
     def get_generation_config(self) -> ImageGenerationConfig:
         ...
+    def get_performance_metrics(self) -> ImageGenerationPerfMetrics:
+        ...
+    def get_resolution_bucket_stats(self) -> list[ResolutionBucketStats]:
+        ...
+    def get_text_encoder_cache_stats(self) -> TextEncoderCacheStats:
+        ...
+    @typing.overload
     def reshape(self, num_images_per_prompt: int, height: int, width: int, guidance_scale: float) -> None:
         ...
+    @typing.overload
+    def reshape(self, num_images_per_prompt: int, resolutions: list[tuple[int, int]], guidance_scale: float, compile_lazily: bool = False) -> None:
+        """
+        Reshapes models to several static resolutions given as (height, width) pairs, so requests with any of them run without recompilation.
+        """
     def set_generation_config(self, generation_config: ImageGenerationConfig) -> None:
         ...
     def set_scheduler(self, scheduler: Scheduler) -> None:
         ...
+    def set_text_encoder_cache_capacity(self, capacity: int) -> None:
+        """
+        Enables LRU cache of text encoder outputs for up to 'capacity' prompts per text encoder, 0 disables the cache.
+        """
 class LLMPipeline:
     """
     This class is used for generation with LLMs
@@ -1076,10 +1273,64 @@ class LLMPipeline:
         ...
     def get_tokenizer(self) -> Tokenizer:
         ...
+    def resume_chat(self, session: ChatSession) -> None:
+        """
+                    Finishes the current chat, if any, and continues the chat of the session from the point it was suspended at.
+                    The KV cache of the session is restored instead of being computed from the chat history. The session keeps its state,
+                    so resuming it again continues from the same point, e.g. to branch a chat.
+        """
     def set_generation_config(self, config: GenerationConfig) -> None:
         ...
     def start_chat(self, system_message: str = '') -> None:
         ...
+    def suspend_chat(self) -> ChatSession:
+        """
+                    Detaches the current chat from the pipeline: its history and KV cache are copied to a ChatSession,
+                    and the pipeline is left without a chat as after finish_chat(). Supported only by pipelines with stateful models.
+        """
+class LatencyPercentiles:
+    """
+    
+        Distribution of a latency in milliseconds. Percentiles are estimated by a histogram with relative error of at most 3%.
+    
+        :param count: Number of measured latencies.
+        :type count: int
+    
+        :param mean: Mean latency.
+        :type mean: float
+    
+        :param p50: Median latency.
+        :type p50: float
+    
+        :param p90: 90th percentile of latencies.
+        :type p90: float
+    
+        :param p99: 99th percentile of latencies.
+        :type p99: float
+    
+        :param max: Maximal latency.
+        :type max: float
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def count(self) -> int:
+        ...
+    @property
+    def max(self) -> float:
+        ...
+    @property
+    def mean(self) -> float:
+        ...
+    @property
+    def p50(self) -> float:
+        ...
+    @property
+    def p90(self) -> float:
+        ...
+    @property
+    def p99(self) -> float:
+        ...
 class MeanStdPair:
     def __init__(self) -> None:
         ...
@@ -1173,6 +1424,18 @@ class PerfMetrics:
     @property
     def raw_metrics(self) -> RawPerfMetrics:
         ...
+class PhiloxGenerator(Generator):
+    """
+    This class implements counter-based Philox pseudo-random generator, which generates tensors in parallel. Generated values depend only on a seed, but not on a number of threads.
+    """
+    def __init__(self, seed: int) -> None:
+        ...
+    def next(self) -> float:
+        ...
+    def randn_tensor(self, shape: openvino._pyopenvino.Shape) -> openvino._pyopenvino.Tensor:
+        ...
+    def seed(self, new_seed: int) -> None:
+        ...
 class PipelineMetrics:
     """
     
@@ -1194,6 +1457,24 @@ class PipelineMetrics:
     
         :param avg_cache_usage: Running average of the KV cache usage (in %) during the lifetime of the pipeline, with max window size of 1000 steps
         :type avg_cache_usage: float
+    
+        :param ttft: Time from adding a request to generation of its first token.
+        :type ttft: LatencyPercentiles
+    
+        :param tpot: Mean time between tokens generated after the first one, measured per finished request.
+        :type tpot: LatencyPercentiles
+    
+        :param queue_wait: Time from adding a request to its first scheduling.
+        :type queue_wait: LatencyPercentiles
+    
+        :param preemptions: Number of times requests were preempted to free KV cache blocks.
+        :type preemptions: int
+    
+        :param recomputed_tokens: Number of processed tokens dropped from KV cache by preemption, which had to be processed again.
+        :type recomputed_tokens: int
+    
+        :param prefix_cache_hit_rate: Percentage of prompt tokens restored from KV cache by prefix caching.
+        :type prefix_cache_hit_rate: float
     """
     def __init__(self) -> None:
         ...
@@ -1207,11 +1488,54 @@ class PipelineMetrics:
     def max_cache_usage(self) -> float:
         ...
     @property
+    def prefix_cache_hit_rate(self) -> float:
+        ...
+    @property
+    def preemptions(self) -> int:
+        ...
+    @property
+    def queue_wait(self) -> LatencyPercentiles:
+        ...
+    @property
+    def recomputed_tokens(self) -> int:
+        ...
+    @property
     def requests(self) -> int:
         ...
     @property
     def scheduled_requests(self) -> int:
         ...
+    @property
+    def tpot(self) -> LatencyPercentiles:
+        ...
+    @property
+    def ttft(self) -> LatencyPercentiles:
+        ...
+class RawImageGenerationPerfMetrics:
+    """
+    
+        Structure with raw performance metrics of image generation before any statistics are calculated.
+    
+        :param step_inference_durations: Duration of denoising model inference for each denoising step.
+        :type step_inference_durations: List[MicroSeconds]
+    
+        :param step_host_durations: Duration of host work for each denoising step: model inputs preparation and scheduler step with guidance.
+        :type step_host_durations: List[MicroSeconds]
+    
+        :param model_switch_durations: Duration of switching to models of the requested resolution bucket including their lazy compilation.
+        :type model_switch_durations: List[MicroSeconds]
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def model_switch_durations(self) -> list[float]:
+        ...
+    @property
+    def step_host_durations(self) -> list[float]:
+        ...
+    @property
+    def step_inference_durations(self) -> list[float]:
+        ...
 class RawPerfMetrics:
     """
     
@@ -1273,6 +1597,37 @@ class RawPerfMetrics:
     @property
     def tokenization_durations(self) -> list[float]:
         ...
+class ResolutionBucketStats:
+    """
+    
+        State of denoising and VAE models compiled for one resolution bucket of an image generation pipeline reshaped to several resolutions.
+    
+        :param height: Height of the bucket resolution
+        :type height: int
+    
+        :param width: Width of the bucket resolution
+        :type width: int
+    
+        :param is_compiled: Whether models are compiled, models of lazily compiled buckets are compiled by the first request with their resolution
+        :type is_compiled: bool
+    
+        :param compile_duration: Duration of models compilation in milliseconds, 0 if models are not compiled yet
+        :type compile_duration: float
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def compile_duration(self) -> float:
+        ...
+    @property
+    def height(self) -> int:
+        ...
+    @property
+    def is_compiled(self) -> bool:
+        ...
+    @property
+    def width(self) -> int:
+        ...
 class SD3Transformer2DModel:
     """
     SD3Transformer2DModel class.
@@ -1405,12 +1760,14 @@ class SchedulerConfig:
             This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
             When turend off only KV-cache required for batch calculation is kept in memory and
             when a sequence has finished genegartion its cache is released.
+        max_num_encoder_seqs:       max number of audio chunks encoded by one encoder inference of WhisperContinuousBatchingPipeline.
     """
     cache_eviction_config: CacheEvictionConfig
     cache_size: int
     dynamic_split_fuse: bool
     enable_prefix_caching: bool
     max_num_batched_tokens: int
+    max_num_encoder_seqs: int
     max_num_seqs: int
     num_kv_blocks: int
     use_cache_eviction: bool
@@ -1511,12 +1868,18 @@ class T5EncoderModel:
                         device (str): Device to run the model on (e.g., CPU, GPU).
                         kwargs: Device properties.
         """
+    def get_cache_stats(self) -> TextEncoderCacheStats:
+        ...
     def get_output_tensor(self, idx: int) -> openvino._pyopenvino.Tensor:
         ...
     def infer(self, pos_prompt: str, neg_prompt: str, do_classifier_free_guidance: bool, max_sequence_length: int) -> openvino._pyopenvino.Tensor:
         ...
     def reshape(self, batch_size: int, max_sequence_length: int) -> T5EncoderModel:
         ...
+    def set_cache_capacity(self, capacity: int) -> T5EncoderModel:
+        """
+        Enables LRU cache of text encoder outputs for up to 'capacity' prompts, 0 disables the cache. The cache is shared by copies of the model.
+        """
 class Text2ImagePipeline:
     """
     This class is used for generation with text-to-image models.
@@ -1591,22 +1954,92 @@ class Text2ImagePipeline:
             width: int - width of resulting images,
             num_inference_steps: int - number of inference steps,
             rng_seed: int - a seed for random numbers generator,
-            generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
+            generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator, openvino_genai.PhiloxGenerator or class inherited from openvino_genai.Generator - random generator,
             adapters: LoRA adapters,
             strength: strength for image to image generation. 1.0f means initial image is fully noised,
-            max_sequence_length: int - length of t5_encoder_model input
+            max_sequence_length: int - length of t5_encoder_model input,
+            vae_tile_size: int - VAE tile size in pixels, 0 disables tiled VAE encoding / decoding,
+            vae_tile_overlap: float - fraction of a VAE tile shared with each neighbour tile,
+            vae_max_concurrent_tiles: int - max number of VAE tiles inferred at the same time
         
             :return: ov.Tensor with resulting images
             :rtype: ov.Tensor
         """
+    def generate_batch(self, prompts: list[str], properties: list[dict]) -> list[openvino._pyopenvino.Tensor]:
+        """
+            Generates images for several requests at once, their latents are denoised together by one denoising model inference per step.
+            Requests must have the same resolution, number of inference steps and LoRA adapters.
+            Supported by Stable Diffusion and Latent Consistency Model pipelines with a dynamic batch dimension of the denoising model.
+        
+            :param prompts: input prompts
+            :type prompts: List[str]
+        
+            :param properties: generation parameters of each request, the same as kwargs of generate
+            :type properties: List[dict]
+        
+            :return: list of ov.Tensor with resulting images of each request, an empty tensor for requests interrupted by a callback
+            :rtype: List[ov.Tensor]
+        """
     def get_generation_config(self) -> ImageGenerationConfig:
         ...
+    def get_performance_metrics(self) -> ImageGenerationPerfMetrics:
+        ...
+    def get_resolution_bucket_stats(self) -> list[ResolutionBucketStats]:
+        ...
+    def get_text_encoder_cache_stats(self) -> TextEncoderCacheStats:
+        ...
+    @typing.overload
     def reshape(self, num_images_per_prompt: int, height: int, width: int, guidance_scale: float) -> None:
         ...
+    @typing.overload
+    def reshape(self, num_images_per_prompt: int, resolutions: list[tuple[int, int]], guidance_scale: float, compile_lazily: bool = False) -> None:
+        """
+        Reshapes models to several static resolutions given as (height, width) pairs, so requests with any of them run without recompilation.
+        """
     def set_generation_config(self, generation_config: ImageGenerationConfig) -> None:
         ...
     def set_scheduler(self, scheduler: Scheduler) -> None:
         ...
+    def set_text_encoder_cache_capacity(self, capacity: int) -> None:
+        """
+        Enables LRU cache of text encoder outputs for up to 'capacity' prompts per text encoder, 0 disables the cache.
+        """
+class TextEncoderCacheStats:
+    """
+    
+        Holds counters of a text encoder outputs cache. Each prompt of a text encoder batch is counted separately.
+    
+        :param hits: Number of prompts whose outputs were taken from the cache
+        :type hits: int
+    
+        :param misses: Number of prompts encoded by a model
+        :type misses: int
+    
+        :param size: Number of cached prompts
+        :type size: int
+    
+        :param capacity: Max number of cached prompts, 0 if the cache is disabled
+        :type capacity: int
+    
+        :param get_hit_rate: Returns ratio of hits to all lookups, 0 if there were no lookups
+        :type get_hit_rate: float
+    """
+    def __init__(self) -> None:
+        ...
+    def get_hit_rate(self) -> float:
+        ...
+    @property
+    def capacity(self) -> int:
+        ...
+    @property
+    def hits(self) -> int:
+        ...
+    @property
+    def misses(self) -> int:
+        ...
+    @property
+    def size(self) -> int:
+        ...
 class TokenizedInputs:
     attention_mask: openvino._pyopenvino.Tensor
     input_ids: openvino._pyopenvino.Tensor
@@ -1676,6 +2109,46 @@ class TorchGenerator(CppStdGenerator):
         ...
     def seed(self, new_seed: int) -> None:
         ...
+class TraceSpanStatistics:
+    """
+    
+        Aggregated durations of a traced part of pipeline steps, e.g. scheduling or inference.
+    
+        :param count: Number of recorded spans.
+        :type count: int
+    
+        :param total_ms: Total duration of spans in milliseconds.
+        :type total_ms: float
+    
+        :param min_ms: Minimal span duration in milliseconds.
+        :type min_ms: float
+    
+        :param max_ms: Maximal span duration in milliseconds.
+        :type max_ms: float
+    
+        :param histogram: Numbers of spans by duration: histogram[0] counts spans shorter than 1 microsecond,
+            histogram[i] counts spans from 2^(i-1) to 2^i microseconds, the last bucket also counts longer spans.
+        :type histogram: list[int]
+    """
+    def __init__(self) -> None:
+        ...
+    def get_mean_ms(self) -> float:
+        ...
+    @property
+    def count(self) -> int:
+        ...
+    @property
+    def histogram(self) -> list[int]:
+        ...
+    @property
+    def max_ms(self) -> float:
+        ...
+    @property
+    def min_ms(self) -> float:
+        ...
+    @property
+    def total_ms(self) -> float:
+        ...
 class UNet2DConditionModel:
     """
     UNet2DConditionModel class.
@@ -1760,11 +2233,16 @@ class VLMPerfMetrics(PerfMetrics):
         :param get_prepare_embeddings_duration: Returns mean and standard deviation of embeddings preparation duration in milliseconds
         :type get_prepare_embeddings_duration: MeanStdPair
     
+        :param get_image_embedding_cache_hit_rate: Returns share of images found in the image embedding cache
+        :type get_image_embedding_cache_hit_rate: float
+    
         :param vlm_raw_metrics: VLM specific raw metrics
         :type VLMRawPerfMetrics:
     """
     def __init__(self) -> None:
         ...
+    def get_image_embedding_cache_hit_rate(self) -> float:
+        ...
     def get_prepare_embeddings_duration(self) -> MeanStdPair:
         ...
     @property
@@ -1857,6 +2335,10 @@ class VLMPipeline:
         ...
     def set_generation_config(self, new_config: GenerationConfig) -> None:
         ...
+    def set_image_embedding_cache_capacity(self, capacity: int) -> None:
+        """
+        Keeps embeddings of up to capacity most recently used images, so repeated images aren't encoded again. 0 disables the cache.
+        """
     def start_chat(self, system_message: str = '') -> None:
         ...
 class VLMRawPerfMetrics:
@@ -1866,12 +2348,44 @@ class VLMRawPerfMetrics:
     
         :param prepare_embeddings_durations: Durations of embeddings preparation.
         :type prepare_embeddings_durations: List[MicroSeconds]
+    
+        :param image_embedding_cache_hits: Number of images whose embeddings were taken from the image embedding cache.
+        :type image_embedding_cache_hits: int
+    
+        :param image_embedding_cache_misses: Number of images encoded while the image embedding cache is enabled.
+        :type image_embedding_cache_misses: int
     """
     def __init__(self) -> None:
         ...
     @property
+    def image_embedding_cache_hits(self) -> int:
+        ...
+    @property
+    def image_embedding_cache_misses(self) -> int:
+        ...
+    @property
     def prepare_embeddings_durations(self) -> list[float]:
         ...
+class WhisperContinuousBatchingPipeline:
+    """
+    Automatic speech recognition pipeline which serves many transcription requests at once
+    """
+    def __init__(self, models_path: os.PathLike, scheduler_config: SchedulerConfig, device: str, properties: dict[str, typing.Any] = {}) -> None:
+        ...
+    def add_request(self, request_id: int, raw_speech_input: list[float], generation_config: WhisperGenerationConfig) -> GenerationHandle:
+        ...
+    def generate(self, raw_speech_inputs: list[list[float]], generation_configs: list[WhisperGenerationConfig]) -> list[WhisperDecodedResults]:
+        ...
+    def get_generation_config(self) -> WhisperGenerationConfig:
+        ...
+    def get_metrics(self) -> PipelineMetrics:
+        ...
+    def get_tokenizer(self) -> Tokenizer:
+        ...
+    def has_non_finished_requests(self) -> bool:
+        ...
+    def step(self) -> None:
+        ...
 class WhisperDecodedResultChunk:
     """
     
@@ -2001,8 +2515,15 @@ class WhisperGenerationConfig:
           auto result = pipeline.generate(raw_speech, ov::genai::hotwords("Polychrome"));
           //  He has gone and gone for good answered Polychrome who...
         :type hotwords: Optional[str]
+        
+        :param chunks_batch_size: Number of 30 seconds chunks of long-form audio encoded by one encoder inference and decoded together as a batch.
+                                  With the default value 1 chunks are processed one by one and every next chunk starts right after the last timestamp
+                                  predicted for the previous chunk. Values greater than 1 split audio into fixed 30 seconds chunks for a better throughput
+                                  of offline transcription, timestamps are predicted only if `return_timestamps` is set.
+        :type chunks_batch_size: int
     """
     begin_suppress_tokens: list[int]
+    chunks_batch_size: int
     decoder_start_token_id: int
     eos_token_id: int
     hotwords: str | None
@@ -2039,11 +2560,21 @@ class WhisperPerfMetrics(PerfMetrics):
         :param get_features_extraction_duration: Returns mean and standard deviation of features extraction duration in milliseconds
         :type get_features_extraction_duration: MeanStdPair
     
+        :param get_encode_inference_duration: Returns mean and standard deviation of encoder inference duration in milliseconds
+        :type get_encode_inference_duration: MeanStdPair
+    
+        :param get_decode_duration: Returns mean and standard deviation of decoding duration of a batch of chunks in milliseconds
+        :type get_decode_duration: MeanStdPair
+    
         :param whisper_raw_metrics: Whisper specific raw metrics
         :type WhisperRawPerfMetrics:
     """
     def __init__(self) -> None:
         ...
+    def get_decode_duration(self) -> MeanStdPair:
+        ...
+    def get_encode_inference_duration(self) -> MeanStdPair:
+        ...
     def get_features_extraction_duration(self) -> MeanStdPair:
         ...
     @property
@@ -2161,13 +2692,44 @@ class WhisperPipeline:
               auto result = pipeline.generate(raw_speech, ov::genai::hotwords("Polychrome"));
               //  He has gone and gone for good answered Polychrome who...
             :type hotwords: Optional[str]
+            
+            :param chunks_batch_size: Number of 30 seconds chunks of long-form audio encoded by one encoder inference and decoded together as a batch.
+                                      With the default value 1 chunks are processed one by one and every next chunk starts right after the last timestamp
+                                      predicted for the previous chunk. Values greater than 1 split audio into fixed 30 seconds chunks for a better throughput
+                                      of offline transcription, timestamps are predicted only if `return_timestamps` is set.
+            :type chunks_batch_size: int
+        """
+    def finish_stream(self) -> WhisperStreamingResult:
+        """
+        Transcribes the rest of the audio stream and finishes live transcription.
         """
     def get_generation_config(self) -> WhisperGenerationConfig:
         ...
     def get_tokenizer(self) -> Tokenizer:
         ...
+    def push_audio(self, audio_frames: list[float]) -> WhisperStreamingResult:
+        """
+            Appends audio to the live transcription started with start_stream().
+        
+            :param audio_frames: inputs in the form of list of floats. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+            :type audio_frames: List[float]
+        
+            :return: chunks finalized by the step and current partial text
+            :rtype: WhisperStreamingResult
+        """
     def set_generation_config(self, config: WhisperGenerationConfig) -> None:
         ...
+    def start_stream(self, generation_config: WhisperGenerationConfig | None = None, step: float = 1.0) -> None:
+        """
+            Starts live transcription of an audio stream. Audio is passed by parts with push_audio(). Transcription
+            of a sliding window of up to 30 seconds is recomputed each time `step` seconds of new audio are received.
+        
+            :param generation_config: generation_config
+            :type generation_config: WhisperGenerationConfig
+        
+            :param step: transcription step in seconds
+            :type step: float
+        """
 class WhisperRawPerfMetrics:
     """
     
@@ -2175,12 +2737,43 @@ class WhisperRawPerfMetrics:
     
         :param features_extraction_durations: Duration for each features extraction call.
         :type features_extraction_durations: List[MicroSeconds]
+    
+        :param encode_inference_durations: Duration for each encoder inference call.
+        :type encode_inference_durations: List[MicroSeconds]
+    
+        :param decode_durations: Duration of greedy decoding for each batch of encoded chunks.
+        :type decode_durations: List[MicroSeconds]
     """
     def __init__(self) -> None:
         ...
     @property
+    def decode_durations(self) -> list[float]:
+        ...
+    @property
+    def encode_inference_durations(self) -> list[float]:
+        ...
+    @property
     def features_extraction_durations(self) -> list[float]:
         ...
+class WhisperStreamingResult:
+    """
+    
+        Result of a live transcription step.
+    
+        Parameters:
+        final_chunks:  chunks which will not change anymore, timestamps are relative to the beginning of the stream.
+        partial_text:  transcription of the not finalized end of the stream, can be revised by the next steps.
+        perf_metrics:  performance metrics of the step.
+    """
+    @property
+    def final_chunks(self) -> list[WhisperDecodedResultChunk]:
+        ...
+    @property
+    def partial_text(self) -> str:
+        ...
+    @property
+    def perf_metrics(self) -> WhisperPerfMetrics:
+        ...
 def draft_model(models_path: os.PathLike, device: str = '', **kwargs) -> openvino._pyopenvino.OVAny:
     """
     device on which inference will be performed
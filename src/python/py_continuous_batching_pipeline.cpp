@@ -1,7 +1,9 @@
 // Copyright (C) 2023-2024 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <chrono>
 #include <filesystem>
+#include <future>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
@@ -23,10 +25,13 @@ using ov::genai::GenerationResult;
 using ov::genai::EncodedGenerationResult;
 using ov::genai::GenerationHandleImpl;
 using ov::genai::GenerationOutput;
+using ov::genai::GenerationOutputs;
 using ov::genai::GenerationFinishReason;
 using ov::genai::GenerationStatus;
 using ov::genai::SchedulerConfig;
 using ov::genai::PipelineMetrics;
+using ov::genai::LatencyPercentiles;
+using ov::genai::TraceSpanStatistics;
 
 namespace {
 
@@ -64,6 +69,7 @@ auto scheduler_config_docstring = R"(
         This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
         When turend off only KV-cache required for batch calculation is kept in memory and
         when a sequence has finished genegartion its cache is released.
+    max_num_encoder_seqs:       max number of audio chunks encoded by one encoder inference of WhisperContinuousBatchingPipeline.
 )";
 
 auto generation_result_docstring = R"(
@@ -102,6 +108,66 @@ auto pipeline_metrics_docstring = R"(
 
     :param avg_cache_usage: Running average of the KV cache usage (in %) during the lifetime of the pipeline, with max window size of 1000 steps
     :type avg_cache_usage: float
+
+    :param ttft: Time from adding a request to generation of its first token.
+    :type ttft: LatencyPercentiles
+
+    :param tpot: Mean time between tokens generated after the first one, measured per finished request.
+    :type tpot: LatencyPercentiles
+
+    :param queue_wait: Time from adding a request to its first scheduling.
+    :type queue_wait: LatencyPercentiles
+
+    :param preemptions: Number of times requests were preempted to free KV cache blocks.
+    :type preemptions: int
+
+    :param recomputed_tokens: Number of processed tokens dropped from KV cache by preemption, which had to be processed again.
+    :type recomputed_tokens: int
+
+    :param prefix_cache_hit_rate: Percentage of prompt tokens restored from KV cache by prefix caching.
+    :type prefix_cache_hit_rate: float
+)";
+
+auto latency_percentiles_docstring = R"(
+    Distribution of a latency in milliseconds. Percentiles are estimated by a histogram with relative error of at most 3%.
+
+    :param count: Number of measured latencies.
+    :type count: int
+
+    :param mean: Mean latency.
+    :type mean: float
+
+    :param p50: Median latency.
+    :type p50: float
+
+    :param p90: 90th percentile of latencies.
+    :type p90: float
+
+    :param p99: 99th percentile of latencies.
+    :type p99: float
+
+    :param max: Maximal latency.
+    :type max: float
+)";
+
+auto trace_span_statistics_docstring = R"(
+    Aggregated durations of a traced part of pipeline steps, e.g. scheduling or inference.
+
+    :param count: Number of recorded spans.
+    :type count: int
+
+    :param total_ms: Total duration of spans in milliseconds.
+    :type total_ms: float
+
+    :param min_ms: Minimal span duration in milliseconds.
+    :type min_ms: float
+
+    :param max_ms: Maximal span duration in milliseconds.
+    :type max_ms: float
+
+    :param histogram: Numbers of spans by duration: histogram[0] counts spans shorter than 1 microsecond,
+        histogram[i] counts spans from 2^(i-1) to 2^i microseconds, the last bucket also counts longer spans.
+    :type histogram: list[int]
 )";
 
 std::ostream& operator << (std::ostream& stream, const GenerationResult& generation_result) {
@@ -116,6 +182,29 @@ std::ostream& operator << (std::ostream& stream, const GenerationResult& generat
     return stream << std::endl;
 }
 
+// Destroying a pipeline joins its engine thread, which may wait for the GIL to call a Python callback,
+// so the engine is stopped with the GIL released. The pipeline itself is deleted under the GIL, as it may own callbacks.
+struct PipelineDeleter {
+    void operator()(ContinuousBatchingPipeline* pipeline) const {
+        {
+            py::gil_scoped_release release;
+            try {
+                pipeline->stop_engine();
+            } catch (...) {
+                // an error of the engine thread can't be reported from a destructor
+            }
+        }
+        delete pipeline;
+    }
+};
+
+using PipelineHolder = std::unique_ptr<ContinuousBatchingPipeline, PipelineDeleter>;
+
+// std::future returned by GenerationHandle::read_async(), shared so its result can be taken more than once
+struct GenerationOutputsFuture {
+    std::shared_future<GenerationOutputs> future;
+};
+
 } // namespace
 
 void init_continuous_batching_pipeline(py::module_& m) {
@@ -166,13 +255,34 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def_readwrite("score", &GenerationOutput::score)
         .def_readwrite("finish_reason", &GenerationOutput::finish_reason);
 
+    py::class_<GenerationOutputsFuture>(m, "GenerationOutputsFuture", "Next chunk of outputs returned by GenerationHandle.read_async().")
+        .def("done", [](const GenerationOutputsFuture& future) {
+                return future.future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            },
+            "Checks if the chunk is generated, doesn't wait.")
+        .def("result", [](const GenerationOutputsFuture& future) {
+                return future.future.get();
+            },
+            py::call_guard<py::gil_scoped_release>(),
+            "Waits for the chunk and returns it, an empty dict means that generation is over. "
+            "Raises an error which stopped generation.");
+
+    // the engine thread holds a stream lock, which these methods take as well, while it waits for the GIL to run a callback
     py::class_<GenerationHandleImpl, std::shared_ptr<GenerationHandleImpl>>(m, "GenerationHandle")
         .def("get_status", &GenerationHandleImpl::get_status)
-        .def("can_read", &GenerationHandleImpl::can_read)
+        .def("can_read", &GenerationHandleImpl::can_read, py::call_guard<py::gil_scoped_release>())
         .def("drop", &GenerationHandleImpl::drop)
-        .def("back", &GenerationHandleImpl::back)
-        .def("read", &GenerationHandleImpl::read)
-        .def("read_all", &GenerationHandleImpl::read_all);
+        .def("back", &GenerationHandleImpl::back, py::call_guard<py::gil_scoped_release>())
+        .def("read", &GenerationHandleImpl::read, py::call_guard<py::gil_scoped_release>())
+        .def("read_all", &GenerationHandleImpl::read_all, py::call_guard<py::gil_scoped_release>())
+        .def("read_async", [](GenerationHandleImpl& handle) {
+                return GenerationOutputsFuture{handle.read_async().share()};
+            },
+            py::call_guard<py::gil_scoped_release>(),
+            "Returns a future of the next chunk of outputs, which becomes ready as soon as the pipeline generates the chunk.")
+        .def("set_callback", &GenerationHandleImpl::set_callback, py::arg("callback"), py::call_guard<py::gil_scoped_release>(),
+             "Passes each next chunk of outputs to the callback, which is called from the pipeline thread. "
+             "The last call gets an empty dict once generation is over.");
 
     // Binding for StopCriteria
     py::enum_<AggregationMode>(m, "AggregationMode",
@@ -200,21 +310,46 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def_readwrite("dynamic_split_fuse", &SchedulerConfig::dynamic_split_fuse)
         .def_readwrite("max_num_seqs", &SchedulerConfig::max_num_seqs)
         .def_readwrite("enable_prefix_caching", &SchedulerConfig::enable_prefix_caching)
+        .def_readwrite("max_num_encoder_seqs", &SchedulerConfig::max_num_encoder_seqs)
         .def_readwrite("use_cache_eviction", &SchedulerConfig::use_cache_eviction)
         .def_readwrite("cache_eviction_config", &SchedulerConfig::cache_eviction_config);
 
+    py::class_<LatencyPercentiles>(m, "LatencyPercentiles", latency_percentiles_docstring)
+            .def(py::init<>())
+            .def_readonly("count", &LatencyPercentiles::count)
+            .def_readonly("mean", &LatencyPercentiles::mean)
+            .def_readonly("p50", &LatencyPercentiles::p50)
+            .def_readonly("p90", &LatencyPercentiles::p90)
+            .def_readonly("p99", &LatencyPercentiles::p99)
+            .def_readonly("max", &LatencyPercentiles::max);
+
     py::class_<PipelineMetrics>(m, "PipelineMetrics", pipeline_metrics_docstring)
             .def(py::init<>())
             .def_readonly("requests", &PipelineMetrics::requests)
             .def_readonly("scheduled_requests", &PipelineMetrics::scheduled_requests)
             .def_readonly("cache_usage", &PipelineMetrics::cache_usage)
             .def_readonly("avg_cache_usage", &PipelineMetrics::avg_cache_usage)
-            .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage);
-
-    py::class_<ContinuousBatchingPipeline>(m, "ContinuousBatchingPipeline", "This class is used for generation with LLMs with continuous batchig")
+            .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage)
+            .def_readonly("ttft", &PipelineMetrics::ttft)
+            .def_readonly("tpot", &PipelineMetrics::tpot)
+            .def_readonly("queue_wait", &PipelineMetrics::queue_wait)
+            .def_readonly("preemptions", &PipelineMetrics::preemptions)
+            .def_readonly("recomputed_tokens", &PipelineMetrics::recomputed_tokens)
+            .def_readonly("prefix_cache_hit_rate", &PipelineMetrics::prefix_cache_hit_rate);
+
+    py::class_<TraceSpanStatistics>(m, "TraceSpanStatistics", trace_span_statistics_docstring)
+            .def(py::init<>())
+            .def_readonly("count", &TraceSpanStatistics::count)
+            .def_readonly("total_ms", &TraceSpanStatistics::total_ms)
+            .def_readonly("min_ms", &TraceSpanStatistics::min_ms)
+            .def_readonly("max_ms", &TraceSpanStatistics::max_ms)
+            .def_readonly("histogram", &TraceSpanStatistics::histogram)
+            .def("get_mean_ms", &TraceSpanStatistics::get_mean_ms);
+
+    py::class_<ContinuousBatchingPipeline, PipelineHolder>(m, "ContinuousBatchingPipeline", "This class is used for generation with LLMs with continuous batchig")
         .def(py::init([](const std::string& models_path, const SchedulerConfig& scheduler_config, const std::string& device, const std::map<std::string, py::object>& llm_plugin_config, const std::map<std::string, py::object>& tokenizer_plugin_config) {
             ScopedVar env_manager(pyutils::ov_tokenizers_module_path());
-            return std::make_unique<ContinuousBatchingPipeline>(models_path, scheduler_config, device, pyutils::properties_to_any_map(llm_plugin_config), pyutils::properties_to_any_map(tokenizer_plugin_config));
+            return PipelineHolder(new ContinuousBatchingPipeline(models_path, scheduler_config, device, pyutils::properties_to_any_map(llm_plugin_config), pyutils::properties_to_any_map(tokenizer_plugin_config)));
         }),
         py::arg("models_path"),
         py::arg("scheduler_config"),
@@ -224,7 +359,7 @@ void init_continuous_batching_pipeline(py::module_& m) {
 
         .def(py::init([](const std::string& models_path, const ov::genai::Tokenizer& tokenizer, const SchedulerConfig& scheduler_config, const std::string& device, const std::map<std::string, py::object>& plugin_config) {
             ScopedVar env_manager(pyutils::ov_tokenizers_module_path());
-            return std::make_unique<ContinuousBatchingPipeline>(models_path, tokenizer, scheduler_config, device, pyutils::properties_to_any_map(plugin_config));
+            return PipelineHolder(new ContinuousBatchingPipeline(models_path, tokenizer, scheduler_config, device, pyutils::properties_to_any_map(plugin_config)));
         }),
         py::arg("models_path"),
         py::arg("tokenizer"),
@@ -235,10 +370,24 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def("get_tokenizer", &ContinuousBatchingPipeline::get_tokenizer)
         .def("get_config", &ContinuousBatchingPipeline::get_config)
         .def("get_metrics", &ContinuousBatchingPipeline::get_metrics)
+        .def("reset_metrics", &ContinuousBatchingPipeline::reset_metrics,
+             "Resets aggregated metrics and returns the metrics before the reset.")
+        .def("enable_tracing", &ContinuousBatchingPipeline::enable_tracing, py::arg("enabled") = true,
+             "Enables or disables tracing of pipeline steps.")
+        .def("get_chrome_trace", &ContinuousBatchingPipeline::get_chrome_trace,
+             "Returns traced spans as a JSON string in Chrome trace event format.")
+        .def("get_trace_statistics", &ContinuousBatchingPipeline::get_trace_statistics,
+             "Returns statistics of traced spans keyed by span names.")
+        .def("clear_trace", &ContinuousBatchingPipeline::clear_trace, "Removes traced spans and their statistics.")
         .def("add_request", py::overload_cast<uint64_t, const ov::Tensor&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("input_ids"), py::arg("sampling_params"))
         .def("add_request", py::overload_cast<uint64_t, const std::string&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("prompt"), py::arg("sampling_params"))
         .def("step", &ContinuousBatchingPipeline::step)
         .def("has_non_finished_requests", &ContinuousBatchingPipeline::has_non_finished_requests)
+        .def("start_engine", &ContinuousBatchingPipeline::start_engine,
+             "Starts a background thread, which calls step() while there are unfinished requests.")
+        // the engine thread may wait for the GIL to call a Python callback
+        .def("stop_engine", &ContinuousBatchingPipeline::stop_engine, py::call_guard<py::gil_scoped_release>(),
+             "Stops the thread started by start_engine() after the current step.")
         .def(
             "generate",
             py::overload_cast<const std::vector<ov::Tensor>&, const std::vector<ov::genai::GenerationConfig>&, const ov::genai::StreamerVariant&>(&ContinuousBatchingPipeline::generate),
@@ -72,6 +72,8 @@ void init_clip_text_model(py::module_& m) {
         .def("set_adapters", &ov::genai::CLIPTextModel::set_adapters, py::arg("adapters"))
         .def("infer", &ov::genai::CLIPTextModel::infer, py::arg("pos_prompt"), py::arg("neg_prompt"), py::arg("do_classifier_free_guidance"))
         .def("get_output_tensor", &ov::genai::CLIPTextModel::get_output_tensor, py::arg("idx"))
+        .def("set_cache_capacity", &ov::genai::CLIPTextModel::set_cache_capacity, py::arg("capacity"), "Enables LRU cache of text encoder outputs for up to 'capacity' prompts, 0 disables the cache. The cache is shared by copies of the model.")
+        .def("get_cache_stats", &ov::genai::CLIPTextModel::get_cache_stats)
         .def(
             "compile",
             [](ov::genai::CLIPTextModel& self,
@@ -136,6 +138,8 @@ void init_clip_text_model_with_projection(py::module_& m) {
         .def("infer", &ov::genai::CLIPTextModelWithProjection::infer, py::arg("pos_prompt"), py::arg("neg_prompt"), py::arg("do_classifier_free_guidance"))
         .def("get_config", &ov::genai::CLIPTextModelWithProjection::get_config)
         .def("get_output_tensor", &ov::genai::CLIPTextModelWithProjection::get_output_tensor, py::arg("idx"))
+        .def("set_cache_capacity", &ov::genai::CLIPTextModelWithProjection::set_cache_capacity, py::arg("capacity"), "Enables LRU cache of text encoder outputs for up to 'capacity' prompts, 0 disables the cache. The cache is shared by copies of the model.")
+        .def("get_cache_stats", &ov::genai::CLIPTextModelWithProjection::get_cache_stats)
         .def("set_adapters", &ov::genai::CLIPTextModelWithProjection::set_adapters, py::arg("adapters"))
         .def(
             "compile",
@@ -191,6 +195,8 @@ void init_t5_encoder_model(py::module_& m) {
         .def("reshape", &ov::genai::T5EncoderModel::reshape, py::arg("batch_size"), py::arg("max_sequence_length"))
         .def("infer", &ov::genai::T5EncoderModel::infer, py::arg("pos_prompt"), py::arg("neg_prompt"), py::arg("do_classifier_free_guidance"), py::arg("max_sequence_length"))
         .def("get_output_tensor", &ov::genai::T5EncoderModel::get_output_tensor, py::arg("idx"))
+        .def("set_cache_capacity", &ov::genai::T5EncoderModel::set_cache_capacity, py::arg("capacity"), "Enables LRU cache of text encoder outputs for up to 'capacity' prompts, 0 disables the cache. The cache is shared by copies of the model.")
+        .def("get_cache_stats", &ov::genai::T5EncoderModel::get_cache_stats)
         // .def("set_adapters", &ov::genai::T5EncoderModel::set_adapters, py::arg("adapters"))
         .def(
             "compile",
@@ -477,6 +483,12 @@ void init_autoencoder_kl(py::module_& m) {
         .def_readwrite("scaling_factor", &ov::genai::AutoencoderKL::Config::scaling_factor)
         .def_readwrite("block_out_channels", &ov::genai::AutoencoderKL::Config::block_out_channels);
 
+    py::class_<ov::genai::AutoencoderKL::TilingConfig>(autoencoder_kl, "TilingConfig", "This class is used for storing AutoencoderKL tiled encoding / decoding parameters.")
+        .def(py::init<>())
+        .def_readwrite("tile_size", &ov::genai::AutoencoderKL::TilingConfig::tile_size)
+        .def_readwrite("tile_overlap", &ov::genai::AutoencoderKL::TilingConfig::tile_overlap)
+        .def_readwrite("max_concurrent_tiles", &ov::genai::AutoencoderKL::TilingConfig::max_concurrent_tiles);
+
     autoencoder_kl.def("reshape", &ov::genai::AutoencoderKL::reshape, py::arg("batch_size"), py::arg("height"), py::arg("width"))
         .def(
             "compile",
@@ -492,8 +504,16 @@ void init_autoencoder_kl(py::module_& m) {
                 device (str): Device to run the model on (e.g., CPU, GPU).
                 kwargs: Device properties.
             )")
-        .def("decode", &ov::genai::AutoencoderKL::decode, py::arg("latent"))
-        .def("encode", &ov::genai::AutoencoderKL::encode, py::arg("image"), py::arg("generator"))
+        .def("decode", py::overload_cast<ov::Tensor>(&ov::genai::AutoencoderKL::decode), py::arg("latent"))
+        .def("decode",
+            py::overload_cast<ov::Tensor, const ov::genai::AutoencoderKL::TilingConfig&>(&ov::genai::AutoencoderKL::decode),
+            py::arg("latent"), py::arg("tiling"))
+        .def("encode",
+            py::overload_cast<ov::Tensor, std::shared_ptr<ov::genai::Generator>>(&ov::genai::AutoencoderKL::encode),
+            py::arg("image"), py::arg("generator"))
+        .def("encode",
+            py::overload_cast<ov::Tensor, std::shared_ptr<ov::genai::Generator>, const ov::genai::AutoencoderKL::TilingConfig&>(&ov::genai::AutoencoderKL::encode),
+            py::arg("image"), py::arg("generator"), py::arg("tiling"))
         .def("get_config", &ov::genai::AutoencoderKL::get_config)
         .def("get_vae_scale_factor", &ov::genai::AutoencoderKL::get_vae_scale_factor);
 }
@@ -45,10 +45,13 @@ auto text2image_generate_docstring = R"(
     width: int - width of resulting images,
     num_inference_steps: int - number of inference steps,
     rng_seed: int - a seed for random numbers generator,
-    generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
+    generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator, openvino_genai.PhiloxGenerator or class inherited from openvino_genai.Generator - random generator,
     adapters: LoRA adapters,
     strength: strength for image to image generation. 1.0f means initial image is fully noised,
-    max_sequence_length: int - length of t5_encoder_model input
+    max_sequence_length: int - length of t5_encoder_model input,
+    vae_tile_size: int - VAE tile size in pixels, 0 disables tiled VAE encoding / decoding,
+    vae_tile_overlap: float - fraction of a VAE tile shared with each neighbour tile,
+    vae_max_concurrent_tiles: int - max number of VAE tiles inferred at the same time
 
     :return: ov.Tensor with resulting images
     :rtype: ov.Tensor
@@ -151,6 +154,85 @@ public:
     }
 };
 
+auto raw_image_generation_perf_metrics_docstring = R"(
+    Structure with raw performance metrics of image generation before any statistics are calculated.
+
+    :param step_inference_durations: Duration of denoising model inference for each denoising step.
+    :type step_inference_durations: List[MicroSeconds]
+
+    :param step_host_durations: Duration of host work for each denoising step: model inputs preparation and scheduler step with guidance.
+    :type step_host_durations: List[MicroSeconds]
+
+    :param model_switch_durations: Duration of switching to models of the requested resolution bucket including their lazy compilation.
+    :type model_switch_durations: List[MicroSeconds]
+)";
+
+auto image_generation_perf_metrics_docstring = R"(
+    Holds performance metrics of the last generate call of an image generation pipeline.
+
+    :param get_step_inference_duration: Returns mean and standard deviation of denoising model inference duration per step in milliseconds
+    :type get_step_inference_duration: MeanStdPair
+
+    :param get_step_host_duration: Returns mean and standard deviation of host work duration per step in milliseconds
+    :type get_step_host_duration: MeanStdPair
+
+    :param get_model_switch_duration: Returns mean and standard deviation of resolution bucket switch duration in milliseconds
+    :type get_model_switch_duration: MeanStdPair
+
+    :param raw_metrics: Raw image generation performance metrics
+    :type RawImageGenerationPerfMetrics:
+)";
+
+auto resolution_bucket_stats_docstring = R"(
+    State of denoising and VAE models compiled for one resolution bucket of an image generation pipeline reshaped to several resolutions.
+
+    :param height: Height of the bucket resolution
+    :type height: int
+
+    :param width: Width of the bucket resolution
+    :type width: int
+
+    :param is_compiled: Whether models are compiled, models of lazily compiled buckets are compiled by the first request with their resolution
+    :type is_compiled: bool
+
+    :param compile_duration: Duration of models compilation in milliseconds, 0 if models are not compiled yet
+    :type compile_duration: float
+)";
+
+auto text2image_generate_batch_docstring = R"(
+    Generates images for several requests at once, their latents are denoised together by one denoising model inference per step.
+    Requests must have the same resolution, number of inference steps and LoRA adapters.
+    Supported by Stable Diffusion and Latent Consistency Model pipelines with a dynamic batch dimension of the denoising model.
+
+    :param prompts: input prompts
+    :type prompts: List[str]
+
+    :param properties: generation parameters of each request, the same as kwargs of generate
+    :type properties: List[dict]
+
+    :return: list of ov.Tensor with resulting images of each request, an empty tensor for requests interrupted by a callback
+    :rtype: List[ov.Tensor]
+)";
+
+auto text_encoder_cache_stats_docstring = R"(
+    Holds counters of a text encoder outputs cache. Each prompt of a text encoder batch is counted separately.
+
+    :param hits: Number of prompts whose outputs were taken from the cache
+    :type hits: int
+
+    :param misses: Number of prompts encoded by a model
+    :type misses: int
+
+    :param size: Number of cached prompts
+    :type size: int
+
+    :param capacity: Max number of cached prompts, 0 if the cache is disabled
+    :type capacity: int
+
+    :param get_hit_rate: Returns ratio of hits to all lookups, 0 if there were no lookups
+    :type get_hit_rate: float
+)";
+
 } // namespace
 
 void init_clip_text_model(py::module_& m);
@@ -173,6 +255,14 @@ void init_image_generation_pipelines(py::module_& m) {
         .def("randn_tensor", &ov::genai::CppStdGenerator::randn_tensor, py::arg("shape"))
         .def("seed", &ov::genai::CppStdGenerator::seed, py::arg("new_seed"));
 
+    py::class_<ov::genai::PhiloxGenerator, ov::genai::Generator, std::shared_ptr<ov::genai::PhiloxGenerator>>(m, "PhiloxGenerator", "This class implements counter-based Philox pseudo-random generator, which generates tensors in parallel. Generated values depend only on a seed, but not on a number of threads.")
+        .def(py::init([](uint64_t seed) {
+            return std::make_unique<ov::genai::PhiloxGenerator>(seed);
+        }), py::arg("seed"))
+        .def("next", &ov::genai::PhiloxGenerator::next)
+        .def("randn_tensor", &ov::genai::PhiloxGenerator::randn_tensor, py::arg("shape"))
+        .def("seed", &ov::genai::PhiloxGenerator::seed, py::arg("new_seed"));
+
     py::class_<::TorchGenerator, ov::genai::CppStdGenerator, std::shared_ptr<::TorchGenerator>>(m, "TorchGenerator", "This class provides OpenVINO GenAI Generator wrapper for torch.Generator")
         .def(py::init([](uint32_t seed) {
             return std::make_unique<::TorchGenerator>(seed);
@@ -222,6 +312,9 @@ void init_image_generation_pipelines(py::module_& m) {
         .def_readwrite("adapters", &ov::genai::ImageGenerationConfig::adapters)
         .def_readwrite("strength", &ov::genai::ImageGenerationConfig::strength)
         .def_readwrite("max_sequence_length", &ov::genai::ImageGenerationConfig::max_sequence_length)
+        .def_readwrite("vae_tile_size", &ov::genai::ImageGenerationConfig::vae_tile_size)
+        .def_readwrite("vae_tile_overlap", &ov::genai::ImageGenerationConfig::vae_tile_overlap)
+        .def_readwrite("vae_max_concurrent_tiles", &ov::genai::ImageGenerationConfig::vae_max_concurrent_tiles)
         .def("validate", &ov::genai::ImageGenerationConfig::validate)
         .def("update_generation_config", [](
             ov::genai::ImageGenerationConfig config,
@@ -229,6 +322,40 @@ void init_image_generation_pipelines(py::module_& m) {
             config.update_generation_config(pyutils::kwargs_to_any_map(kwargs));
         });
 
+    py::class_<ov::genai::RawImageGenerationPerfMetrics>(m, "RawImageGenerationPerfMetrics", raw_image_generation_perf_metrics_docstring)
+        .def(py::init<>())
+        .def_property_readonly("step_inference_durations", [](const ov::genai::RawImageGenerationPerfMetrics& rw) {
+            return pyutils::get_ms(rw, &ov::genai::RawImageGenerationPerfMetrics::step_inference_durations);
+        })
+        .def_property_readonly("step_host_durations", [](const ov::genai::RawImageGenerationPerfMetrics& rw) {
+            return pyutils::get_ms(rw, &ov::genai::RawImageGenerationPerfMetrics::step_host_durations);
+        })
+        .def_property_readonly("model_switch_durations", [](const ov::genai::RawImageGenerationPerfMetrics& rw) {
+            return pyutils::get_ms(rw, &ov::genai::RawImageGenerationPerfMetrics::model_switch_durations);
+        });
+
+    py::class_<ov::genai::ImageGenerationPerfMetrics>(m, "ImageGenerationPerfMetrics", image_generation_perf_metrics_docstring)
+        .def(py::init<>())
+        .def("get_step_inference_duration", &ov::genai::ImageGenerationPerfMetrics::get_step_inference_duration)
+        .def("get_step_host_duration", &ov::genai::ImageGenerationPerfMetrics::get_step_host_duration)
+        .def("get_model_switch_duration", &ov::genai::ImageGenerationPerfMetrics::get_model_switch_duration)
+        .def_readonly("raw_metrics", &ov::genai::ImageGenerationPerfMetrics::raw_metrics);
+
+    py::class_<ov::genai::TextEncoderCacheStats>(m, "TextEncoderCacheStats", text_encoder_cache_stats_docstring)
+        .def(py::init<>())
+        .def_readonly("hits", &ov::genai::TextEncoderCacheStats::hits)
+        .def_readonly("misses", &ov::genai::TextEncoderCacheStats::misses)
+        .def_readonly("size", &ov::genai::TextEncoderCacheStats::size)
+        .def_readonly("capacity", &ov::genai::TextEncoderCacheStats::capacity)
+        .def("get_hit_rate", &ov::genai::TextEncoderCacheStats::get_hit_rate);
+
+    py::class_<ov::genai::ResolutionBucketStats>(m, "ResolutionBucketStats", resolution_bucket_stats_docstring)
+        .def(py::init<>())
+        .def_readonly("height", &ov::genai::ResolutionBucketStats::height)
+        .def_readonly("width", &ov::genai::ResolutionBucketStats::width)
+        .def_readonly("is_compiled", &ov::genai::ResolutionBucketStats::is_compiled)
+        .def_readonly("compile_duration", &ov::genai::ResolutionBucketStats::compile_duration);
+
     auto text2image_pipeline = py::class_<ov::genai::Text2ImagePipeline>(m, "Text2ImagePipeline", "This class is used for generation with text-to-image models.")
         .def(py::init([](const std::filesystem::path& models_path) {
             ScopedVar env_manager(pyutils::ov_tokenizers_module_path());
@@ -258,7 +385,11 @@ void init_image_generation_pipelines(py::module_& m) {
         .def("get_generation_config", &ov::genai::Text2ImagePipeline::get_generation_config)
         .def("set_generation_config", &ov::genai::Text2ImagePipeline::set_generation_config, py::arg("generation_config"))
         .def("set_scheduler", &ov::genai::Text2ImagePipeline::set_scheduler, py::arg("scheduler"))
-        .def("reshape", &ov::genai::Text2ImagePipeline::reshape, py::arg("num_images_per_prompt"), py::arg("height"), py::arg("width"), py::arg("guidance_scale"))
+        .def("reshape", py::overload_cast<const int, const int, const int, const float>(&ov::genai::Text2ImagePipeline::reshape),
+             py::arg("num_images_per_prompt"), py::arg("height"), py::arg("width"), py::arg("guidance_scale"))
+        .def("reshape", py::overload_cast<const int, const std::vector<std::pair<int, int>>&, const float, const bool>(&ov::genai::Text2ImagePipeline::reshape),
+             py::arg("num_images_per_prompt"), py::arg("resolutions"), py::arg("guidance_scale"), py::arg("compile_lazily") = false,
+             "Reshapes models to several static resolutions given as (height, width) pairs, so requests with any of them run without recompilation.")
         .def_static("stable_diffusion", &ov::genai::Text2ImagePipeline::stable_diffusion, py::arg("scheduler"), py::arg("clip_text_model"), py::arg("unet"), py::arg("vae"))
         .def_static("latent_consistency_model", &ov::genai::Text2ImagePipeline::latent_consistency_model, py::arg("scheduler"), py::arg("clip_text_model"), py::arg("unet"), py::arg("vae"))
         .def_static("stable_diffusion_xl", &ov::genai::Text2ImagePipeline::stable_diffusion_xl, py::arg("scheduler"), py::arg("clip_text_model"), py::arg("clip_text_model_with_projection"), py::arg("unet"), py::arg("vae"))
@@ -294,7 +425,27 @@ void init_image_generation_pipelines(py::module_& m) {
             },
             py::arg("prompt"), "Input string",
             (text2image_generate_docstring + std::string(" \n ")).c_str())
-        .def("decode", &ov::genai::Text2ImagePipeline::decode, py::arg("latent"));
+        .def(
+            "generate_batch",
+            [](ov::genai::Text2ImagePipeline& pipe,
+                const std::vector<std::string>& prompts,
+                const std::vector<py::dict>& properties
+            ) -> std::vector<ov::Tensor> {
+                std::vector<ov::AnyMap> params;
+                for (const py::dict& request_properties : properties) {
+                    params.push_back(pyutils::py_object_to_any_map(request_properties));
+                }
+                return pipe.generate_batch(prompts, params);
+            },
+            py::arg("prompts"), "Input strings",
+            py::arg("properties"), "Generation parameters of each request",
+            text2image_generate_batch_docstring)
+        .def("decode", &ov::genai::Text2ImagePipeline::decode, py::arg("latent"))
+        .def("get_performance_metrics", &ov::genai::Text2ImagePipeline::get_performance_metrics)
+        .def("set_text_encoder_cache_capacity", &ov::genai::Text2ImagePipeline::set_text_encoder_cache_capacity, py::arg("capacity"),
+             "Enables LRU cache of text encoder outputs for up to 'capacity' prompts per text encoder, 0 disables the cache.")
+        .def("get_text_encoder_cache_stats", &ov::genai::Text2ImagePipeline::get_text_encoder_cache_stats)
+        .def("get_resolution_bucket_stats", &ov::genai::Text2ImagePipeline::get_resolution_bucket_stats);
 
 
     auto image2image_pipeline = py::class_<ov::genai::Image2ImagePipeline>(m, "Image2ImagePipeline", "This class is used for generation with image-to-image models.")
@@ -326,7 +477,11 @@ void init_image_generation_pipelines(py::module_& m) {
         .def("get_generation_config", &ov::genai::Image2ImagePipeline::get_generation_config)
         .def("set_generation_config", &ov::genai::Image2ImagePipeline::set_generation_config, py::arg("generation_config"))
         .def("set_scheduler", &ov::genai::Image2ImagePipeline::set_scheduler, py::arg("scheduler"))
-        .def("reshape", &ov::genai::Image2ImagePipeline::reshape, py::arg("num_images_per_prompt"), py::arg("height"), py::arg("width"), py::arg("guidance_scale"))
+        .def("reshape", py::overload_cast<const int, const int, const int, const float>(&ov::genai::Image2ImagePipeline::reshape),
+             py::arg("num_images_per_prompt"), py::arg("height"), py::arg("width"), py::arg("guidance_scale"))
+        .def("reshape", py::overload_cast<const int, const std::vector<std::pair<int, int>>&, const float, const bool>(&ov::genai::Image2ImagePipeline::reshape),
+             py::arg("num_images_per_prompt"), py::arg("resolutions"), py::arg("guidance_scale"), py::arg("compile_lazily") = false,
+             "Reshapes models to several static resolutions given as (height, width) pairs, so requests with any of them run without recompilation.")
         .def_static("stable_diffusion", &ov::genai::Image2ImagePipeline::stable_diffusion, py::arg("scheduler"), py::arg("clip_text_model"), py::arg("unet"), py::arg("vae"))
         .def_static("latent_consistency_model", &ov::genai::Image2ImagePipeline::latent_consistency_model, py::arg("scheduler"), py::arg("clip_text_model"), py::arg("unet"), py::arg("vae"))
         .def_static("stable_diffusion_xl", &ov::genai::Image2ImagePipeline::stable_diffusion_xl, py::arg("scheduler"), py::arg("clip_text_model"), py::arg("clip_text_model_with_projection"), py::arg("unet"), py::arg("vae"))
@@ -357,7 +512,12 @@ void init_image_generation_pipelines(py::module_& m) {
             py::arg("prompt"), "Input string",
             py::arg("image"), "Initial image",
             (text2image_generate_docstring + std::string(" \n ")).c_str())
-        .def("decode", &ov::genai::Image2ImagePipeline::decode, py::arg("latent"));
+        .def("decode", &ov::genai::Image2ImagePipeline::decode, py::arg("latent"))
+        .def("get_performance_metrics", &ov::genai::Image2ImagePipeline::get_performance_metrics)
+        .def("set_text_encoder_cache_capacity", &ov::genai::Image2ImagePipeline::set_text_encoder_cache_capacity, py::arg("capacity"),
+             "Enables LRU cache of text encoder outputs for up to 'capacity' prompts per text encoder, 0 disables the cache.")
+        .def("get_text_encoder_cache_stats", &ov::genai::Image2ImagePipeline::get_text_encoder_cache_stats)
+        .def("get_resolution_bucket_stats", &ov::genai::Image2ImagePipeline::get_resolution_bucket_stats);
 
 
     auto inpainting_pipeline = py::class_<ov::genai::InpaintingPipeline>(m, "InpaintingPipeline", "This class is used for generation with inpainting models.")
@@ -389,7 +549,11 @@ void init_image_generation_pipelines(py::module_& m) {
         .def("get_generation_config", &ov::genai::InpaintingPipeline::get_generation_config)
         .def("set_generation_config", &ov::genai::InpaintingPipeline::set_generation_config, py::arg("generation_config"))
         .def("set_scheduler", &ov::genai::InpaintingPipeline::set_scheduler, py::arg("scheduler"))
-        .def("reshape", &ov::genai::InpaintingPipeline::reshape, py::arg("num_images_per_prompt"), py::arg("height"), py::arg("width"), py::arg("guidance_scale"))
+        .def("reshape", py::overload_cast<const int, const int, const int, const float>(&ov::genai::InpaintingPipeline::reshape),
+             py::arg("num_images_per_prompt"), py::arg("height"), py::arg("width"), py::arg("guidance_scale"))
+        .def("reshape", py::overload_cast<const int, const std::vector<std::pair<int, int>>&, const float, const bool>(&ov::genai::InpaintingPipeline::reshape),
+             py::arg("num_images_per_prompt"), py::arg("resolutions"), py::arg("guidance_scale"), py::arg("compile_lazily") = false,
+             "Reshapes models to several static resolutions given as (height, width) pairs, so requests with any of them run without recompilation.")
         .def_static("stable_diffusion", &ov::genai::InpaintingPipeline::stable_diffusion, py::arg("scheduler"), py::arg("clip_text_model"), py::arg("unet"), py::arg("vae"))
         .def_static("latent_consistency_model", &ov::genai::InpaintingPipeline::latent_consistency_model, py::arg("scheduler"), py::arg("clip_text_model"), py::arg("unet"), py::arg("vae"))
         .def_static("stable_diffusion_xl", &ov::genai::InpaintingPipeline::stable_diffusion_xl, py::arg("scheduler"), py::arg("clip_text_model"), py::arg("clip_text_model_with_projection"), py::arg("unet"), py::arg("vae"))
@@ -422,7 +586,12 @@ void init_image_generation_pipelines(py::module_& m) {
             py::arg("image"), "Initial image",
             py::arg("mask_image"), "Mask image",
             (text2image_generate_docstring + std::string(" \n ")).c_str())
-        .def("decode", &ov::genai::InpaintingPipeline::decode, py::arg("latent"));
+        .def("decode", &ov::genai::InpaintingPipeline::decode, py::arg("latent"))
+        .def("get_performance_metrics", &ov::genai::InpaintingPipeline::get_performance_metrics)
+        .def("set_text_encoder_cache_capacity", &ov::genai::InpaintingPipeline::set_text_encoder_cache_capacity, py::arg("capacity"),
+             "Enables LRU cache of text encoder outputs for up to 'capacity' prompts per text encoder, 0 disables the cache.")
+        .def("get_text_encoder_cache_stats", &ov::genai::InpaintingPipeline::get_text_encoder_cache_stats)
+        .def("get_resolution_bucket_stats", &ov::genai::InpaintingPipeline::get_resolution_bucket_stats);
 
     // define constructors to create one pipeline from another
     // NOTE: needs to be defined once all pipelines are created
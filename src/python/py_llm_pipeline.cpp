@@ -18,6 +18,7 @@ namespace pyutils = ov::genai::pybind::utils;
 
 using ov::genai::OptionalGenerationConfig;
 using ov::genai::LLMPipeline;
+using ov::genai::ChatSession;
 using ov::genai::TokenizedInputs;
 using ov::genai::EncodedInputs;
 using ov::genai::StreamerVariant;
@@ -95,6 +96,19 @@ py::object call_common_generate(
 extern char generation_config_docstring[];
 
 void init_llm_pipeline(py::module_& m) {
+    py::class_<ChatSession>(m, "ChatSession", R"(
+        Chat detached from LLMPipeline by LLMPipeline.suspend_chat(): chat history and KV cache of the model saved
+        in host memory or in a file. LLMPipeline.resume_chat() restores the KV cache instead of processing the chat history again,
+        so one pipeline can serve chats of many users. Copies of a session share its state.
+    )")
+        .def("get_kv_cache_length", &ChatSession::get_kv_cache_length, "Number of tokens in the saved KV cache.")
+        .def("get_memory_size", &ChatSession::get_memory_size, "Size of the saved KV cache in host memory in bytes, 0 if the session is offloaded.")
+        .def("offload", &ChatSession::offload, py::arg("path"), R"(
+            Moves the saved KV cache to a file and releases its host memory. The file is read when the session is resumed,
+            the session stays offloaded, so it can be resumed again. The file must be kept while the session is in use.
+        )")
+        .def("is_offloaded", &ChatSession::is_offloaded);
+
     py::class_<LLMPipeline>(m, "LLMPipeline", "This class is used for generation with LLMs")
         // init(model_path, tokenizer, device, config, kwargs) should be defined before init(model_path, device, config, kwargs) 
         // to prevent tokenizer treated as kwargs argument
@@ -192,6 +206,15 @@ void init_llm_pipeline(py::module_& m) {
         .def("get_tokenizer", &LLMPipeline::get_tokenizer)
         .def("start_chat", &LLMPipeline::start_chat, py::arg("system_message") = "")
         .def("finish_chat", &LLMPipeline::finish_chat)
+        .def("suspend_chat", &LLMPipeline::suspend_chat, R"(
+            Detaches the current chat from the pipeline: its history and KV cache are copied to a ChatSession,
+            and the pipeline is left without a chat as after finish_chat(). Supported only by pipelines with stateful models.
+        )")
+        .def("resume_chat", &LLMPipeline::resume_chat, py::arg("session"), R"(
+            Finishes the current chat, if any, and continues the chat of the session from the point it was suspended at.
+            The KV cache of the session is restored instead of being computed from the chat history. The session keeps its state,
+            so resuming it again continues from the same point, e.g. to branch a chat.
+        )")
         .def("get_generation_config", &LLMPipeline::get_generation_config, py::return_value_policy::copy)
         .def("set_generation_config", &LLMPipeline::set_generation_config, py::arg("config"));
 
@@ -13,6 +13,15 @@
 namespace py = pybind11;
 
 void init_lora_adapter(py::module_& m) {
+    py::class_<ov::genai::AdapterLoadStats>(m, "AdapterLoadStats", "Loading statistics of LoRA adapter file.")
+        .def(py::init<>())
+        .def_readonly("load_duration", &ov::genai::AdapterLoadStats::load_duration, "Duration of mapping and parsing of the adapter file in milliseconds.")
+        .def_readonly("file_size", &ov::genai::AdapterLoadStats::file_size, "Size of the adapter file in bytes.")
+        .def_readonly("resident_size", &ov::genai::AdapterLoadStats::resident_size,
+                      "Number of bytes of the memory mapped file currently resident in physical memory, 0 if the OS doesn't allow to query it.")
+        .def_readonly("fusion_duration", &ov::genai::AdapterLoadStats::fusion_duration,
+                      "Total duration of fusing the adapter into model weights with MODE_FUSE in milliseconds, summed over all models the adapter was fused to.");
+
     py::class_<ov::genai::Adapter>(m, "Adapter", "Immutable LoRA Adapter that carries the adaptation matrices and serves as unique adapter identifier.")
         .def(py::init<>())
         .def(py::init([](
@@ -30,7 +39,8 @@ void init_lora_adapter(py::module_& m) {
             [](ov::genai::Adapter& self
             ) {
                 return bool(self);
-            });
+            })
+        .def("get_load_stats", &ov::genai::Adapter::get_load_stats);
 
     auto adapter_config = py::class_<ov::genai::AdapterConfig>(m, "AdapterConfig", "Adapter config that defines a combination of LoRA adapters with blending parameters.");
     py::enum_<ov::genai::AdapterConfig::Mode>(adapter_config, "Mode")
@@ -64,6 +64,12 @@ auto raw_perf_metrics_docstring = R"(
 
     :param prepare_embeddings_durations: Durations of embeddings preparation.
     :type prepare_embeddings_durations: List[MicroSeconds]
+
+    :param image_embedding_cache_hits: Number of images whose embeddings were taken from the image embedding cache.
+    :type image_embedding_cache_hits: int
+
+    :param image_embedding_cache_misses: Number of images encoded while the image embedding cache is enabled.
+    :type image_embedding_cache_misses: int
 )";
 
 auto perf_metrics_docstring = R"(
@@ -72,6 +78,9 @@ auto perf_metrics_docstring = R"(
     :param get_prepare_embeddings_duration: Returns mean and standard deviation of embeddings preparation duration in milliseconds
     :type get_prepare_embeddings_duration: MeanStdPair
 
+    :param get_image_embedding_cache_hit_rate: Returns share of images found in the image embedding cache
+    :type get_image_embedding_cache_hit_rate: float
+
     :param vlm_raw_metrics: VLM specific raw metrics
     :type VLMRawPerfMetrics:
 )";
@@ -105,11 +114,14 @@ void init_vlm_pipeline(py::module_& m) {
         .def(py::init<>())
         .def_property_readonly("prepare_embeddings_durations", [](const ov::genai::VLMRawPerfMetrics& rw) {
             return pyutils::get_ms(rw, &ov::genai::VLMRawPerfMetrics::prepare_embeddings_durations);
-        });
+        })
+        .def_readonly("image_embedding_cache_hits", &ov::genai::VLMRawPerfMetrics::image_embedding_cache_hits)
+        .def_readonly("image_embedding_cache_misses", &ov::genai::VLMRawPerfMetrics::image_embedding_cache_misses);
 
     py::class_<ov::genai::VLMPerfMetrics, ov::genai::PerfMetrics>(m, "VLMPerfMetrics", perf_metrics_docstring)
         .def(py::init<>())
         .def("get_prepare_embeddings_duration", &ov::genai::VLMPerfMetrics::get_prepare_embeddings_duration)
+        .def("get_image_embedding_cache_hit_rate", &ov::genai::VLMPerfMetrics::get_image_embedding_cache_hit_rate)
         .def_readonly("vlm_raw_metrics", &ov::genai::VLMPerfMetrics::vlm_raw_metrics);
 
     py::class_<ov::genai::VLMDecodedResults>(m, "VLMDecodedResults", decoded_results_docstring)
@@ -154,6 +166,8 @@ void init_vlm_pipeline(py::module_& m) {
         .def("get_tokenizer", &ov::genai::VLMPipeline::get_tokenizer)
         .def("get_generation_config", &ov::genai::VLMPipeline::get_generation_config)
         .def("set_generation_config", &ov::genai::VLMPipeline::set_generation_config, py::arg("new_config"))
+        .def("set_image_embedding_cache_capacity", &ov::genai::VLMPipeline::set_image_embedding_cache_capacity, py::arg("capacity"),
+            "Keeps embeddings of up to capacity most recently used images, so repeated images aren't encoded again. 0 disables the cache.")
         .def(
             "generate",
             [](ov::genai::VLMPipeline& pipe,
@@ -8,6 +8,7 @@
 #include <pybind11/stl_bind.h>
 
 #include "openvino/genai/perf_metrics.hpp"
+#include "openvino/genai/whisper_continuous_batching_pipeline.hpp"
 #include "openvino/genai/whisper_generation_config.hpp"
 #include "openvino/genai/whisper_pipeline.hpp"
 #include "py_utils.hpp"
@@ -23,12 +24,15 @@ using ov::genai::RawSpeechInput;
 using ov::genai::StreamerBase;
 using ov::genai::StreamerVariant;
 using ov::genai::Tokenizer;
+using ov::genai::SchedulerConfig;
+using ov::genai::WhisperContinuousBatchingPipeline;
 using ov::genai::WhisperDecodedResultChunk;
 using ov::genai::WhisperDecodedResults;
 using ov::genai::WhisperGenerationConfig;
 using ov::genai::WhisperPerfMetrics;
 using ov::genai::WhisperPipeline;
 using ov::genai::WhisperRawPerfMetrics;
+using ov::genai::WhisperStreamingResult;
 using PyBindChunkStreamerVariant =
     std::variant<std::function<bool(py::str)>, std::shared_ptr<ChunkStreamerBase>, std::monostate>;
 
@@ -74,6 +78,36 @@ auto whisper_decoded_result_chunk = R"(
     :param text     chunk text
 )";
 
+auto whisper_streaming_result_docstring = R"(
+    Result of a live transcription step.
+
+    Parameters:
+    final_chunks:  chunks which will not change anymore, timestamps are relative to the beginning of the stream.
+    partial_text:  transcription of the not finalized end of the stream, can be revised by the next steps.
+    perf_metrics:  performance metrics of the step.
+)";
+
+auto start_stream_docstring = R"(
+    Starts live transcription of an audio stream. Audio is passed by parts with push_audio(). Transcription
+    of a sliding window of up to 30 seconds is recomputed each time `step` seconds of new audio are received.
+
+    :param generation_config: generation_config
+    :type generation_config: WhisperGenerationConfig
+
+    :param step: transcription step in seconds
+    :type step: float
+)";
+
+auto push_audio_docstring = R"(
+    Appends audio to the live transcription started with start_stream().
+
+    :param audio_frames: inputs in the form of list of floats. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+    :type audio_frames: List[float]
+
+    :return: chunks finalized by the step and current partial text
+    :rtype: WhisperStreamingResult
+)";
+
 auto whisper_generation_config_docstring = R"(
     WhisperGenerationConfig
     :param max_length: the maximum length the generated tokens can have. Corresponds to the length of the input prompt +
@@ -156,6 +190,12 @@ auto whisper_generation_config_docstring = R"(
       auto result = pipeline.generate(raw_speech, ov::genai::hotwords("Polychrome"));
       //  He has gone and gone for good answered Polychrome who...
     :type hotwords: Optional[str]
+
+    :param chunks_batch_size: Number of 30 seconds chunks of long-form audio encoded by one encoder inference and decoded together as a batch.
+                              With the default value 1 chunks are processed one by one and every next chunk starts right after the last timestamp
+                              predicted for the previous chunk. Values greater than 1 split audio into fixed 30 seconds chunks for a better throughput
+                              of offline transcription, timestamps are predicted only if `return_timestamps` is set.
+    :type chunks_batch_size: int
 )";
 
 auto streamer_base_docstring = R"(
@@ -167,6 +207,12 @@ auto raw_perf_metrics_docstring = R"(
 
     :param features_extraction_durations: Duration for each features extraction call.
     :type features_extraction_durations: List[MicroSeconds]
+
+    :param encode_inference_durations: Duration for each encoder inference call.
+    :type encode_inference_durations: List[MicroSeconds]
+
+    :param decode_durations: Duration of greedy decoding for each batch of encoded chunks.
+    :type decode_durations: List[MicroSeconds]
 )";
 
 auto perf_metrics_docstring = R"(
@@ -175,6 +221,12 @@ auto perf_metrics_docstring = R"(
     :param get_features_extraction_duration: Returns mean and standard deviation of features extraction duration in milliseconds
     :type get_features_extraction_duration: MeanStdPair
 
+    :param get_encode_inference_duration: Returns mean and standard deviation of encoder inference duration in milliseconds
+    :type get_encode_inference_duration: MeanStdPair
+
+    :param get_decode_duration: Returns mean and standard deviation of decoding duration of a batch of chunks in milliseconds
+    :type get_decode_duration: MeanStdPair
+
     :param whisper_raw_metrics: Whisper specific raw metrics
     :type WhisperRawPerfMetrics:
 )";
@@ -295,17 +347,26 @@ void init_whisper_pipeline(py::module_& m) {
         .def_readwrite("return_timestamps", &WhisperGenerationConfig::return_timestamps)
         .def_readwrite("initial_prompt", &WhisperGenerationConfig::initial_prompt)
         .def_readwrite("hotwords", &WhisperGenerationConfig::hotwords)
+        .def_readwrite("chunks_batch_size", &WhisperGenerationConfig::chunks_batch_size)
         .def("set_eos_token_id", &WhisperGenerationConfig::set_eos_token_id, py::arg("tokenizer_eos_token_id"));
 
     py::class_<WhisperRawPerfMetrics>(m, "WhisperRawPerfMetrics", raw_perf_metrics_docstring)
         .def(py::init<>())
         .def_property_readonly("features_extraction_durations", [](const WhisperRawPerfMetrics& rw) {
             return pyutils::get_ms(rw, &WhisperRawPerfMetrics::features_extraction_durations);
+        })
+        .def_property_readonly("encode_inference_durations", [](const WhisperRawPerfMetrics& rw) {
+            return pyutils::get_ms(rw, &WhisperRawPerfMetrics::encode_inference_durations);
+        })
+        .def_property_readonly("decode_durations", [](const WhisperRawPerfMetrics& rw) {
+            return pyutils::get_ms(rw, &WhisperRawPerfMetrics::decode_durations);
         });
 
     py::class_<WhisperPerfMetrics, PerfMetrics>(m, "WhisperPerfMetrics", perf_metrics_docstring)
         .def(py::init<>())
         .def("get_features_extraction_duration", &WhisperPerfMetrics::get_features_extraction_duration)
+        .def("get_encode_inference_duration", &WhisperPerfMetrics::get_encode_inference_duration)
+        .def("get_decode_duration", &WhisperPerfMetrics::get_decode_duration)
         .def_readonly("whisper_raw_metrics", &WhisperPerfMetrics::whisper_raw_metrics);
 
     py::class_<WhisperDecodedResultChunk>(m, "WhisperDecodedResultChunk", whisper_decoded_result_chunk)
@@ -338,6 +399,14 @@ void init_whisper_pipeline(py::module_& m) {
             return res;
         });
 
+    py::class_<WhisperStreamingResult>(m, "WhisperStreamingResult", whisper_streaming_result_docstring)
+        .def_readonly("final_chunks", &WhisperStreamingResult::final_chunks)
+        .def_property_readonly("partial_text",
+                               [](const WhisperStreamingResult& result) {
+                                   return pyutils::handle_utf8(result.partial_text);
+                               })
+        .def_readonly("perf_metrics", &WhisperStreamingResult::perf_metrics);
+
     py::class_<WhisperPipeline>(m, "WhisperPipeline", "Automatic speech recognition pipeline")
         .def(
             py::init([](const std::filesystem::path& models_path, const std::string& device, const py::kwargs& kwargs) {
@@ -373,7 +442,50 @@ void init_whisper_pipeline(py::module_& m) {
             "streamer",
             (whisper_generate_docstring + std::string(" \n ") + whisper_generation_config_docstring).c_str())
 
+        .def("start_stream",
+             &WhisperPipeline::start_stream,
+             py::arg("generation_config") = std::nullopt,
+             py::arg("step") = 1.0f,
+             start_stream_docstring)
+        .def("push_audio", &WhisperPipeline::push_audio, py::arg("audio_frames"), push_audio_docstring)
+        .def("finish_stream",
+             &WhisperPipeline::finish_stream,
+             "Transcribes the rest of the audio stream and finishes live transcription.")
+
         .def("get_tokenizer", &WhisperPipeline::get_tokenizer)
         .def("get_generation_config", &WhisperPipeline::get_generation_config, py::return_value_policy::copy)
         .def("set_generation_config", &WhisperPipeline::set_generation_config, py::arg("config"));
+
+    py::class_<WhisperContinuousBatchingPipeline>(
+        m,
+        "WhisperContinuousBatchingPipeline",
+        "Automatic speech recognition pipeline which serves many transcription requests at once")
+        .def(py::init([](const std::filesystem::path& models_path,
+                         const SchedulerConfig& scheduler_config,
+                         const std::string& device,
+                         const std::map<std::string, py::object>& plugin_config) {
+                 ScopedVar env_manager(pyutils::ov_tokenizers_module_path());
+                 return std::make_unique<WhisperContinuousBatchingPipeline>(models_path,
+                                                                            scheduler_config,
+                                                                            device,
+                                                                            pyutils::properties_to_any_map(plugin_config));
+             }),
+             py::arg("models_path"),
+             py::arg("scheduler_config"),
+             py::arg("device"),
+             py::arg("properties") = ov::AnyMap({}))
+        .def("get_tokenizer", &WhisperContinuousBatchingPipeline::get_tokenizer)
+        .def("get_generation_config", &WhisperContinuousBatchingPipeline::get_generation_config)
+        .def("get_metrics", &WhisperContinuousBatchingPipeline::get_metrics)
+        .def("add_request",
+             &WhisperContinuousBatchingPipeline::add_request,
+             py::arg("request_id"),
+             py::arg("raw_speech_input"),
+             py::arg("generation_config"))
+        .def("step", &WhisperContinuousBatchingPipeline::step)
+        .def("has_non_finished_requests", &WhisperContinuousBatchingPipeline::has_non_finished_requests)
+        .def("generate",
+             &WhisperContinuousBatchingPipeline::generate,
+             py::arg("raw_speech_inputs"),
+             py::arg("generation_configs"));
 }
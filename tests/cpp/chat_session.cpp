@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+#include "chat_session.hpp"
+
+using ov::genai::KVCacheSnapshot;
+
+namespace {
+
+ov::Tensor make_state(float first_value, size_t seq_len) {
+    // [BATCH_SIZE, num_kv_heads, seq_len, head_size]
+    ov::Tensor tensor(ov::element::f32, {1, 2, seq_len, 4});
+    std::iota(tensor.data<float>(), tensor.data<float>() + tensor.get_size(), first_value);
+    return tensor;
+}
+
+KVCacheSnapshot make_snapshot(size_t seq_len) {
+    ov::Tensor attention_mask(ov::element::i64, {1, seq_len});
+    std::fill_n(attention_mask.data<int64_t>(), seq_len, 1);
+    return KVCacheSnapshot({{"past_key_values.0.key", make_state(0.0f, seq_len)},
+                            {"past_key_values.0.value", make_state(100.0f, seq_len)}},
+                           attention_mask);
+}
+
+}  // namespace
+
+TEST(TestKVCacheSnapshot, empty_snapshot) {
+    KVCacheSnapshot snapshot;
+    EXPECT_EQ(snapshot.get_length(), 0);
+    EXPECT_EQ(snapshot.get_byte_size(), 0);
+    EXPECT_FALSE(snapshot.is_offloaded());
+    EXPECT_TRUE(snapshot.get_states().empty());
+}
+
+TEST(TestKVCacheSnapshot, keeps_states_in_memory) {
+    KVCacheSnapshot snapshot = make_snapshot(3);
+    EXPECT_EQ(snapshot.get_length(), 3);
+    EXPECT_EQ(snapshot.get_byte_size(), 2 * 1 * 2 * 3 * 4 * sizeof(float));
+
+    auto states = snapshot.get_states();
+    ASSERT_EQ(states.size(), 2);
+    EXPECT_EQ(states[0].first, "past_key_values.0.key");
+    EXPECT_EQ(states[1].second.data<float>()[0], 100.0f);
+}
+
+TEST(TestKVCacheSnapshot, offloads_states_to_file) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "genai_kv_cache_snapshot.bin";
+    KVCacheSnapshot snapshot = make_snapshot(5);
+    const size_t byte_size = snapshot.get_byte_size();
+
+    snapshot.offload(path);
+    EXPECT_TRUE(snapshot.is_offloaded());
+    EXPECT_EQ(snapshot.get_byte_size(), 0);
+    EXPECT_EQ(snapshot.get_length(), 5);
+    EXPECT_EQ(std::filesystem::file_size(path), byte_size);
+
+    // states are read back on every access, the snapshot stays offloaded
+    for (size_t i = 0; i < 2; ++i) {
+        auto states = snapshot.get_states();
+        ASSERT_EQ(states.size(), 2);
+        EXPECT_EQ(states[1].first, "past_key_values.0.value");
+        ASSERT_EQ(states[1].second.get_shape(), ov::Shape({1, 2, 5, 4}));
+        const float* data = states[1].second.data<float>();
+        for (size_t j = 0; j < states[1].second.get_size(); ++j)
+            ASSERT_EQ(data[j], 100.0f + j);
+    }
+    EXPECT_TRUE(snapshot.is_offloaded());
+    std::filesystem::remove(path);
+    EXPECT_THROW(snapshot.get_states(), ov::Exception);
+}
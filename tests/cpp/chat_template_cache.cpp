@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "chat_template_cache.hpp"
+
+namespace {
+
+const std::string chat_template = "{% for message in messages %}<{{ message['role'] }}>{{ message['content'] }}{% endfor %}";
+
+jinja2::ValuesMap make_params(const std::string& content) {
+    jinja2::ValuesMap message = {{"role", "user"}, {"content", content}};
+    return {{"messages", jinja2::ValuesList{message}}};
+}
+
+}  // namespace
+
+TEST(TestChatTemplateCache, parses_template_once) {
+    ov::genai::ChatTemplateCache cache;
+    EXPECT_EQ(cache.render(chat_template, make_params("hi")), "<user>hi");
+    EXPECT_EQ(cache.render(chat_template, make_params("bye")), "<user>bye");
+    EXPECT_EQ(cache.get_size(), 1);
+    EXPECT_EQ(cache.get_num_parsed(), 1);
+}
+
+TEST(TestChatTemplateCache, evicts_least_recently_used_template) {
+    ov::genai::ChatTemplateCache cache(2);
+    const std::string other_template = "[" + chat_template + "]", another_template = "(" + chat_template + ")";
+    cache.render(chat_template, make_params("a"));
+    cache.render(other_template, make_params("b"));
+    cache.render(chat_template, make_params("c"));
+    EXPECT_EQ(cache.render(another_template, make_params("d")), "(<user>d)");
+    EXPECT_EQ(cache.get_size(), 2);
+    EXPECT_EQ(cache.get_num_parsed(), 3);
+
+    // other_template was evicted, chat_template stayed
+    cache.render(chat_template, make_params("e"));
+    EXPECT_EQ(cache.get_num_parsed(), 3);
+    cache.render(other_template, make_params("f"));
+    EXPECT_EQ(cache.get_num_parsed(), 4);
+}
+
+TEST(TestChatTemplateCache, renders_from_several_threads) {
+    ov::genai::ChatTemplateCache cache;
+    const size_t num_threads = 4, num_renders = 100;
+    std::vector<size_t> num_errors(num_threads, 0);
+    std::vector<std::thread> threads;
+    for (size_t thread_id = 0; thread_id < num_threads; ++thread_id) {
+        threads.emplace_back([&, thread_id] {
+            for (size_t i = 0; i < num_renders; ++i) {
+                const std::string content = std::to_string(thread_id) + "_" + std::to_string(i);
+                if (cache.render(chat_template, make_params(content)) != "<user>" + content)
+                    ++num_errors[thread_id];
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (size_t errors : num_errors)
+        EXPECT_EQ(errors, 0);
+    // at most one copy per thread rendering at the same time
+    EXPECT_LE(cache.get_num_parsed(), num_threads);
+}
+
+TEST(TestChatTemplateCache, throws_on_invalid_template) {
+    ov::genai::ChatTemplateCache cache;
+    EXPECT_THROW(cache.render("{% for message in messages %}", make_params("hi")), std::exception);
+}
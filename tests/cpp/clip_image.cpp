@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+#include "visual_language/clip.hpp"
+
+namespace {
+
+clip_image_u8 make_image(int width, int height) {
+    clip_image_u8 image{width, height, std::vector<uint8_t>(3 * width * height)};
+    for (size_t i = 0; i < image.buf.size(); ++i)
+        image.buf[i] = static_cast<uint8_t>((i * 37 + i / 97) % 256);
+    return image;
+}
+
+// per pixel cubic interpolation of ViT.cpp: rows are interpolated along x first, then the results along y
+uint8_t reference_bicubic_pixel(const clip_image_u8& img, int target_width, int target_height, int i, int j, int k) {
+    auto at = [&](int y, int x) {
+        return static_cast<float>(img.buf[(std::clamp(y, 0, img.ny - 1) * img.nx + std::clamp(x, 0, img.nx - 1)) * 3 + k]);
+    };
+    auto cubic = [](float p0, float p1, float p2, float p3, float t) {
+        const float d0 = p0 - p1, d2 = p2 - p1, d3 = p3 - p1;
+        const float a1 = -1.0 / 3 * d0 + d2 - 1.0 / 6 * d3;
+        const float a2 = 1.0 / 2 * d0 + 1.0 / 2 * d2;
+        const float a3 = -1.0 / 6 * d0 - 1.0 / 2 * d2 + 1.0 / 6 * d3;
+        return p1 + a1 * t + a2 * t * t + a3 * t * t * t;
+    };
+    const float tx = (float)img.nx / target_width, ty = (float)img.ny / target_height;
+    const int x = (int)(tx * j), y = (int)(ty * i);
+    const float dx = tx * j - x, dy = ty * i - y;
+    float column[4];
+    for (int jj = 0; jj < 4; ++jj)
+        column[jj] = cubic(at(y - 1 + jj, x - 1), at(y - 1 + jj, x), at(y - 1 + jj, x + 1), at(y - 1 + jj, x + 2), dx);
+    return static_cast<uint8_t>(std::min(std::max(std::round(cubic(column[0], column[1], column[2], column[3], dy)), 0.0f), 255.0f));
+}
+
+}  // namespace
+
+TEST(TestClipImage, bicubic_resize_matches_per_pixel_interpolation) {
+    for (auto [width, height, target_width, target_height] : {std::array<int, 4>{37, 23, 64, 41}, {640, 480, 448, 336}, {200, 90, 56, 84}}) {
+        clip_image_u8 image = make_image(width, height), resized;
+        bicubic_resize(image, resized, target_width, target_height);
+        ASSERT_EQ(resized.nx, target_width);
+        ASSERT_EQ(resized.ny, target_height);
+
+        for (int i = 0; i < target_height; ++i) {
+            for (int j = 0; j < target_width; ++j) {
+                for (int k = 0; k < 3; ++k) {
+                    // separable weights round differently from the per pixel formula
+                    ASSERT_NEAR(resized.buf[(i * target_width + j) * 3 + k], reference_bicubic_pixel(image, target_width, target_height, i, j, k), 1)
+                        << "pixel " << i << ", " << j << ", channel " << k;
+                }
+            }
+        }
+    }
+}
+
+TEST(TestClipImage, bicubic_resize_keeps_constant_image) {
+    clip_image_u8 image{50, 30, std::vector<uint8_t>(3 * 50 * 30)};
+    for (size_t i = 0; i < image.buf.size(); ++i)
+        image.buf[i] = static_cast<uint8_t>(10 + 100 * (i % 3));
+
+    clip_image_u8 resized;
+    bicubic_resize(image, resized, 71, 19);
+    for (size_t i = 0; i < resized.buf.size(); ++i)
+        ASSERT_EQ(resized.buf[i], 10 + 100 * (i % 3));
+
+    clip_image_u8 same;
+    bicubic_resize(image, same, 50, 30);
+    EXPECT_EQ(same.buf, image.buf);
+}
+
+TEST(TestClipImage, preprocess_normalizes_to_planar_layout) {
+    clip_ctx ctx;
+    ctx.image_mean[0] = 0.5f;
+    ctx.image_std[2] = 0.25f;
+    clip_image_u8 image = make_image(13, 7);
+
+    clip_image_f32 preprocessed = clip_image_preprocess(ctx, image);
+    ASSERT_EQ(preprocessed.nx, 13);
+    ASSERT_EQ(preprocessed.ny, 7);
+    for (int y = 0; y < 7; ++y) {
+        for (int x = 0; x < 13; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                const float expected = ((float(image.buf[3 * (y * 13 + x) + c]) / 255.0f) - ctx.image_mean[c]) / ctx.image_std[c];
+                EXPECT_EQ(preprocessed.buf[(c * 7 + y) * 13 + x], expected);
+            }
+        }
+    }
+}
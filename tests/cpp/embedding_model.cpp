@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/subtract.hpp"
+
+#include "visual_language/embedding_model.hpp"
+
+namespace {
+
+const size_t vocab_size = 5, hidden_size = 3;
+
+std::shared_ptr<ov::Model> make_lookup_model(const ov::Output<ov::Node>& weights) {
+    auto ids = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::PartialShape{-1, -1});
+    auto axis = ov::op::v0::Constant::create(ov::element::i64, {}, {0});
+    auto gather = std::make_shared<ov::op::v8::Gather>(weights, ids, axis);
+    auto embeds = std::make_shared<ov::op::v0::Convert>(gather, ov::element::f32);
+    return std::make_shared<ov::Model>(ov::OutputVector{embeds}, ov::ParameterVector{ids});
+}
+
+ov::Tensor make_ids(std::vector<int64_t> ids) {
+    ov::Tensor tensor(ov::element::i64, {1, ids.size()});
+    std::copy(ids.begin(), ids.end(), tensor.data<int64_t>());
+    return tensor;
+}
+
+}  // namespace
+
+TEST(TestEmbeddingsModel, gathers_scaled_rows_of_f16_weights) {
+    std::vector<float> weights(vocab_size * hidden_size);
+    for (size_t i = 0; i < weights.size(); ++i)
+        weights[i] = static_cast<float>(i) - 4.0f;
+    auto weights_f16 = ov::op::v0::Constant::create(ov::element::f16, {vocab_size, hidden_size}, weights);
+    auto decompressed = std::make_shared<ov::op::v0::Convert>(weights_f16, ov::element::f32);
+
+    // no model is compiled for a lookup, so a device isn't used
+    ov::genai::EmbeddingsModel embedding(make_lookup_model(decompressed), 2.0f, "NONEXISTENT", {});
+    ov::Tensor embeds = embedding.infer(make_ids({4, 0, 2}));
+
+    ASSERT_EQ(embeds.get_shape(), ov::Shape({1, 3, hidden_size}));
+    const float* data = embeds.data<const float>();
+    const std::vector<size_t> ids = {4, 0, 2};
+    for (size_t i = 0; i < ids.size(); ++i)
+        for (size_t j = 0; j < hidden_size; ++j)
+            EXPECT_FLOAT_EQ(data[i * hidden_size + j], 2.0f * weights[ids[i] * hidden_size + j]);
+}
+
+TEST(TestEmbeddingsModel, gathers_decompressed_rows_of_int8_weights) {
+    std::vector<uint8_t> weights(vocab_size * hidden_size);
+    for (size_t i = 0; i < weights.size(); ++i)
+        weights[i] = static_cast<uint8_t>(10 * i);
+    std::vector<float> zero_points = {1, 2, 3, 4, 5}, scales = {0.5f, 0.25f, 1.0f, 2.0f, 4.0f};
+
+    auto weights_u8 = ov::op::v0::Constant::create(ov::element::u8, {vocab_size, hidden_size}, weights);
+    auto zero_points_u8 = ov::op::v0::Constant::create(ov::element::u8, {vocab_size, 1}, zero_points);
+    auto scales_f16 = ov::op::v0::Constant::create(ov::element::f16, {vocab_size, 1}, scales);
+    auto subtract = std::make_shared<ov::op::v1::Subtract>(std::make_shared<ov::op::v0::Convert>(weights_u8, ov::element::f16),
+                                                           std::make_shared<ov::op::v0::Convert>(zero_points_u8, ov::element::f16));
+    auto multiply = std::make_shared<ov::op::v1::Multiply>(subtract, scales_f16);
+
+    ov::genai::EmbeddingsModel embedding(make_lookup_model(multiply), 1.0f, "NONEXISTENT", {});
+    // a clone shares the weights
+    ov::Tensor embeds = embedding.clone().infer(make_ids({1, 3}));
+
+    ASSERT_EQ(embeds.get_shape(), ov::Shape({1, 2, hidden_size}));
+    const float* data = embeds.data<const float>();
+    const std::vector<size_t> ids = {1, 3};
+    for (size_t i = 0; i < ids.size(); ++i)
+        for (size_t j = 0; j < hidden_size; ++j)
+            EXPECT_FLOAT_EQ(data[i * hidden_size + j], (weights[ids[i] * hidden_size + j] - zero_points[ids[i]]) * scales[ids[i]]);
+}
+
+TEST(TestEmbeddingsModel, rejects_out_of_vocabulary_ids) {
+    auto weights = ov::op::v0::Constant::create(ov::element::f32, {vocab_size, hidden_size}, std::vector<float>(vocab_size * hidden_size, 1.0f));
+    ov::genai::EmbeddingsModel embedding(make_lookup_model(weights), 1.0f, "NONEXISTENT", {});
+    EXPECT_THROW(embedding.infer(make_ids({0, static_cast<int64_t>(vocab_size)})), ov::Exception);
+}
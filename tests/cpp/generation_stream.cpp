@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "generation_stream.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+GenerationOutputs make_outputs(int64_t token) {
+    GenerationOutput output;
+    output.generated_ids = {token};
+    output.generated_log_probs = {0.0f};
+    return {{0, output}};
+}
+
+}  // namespace
+
+TEST(TestGenerationStream, read_async_waits_for_next_outputs) {
+    auto stream = GenerationStream::create();
+    stream->push(make_outputs(1));
+    EXPECT_EQ(stream->read_async().get().at(0).generated_ids[0], 1);
+
+    auto future = stream->read_async();
+    EXPECT_EQ(future.wait_for(std::chrono::milliseconds(0)), std::future_status::timeout);
+    std::thread producer([&] { stream->push(make_outputs(2)); });
+    EXPECT_EQ(future.get().at(0).generated_ids[0], 2);
+    producer.join();
+    EXPECT_FALSE(stream->can_read());
+}
+
+TEST(TestGenerationStream, close_passes_empty_outputs_to_awaiting_futures) {
+    auto stream = GenerationStream::create();
+    auto future = stream->read_async();
+    stream->close();
+    EXPECT_TRUE(future.get().empty());
+    EXPECT_TRUE(stream->read_async().get().empty());
+    // pull based reading isn't affected
+    EXPECT_FALSE(stream->can_read());
+}
+
+TEST(TestGenerationStream, callback_gets_queued_and_next_outputs_and_single_end) {
+    auto stream = GenerationStream::create();
+    stream->push(make_outputs(1));
+
+    std::vector<GenerationOutputs> received;
+    stream->set_callback([&](GenerationOutputs outputs) { received.push_back(std::move(outputs)); });
+    stream->push(make_outputs(2));
+    // a request dropped by a handle pushes empty outputs before it leaves a pipeline
+    stream->push({});
+    stream->close();
+
+    ASSERT_EQ(received.size(), 3);
+    EXPECT_EQ(received[0].at(0).generated_ids[0], 1);
+    EXPECT_EQ(received[1].at(0).generated_ids[0], 2);
+    EXPECT_TRUE(received[2].empty());
+    EXPECT_FALSE(stream->can_read());
+}
+
+TEST(TestGenerationStream, callback_set_after_close_gets_end) {
+    auto stream = GenerationStream::create();
+    stream->push(make_outputs(1));
+    stream->close();
+
+    size_t num_outputs = 0, num_ends = 0;
+    stream->set_callback([&](GenerationOutputs outputs) { outputs.empty() ? ++num_ends : ++num_outputs; });
+    EXPECT_EQ(num_outputs, 1);
+    EXPECT_EQ(num_ends, 1);
+}
+
+TEST(TestGenerationStream, fail_wakes_blocked_readers_with_error) {
+    auto stream = GenerationStream::create();
+    auto future = stream->read_async();
+    std::exception_ptr error = std::make_exception_ptr(std::runtime_error("step failed"));
+    std::thread pipeline([&] { stream->fail(error); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+    pipeline.join();
+    EXPECT_EQ(stream->get_status(), GenerationStatus::DROPPED_BY_PIPELINE);
+    EXPECT_THROW(stream->read_async().get(), std::runtime_error);
+}
+
+TEST(TestGenerationStream, fail_wakes_blocked_read_with_error) {
+    auto stream = GenerationStream::create();
+    stream->push(make_outputs(1));
+    std::thread pipeline([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        stream->fail(std::make_exception_ptr(std::runtime_error("step failed")));
+    });
+    EXPECT_EQ(stream->read().at(0).generated_ids[0], 1);
+    EXPECT_THROW(stream->read(), std::runtime_error);
+    pipeline.join();
+}
+
+TEST(TestGenerationStream, fail_passes_single_end_to_callback) {
+    auto stream = GenerationStream::create();
+    size_t num_ends = 0;
+    stream->set_callback([&](GenerationOutputs outputs) { EXPECT_TRUE(outputs.empty()); ++num_ends; });
+    stream->fail(std::make_exception_ptr(std::runtime_error("step failed")));
+    EXPECT_EQ(num_ends, 1);
+}
+
+TEST(TestGenerationStream, outputs_pushed_concurrently_are_read_in_order) {
+    const int64_t num_tokens = 10000;
+    for (bool use_futures : {false, true}) {
+        auto stream = GenerationStream::create();
+        std::thread producer([&] {
+            for (int64_t token = 0; token < num_tokens; ++token)
+                stream->push(make_outputs(token));
+            stream->close();
+        });
+        for (int64_t token = 0; token < num_tokens; ++token) {
+            GenerationOutputs outputs = use_futures ? stream->read_async().get() : stream->read();
+            ASSERT_EQ(outputs.at(0).generated_ids[0], token);
+        }
+        producer.join();
+        if (use_futures)
+            EXPECT_TRUE(stream->read_async().get().empty());
+    }
+}
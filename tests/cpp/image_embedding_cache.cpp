@@ -0,0 +1,144 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "visual_language/image_embedding_cache.hpp"
+
+using ov::genai::ImageEmbeddingCache;
+
+namespace {
+
+ov::Tensor make_image(size_t height, size_t width, uint8_t seed) {
+    ov::Tensor image(ov::element::u8, {1, height, width, 3});
+    for (size_t i = 0; i < image.get_size(); ++i)
+        image.data<uint8_t>()[i] = static_cast<uint8_t>(seed + i * 7);
+    return image;
+}
+
+// fake encoder which fills embeddings with the number of calls, so it's visible which call produced an entry
+struct FakeEncoder {
+    size_t calls = 0;
+    ov::Tensor output{ov::element::f32, {1, 4, 2}};
+
+    ImageEmbeddingCache::Entry operator()() {
+        ++calls;
+        // mimics an infer request which overwrites its output tensor
+        std::fill_n(output.data<float>(), output.get_size(), static_cast<float>(calls));
+        ImageEmbeddingCache::Entry entry;
+        entry.encoded_image.resized_source = output;
+        entry.resampled = {output, output};
+        return entry;
+    }
+};
+
+}  // namespace
+
+TEST(TestImageEmbeddingCache, key_depends_on_content_and_preprocessing) {
+    ov::genai::ProcessorConfig config;
+    const auto key = ov::genai::get_image_embedding_key(make_image(8, 8, 1), config);
+
+    EXPECT_EQ(ov::genai::get_image_embedding_key(make_image(8, 8, 1), config), key);
+    EXPECT_NE(ov::genai::get_image_embedding_key(make_image(8, 8, 2), config), key);
+    // the same bytes in another shape
+    EXPECT_NE(ov::genai::get_image_embedding_key(make_image(4, 16, 1), config), key);
+
+    ov::genai::ProcessorConfig other_config = config;
+    other_config.norm_mean[1] = 0.5f;
+    EXPECT_NE(ov::genai::get_image_embedding_key(make_image(8, 8, 1), other_config), key);
+}
+
+TEST(TestImageEmbeddingCache, key_of_large_image_covers_all_blocks) {
+    // larger than a hash block, so the last byte is hashed by another thread
+    ov::Tensor image = make_image(1024, 1024, 3);
+    ov::genai::ProcessorConfig config;
+    const auto key = ov::genai::get_image_embedding_key(image, config);
+
+    image.data<uint8_t>()[image.get_size() - 1] ^= 1;
+    EXPECT_NE(ov::genai::get_image_embedding_key(image, config), key);
+}
+
+TEST(TestImageEmbeddingCache, disabled_cache_always_encodes) {
+    ImageEmbeddingCache cache;
+    FakeEncoder encoder;
+    auto encode = [&]() { return encoder(); };
+
+    bool hit = true;
+    cache.encode({1, 1}, make_image(2, 2, 1), encode, hit);
+    EXPECT_FALSE(hit);
+    cache.encode({1, 1}, make_image(2, 2, 1), encode, hit);
+    EXPECT_FALSE(hit);
+
+    EXPECT_EQ(encoder.calls, 2);
+    EXPECT_EQ(cache.get_size(), 0);
+}
+
+TEST(TestImageEmbeddingCache, repeated_image_is_not_encoded_again) {
+    ImageEmbeddingCache cache(2);
+    FakeEncoder encoder;
+    auto encode = [&]() { return encoder(); };
+
+    bool hit = true;
+    auto first = cache.encode({1, 1}, make_image(2, 2, 1), encode, hit);
+    EXPECT_FALSE(hit);
+    // overwrites the encoder output, a cached entry must own a copy
+    cache.encode({2, 1}, make_image(2, 2, 2), encode, hit);
+    auto second = cache.encode({1, 1}, make_image(2, 2, 1), encode, hit);
+    EXPECT_TRUE(hit);
+
+    EXPECT_EQ(encoder.calls, 2);
+    EXPECT_EQ(second, first);
+    ASSERT_EQ(second->resampled.size(), 2);
+    for (const ov::Tensor& tensor : {second->encoded_image.resized_source, second->resampled[0], second->resampled[1]}) {
+        for (size_t i = 0; i < tensor.get_size(); ++i)
+            EXPECT_EQ(tensor.data<float>()[i], 1.0f);
+    }
+}
+
+TEST(TestImageEmbeddingCache, least_recently_used_entry_is_evicted) {
+    ImageEmbeddingCache cache(2);
+    FakeEncoder encoder;
+    auto encode = [&]() { return encoder(); };
+
+    bool hit = false;
+    cache.encode({1, 1}, make_image(2, 2, 1), encode, hit);
+    cache.encode({2, 1}, make_image(2, 2, 2), encode, hit);
+    cache.encode({1, 1}, make_image(2, 2, 1), encode, hit);  // makes the first image the most recently used
+    cache.encode({3, 1}, make_image(2, 2, 3), encode, hit);  // evicts the second image
+    ASSERT_EQ(encoder.calls, 3);
+
+    cache.encode({1, 1}, make_image(2, 2, 1), encode, hit);
+    EXPECT_TRUE(hit);
+    cache.encode({2, 1}, make_image(2, 2, 2), encode, hit);
+    EXPECT_FALSE(hit);
+    EXPECT_EQ(cache.get_size(), 2);
+
+    cache.set_capacity(1);
+    EXPECT_EQ(cache.get_size(), 1);
+    cache.encode({2, 1}, make_image(2, 2, 2), encode, hit);
+    EXPECT_TRUE(hit);
+}
+
+TEST(TestImageEmbeddingCache, colliding_key_of_another_image_is_a_miss) {
+    ImageEmbeddingCache cache(2);
+    FakeEncoder encoder;
+    auto encode = [&]() { return encoder(); };
+
+    bool hit = true;
+    cache.encode({1, 1}, make_image(2, 2, 1), encode, hit);
+    // the same key as a crafted collision
+    auto other = cache.encode({1, 1}, make_image(2, 2, 2), encode, hit);
+    EXPECT_FALSE(hit);
+    EXPECT_EQ(encoder.calls, 2);
+    EXPECT_EQ(other->encoded_image.resized_source.data<float>()[0], 2.0f);
+
+    // the same bytes in another shape
+    cache.encode({1, 1}, make_image(1, 4, 2), encode, hit);
+    EXPECT_FALSE(hit);
+    cache.encode({1, 1}, make_image(1, 4, 2), encode, hit);
+    EXPECT_TRUE(hit);
+    EXPECT_EQ(encoder.calls, 3);
+}
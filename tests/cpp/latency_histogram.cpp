@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "latency_histogram.hpp"
+
+using ov::genai::LatencyHistogram;
+using std::chrono::microseconds;
+
+TEST(TestLatencyHistogram, empty_histogram_has_zero_percentiles) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.get_quantile(0.5f), microseconds(0));
+    ov::genai::LatencyPercentiles percentiles = histogram.get_percentiles();
+    EXPECT_EQ(percentiles.count, 0);
+    EXPECT_EQ(percentiles.p99, 0.0f);
+}
+
+TEST(TestLatencyHistogram, small_durations_are_exact) {
+    LatencyHistogram histogram;
+    for (int64_t duration = 1; duration <= 10; ++duration)
+        histogram.record(microseconds(duration));
+    EXPECT_EQ(histogram.get_count(), 10);
+    EXPECT_EQ(histogram.get_quantile(0.0f), microseconds(1));
+    EXPECT_EQ(histogram.get_quantile(0.5f), microseconds(5));
+    EXPECT_EQ(histogram.get_quantile(0.9f), microseconds(9));
+    EXPECT_EQ(histogram.get_quantile(1.0f), microseconds(10));
+}
+
+class LatencyHistogramErrorTest : public ::testing::TestWithParam<int64_t> {};
+
+TEST_P(LatencyHistogramErrorTest, quantiles_have_bounded_relative_error) {
+    const int64_t scale = GetParam();
+    LatencyHistogram histogram;
+    for (int64_t i = 1; i <= 1000; ++i)
+        histogram.record(microseconds(i * scale));
+
+    for (float q : {0.5f, 0.9f, 0.99f}) {
+        const double expected = q * 1000 * scale;
+        const double estimated = static_cast<double>(histogram.get_quantile(q).count());
+        EXPECT_NEAR(estimated, expected, expected / 32 + 1) << "quantile " << q;
+    }
+    EXPECT_EQ(histogram.get_quantile(1.0f), microseconds(1000 * scale));
+}
+
+INSTANTIATE_TEST_SUITE_P(LatencyScales, LatencyHistogramErrorTest, ::testing::Values(1, 37, 1000, 123456));
+
+TEST(TestLatencyHistogram, percentiles_are_in_milliseconds) {
+    LatencyHistogram histogram;
+    histogram.record(microseconds(2000));
+    histogram.record(microseconds(4000));
+    // negative durations are counted as zero
+    histogram.record(microseconds(-5));
+
+    ov::genai::LatencyPercentiles percentiles = histogram.get_percentiles();
+    EXPECT_EQ(percentiles.count, 3);
+    EXPECT_FLOAT_EQ(percentiles.mean, 2.0f);
+    EXPECT_FLOAT_EQ(percentiles.max, 4.0f);
+    EXPECT_NEAR(percentiles.p50, 2.0f, 2.0f / 32);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.get_percentiles().count, 0);
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "mpsc_queue.hpp"
+#include "spsc_queue.hpp"
+
+TEST(TestMPSCQueue, pops_in_push_order) {
+    MPSCQueue<int> queue;
+    EXPECT_TRUE(queue.empty());
+    int value = 0;
+    EXPECT_FALSE(queue.try_pop(value));
+
+    for (int i = 0; i < 3; ++i)
+        queue.push(i);
+    EXPECT_EQ(queue.size(), 3);
+
+    std::vector<int> values = {-1};
+    EXPECT_EQ(queue.drain_to(values), 3);
+    EXPECT_EQ(values, std::vector<int>({-1, 0, 1, 2}));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(TestMPSCQueue, keeps_order_of_each_producer) {
+    const size_t num_producers = 8, num_values = 10000;
+    MPSCQueue<std::pair<size_t, size_t>> queue;
+
+    std::vector<std::thread> producers;
+    for (size_t producer = 0; producer < num_producers; ++producer) {
+        producers.emplace_back([&, producer] {
+            for (size_t i = 0; i < num_values; ++i)
+                queue.push({producer, i});
+        });
+    }
+
+    // consumes concurrently with the producers
+    std::vector<size_t> next_values(num_producers, 0);
+    size_t num_popped = 0;
+    std::pair<size_t, size_t> value;
+    while (num_popped < num_producers * num_values) {
+        if (!queue.try_pop(value))
+            continue;
+        ASSERT_EQ(value.second, next_values[value.first]);
+        ++next_values[value.first];
+        ++num_popped;
+    }
+
+    for (auto& producer : producers)
+        producer.join();
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.try_pop(value));
+}
+
+TEST(TestSPSCQueue, pops_in_push_order_across_segments) {
+    SPSCQueue<int, 4> queue;
+    EXPECT_TRUE(queue.empty());
+    for (int i = 0; i < 10; ++i)
+        queue.push(i);
+    EXPECT_EQ(queue.back(), 9);
+
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_FALSE(queue.empty());
+        EXPECT_EQ(queue.pull(), i);
+    }
+    EXPECT_TRUE(queue.empty());
+    int value = 0;
+    EXPECT_FALSE(queue.try_pop(value));
+
+    queue.push(10);
+    EXPECT_EQ(queue.back(), 10);
+    EXPECT_EQ(queue.pull(), 10);
+}
+
+TEST(TestSPSCQueue, pull_waits_for_producer) {
+    const int num_values = 100000;
+    SPSCQueue<int, 4> queue;
+    std::thread producer([&] {
+        for (int i = 0; i < num_values; ++i) {
+            queue.push(i);
+            // lets the consumer go to sleep sometimes
+            if (i % 1000 == 0)
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    });
+
+    for (int i = 0; i < num_values; ++i)
+        ASSERT_EQ(queue.pull(), i);
+    producer.join();
+    EXPECT_TRUE(queue.empty());
+}
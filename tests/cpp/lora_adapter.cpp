@@ -0,0 +1,264 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/genai/lora_adapter.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+const size_t input_dim = 4, output_dim = 3;
+
+struct LoRAWeights {
+    size_t rank = 0;
+    std::vector<float> A, B;    // [rank, input_dim] and [output_dim, rank]
+};
+
+LoRAWeights make_lora_weights(size_t rank, float seed) {
+    LoRAWeights weights;
+    weights.rank = rank;
+    for (size_t i = 0; i < rank * input_dim; ++i)
+        weights.A.push_back(seed + 0.1f * i);
+    for (size_t i = 0; i < output_dim * rank; ++i)
+        weights.B.push_back(seed - 0.2f * i);
+    return weights;
+}
+
+// writes LoRA tensors for each layer name to a safetensors file and loads it as an adapter
+Adapter write_adapter(const std::string& file_name, const std::map<std::string, LoRAWeights>& layers) {
+    nlohmann::json header;
+    std::string data;
+    auto add_tensor = [&](const std::string& name, const std::vector<size_t>& shape, const std::vector<float>& values) {
+        const size_t begin = data.size();
+        data.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float));
+        header[name] = {{"dtype", "F32"}, {"shape", shape}, {"data_offsets", {begin, data.size()}}};
+    };
+    for (const auto& [layer, weights] : layers) {
+        add_tensor(layer + ".lora_A.weight", {weights.rank, input_dim}, weights.A);
+        add_tensor(layer + ".lora_B.weight", {output_dim, weights.rank}, weights.B);
+    }
+
+    std::string header_text = header.dump();
+    header_text.append((8 - header_text.size() % 8) % 8, ' ');
+    const uint64_t header_size = header_text.size();
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / file_name;
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header_size), sizeof(header_size));
+    file.write(header_text.data(), header_text.size());
+    file.write(data.data(), data.size());
+    file.close();
+    return Adapter(path);
+}
+
+std::vector<float> make_base_weights(float seed) {
+    std::vector<float> weights(output_dim * input_dim);
+    for (size_t i = 0; i < weights.size(); ++i)
+        weights[i] = seed + 0.05f * i;
+    return weights;
+}
+
+// fixed width, because adapter tensors are matched to layers by a substring of the layer name
+std::string layer_name(size_t layer) {
+    std::string index = std::to_string(layer);
+    return "layer_" + std::string(3 - index.size(), '0') + index;
+}
+
+// y = x * W^T for x of [tokens, input_dim] shape, W of [output_dim, input_dim] shape
+std::shared_ptr<ov::Model> make_linear_model(const std::vector<std::vector<float>>& layer_weights) {
+    auto x = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{ov::Dimension::dynamic(), input_dim});
+    x->output(0).set_names({"x"});
+    ov::ResultVector results;
+    for (size_t layer = 0; layer < layer_weights.size(); ++layer) {
+        auto weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{output_dim, input_dim}, layer_weights[layer]);
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(x, weights, false, true);
+        matmul->set_friendly_name(layer_name(layer));
+        results.push_back(std::make_shared<ov::op::v0::Result>(matmul));
+    }
+    return std::make_shared<ov::Model>(results, ov::ParameterVector{x});
+}
+
+// y += alpha * (x * A^T) * B^T for a single token x
+void add_lora_delta(std::vector<float>& y, const std::vector<float>& x, const LoRAWeights& weights, float alpha) {
+    for (size_t r = 0; r < weights.rank; ++r) {
+        float projection = 0.0f;
+        for (size_t i = 0; i < input_dim; ++i)
+            projection += weights.A[r * input_dim + i] * x[i];
+        for (size_t o = 0; o < output_dim; ++o)
+            y[o] += alpha * weights.B[o * weights.rank + r] * projection;
+    }
+}
+
+}  // namespace
+
+class TestPerTokenAdapters : public ::testing::Test {
+protected:
+    void SetUp() override {
+        first_weights = make_lora_weights(1, 0.5f);
+        second_weights = make_lora_weights(2, -0.3f);
+        first = write_adapter("genai_lora_per_token_first.safetensors", {{layer_name(0), first_weights}});
+        second = write_adapter("genai_lora_per_token_second.safetensors", {{layer_name(0), second_weights}});
+        base_weights = make_base_weights(0.25f);
+
+        auto model = make_linear_model({base_weights});
+        AdapterConfig registered({first, second}, AdapterConfig::MODE_DYNAMIC);
+        controller = AdapterController(model, registered, "CPU", /*per_token_adapters=*/true);
+        request = ov::Core().compile_model(model, "CPU").create_infer_request();
+    }
+
+    // runs one inference with a token adapted by each of `configs` and checks that each token gets only its own adapters
+    std::vector<int32_t> check_batch(const std::vector<AdapterConfig>& configs) {
+        const size_t num_tokens = configs.size();
+        std::vector<int32_t> slots = controller.apply_batched(request, configs);
+        EXPECT_EQ(slots.size(), num_tokens);
+
+        ov::Tensor x(ov::element::f32, {num_tokens, input_dim});
+        for (size_t i = 0; i < x.get_size(); ++i)
+            x.data<float>()[i] = 0.1f * (i % 7) - 0.2f;
+        ov::Tensor token_slots(ov::element::i32, {num_tokens});
+        std::copy(slots.begin(), slots.end(), token_slots.data<int32_t>());
+        request.set_tensor("x", x);
+        request.set_tensor(AdapterController::ADAPTER_SLOTS_INPUT_NAME, token_slots);
+        request.infer();
+        const float* y = request.get_output_tensor(0).data<float>();
+
+        for (size_t token = 0; token < num_tokens; ++token) {
+            std::vector<float> token_x(x.data<float>() + token * input_dim, x.data<float>() + (token + 1) * input_dim);
+            std::vector<float> expected(output_dim, 0.0f);
+            for (size_t o = 0; o < output_dim; ++o)
+                for (size_t i = 0; i < input_dim; ++i)
+                    expected[o] += base_weights[o * input_dim + i] * token_x[i];
+            for (const Adapter& adapter : configs[token].get_adapters())
+                add_lora_delta(expected, token_x, adapter == first ? first_weights : second_weights, configs[token].get_alpha(adapter));
+
+            for (size_t o = 0; o < output_dim; ++o)
+                EXPECT_NEAR(y[token * output_dim + o], expected[o], 1e-4f) << "token " << token << ", output " << o;
+        }
+        return slots;
+    }
+
+    LoRAWeights first_weights, second_weights;
+    Adapter first, second;
+    std::vector<float> base_weights;
+    AdapterController controller;
+    ov::InferRequest request;
+};
+
+TEST_F(TestPerTokenAdapters, token_gets_only_adapters_of_its_slot) {
+    const AdapterConfig first_config(first, 0.5f), second_config(second, 2.0f), both_config({{first, 1.0f}, {second, -1.0f}});
+
+    // ranks of all configs are concatenated, tokens of different configs are interleaved
+    EXPECT_EQ(check_batch({first_config, AdapterConfig(), second_config, both_config, first_config}),
+              std::vector<int32_t>({0, -1, 1, 2, 0}));
+}
+
+TEST_F(TestPerTokenAdapters, alpha_is_part_of_slot) {
+    const AdapterConfig half(first, 0.5f), twice(first, 2.0f);
+    EXPECT_EQ(check_batch({half, twice, half}), std::vector<int32_t>({0, 1, 0}));
+}
+
+TEST_F(TestPerTokenAdapters, slots_are_rebuilt_only_for_new_configs) {
+    const AdapterConfig first_config(first, 1.0f), second_config(second, 1.0f), both_config({first, second});
+
+    EXPECT_EQ(check_batch({first_config, second_config}), std::vector<int32_t>({0, 1}));
+    // the same configs in another order keep their slots
+    EXPECT_EQ(check_batch({second_config, AdapterConfig(), second_config}), std::vector<int32_t>({1, -1, 1}));
+    // a new config rebuilds slots from configs of this batch only
+    EXPECT_EQ(check_batch({both_config, second_config}), std::vector<int32_t>({0, 1}));
+    EXPECT_EQ(check_batch({AdapterConfig()}), std::vector<int32_t>({-1}));
+}
+
+TEST(TestLoRAFusion, parallel_fusion_matches_sequential_one) {
+    // more layers than fusions queued before they are evaluated together
+    const size_t num_layers = 150;
+    const float alpha = 0.75f;
+    std::vector<std::vector<float>> base_weights;
+    std::map<std::string, LoRAWeights> lora_weights;
+    for (size_t layer = 0; layer < num_layers; ++layer) {
+        base_weights.push_back(make_base_weights(0.01f * layer));
+        lora_weights[layer_name(layer)] = make_lora_weights(1 + layer % 3, -0.02f * layer);
+    }
+    Adapter adapter = write_adapter("genai_lora_fusion.safetensors", lora_weights);
+
+    auto get_fused_weights = [](const std::shared_ptr<ov::Model>& model) {
+        std::map<std::string, std::vector<float>> weights;
+        for (const auto& node : model->get_ordered_ops()) {
+            if (std::dynamic_pointer_cast<ov::op::v0::MatMul>(node)) {
+                auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(node->get_input_node_shared_ptr(1));
+                EXPECT_TRUE(constant) << node->get_friendly_name();
+                weights[node->get_friendly_name()] = constant->cast_vector<float>();
+            }
+        }
+        return weights;
+    };
+
+    auto model = make_linear_model(base_weights);
+    AdapterController(model, AdapterConfig(adapter, alpha, AdapterConfig::MODE_FUSE), "CPU");
+    const auto parallel_weights = get_fused_weights(model);
+    ASSERT_EQ(parallel_weights.size(), num_layers);
+
+    for (size_t layer = 0; layer < num_layers; ++layer) {
+        // a model with a single layer is fused by a single evaluation
+        auto layer_model = make_linear_model({base_weights[layer]});
+        layer_model->get_results()[0]->get_input_node_shared_ptr(0)->set_friendly_name(layer_name(layer));
+        AdapterController(layer_model, AdapterConfig(adapter, alpha, AdapterConfig::MODE_FUSE), "CPU");
+        const std::vector<float>& fused = parallel_weights.at(layer_name(layer));
+        EXPECT_EQ(fused, get_fused_weights(layer_model).at(layer_name(layer))) << layer_name(layer);
+
+        // W + alpha * B * A
+        const LoRAWeights& lora = lora_weights.at(layer_name(layer));
+        for (size_t o = 0; o < output_dim; ++o) {
+            for (size_t i = 0; i < input_dim; ++i) {
+                float expected = base_weights[layer][o * input_dim + i];
+                for (size_t r = 0; r < lora.rank; ++r)
+                    expected += alpha * lora.B[o * lora.rank + r] * lora.A[r * input_dim + i];
+                EXPECT_NEAR(fused[o * input_dim + i], expected, 1e-4f) << layer_name(layer);
+            }
+        }
+    }
+}
+
+TEST(TestLoRAFusion, weights_of_previous_fusion_are_updated_in_place) {
+    const float alpha = 0.5f;
+    const std::vector<float> base_weights = make_base_weights(0.3f);
+    const LoRAWeights lora = make_lora_weights(2, 0.1f);
+    Adapter adapter = write_adapter("genai_lora_in_place_fusion.safetensors", {{layer_name(0), lora}});
+
+    auto model = make_linear_model({base_weights});
+    auto matmul = model->get_results()[0]->get_input_node_shared_ptr(0);
+    auto original = matmul->get_input_node_shared_ptr(1);
+
+    // original weights are replaced, as they may be read-only
+    AdapterController(model, AdapterConfig(adapter, alpha, AdapterConfig::MODE_FUSE), "CPU");
+    auto fused = matmul->get_input_node_shared_ptr(1);
+    EXPECT_NE(fused, original);
+    EXPECT_EQ(std::dynamic_pointer_cast<ov::op::v0::Constant>(original)->cast_vector<float>(), base_weights);
+
+    // weights allocated by the first fusion are owned by the model
+    AdapterController(model, AdapterConfig(adapter, alpha, AdapterConfig::MODE_FUSE), "CPU");
+    EXPECT_EQ(matmul->get_input_node_shared_ptr(1), fused);
+
+    const auto weights = std::dynamic_pointer_cast<ov::op::v0::Constant>(fused)->cast_vector<float>();
+    for (size_t o = 0; o < output_dim; ++o) {
+        for (size_t i = 0; i < input_dim; ++i) {
+            float expected = base_weights[o * input_dim + i];
+            for (size_t r = 0; r < lora.rank; ++r)
+                expected += 2 * alpha * lora.B[o * lora.rank + r] * lora.A[r * input_dim + i];
+            EXPECT_NEAR(weights[o * input_dim + i], expected, 1e-4f);
+        }
+    }
+}
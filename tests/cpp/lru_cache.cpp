@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "lru_cache.hpp"
+
+using ov::genai::LRUCache;
+
+TEST(TestLRUCache, evicts_least_recently_used) {
+    LRUCache<std::string, int> cache(2);
+    cache.insert("a", 1);
+    cache.insert("b", 2);
+    // a lookup makes "a" the most recently used one
+    ASSERT_NE(cache.find("a"), nullptr);
+    cache.insert("c", 3);
+
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.find("b"), nullptr);
+    EXPECT_EQ(*cache.find("a"), 1);
+    EXPECT_EQ(*cache.find("c"), 3);
+}
+
+TEST(TestLRUCache, insert_replaces_cached_value) {
+    LRUCache<std::string, int> cache(2);
+    cache.insert("a", 1);
+    cache.insert("b", 2);
+    cache.insert("a", 10);
+    cache.insert("c", 3);
+
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(*cache.find("a"), 10);
+    EXPECT_EQ(cache.find("b"), nullptr);
+}
+
+TEST(TestLRUCache, zero_capacity_keeps_nothing) {
+    LRUCache<int, int> cache;
+    cache.insert(1, 1);
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.find(1), nullptr);
+}
+
+TEST(TestLRUCache, shrinking_evicts_least_recently_used) {
+    LRUCache<int, int> cache(3);
+    for (int key : {1, 2, 3})
+        cache.insert(key, key);
+    cache.find(1);
+    cache.set_capacity(1);
+
+    EXPECT_EQ(cache.get_capacity(), 1);
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_NE(cache.find(1), nullptr);
+
+    cache.set_capacity(2);
+    cache.insert(2, 2);
+    EXPECT_EQ(cache.size(), 2);
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+
+#include "utils/mapped_file.hpp"
+
+using ov::genai::utils::MappedFile;
+
+namespace {
+
+std::filesystem::path write_temp_file(const std::string& name, const std::string& contents) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(contents.data(), contents.size());
+    return path;
+}
+
+}  // namespace
+
+TEST(TestMappedFile, maps_file_contents) {
+    const std::string contents = "safetensors header and weights";
+    const auto path = write_temp_file("genai_mapped_file_contents.bin", contents);
+
+    {
+        MappedFile file(path);
+        static_assert(std::is_same_v<decltype(file.data()), const char*>, "the mapping is read-only");
+        ASSERT_EQ(file.size(), contents.size());
+        EXPECT_EQ(std::memcmp(file.data(), contents.data(), contents.size()), 0);
+        EXPECT_LE(file.get_resident_size(), file.size());
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(TestMappedFile, empty_or_missing_file_throws) {
+    const auto path = write_temp_file("genai_mapped_file_empty.bin", "");
+    EXPECT_ANY_THROW(MappedFile{path});
+    std::filesystem::remove(path);
+    EXPECT_ANY_THROW(MappedFile{path});
+}
+
+TEST(TestMappedFile, shared_mapping_is_reused_while_alive) {
+    const auto path = write_temp_file("genai_mapped_file_shared.bin", "adapter weights");
+
+    auto first = MappedFile::open_shared(path);
+    auto second = MappedFile::open_shared(path.parent_path() / "." / path.filename());
+    EXPECT_EQ(first, second);
+
+    first.reset();
+    second.reset();
+    // all holders released the mapping, so the file is mapped again and the new mapping is valid
+    auto third = MappedFile::open_shared(path);
+    EXPECT_EQ(std::memcmp(third->data(), "adapter weights", third->size()), 0);
+
+    third.reset();
+    std::filesystem::remove(path);
+}
+
+TEST(TestMappedFile, modified_file_is_mapped_again) {
+    const auto path = write_temp_file("genai_mapped_file_modified.bin", "old weights");
+    auto old_file = MappedFile::open_shared(path);
+
+    write_temp_file("genai_mapped_file_modified.bin", "new weights, longer");
+    std::filesystem::last_write_time(path, old_file->last_write_time() + std::chrono::seconds(1));
+
+    auto new_file = MappedFile::open_shared(path);
+    EXPECT_NE(old_file, new_file);
+    ASSERT_EQ(new_file->size(), std::string("new weights, longer").size());
+    EXPECT_EQ(std::memcmp(new_file->data(), "new weights, longer", new_file->size()), 0);
+
+    old_file.reset();
+    new_file.reset();
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,121 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/genai/generation_config.hpp"
+
+#include "model_runner.hpp"
+#include "scheduler.hpp"
+#include "sequence_group.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+const size_t vocab_size = 10, hidden_size = 3;
+
+// the embedding of token `id` is {10 * id, 10 * id + 1, 10 * id + 2}
+EmbeddingsModel make_embedding_model() {
+    std::vector<float> weights(vocab_size * hidden_size);
+    for (size_t i = 0; i < weights.size(); ++i)
+        weights[i] = static_cast<float>(10 * (i / hidden_size) + i % hidden_size);
+    auto ids = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::PartialShape{-1, -1});
+    auto gather = std::make_shared<ov::op::v8::Gather>(ov::op::v0::Constant::create(ov::element::f32, {vocab_size, hidden_size}, weights),
+                                                       ids, ov::op::v0::Constant::create(ov::element::i64, {}, {0}));
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{gather}, ov::ParameterVector{ids});
+    return EmbeddingsModel(model, 1.0f, "CPU", {});
+}
+
+// a paged attention model stub which returns its `inputs_embeds` as logits, so logits rows show which embeddings were fed
+ov::InferRequest make_echo_request() {
+    ov::ParameterVector parameters;
+    auto add_parameter = [&](const std::string& name, ov::element::Type type, const ov::PartialShape& shape) {
+        auto parameter = std::make_shared<ov::op::v0::Parameter>(type, shape);
+        parameter->output(0).set_names({name});
+        parameters.push_back(parameter);
+        return parameter;
+    };
+    auto inputs_embeds = add_parameter("inputs_embeds", ov::element::f32, {-1, hidden_size});
+    add_parameter("position_ids", ov::element::i64, {-1});
+    for (const std::string& name : {"past_lens", "subsequence_begins", "block_indices", "block_indices_begins"})
+        add_parameter(name, ov::element::i32, {-1});
+    add_parameter("max_context_len", ov::element::i32, {});
+
+    auto logits = std::make_shared<ov::op::v1::Multiply>(inputs_embeds, ov::op::v0::Constant::create(ov::element::f32, {}, {1.0f}));
+    logits->output(0).set_names({"logits"});
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{logits}, parameters);
+    return ov::Core().compile_model(model, "CPU").create_infer_request();
+}
+
+std::vector<float> token_embedding(int64_t id) {
+    return {10.0f * id, 10.0f * id + 1, 10.0f * id + 2};
+}
+
+std::vector<float> get_row(const ov::Tensor& logits, size_t row) {
+    const float* data = logits.data<const float>() + row * hidden_size;
+    return std::vector<float>(data, data + hidden_size);
+}
+
+}  // namespace
+
+TEST(TestModelRunner, embeddings_are_placed_at_rows_of_their_sequences) {
+    const size_t block_size = 4;
+    SchedulerConfig scheduler_config;
+    scheduler_config.num_kv_blocks = 10;
+    scheduler_config.dynamic_split_fuse = false;
+    scheduler_config.max_num_seqs = 5;
+
+    // a beam search group with prompt embeddings, e.g. of an image, and a group with a text prompt
+    std::vector<int64_t> image_prompt_ids = {0, 0, 0}, text_prompt_ids = {4, 6};
+    auto image_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {image_prompt_ids.size()}, image_prompt_ids.data()),
+                                                       ov::genai::beam_search(), block_size, false);
+    image_group->set_sequence_group_ptr(image_group);
+    ov::Tensor prompt_embeds(ov::element::f32, {1, image_prompt_ids.size(), hidden_size});
+    for (size_t i = 0; i < prompt_embeds.get_size(); ++i)
+        prompt_embeds.data<float>()[i] = -1.0f - i;
+    image_group->set_input_embeds(prompt_embeds);
+
+    auto text_group = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {text_prompt_ids.size()}, text_prompt_ids.data()),
+                                                      ov::genai::greedy(), block_size, false);
+    text_group->set_sequence_group_ptr(text_group);
+    std::vector<SequenceGroup::Ptr> requests = {image_group, text_group};
+
+    Scheduler scheduler(block_size, scheduler_config);
+    ModelRunner model_runner(make_echo_request(), block_size);
+    model_runner.set_embedding_model(make_embedding_model(), hidden_size);
+
+    // prompts: embeddings of the image prompt are taken as is, text prompt tokens are embedded
+    auto output = scheduler.schedule(requests);
+    ov::Tensor logits = model_runner.forward(requests, output);
+    ASSERT_EQ(logits.get_shape(), ov::Shape({image_prompt_ids.size() + text_prompt_ids.size(), hidden_size}));
+    for (size_t position = 0; position < image_prompt_ids.size(); ++position)
+        EXPECT_EQ(get_row(logits, position), std::vector<float>(prompt_embeds.data<float>() + position * hidden_size,
+                                                                 prompt_embeds.data<float>() + (position + 1) * hidden_size));
+    EXPECT_EQ(get_row(logits, 3), token_embedding(4));
+    EXPECT_EQ(get_row(logits, 4), token_embedding(6));
+
+    // beams of the image group select different tokens
+    auto beam = image_group->get_running_sequences()[0];
+    auto forked_beam = image_group->fork_sequence(beam);
+    scheduler.fork_sequence(beam->get_id(), forked_beam->get_id());
+    beam->append_token(5, 0.5);
+    forked_beam->append_token(7, 0.4);
+    text_group->get_running_sequences()[0]->append_token(8, 0.9);
+    for (auto& request : requests)
+        request->finish_iteration();
+
+    // generated tokens: a row per running sequence in the order of groups and their sequences
+    output = scheduler.schedule(requests);
+    logits = model_runner.forward(requests, output);
+    ASSERT_EQ(logits.get_shape(), ov::Shape({3, hidden_size}));
+    EXPECT_EQ(get_row(logits, 0), token_embedding(5));
+    EXPECT_EQ(get_row(logits, 1), token_embedding(7));
+    EXPECT_EQ(get_row(logits, 2), token_embedding(8));
+}
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "openvino/genai/image_generation/generation_config.hpp"
+
+using ov::genai::PhiloxGenerator;
+
+TEST(TestPhiloxGenerator, same_seed_gives_same_tensor) {
+    PhiloxGenerator first(42), second(42), other(43);
+    ov::Tensor a = first.randn_tensor({2, 4, 128, 128});
+    ov::Tensor b = second.randn_tensor({2, 4, 128, 128});
+    ov::Tensor c = other.randn_tensor({2, 4, 128, 128});
+
+    size_t num_different = 0;
+    for (size_t i = 0; i < a.get_size(); ++i) {
+        ASSERT_EQ(a.data<float>()[i], b.data<float>()[i]) << "index " << i;
+        num_different += a.data<float>()[i] != c.data<float>()[i];
+    }
+    EXPECT_GT(num_different, a.get_size() / 2);
+}
+
+TEST(TestPhiloxGenerator, tensor_matches_sequence_of_next_values) {
+    // the sequence doesn't depend on how it's split between 'randn_tensor' and 'next' calls or between threads
+    PhiloxGenerator tensor_generator(7), scalar_generator(7);
+    for (size_t size : {1, 5, 31, 32, 33, 100000, 17}) {
+        ov::Tensor tensor = tensor_generator.randn_tensor({size});
+        for (size_t i = 0; i < size; ++i) {
+            ASSERT_EQ(tensor.data<float>()[i], scalar_generator.next()) << "size " << size << ", index " << i;
+        }
+    }
+}
+
+TEST(TestPhiloxGenerator, seed_restarts_sequence) {
+    PhiloxGenerator generator(1);
+    ov::Tensor first = generator.randn_tensor({1000});
+    generator.next();
+    generator.seed(1);
+    ov::Tensor second = generator.randn_tensor({1000});
+    for (size_t i = 0; i < first.get_size(); ++i) {
+        ASSERT_EQ(first.data<float>()[i], second.data<float>()[i]);
+    }
+}
+
+TEST(TestPhiloxGenerator, values_are_standard_normal) {
+    PhiloxGenerator generator(2024);
+    ov::Tensor tensor = generator.randn_tensor({1 << 20});
+    const float* data = tensor.data<const float>();
+
+    double sum = 0.0, sum_squares = 0.0;
+    size_t within_one_sigma = 0;
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        ASSERT_TRUE(std::isfinite(data[i]));
+        sum += data[i];
+        sum_squares += data[i] * data[i];
+        within_one_sigma += std::fabs(data[i]) < 1.0f;
+    }
+
+    const double size = static_cast<double>(tensor.get_size());
+    EXPECT_NEAR(sum / size, 0.0, 0.01);
+    EXPECT_NEAR(sum_squares / size, 1.0, 0.01);
+    EXPECT_NEAR(within_one_sigma / size, 0.6827, 0.01);
+}
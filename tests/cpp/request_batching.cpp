@@ -0,0 +1,137 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "image_generation/request_batching.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+struct FakeRequest {
+    size_t id = 0;
+    ImageGenerationConfig config;
+    std::promise<ov::Tensor> promise;
+    bool is_invalid = false;
+};
+
+ImageGenerationConfig make_config(int64_t size, size_t num_images = 1) {
+    ImageGenerationConfig config;
+    config.height = config.width = size;
+    config.num_images_per_prompt = num_images;
+    return config;
+}
+
+std::deque<FakeRequest> make_requests(const std::vector<ImageGenerationConfig>& configs) {
+    std::deque<FakeRequest> requests;
+    for (const ImageGenerationConfig& config : configs) {
+        FakeRequest request;
+        request.id = requests.size();
+        request.config = config;
+        requests.push_back(std::move(request));
+    }
+    return requests;
+}
+
+std::vector<size_t> get_ids(const std::vector<FakeRequest>& batch) {
+    std::vector<size_t> ids;
+    for (const FakeRequest& request : batch)
+        ids.push_back(request.id);
+    return ids;
+}
+
+}  // namespace
+
+TEST(TestRequestBatching, are_batchable) {
+    const ImageGenerationConfig config = make_config(512);
+    EXPECT_TRUE(are_batchable(config, config));
+
+    // guidance scale, number of images and random generator are per request
+    ImageGenerationConfig other = config;
+    other.guidance_scale = config.guidance_scale + 1.0f;
+    other.num_images_per_prompt = 3;
+    other.rng_seed = config.rng_seed + 1;
+    EXPECT_TRUE(are_batchable(config, other));
+
+    EXPECT_FALSE(are_batchable(config, make_config(256)));
+
+    other = config;
+    other.width = 256;
+    EXPECT_FALSE(are_batchable(config, other));
+
+    other = config;
+    other.num_inference_steps = config.num_inference_steps + 1;
+    EXPECT_FALSE(are_batchable(config, other));
+
+    other = config;
+    other.strength = 0.5f;
+    EXPECT_FALSE(are_batchable(config, other));
+}
+
+TEST(TestRequestBatching, take_batch_skips_requests_not_batchable_with_oldest) {
+    auto requests = make_requests({make_config(512), make_config(256), make_config(512), make_config(256), make_config(512)});
+
+    EXPECT_EQ(get_ids(take_batch(requests, 4)), std::vector<size_t>({0, 2, 4}));
+    ASSERT_EQ(requests.size(), 2);
+    EXPECT_EQ(get_ids(take_batch(requests, 4)), std::vector<size_t>({1, 3}));
+    EXPECT_TRUE(requests.empty());
+    EXPECT_TRUE(take_batch(requests, 4).empty());
+}
+
+TEST(TestRequestBatching, take_batch_limits_number_of_images) {
+    auto requests = make_requests({make_config(512, 2), make_config(512, 3), make_config(512, 1), make_config(512, 1)});
+
+    // the request with 3 images doesn't fit, the following ones do
+    EXPECT_EQ(get_ids(take_batch(requests, 4)), std::vector<size_t>({0, 2, 3}));
+    EXPECT_EQ(get_ids(take_batch(requests, 4)), std::vector<size_t>({1}));
+
+    // the oldest request is taken alone even if it has more images than a batch
+    requests = make_requests({make_config(512, 5), make_config(512, 1)});
+    EXPECT_EQ(get_ids(take_batch(requests, 4)), std::vector<size_t>({0}));
+    EXPECT_EQ(get_ids(take_batch(requests, 4)), std::vector<size_t>({1}));
+}
+
+TEST(TestRequestBatching, error_is_passed_only_to_failed_request) {
+    auto requests = make_requests({make_config(512), make_config(512), make_config(512)});
+    requests[1].is_invalid = true;
+    std::vector<FakeRequest> batch(std::make_move_iterator(requests.begin()), std::make_move_iterator(requests.end()));
+    std::vector<std::future<ov::Tensor>> futures;
+    for (FakeRequest& request : batch)
+        futures.push_back(request.promise.get_future());
+
+    std::vector<std::vector<size_t>> calls;
+    generate_batch_isolating_errors(batch, [&](const std::vector<size_t>& request_indices) {
+        calls.push_back(request_indices);
+        std::vector<ov::Tensor> images;
+        for (size_t index : request_indices) {
+            if (batch[index].is_invalid)
+                throw std::runtime_error("invalid request");
+            ov::Tensor image(ov::element::u8, {1, 1, 1, 3});
+            std::fill_n(image.data<uint8_t>(), 3, static_cast<uint8_t>(batch[index].id));
+            images.push_back(image);
+        }
+        return images;
+    });
+
+    // the whole batch, then each request alone
+    EXPECT_EQ(calls, std::vector<std::vector<size_t>>({{0, 1, 2}, {0}, {1}, {2}}));
+    EXPECT_EQ(futures[0].get().data<uint8_t>()[0], 0);
+    EXPECT_THROW(futures[1].get(), std::runtime_error);
+    EXPECT_EQ(futures[2].get().data<uint8_t>()[0], 2);
+}
+
+TEST(TestRequestBatching, batch_is_generated_once_without_errors) {
+    auto requests = make_requests({make_config(512), make_config(512)});
+    std::vector<FakeRequest> batch(std::make_move_iterator(requests.begin()), std::make_move_iterator(requests.end()));
+    auto future = batch[1].promise.get_future();
+
+    size_t num_calls = 0;
+    generate_batch_isolating_errors(batch, [&](const std::vector<size_t>& request_indices) {
+        ++num_calls;
+        return std::vector<ov::Tensor>(request_indices.size(), ov::Tensor(ov::element::u8, {1, 1, 1, 3}));
+    });
+    EXPECT_EQ(num_calls, 1);
+    EXPECT_EQ(future.get().get_shape(), ov::Shape({1, 1, 1, 3}));
+}
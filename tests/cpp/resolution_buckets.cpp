@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "image_generation/resolution_buckets.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+struct FakeModels {
+    int64_t height = 0;
+    size_t num_compilations = 0;
+};
+
+ResolutionBuckets<FakeModels> make_buckets(bool compile_lazily) {
+    ResolutionBuckets<FakeModels> buckets(compile_lazily);
+    for (int64_t size : {512, 768, 1024}) {
+        buckets.add(size, size, FakeModels{size});
+    }
+    return buckets;
+}
+
+void compile(FakeModels& models) {
+    ++models.num_compilations;
+}
+
+std::vector<bool> get_compiled(const ResolutionBuckets<FakeModels>& buckets) {
+    std::vector<bool> is_compiled;
+    for (const ResolutionBucketStats& stats : buckets.get_stats())
+        is_compiled.push_back(stats.is_compiled);
+    return is_compiled;
+}
+
+}  // namespace
+
+TEST(TestResolutionBuckets, all_buckets_are_compiled_eagerly) {
+    auto buckets = make_buckets(false);
+    EXPECT_EQ(get_compiled(buckets), std::vector<bool>({false, false, false}));
+    buckets.compile(compile);
+    EXPECT_EQ(get_compiled(buckets), std::vector<bool>({true, true, true}));
+
+    // selection doesn't compile models again
+    MicroSeconds switch_duration{0};
+    const FakeModels& models = buckets.select(768, 768, switch_duration);
+    EXPECT_EQ(models.height, 768);
+    EXPECT_EQ(models.num_compilations, 1);
+}
+
+TEST(TestResolutionBuckets, lazy_buckets_are_compiled_on_first_selection) {
+    auto buckets = make_buckets(true);
+    buckets.compile(compile);
+    // the first bucket is used when a resolution isn't specified, so it's always compiled
+    EXPECT_EQ(get_compiled(buckets), std::vector<bool>({true, false, false}));
+    EXPECT_EQ(buckets.front().height, 512);
+
+    MicroSeconds switch_duration{0};
+    EXPECT_EQ(buckets.select(1024, 1024, switch_duration).num_compilations, 1);
+    EXPECT_EQ(get_compiled(buckets), std::vector<bool>({true, false, true}));
+    EXPECT_EQ(buckets.select(1024, 1024, switch_duration).num_compilations, 1);
+    EXPECT_EQ(buckets.select(512, 512, switch_duration).num_compilations, 1);
+}
+
+TEST(TestResolutionBuckets, switch_duration_includes_compilation) {
+    auto buckets = make_buckets(true);
+    const MicroSeconds compile_duration{20000};
+    buckets.compile([&](FakeModels& models) {
+        ++models.num_compilations;
+        if (models.height != 512)
+            std::this_thread::sleep_for(compile_duration);
+    });
+
+    MicroSeconds switch_duration{0};
+    buckets.select(768, 768, switch_duration);
+    EXPECT_GE(switch_duration.count(), compile_duration.count());
+
+    const std::vector<ResolutionBucketStats> stats = buckets.get_stats();
+    ASSERT_EQ(stats.size(), 3);
+    EXPECT_EQ(stats[1].height, 768);
+    EXPECT_EQ(stats[1].width, 768);
+    // compile duration is in milliseconds
+    EXPECT_GE(stats[1].compile_duration, compile_duration.count() / 1000.0f);
+    EXPECT_EQ(stats[2].compile_duration, 0.0f);
+
+    buckets.select(768, 768, switch_duration);
+    EXPECT_LT(switch_duration.count(), compile_duration.count());
+}
+
+TEST(TestResolutionBuckets, unknown_resolution_is_rejected) {
+    auto buckets = make_buckets(true);
+    buckets.compile(compile);
+
+    MicroSeconds switch_duration{0};
+    EXPECT_THROW(buckets.select(512, 768, switch_duration), ov::Exception);
+    EXPECT_THROW(buckets.select(256, 256, switch_duration), ov::Exception);
+}
+
+TEST(TestResolutionBuckets, resolution_is_added_once) {
+    auto buckets = make_buckets(false);
+    EXPECT_THROW(buckets.add(768, 768, FakeModels{768}), ov::Exception);
+    // the same sizes in another order are a different resolution
+    buckets.add(512, 768, FakeModels{512});
+    EXPECT_EQ(buckets.get_stats().size(), 4);
+}
+
+TEST(TestResolutionBuckets, lazy_bucket_is_not_selected_before_compile) {
+    auto buckets = make_buckets(true);
+    MicroSeconds switch_duration{0};
+    EXPECT_THROW(buckets.select(768, 768, switch_duration), ov::Exception);
+
+    buckets.clear();
+    EXPECT_TRUE(buckets.empty());
+    EXPECT_THROW(buckets.front(), ov::Exception);
+}
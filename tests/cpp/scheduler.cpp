@@ -950,3 +950,61 @@ TEST(TestScheduler, FullyPreemptsCacheEvictedSequences) {
     EXPECT_EQ(block_table2, ref_block_table2_after_recompute);
 
 }
+
+TEST(TestScheduler, prefix_caching_hashes_prompt_embeddings) {
+    const size_t block_size = 4, prompt_len = 8, hidden_size = 16;
+    // prompts of visual language models have the same placeholder ids, only embeddings differ
+    std::vector<int64_t> prompt_ids(prompt_len, 0);
+    auto create_sequence = [&](float second_block_value) {
+        SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {prompt_len}, prompt_ids.data()),
+                                                                            ov::genai::greedy(), block_size, true);
+        sequence_group->set_sequence_group_ptr(sequence_group);
+        ov::Tensor input_embeds(ov::element::f32, {1, prompt_len, hidden_size});
+        float* data = input_embeds.data<float>();
+        for (size_t position = 0; position < prompt_len; ++position)
+            std::fill_n(data + position * hidden_size, hidden_size, position < block_size ? 1.0f : second_block_value);
+        sequence_group->set_input_embeds(input_embeds);
+        return sequence_group;
+    };
+
+    SequenceGroup::Ptr first = create_sequence(2.0f), same = create_sequence(2.0f), other = create_sequence(3.0f);
+    SequenceGroup::Ptr tokens = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {prompt_len}, prompt_ids.data()),
+                                                                ov::genai::greedy(), block_size, true);
+    tokens->set_sequence_group_ptr(tokens);
+
+    auto hash = [](const SequenceGroup::Ptr& sequence_group, size_t content_length) {
+        return (*sequence_group)[0]->get_hash(content_length);
+    };
+    EXPECT_EQ(first->get_prompt_ids(), prompt_ids);
+    EXPECT_EQ(hash(first, block_size), hash(same, block_size));
+    EXPECT_EQ(hash(first, prompt_len), hash(same, prompt_len));
+    EXPECT_EQ(hash(first, block_size), hash(other, block_size));
+    EXPECT_NE(hash(first, prompt_len), hash(other, prompt_len));
+    EXPECT_NE(hash(first, block_size), hash(tokens, block_size));
+}
+
+TEST(TestScheduler, prefix_caching_hashes_adapters) {
+    const size_t block_size = 4, prompt_len = 8;
+    std::vector<int64_t> prompt_ids = {1, 2, 3, 4, 5, 6, 7, 8};
+    // KV of the same prompt differs if it's computed with other LoRA adapters or alphas
+    auto create_sequence = [&](const std::vector<int64_t>& adapters_key) {
+        SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {prompt_len}, prompt_ids.data()),
+                                                                            ov::genai::greedy(), block_size, true);
+        sequence_group->set_sequence_group_ptr(sequence_group);
+        sequence_group->set_adapters_key(adapters_key);
+        return sequence_group;
+    };
+
+    SequenceGroup::Ptr base = create_sequence({}), first = create_sequence({0, 1}), same = create_sequence({0, 1}),
+                       other_alpha = create_sequence({0, 2}), other_adapter = create_sequence({1, 1});
+
+    auto hash = [](const SequenceGroup::Ptr& sequence_group, size_t content_length) {
+        return (*sequence_group)[0]->get_hash(content_length);
+    };
+    for (size_t content_length : {block_size, prompt_len, prompt_len - 1}) {
+        EXPECT_EQ(hash(first, content_length), hash(same, content_length));
+        EXPECT_NE(hash(first, content_length), hash(base, content_length));
+        EXPECT_NE(hash(first, content_length), hash(other_alpha, content_length));
+        EXPECT_NE(hash(first, content_length), hash(other_adapter, content_length));
+    }
+}
@@ -24,10 +24,7 @@ protected:
                                                                                 true);
             sequence_group->set_sequence_group_ptr(sequence_group);
 
-            {
-                std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
-                m_awaiting_requests.push_back(sequence_group);
-            }
+            m_awaiting_requests.push(sequence_group);
             pull_awaiting_requests();
             return std::make_shared<ov::genai::GenerationHandleImpl>(sequence_group->get_generation_stream(), sampling_params);
         };
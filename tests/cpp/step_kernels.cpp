@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "image_generation/schedulers/step_kernels.hpp"
+
+namespace {
+
+ov::Tensor make_tensor(const ov::Shape& shape, float start, float step) {
+    ov::Tensor tensor(ov::element::f32, shape);
+    float* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); ++i)
+        data[i] = start + step * i;
+    return tensor;
+}
+
+}  // namespace
+
+TEST(TestStepKernels, guided_noise_combines_batch_halves) {
+    // large enough to be split between threads
+    const ov::Shape latent_shape{2, 4, 64, 64}, noise_shape{4, 4, 64, 64};
+    const size_t latent_size = ov::shape_size(latent_shape);
+    ov::Tensor noise_pred = make_tensor(noise_shape, -1.0f, 1e-4f);
+    const float* uncond = noise_pred.data<const float>();
+    const float* text = uncond + latent_size;
+
+    std::vector<float> guided(latent_size, 0.0f);
+    const float guidance_scale = 7.5f;
+    ov::genai::kernels::for_each_guided_noise(noise_pred, latent_size, guidance_scale, [&](size_t i, float noise) {
+        guided[i] = noise;
+    });
+
+    for (size_t i = 0; i < latent_size; ++i) {
+        ASSERT_FLOAT_EQ(guided[i], uncond[i] + guidance_scale * (text[i] - uncond[i])) << "index " << i;
+    }
+}
+
+TEST(TestStepKernels, noise_without_guidance_is_passed_as_is) {
+    const ov::Shape latent_shape{1, 4, 8, 8};
+    ov::Tensor noise_pred = make_tensor(latent_shape, 0.5f, 0.25f);
+
+    std::vector<float> result(noise_pred.get_size(), 0.0f);
+    ov::genai::kernels::for_each_guided_noise(noise_pred, noise_pred.get_size(), 7.5f, [&](size_t i, float noise) {
+        result[i] = noise;
+    });
+
+    for (size_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(result[i], noise_pred.data<const float>()[i]);
+    }
+}
+
+TEST(TestStepKernels, repeat_scaled_fills_each_batch_part) {
+    const ov::Shape latent_shape{1, 4, 96, 96};
+    ov::Tensor latent = make_tensor(latent_shape, 1.0f, 0.5f);
+    ov::Tensor latent_cfg(ov::element::f32, {2, 4, 96, 96});
+
+    ov::genai::kernels::repeat_scaled(latent, latent_cfg, 0.25f);
+
+    const float* src = latent.data<const float>();
+    const float* dst = latent_cfg.data<const float>();
+    for (size_t n = 0; n < 2; ++n) {
+        for (size_t i = 0; i < latent.get_size(); ++i) {
+            ASSERT_FLOAT_EQ(dst[n * latent.get_size() + i], src[i] * 0.25f);
+        }
+    }
+}
@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <thread>
+
+#include <nlohmann/json.hpp>
+
+#include "step_tracer.hpp"
+
+using ov::genai::StepTracer;
+
+namespace {
+
+void record(const StepTracer& tracer, const char* name, std::chrono::microseconds duration) {
+    const auto start = StepTracer::Clock::now();
+    tracer.record(name, start, start + duration);
+}
+
+}  // namespace
+
+TEST(TestStepTracer, disabled_tracer_records_nothing) {
+    StepTracer tracer;
+    {
+        StepTracer::Span span(tracer, "step");
+    }
+    EXPECT_TRUE(tracer.get_statistics().empty());
+    EXPECT_TRUE(nlohmann::json::parse(tracer.get_chrome_trace())["traceEvents"].empty());
+}
+
+TEST(TestStepTracer, aggregates_spans_by_name) {
+    StepTracer tracer;
+    tracer.set_enabled(true);
+    {
+        StepTracer::Span span(tracer, "step");
+        StepTracer::Span ended_span(tracer, "scheduling");
+        ended_span.end();
+    }
+    record(tracer, "infer", std::chrono::microseconds(0));
+    record(tracer, "infer", std::chrono::microseconds(3));
+    record(tracer, "infer", std::chrono::microseconds(1000));
+
+    auto statistics = tracer.get_statistics();
+    ASSERT_EQ(statistics.size(), 3);
+    EXPECT_EQ(statistics.at("step").count, 1);
+    EXPECT_EQ(statistics.at("scheduling").count, 1);
+
+    const ov::genai::TraceSpanStatistics& infer = statistics.at("infer");
+    EXPECT_EQ(infer.count, 3);
+    EXPECT_FLOAT_EQ(infer.min_ms, 0.0f);
+    EXPECT_FLOAT_EQ(infer.max_ms, 1.0f);
+    EXPECT_FLOAT_EQ(infer.total_ms, 1.003f);
+    // 0 us, 3 us in [2, 4) and 1000 us in [512, 1024)
+    EXPECT_EQ(infer.histogram[0], 1);
+    EXPECT_EQ(infer.histogram[2], 1);
+    EXPECT_EQ(infer.histogram[10], 1);
+    EXPECT_EQ(std::accumulate(infer.histogram.begin(), infer.histogram.end(), size_t{0}), 3);
+
+    tracer.clear();
+    EXPECT_TRUE(tracer.get_statistics().empty());
+    EXPECT_TRUE(tracer.is_enabled());
+}
+
+TEST(TestStepTracer, children_write_to_parent_trace) {
+    StepTracer tracer;
+    StepTracer main = tracer.child("main"), draft = tracer.child("draft");
+    tracer.set_enabled(true);
+    EXPECT_TRUE(main.is_enabled());
+
+    record(tracer, "step", std::chrono::microseconds(10));
+    record(main, "step", std::chrono::microseconds(5));
+    record(draft.child("inner"), "step", std::chrono::microseconds(1));
+
+    auto statistics = tracer.get_statistics();
+    ASSERT_EQ(statistics.size(), 3);
+    EXPECT_EQ(statistics.count("step"), 1);
+    EXPECT_EQ(statistics.count("main/step"), 1);
+    EXPECT_EQ(statistics.count("draft/inner/step"), 1);
+
+    auto events = nlohmann::json::parse(tracer.get_chrome_trace())["traceEvents"];
+    ASSERT_EQ(events.size(), 3);
+    EXPECT_EQ(events[0]["cat"], "pipeline");
+    EXPECT_EQ(events[1]["cat"], "main");
+    EXPECT_EQ(events[1]["ph"], "X");
+    EXPECT_DOUBLE_EQ(events[1]["dur"].get<double>(), 5.0);
+}
+
+TEST(TestStepTracer, keeps_limited_number_of_events) {
+    StepTracer tracer(2);
+    tracer.set_enabled(true);
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&tracer] {
+            for (size_t i = 0; i < 100; ++i)
+                StepTracer::Span span(tracer, "step");
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    auto trace = nlohmann::json::parse(tracer.get_chrome_trace());
+    EXPECT_EQ(trace["traceEvents"].size(), 2);
+    EXPECT_EQ(trace["otherData"]["dropped_events"], 398);
+    EXPECT_EQ(tracer.get_statistics().at("step").count, 400);
+}
@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "image_generation/models/text_encoder_cache.hpp"
+
+using ov::genai::TextEncoderCache;
+
+namespace {
+
+// fake encoder with two outputs: [batch, 3] filled with a prompt length and [batch] filled with a batch index
+struct FakeEncoder {
+    std::vector<std::vector<std::string>> calls;
+
+    TextEncoderCache::Outputs operator()(const std::vector<std::string>& prompts) {
+        calls.push_back(prompts);
+        ov::Tensor hidden_state(ov::element::f32, {prompts.size(), 3}), pooled(ov::element::f32, {prompts.size()});
+        for (size_t i = 0; i < prompts.size(); ++i) {
+            std::fill_n(hidden_state.data<float>() + i * 3, 3, static_cast<float>(prompts[i].size()));
+            pooled.data<float>()[i] = static_cast<float>(i);
+        }
+        return {hidden_state, pooled};
+    }
+};
+
+}  // namespace
+
+TEST(TestTextEncoderCache, disabled_cache_always_encodes) {
+    TextEncoderCache cache;
+    FakeEncoder encoder;
+    auto encode = [&](const std::vector<std::string>& prompts) { return encoder(prompts); };
+
+    cache.encode({"", "a cat"}, 77, true, encode);
+    cache.encode({"", "a cat"}, 77, true, encode);
+
+    EXPECT_EQ(encoder.calls.size(), 2);
+    EXPECT_EQ(cache.get_stats().size, 0);
+    EXPECT_EQ(cache.get_stats().hits + cache.get_stats().misses, 0);
+}
+
+TEST(TestTextEncoderCache, repeated_batch_is_assembled_from_cache) {
+    TextEncoderCache cache(4);
+    FakeEncoder encoder;
+    auto encode = [&](const std::vector<std::string>& prompts) { return encoder(prompts); };
+
+    auto first = cache.encode({"", "a cat"}, 77, false, encode);
+    auto second = cache.encode({"", "a cat"}, 77, false, encode);
+
+    ASSERT_EQ(encoder.calls.size(), 1);
+    ASSERT_EQ(second.size(), first.size());
+    for (size_t idx = 0; idx < first.size(); ++idx) {
+        ASSERT_EQ(second[idx].get_shape(), first[idx].get_shape());
+        for (size_t i = 0; i < first[idx].get_size(); ++i)
+            EXPECT_EQ(second[idx].data<float>()[i], first[idx].data<float>()[i]);
+    }
+
+    auto stats = cache.get_stats();
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.size, 2);
+    EXPECT_FLOAT_EQ(stats.get_hit_rate(), 0.5f);
+}
+
+TEST(TestTextEncoderCache, partial_batch_encodes_missing_prompts_only) {
+    TextEncoderCache cache(4);
+    FakeEncoder encoder;
+    auto encode = [&](const std::vector<std::string>& prompts) { return encoder(prompts); };
+
+    cache.encode({"", "a cat"}, 77, true, encode);
+    auto outputs = cache.encode({"", "a dog on a sofa"}, 77, true, encode);
+
+    ASSERT_EQ(encoder.calls.size(), 2);
+    EXPECT_EQ(encoder.calls[1], std::vector<std::string>{"a dog on a sofa"});
+
+    // the negative prompt row comes from the cache, the positive one is encoded with batch size 1
+    ASSERT_EQ(outputs[0].get_shape(), ov::Shape({2, 3}));
+    EXPECT_EQ(outputs[0].data<float>()[0], 0.0f);
+    EXPECT_EQ(outputs[0].data<float>()[3], 15.0f);
+    EXPECT_EQ(outputs[1].data<float>()[0], 0.0f);
+    EXPECT_EQ(outputs[1].data<float>()[1], 0.0f);
+
+    // a model with static batch encodes missing prompts padded to the batch size
+    outputs = cache.encode({"", "a bird"}, 77, false, encode);
+    ASSERT_EQ(encoder.calls.size(), 3);
+    EXPECT_EQ(encoder.calls[2], std::vector<std::string>({"a bird", "a bird"}));
+    ASSERT_EQ(outputs[0].get_shape(), ov::Shape({2, 3}));
+    EXPECT_EQ(outputs[0].data<float>()[0], 0.0f);
+    EXPECT_EQ(outputs[0].data<float>()[3], 6.0f);
+    EXPECT_EQ(cache.get_stats().hits, 2);
+}
+
+TEST(TestTextEncoderCache, key_includes_max_sequence_length) {
+    TextEncoderCache cache(4);
+    FakeEncoder encoder;
+    auto encode = [&](const std::vector<std::string>& prompts) { return encoder(prompts); };
+
+    cache.encode({"a cat"}, 256, true, encode);
+    cache.encode({"a cat"}, 512, true, encode);
+    cache.encode({"a cat"}, 256, true, encode);
+
+    EXPECT_EQ(encoder.calls.size(), 2);
+    EXPECT_EQ(cache.get_stats().hits, 1);
+}
+
+TEST(TestTextEncoderCache, least_recently_used_prompt_is_evicted) {
+    TextEncoderCache cache(2);
+    FakeEncoder encoder;
+    auto encode = [&](const std::vector<std::string>& prompts) { return encoder(prompts); };
+
+    cache.encode({"a"}, 77, true, encode);
+    cache.encode({"b"}, 77, true, encode);
+    cache.encode({"a"}, 77, true, encode);  // "b" becomes the least recently used
+    cache.encode({"c"}, 77, true, encode);
+    EXPECT_EQ(cache.get_stats().size, 2);
+
+    cache.encode({"a"}, 77, true, encode);
+    EXPECT_EQ(encoder.calls.size(), 3);
+    cache.encode({"b"}, 77, true, encode);
+    EXPECT_EQ(encoder.calls.size(), 4);
+
+    cache.set_capacity(1);
+    EXPECT_EQ(cache.get_stats().size, 1);
+    cache.encode({"b"}, 77, true, encode);
+    EXPECT_EQ(encoder.calls.size(), 4);
+}
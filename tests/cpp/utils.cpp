@@ -18,4 +18,23 @@ TEST(TestIsContainer, test_is_container) {
     EXPECT_EQ(is_container<std::vector<float>>, true);
     EXPECT_EQ(is_container<map_type>, true);
     EXPECT_EQ(is_container<std::set<int64_t>>, true);
-}
\ No newline at end of file
+}
+TEST(TestMaskKVCacheTail, masks_last_tokens) {
+    ov::Tensor attention_mask(ov::element::i64, {1, 5});
+    std::fill_n(attention_mask.data<int64_t>(), 5, 1);
+
+    EXPECT_EQ(mask_kv_cache_tail(attention_mask, 2), 3);
+    const int64_t* mask = attention_mask.data<int64_t>();
+    EXPECT_EQ(std::vector<int64_t>(mask, mask + 5), std::vector<int64_t>({1, 1, 1, 0, 0}));
+}
+
+TEST(TestMaskKVCacheTail, skips_masked_tokens) {
+    ov::Tensor attention_mask(ov::element::i64, {1, 6});
+    std::vector<int64_t> values{1, 1, 0, 0, 1, 1};
+    std::copy(values.begin(), values.end(), attention_mask.data<int64_t>());
+
+    EXPECT_EQ(mask_kv_cache_tail(attention_mask, 3), 1);
+    const int64_t* mask = attention_mask.data<int64_t>();
+    EXPECT_EQ(std::vector<int64_t>(mask, mask + 6), std::vector<int64_t>({1, 0, 0, 0, 0, 0}));
+    EXPECT_THROW(mask_kv_cache_tail(attention_mask, 2), ov::Exception);
+}
@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "image_generation/vae_tiling.hpp"
+
+using ov::genai::TileRange;
+
+TEST(TestVAETiling, single_tile_when_range_fits) {
+    auto tiles = ov::genai::split_into_tiles(48, 64, 16);
+    ASSERT_EQ(tiles.size(), 1);
+    EXPECT_EQ(tiles[0].begin, 0);
+    EXPECT_EQ(tiles[0].size, 48);
+    EXPECT_EQ(tiles[0].overlap_before, 0);
+    EXPECT_EQ(tiles[0].overlap_after, 0);
+}
+
+TEST(TestVAETiling, tiles_cover_range_with_overlap) {
+    for (size_t length : {65, 112, 113, 160, 256, 257}) {
+        const size_t tile_size = 64, overlap = 16;
+        auto tiles = ov::genai::split_into_tiles(length, tile_size, overlap);
+        ASSERT_GT(tiles.size(), 1);
+
+        EXPECT_EQ(tiles.front().begin, 0);
+        EXPECT_EQ(tiles.back().begin + tiles.back().size, length);
+        EXPECT_EQ(tiles.front().overlap_before, 0);
+        EXPECT_EQ(tiles.back().overlap_after, 0);
+        for (size_t i = 1; i < tiles.size(); ++i) {
+            EXPECT_EQ(tiles[i].size, tile_size);
+            EXPECT_GT(tiles[i].begin, tiles[i - 1].begin);
+            // rounding of evenly distributed tile positions may shorten overlap by one element
+            EXPECT_GE(tiles[i].overlap_before + 1, overlap);
+            EXPECT_EQ(tiles[i].overlap_before, tiles[i - 1].begin + tile_size - tiles[i].begin);
+            EXPECT_EQ(tiles[i - 1].overlap_after, tiles[i].overlap_before);
+        }
+
+        // fewer tiles can't provide the overlap
+        EXPECT_LT((tiles.size() - 2) * (tile_size - overlap) + tile_size, length);
+    }
+}
+
+TEST(TestVAETiling, blending_weights_are_complementary_on_seams) {
+    auto tiles = ov::genai::split_into_tiles(100, 64, 28);
+    ASSERT_EQ(tiles.size(), 2);
+
+    auto first = ov::genai::get_blending_weights(tiles[0]), second = ov::genai::get_blending_weights(tiles[1]);
+    for (size_t position = 0; position < 100; ++position) {
+        float sum = 0.0f;
+        if (position < tiles[0].begin + tiles[0].size)
+            sum += first[position - tiles[0].begin];
+        if (position >= tiles[1].begin)
+            sum += second[position - tiles[1].begin];
+        EXPECT_NEAR(sum, 1.0f, 1e-6f);
+    }
+}
+
+TEST(TestVAETiling, blending_tiles_of_constant_tensor_restores_it) {
+    const size_t batch = 2, channels = 3, height = 40, width = 70, tile_size = 24, overlap = 8;
+    auto tiles_y = ov::genai::split_into_tiles(height, tile_size, overlap);
+    auto tiles_x = ov::genai::split_into_tiles(width, tile_size, overlap);
+
+    for (bool channels_last : {false, true}) {
+        ov::genai::TileBlender blender(batch, channels, height, width, channels_last);
+        for (const TileRange& tile_y : tiles_y) {
+            for (const TileRange& tile_x : tiles_x) {
+                // each channel has its own value, so layout errors are visible
+                std::vector<uint8_t> tile(batch * channels * tile_y.size * tile_x.size);
+                for (size_t i = 0; i < tile.size(); ++i) {
+                    const size_t channel = channels_last ? i % channels : (i / (tile_y.size * tile_x.size)) % channels;
+                    tile[i] = static_cast<uint8_t>(100 + channel);
+                }
+                blender.add_tile(tile.data(), tile_y, tile_x);
+            }
+        }
+
+        std::vector<uint8_t> result(batch * channels * height * width);
+        blender.get_result(result.data());
+        for (size_t i = 0; i < result.size(); ++i) {
+            const size_t channel = channels_last ? i % channels : (i / (height * width)) % channels;
+            ASSERT_EQ(result[i], 100 + channel) << "channels_last " << channels_last << ", index " << i;
+        }
+    }
+}
+
+TEST(TestVAETiling, blending_smooths_seam) {
+    // two tiles with different values: the seam becomes a monotonic ramp instead of a step
+    const size_t width = 100;
+    auto tiles = ov::genai::split_into_tiles(width, 64, 28);
+    ASSERT_EQ(tiles.size(), 2);
+    TileRange row{0, 1, 0, 0};
+
+    ov::genai::TileBlender blender(1, 1, 1, width, false);
+    std::vector<float> zeros(64, 0.0f), ones(64, 1.0f);
+    blender.add_tile(zeros.data(), row, tiles[0]);
+    blender.add_tile(ones.data(), row, tiles[1]);
+
+    std::vector<float> result(width);
+    blender.get_result(result.data());
+    EXPECT_FLOAT_EQ(result.front(), 0.0f);
+    EXPECT_FLOAT_EQ(result.back(), 1.0f);
+    for (size_t i = 1; i < width; ++i) {
+        EXPECT_GE(result[i], result[i - 1]);
+        EXPECT_LT(result[i] - result[i - 1], 0.1f);
+    }
+}
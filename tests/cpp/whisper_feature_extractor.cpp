@@ -0,0 +1,121 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+
+#include "whisper/whisper_feature_extractor.hpp"
+
+namespace {
+
+std::vector<float> sine_wave(size_t n_samples, float frequency, size_t sampling_rate) {
+    std::vector<float> samples(n_samples);
+    for (size_t i = 0; i < n_samples; i++) {
+        samples[i] = 0.5f * std::sin(2.0f * static_cast<float>(M_PI) * frequency * i / sampling_rate);
+    }
+    return samples;
+}
+
+size_t loudest_mel_channel(const ov::genai::WhisperFeatures& features, size_t frame) {
+    size_t result = 0;
+    for (size_t j = 1; j < features.feature_size; j++) {
+        if (features.data[j * features.n_frames + frame] > features.data[result * features.n_frames + frame]) {
+            result = j;
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(TestWhisperFeatureExtractor, pure_tone_peaks_in_matching_mel_channel) {
+    // preprocessor_config.json doesn't exist, default whisper parameters are used
+    ov::genai::WhisperFeatureExtractor extractor("");
+
+    // 1 kHz is the boundary of linear and log parts of the slaney mel scale, 26th filter is centered at ~1005 Hz
+    auto features = extractor.extract(sine_wave(extractor.sampling_rate, 1000.0f, extractor.sampling_rate));
+    ASSERT_EQ(features.feature_size, extractor.feature_size);
+    ASSERT_EQ(features.n_frames, extractor.nb_max_frames);
+
+    for (size_t frame : {10, 50, 99}) {
+        EXPECT_EQ(loudest_mel_channel(features, frame), 26);
+    }
+
+    // doubling the frequency moves the peak towards higher channels
+    features = extractor.extract(sine_wave(extractor.sampling_rate, 2000.0f, extractor.sampling_rate));
+    EXPECT_GT(loudest_mel_channel(features, 50), 26);
+}
+
+TEST(TestWhisperFeatureExtractor, frames_after_speech_end_are_clamped) {
+    ov::genai::WhisperFeatureExtractor extractor("");
+
+    // 45 seconds, so the number of frames is not padded to 30 seconds
+    const size_t n_samples = extractor.sampling_rate * 45;
+    const auto features = extractor.extract(sine_wave(n_samples, 440.0f, extractor.sampling_rate));
+    ASSERT_EQ(features.n_frames, n_samples / extractor.hop_length);
+
+    const float max_value = *std::max_element(features.data.begin(), features.data.end());
+    const float min_value = *std::min_element(features.data.begin(), features.data.end());
+    // values are clamped to (max - 8) before (x + 4) / 4 normalization
+    EXPECT_NEAR(max_value - min_value, 2.0f, 1e-5f);
+
+    for (size_t j = 0; j < features.feature_size; j++) {
+        for (size_t frame = 10; frame < features.n_frames - 10; frame += 997) {
+            EXPECT_TRUE(std::isfinite(features.data[j * features.n_frames + frame]));
+        }
+    }
+}
+
+TEST(TestWhisperFeatureExtractor, incremental_frames_match_whole_audio) {
+    ov::genai::WhisperFeatureExtractor extractor("");
+
+    const auto samples = sine_wave(extractor.sampling_rate * 2, 440.0f, extractor.sampling_rate);
+    const auto features = extractor.extract(samples);
+
+    // interior frames don't depend on the reflect padding of the audio start
+    const size_t first_frame = 10;
+    const size_t n_frames = 50;
+    const size_t begin = first_frame * extractor.hop_length - extractor.n_fft / 2;
+    const auto frames = extractor.extract_log_mel_frames(samples.data() + begin,
+                                                         (n_frames - 1) * extractor.hop_length + extractor.n_fft,
+                                                         n_frames);
+    ASSERT_EQ(frames.feature_size, extractor.feature_size);
+    ASSERT_EQ(frames.n_frames, n_frames);
+
+    const float max_value = *std::max_element(features.data.begin(), features.data.end()) * 4.0f - 4.0f;
+    for (size_t j = 0; j < extractor.feature_size; j++) {
+        for (size_t f = 0; f < n_frames; f++) {
+            // not normalized frames, apply the same clamping and normalization as extract() does
+            const float value = (std::max(frames.data[j * n_frames + f], max_value - 8.0f) + 4.0f) / 4.0f;
+            EXPECT_NEAR(value, features.data[j * features.n_frames + first_frame + f], 1e-5f);
+        }
+    }
+}
+
+TEST(TestWhisperFeatureExtractor, n_fft_with_large_prime_factor) {
+    // 402 / 2 = 3 * 67 and 404 / 2 = 2 * 101 have prime factors transformed by the plain DFT, 201 = 3 * 67 is odd
+    for (size_t n_fft : {201, 402, 404}) {
+        const std::filesystem::path config_path = std::filesystem::temp_directory_path() / "genai_preprocessor_config.json";
+        {
+            std::ofstream config(config_path);
+            config << "{\"n_fft\": " << n_fft << "}";
+        }
+        ov::genai::WhisperFeatureExtractor extractor(config_path);
+        std::filesystem::remove(config_path);
+        ASSERT_EQ(extractor.n_fft, n_fft);
+
+        const auto features = extractor.extract(sine_wave(extractor.sampling_rate, 1000.0f, extractor.sampling_rate));
+        for (float value : features.data) {
+            ASSERT_TRUE(std::isfinite(value));
+        }
+        // frequency resolution of 201 is too low to separate neighbour mel channels
+        if (n_fft > 400) {
+            EXPECT_EQ(loudest_mel_channel(features, 50), 26);
+        }
+    }
+}
@@ -99,6 +99,37 @@ def test_chat_compare_text_history_with_HF(model_descr, generation_config: Dict)
     assert chat_history_ov == chat_history_hf
 
 
+@pytest.mark.parametrize("generation_config", configs)
+@pytest.mark.parametrize("offload", [False, True])
+@pytest.mark.precommit
+@pytest.mark.nightly
+def test_chat_suspend_resume_matches_uninterrupted_chat(generation_config: Dict, offload: bool, tmp_path):
+    model_descr = get_chat_models_list()[0]
+    model_id, path, tokenizer, model_opt, pipe = read_model((model_descr[0], model_descr[1] / '_test_chat'))
+
+    pipe.start_chat()
+    answers_uninterrupted = [pipe.generate(prompt, **generation_config) for prompt in quenstions]
+    pipe.finish_chat()
+
+    split = len(quenstions) // 2
+    pipe.start_chat()
+    answers = [pipe.generate(prompt, **generation_config) for prompt in quenstions[:split]]
+    session = pipe.suspend_chat()
+
+    # another chat overwrites KV cache of the pipeline in between
+    pipe.start_chat()
+    pipe.generate('Why is the sky blue?', **generation_config)
+    pipe.finish_chat()
+
+    if offload:
+        session.offload(tmp_path / 'chat_session.bin')
+    pipe.resume_chat(session)
+    answers += [pipe.generate(prompt, **generation_config) for prompt in quenstions[split:]]
+    pipe.finish_chat()
+
+    assert answers == answers_uninterrupted
+
+
 @pytest.mark.parametrize("generation_config", configs)
 @pytest.mark.parametrize("model_descr", get_chat_models_list())
 @pytest.mark.precommit
@@ -242,3 +273,34 @@ def test_add_special_tokens(add_special_tokens, skip_special_tokens, prompt):
     decoded_genai = genai_tokenizer.decode(res_genai, skip_special_tokens=skip_special_tokens)[0]
     decoded_hf = hf_tokenizer.decode(res_hf[0], skip_special_tokens=skip_special_tokens)
     assert decoded_genai == decoded_hf
+
+
+@pytest.mark.precommit
+@pytest.mark.nightly
+@pytest.mark.parametrize("performance_hint", ["LATENCY", "THROUGHPUT"])
+def test_large_batch_matches_single_prompts(performance_hint):
+    import numpy as np
+    model_descr = get_chat_models_list()[0]
+    model_id, path, hf_tokenizer, model_opt, pipe = read_model((model_descr[0], model_descr[1] / '_test_chat'))
+    # THROUGHPUT hint gives several infer requests, so sub-batches are processed in parallel
+    genai_tokenizer = ov_genai.Tokenizer(path, PERFORMANCE_HINT=performance_hint)
+
+    # more prompts than fit into a single sub-batch, of different lengths so that sub-batches are reordered by length
+    batch = [prompts[i % len(prompts)] * (1 + i % 5) for i in range(300)]
+
+    # special tokens states are toggled between calls, each infer request of the pool has to follow them
+    for add_special_tokens, skip_special_tokens in [(True, True), (False, False), (True, False), (False, True)]:
+        encoded = genai_tokenizer.encode(batch, add_special_tokens)
+        input_ids, attention_mask = encoded.input_ids.data, encoded.attention_mask.data
+        assert input_ids.shape[0] == len(batch)
+
+        batch_tokens = []
+        for i, prompt in enumerate(batch):
+            tokens = input_ids[i][attention_mask[i] == 1]
+            assert np.array_equal(tokens, genai_tokenizer.encode(prompt, add_special_tokens).input_ids.data[0])
+            batch_tokens.append(tokens.tolist())
+
+        decoded = genai_tokenizer.decode(batch_tokens, skip_special_tokens=skip_special_tokens)
+        assert len(decoded) == len(batch)
+        for tokens, text in zip(batch_tokens, decoded):
+            assert text == genai_tokenizer.decode(tokens, skip_special_tokens=skip_special_tokens)
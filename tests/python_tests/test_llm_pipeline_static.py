@@ -48,6 +48,52 @@ def test_generation_compare_with_stateful():
     assert ref_out == actual_out
 
 
+@pytest.mark.skipif(sys.platform in ["darwin", "linux"], reason="Not supposed to work on mac. Segfault on linux CI")
+@pytest.mark.precommit
+@pytest.mark.nightly
+@pytest.mark.parametrize("num_sentences", [1, 20])
+def test_chunked_prefill_compare_with_stateful(num_sentences):
+    # NB: Prompts are shorter and longer than a chunk
+    prompt = 'The Sun is yellow because' + ' The Sun is a star.' * num_sentences
+    model_path = get_models_list()[0][1]
+
+    stateful_pipe = ov_genai.LLMPipeline(model_path, "CPU")
+    ref_out = stateful_pipe.generate(prompt, max_new_tokens=50)
+
+    pipeline_config = { "MAX_PROMPT_LEN": 512, "PREFILL_CHUNK_SIZE": 64 }
+    pipeline_config |= common_config
+    static_pipe = ov_genai.LLMPipeline(model_path, "NPU", **pipeline_config)
+    actual_out = static_pipe.generate(prompt, max_new_tokens=50)
+
+    if ref_out != actual_out:
+        print(f'ref_out: {ref_out}\n')
+        print(f'actual_out: {actual_out}')
+    assert ref_out == actual_out
+
+
+@pytest.mark.precommit
+@pytest.mark.nightly
+def test_chunked_prefill_long_prompt_compare_with_stateful():
+    # NB: Prompt is longer than MAX_PROMPT_LEN, chunked prefill places it in the whole KV-cache
+    prompt = 'The Sun is yellow because' + ' The Sun is a star.' * 40
+    model_path = get_models_list()[0][1]
+
+    stateful_pipe = ov_genai.LLMPipeline(model_path, "CPU")
+    ref_out = stateful_pipe.generate(prompt, max_new_tokens=20)
+
+    # NB: Static pipeline is compiled for CPU directly, so the test doesn't need NPU plugin
+    pipeline_config = { "STATIC_PIPELINE": True, "MAX_PROMPT_LEN": 128, "MIN_RESPONSE_LEN": 256, "PREFILL_CHUNK_SIZE": 64,
+                        "PREFILL_CONFIG": { }, "GENERATE_CONFIG": { } }
+    static_pipe = ov_genai.LLMPipeline(model_path, "CPU", **pipeline_config)
+    assert static_pipe.get_tokenizer().encode(prompt).input_ids.get_size() > pipeline_config["MAX_PROMPT_LEN"]
+    actual_out = static_pipe.generate(prompt, max_new_tokens=20)
+
+    if ref_out != actual_out:
+        print(f'ref_out: {ref_out}\n')
+        print(f'actual_out: {actual_out}')
+    assert ref_out == actual_out
+
+
 @pytest.mark.skipif(sys.platform in ["darwin", "linux"], reason="Not supposed to work on mac. Segfault on linux CI")
 @pytest.mark.precommit
 @pytest.mark.nightly
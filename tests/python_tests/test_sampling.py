@@ -406,3 +406,46 @@ def test_post_oom_health(tmp_path, sampling_config):
     output = pipe.generate(["What is OpenVINO?"], generation_configs)
     assert (len(output))
     assert(len(output[0].m_generation_ids))
+
+
+@pytest.mark.precommit
+def test_engine_outputs_match_generate(tmp_path):
+    import threading
+    generation_config = get_greedy()
+    model_id : str = "facebook/opt-125m"
+    model, hf_tokenizer = get_model_and_tokenizer(model_id, use_optimum=True)
+
+    model_path : Path = tmp_path / model_id
+    save_ov_model_from_optimum(model, hf_tokenizer, model_path)
+
+    tokenizer = Tokenizer(model_path.absolute().as_posix())
+    pipe = ContinuousBatchingPipeline(model_path.absolute().as_posix(), tokenizer, get_scheduler_config(), "CPU", {})
+    prompts = ["What is OpenVINO?", "How are you?", "Why is the Sun yellow?"]
+    input_ids = [tokenizer.encode(prompt).input_ids for prompt in prompts]
+    reference = [result.m_generation_ids[0] for result in pipe.generate(input_ids, [generation_config] * len(prompts))]
+
+    pipe.start_engine()
+
+    # the callback waits for the GIL on the engine thread, while the main thread waits for outputs of other requests
+    callback_tokens = []
+    callback_finished = threading.Event()
+    def callback(outputs):
+        if not outputs:
+            callback_finished.set()
+        for output in outputs.values():
+            callback_tokens.extend(output.generated_ids)
+
+    callback_handle = pipe.add_request(0, input_ids[0], generation_config)
+    callback_handle.set_callback(callback)
+    async_handle = pipe.add_request(1, input_ids[1], generation_config)
+    read_handle = pipe.add_request(2, input_ids[2], generation_config)
+
+    async_tokens = []
+    while outputs := async_handle.read_async().result():
+        for output in outputs.values():
+            async_tokens.extend(output.generated_ids)
+    read_tokens = read_handle.read_all()[0].generated_ids
+    assert callback_finished.wait(timeout=60)
+    pipe.stop_engine()
+
+    assert [callback_tokens, async_tokens, read_tokens] == reference
@@ -7,7 +7,7 @@ import pytest
 import transformers
 from optimum.intel.openvino import OVModelForVisualCausalLM
 from openvino_genai import VLMPipeline
-from common import get_greedy, get_image_by_link, get_beam_search, get_greedy, get_multinomial_all_parameters
+from common import get_greedy, get_image_by_link, get_beam_search, get_greedy, get_multinomial_all_parameters, get_scheduler_config
 
 def get_ov_model(cache):
     model_dir = cache.mkdir("tiny-random-minicpmv-2_6")
@@ -66,6 +66,22 @@ def test_vlm_pipeline(cache):
         pipe.finish_chat()
 
 
+@pytest.mark.precommit
+@pytest.mark.nightly
+def test_vlm_continuous_batching_vs_stateful(cache):
+    models_path = get_ov_model(cache)
+    stateful_pipe = VLMPipeline(models_path, "CPU")
+    # scheduler_config switches VLMPipeline to continuous batching backend
+    cb_pipe = VLMPipeline(models_path, "CPU", scheduler_config=get_scheduler_config())
+
+    for links in image_links_for_testing:
+        images = [get_image_by_link(link) for link in links]
+        for prompt in prompts:
+            stateful_result = stateful_pipe.generate(prompt, images=images, generation_config=get_greedy())
+            cb_result = cb_pipe.generate(prompt, images=images, generation_config=get_greedy())
+            assert stateful_result.texts == cb_result.texts
+
+
 @pytest.mark.precommit
 @pytest.mark.nightly
 def test_vlm_get_tokenizer(cache):
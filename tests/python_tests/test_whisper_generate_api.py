@@ -3,6 +3,7 @@
 
 import openvino_genai as ov_genai
 import functools
+import math
 import pytest
 import openvino_tokenizers
 import openvino
@@ -570,6 +571,157 @@ def test_longform_audio(model_descr, test_sample):
     assert genai_result.chunks == None
 
 
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize(
+    "test_sample",
+    [
+        *get_samples_from_dataset(language="en", length=3, long_form=True),
+    ],
+)
+@pytest.mark.precommit
+def test_longform_audio_chunks_batch(model_descr, test_sample):
+    model_id, path, opt_pipe, pipe = read_whisper_model(model_descr)
+
+    chunks_batch_size = 2
+    num_chunks = math.ceil(len(test_sample) / (16000 * 30))
+
+    genai_result = pipe.generate(test_sample, chunks_batch_size=chunks_batch_size)
+
+    assert genai_result.texts[0]
+    assert genai_result.chunks == None
+
+    whisper_raw_metrics = genai_result.perf_metrics.whisper_raw_metrics
+    assert len(whisper_raw_metrics.encode_inference_durations) == math.ceil(num_chunks / chunks_batch_size)
+    assert len(whisper_raw_metrics.decode_durations) == math.ceil(num_chunks / chunks_batch_size)
+    assert genai_result.perf_metrics.get_encode_inference_duration().mean > 0
+    assert genai_result.perf_metrics.get_decode_duration().mean > 0
+
+    genai_result = pipe.generate(test_sample, chunks_batch_size=chunks_batch_size, return_timestamps=True)
+
+    assert genai_result.chunks
+    # timestamps are shifted by the start of the fixed 30 seconds chunk
+    starts = [chunk.start_ts for chunk in genai_result.chunks]
+    assert starts == sorted(starts)
+    assert starts[-1] < len(test_sample) / 16000
+
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize(
+    "test_sample",
+    [
+        *get_samples_from_dataset(language="en", length=1, long_form=True),
+    ],
+)
+@pytest.mark.precommit
+def test_longform_audio_chunks_batch_with_silent_chunk(model_descr, test_sample):
+    model_id, path, opt_pipe, pipe = read_whisper_model(model_descr)
+
+    chunk_size = 16000 * 30
+    speech = np.asarray(test_sample[:chunk_size], dtype=np.float32)
+    speech = np.pad(speech, (0, chunk_size - len(speech)))
+    silence = np.zeros(chunk_size, dtype=np.float32)
+    # speech comes first and the language is fixed, so no chunk detects its language on silence
+    chunks = [speech, silence, speech, silence]
+
+    # each chunk decoded separately
+    expected_words = []
+    for chunk in chunks:
+        expected_words += pipe.generate(chunk.tolist(), language="<|en|>").texts[0].split()
+
+    # all chunks are decoded as one batch, rows of silent chunks may finish at the first token
+    genai_result = pipe.generate(
+        np.concatenate(chunks).tolist(), language="<|en|>", chunks_batch_size=len(chunks)
+    )
+
+    assert genai_result.texts[0].split() == expected_words
+
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize(
+    "test_sample",
+    [
+        *get_samples_from_dataset(language="en", length=1, long_form=True),
+    ],
+)
+@pytest.mark.precommit
+def test_live_transcription(model_descr, test_sample):
+    model_id, path, opt_pipe, pipe = read_whisper_model(model_descr)
+
+    sampling_rate = 16000
+    frames_per_push = sampling_rate // 2
+
+    pipe.start_stream(step=1.0)
+
+    chunks = []
+    partial_texts = []
+    for offset in range(0, len(test_sample), frames_per_push):
+        result = pipe.push_audio(test_sample[offset : offset + frames_per_push])
+        chunks += result.final_chunks
+        partial_texts.append(result.partial_text)
+
+    result = pipe.finish_stream()
+    chunks += result.final_chunks
+
+    assert result.partial_text == ""
+    assert any(partial_texts)
+    assert chunks
+
+    # final chunks are never revised, so they come in order of the stream
+    starts = [chunk.start_ts for chunk in chunks]
+    assert starts == sorted(starts)
+    assert chunks[-1].end_ts <= len(test_sample) / sampling_rate + 1
+
+    # the same words as for offline transcription are recognized
+    streamed_words = set("".join(chunk.text for chunk in chunks).lower().split())
+    offline_words = set(pipe.generate(test_sample).texts[0].lower().split())
+    assert len(streamed_words & offline_words) > 0.5 * len(offline_words)
+
+    with pytest.raises(RuntimeError):
+        pipe.push_audio(test_sample[:frames_per_push])
+
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+# chunks which don't fit the encoder batch are encoded at the next steps
+@pytest.mark.parametrize("max_num_encoder_seqs", [1, 4])
+@pytest.mark.precommit
+def test_continuous_batching(model_descr, max_num_encoder_seqs):
+    model_id, path, opt_pipe, pipe = read_whisper_model(model_descr)
+
+    samples = [
+        *get_samples_from_dataset(language="en", length=3),
+        *get_samples_from_dataset(language="en", length=1, long_form=True),
+    ]
+    configs = [pipe.get_generation_config() for _ in samples]
+    configs[1].return_timestamps = True
+
+    scheduler_config = ov_genai.SchedulerConfig()
+    scheduler_config.max_num_seqs = 2
+    scheduler_config.max_num_encoder_seqs = max_num_encoder_seqs
+    cb_pipe = ov_genai.WhisperContinuousBatchingPipeline(path, scheduler_config, "CPU")
+
+    results = cb_pipe.generate(samples, configs)
+
+    assert len(results) == len(samples)
+    for sample, config, result in zip(samples, configs, results):
+        expected = pipe.generate(sample, config)
+        assert result.texts[0] == expected.texts[0]
+        assert (result.chunks is None) == (expected.chunks is None)
+
+    # language detection is a decoder inference, short-form samples are encoded once
+    for result in results[:-1]:
+        assert len(result.perf_metrics.whisper_raw_metrics.encode_inference_durations) == 1
+
+    # streaming through handles
+    handles = [cb_pipe.add_request(request_id, sample, configs[0]) for request_id, sample in enumerate(samples[:2])]
+    while cb_pipe.has_non_finished_requests():
+        cb_pipe.step()
+
+    for sample, handle in zip(samples, handles):
+        outputs = handle.read_all()
+        text = cb_pipe.get_tokenizer().decode(outputs[0].generated_ids)
+        assert text == pipe.generate(sample, configs[0]).texts[0]
+
+
 @pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
 @pytest.mark.parametrize(
     "test_sample",
@@ -633,3 +785,8 @@ def test_perf_metrics(model_descr, test_sample):
     mean_dur, std_dur = perf_metrics.get_features_extraction_duration()
     assert np.allclose(mean_dur, np.mean(raw_dur))
     assert np.allclose(std_dur, np.std(raw_dur))
+
+    raw_dur = np.array(whisper_raw_metrics.encode_inference_durations) / 1000
+    mean_dur, std_dur = perf_metrics.get_encode_inference_duration()
+    assert np.allclose(mean_dur, np.mean(raw_dur))
+    assert np.allclose(std_dur, np.std(raw_dur))
@@ -0,0 +1,183 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include <cxxopts.hpp>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::vector<std::string> parse_list(const std::string& list) {
+    std::vector<std::string> values;
+    std::istringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        values.push_back(item);
+    }
+    return values;
+}
+
+struct RequestTimes {
+    double ttft_ms = 0.0;
+    double inter_token_ms = 0.0;
+};
+
+// reads outputs of a request with `mode` and returns its time to first token and mean time between next chunks
+RequestTimes consume(const std::string& mode, ov::genai::GenerationHandle& handle, Clock::time_point start) {
+    std::vector<Clock::time_point> chunk_times;
+    if (mode == "polling") {
+        // the way clients of step() driven pipelines wait for outputs
+        while (handle->get_status() == ov::genai::GenerationStatus::RUNNING || handle->can_read()) {
+            if (handle->can_read()) {
+                handle->read();
+                chunk_times.push_back(Clock::now());
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    } else if (mode == "futures") {
+        while (!handle->read_async().get().empty()) {
+            chunk_times.push_back(Clock::now());
+        }
+    } else {
+        std::promise<void> finished;
+        handle->set_callback([&](ov::genai::GenerationOutputs outputs) {
+            if (outputs.empty()) {
+                finished.set_value();
+            } else {
+                chunk_times.push_back(Clock::now());
+            }
+        });
+        finished.get_future().wait();
+    }
+
+    RequestTimes times;
+    if (!chunk_times.empty()) {
+        times.ttft_ms = std::chrono::duration<double, std::milli>(chunk_times.front() - start).count();
+        if (chunk_times.size() > 1) {
+            times.inter_token_ms = std::chrono::duration<double, std::milli>(chunk_times.back() - chunk_times.front()).count() / (chunk_times.size() - 1);
+        }
+    }
+    return times;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("engine_latency_benchmark",
+                             "Measures end-to-end latency of streamed requests when a client thread drives step() and polls handles "
+                             "and when the pipeline engine thread passes outputs to futures or callbacks");
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>())
+    ("d,device", "Target device to run the model", cxxopts::value<std::string>()->default_value("CPU"))
+    ("modes", "Comma separated list of modes: polling, futures, callbacks", cxxopts::value<std::string>()->default_value("polling,futures,callbacks"))
+    ("c,clients", "Number of client threads sending requests one after another", cxxopts::value<size_t>()->default_value("8"))
+    ("n,num_prompts", "Number of requests per measurement", cxxopts::value<size_t>()->default_value("64"))
+    ("max_new_tokens", "Number of tokens generated for each request", cxxopts::value<size_t>()->default_value("64"))
+    ("p,prompt", "Prompt used by all requests", cxxopts::value<std::string>()->default_value("The Sky is blue because"))
+    ("cache_size", "Size of memory used for KV cache in GB", cxxopts::value<size_t>()->default_value("4"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help") || !result.count("model")) {
+        std::cout << options.help() << std::endl;
+        return result.count("help") ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    const size_t num_prompts = result["num_prompts"].as<size_t>(), num_clients = result["clients"].as<size_t>();
+    const std::string prompt = result["prompt"].as<std::string>();
+
+    ov::genai::SchedulerConfig scheduler_config;
+    scheduler_config.cache_size = result["cache_size"].as<size_t>();
+    scheduler_config.max_num_seqs = num_clients;
+    ov::genai::ContinuousBatchingPipeline pipe(result["model"].as<std::string>(), scheduler_config, result["device"].as<std::string>());
+
+    ov::genai::GenerationConfig config = ov::genai::greedy();
+    config.max_new_tokens = result["max_new_tokens"].as<size_t>();
+    config.ignore_eos = true;
+
+    std::cout << "mode, requests, duration ms, tokens/s, mean TTFT ms, mean inter-token ms, CPU time s" << std::endl;
+    for (const std::string& mode : parse_list(result["modes"].as<std::string>())) {
+        OPENVINO_ASSERT(mode == "polling" || mode == "futures" || mode == "callbacks", "Unknown mode ", mode);
+
+        std::atomic<bool> clients_finished{false};
+        std::thread driver;
+        if (mode == "polling") {
+            driver = std::thread([&] {
+                while (!clients_finished) {
+                    if (pipe.has_non_finished_requests())
+                        pipe.step();
+                    else
+                        std::this_thread::yield();
+                }
+            });
+        } else {
+            pipe.start_engine();
+        }
+
+        std::atomic<size_t> next_request{0};
+        std::mutex times_mutex;
+        std::vector<RequestTimes> request_times;
+        const std::clock_t cpu_start = std::clock();
+        const auto start = Clock::now();
+
+        std::vector<std::thread> clients;
+        for (size_t client = 0; client < num_clients; ++client) {
+            clients.emplace_back([&] {
+                for (size_t request_id = next_request++; request_id < num_prompts; request_id = next_request++) {
+                    const auto request_start = Clock::now();
+                    ov::genai::GenerationHandle handle = pipe.add_request(request_id, prompt, config);
+                    RequestTimes times = consume(mode, handle, request_start);
+                    std::lock_guard<std::mutex> lock(times_mutex);
+                    request_times.push_back(times);
+                }
+            });
+        }
+        for (std::thread& client : clients)
+            client.join();
+
+        const double duration_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        const double cpu_seconds = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+        clients_finished = true;
+        if (driver.joinable())
+            driver.join();
+        pipe.stop_engine();
+
+        double ttft_ms = 0.0, inter_token_ms = 0.0;
+        for (const RequestTimes& times : request_times) {
+            ttft_ms += times.ttft_ms;
+            inter_token_ms += times.inter_token_ms;
+        }
+        std::cout << mode << ", " << num_prompts << ", " << duration_ms << ", " << num_prompts * config.max_new_tokens * 1000.0 / duration_ms << ", "
+                  << ttft_ms / num_prompts << ", " << inter_token_ms / num_prompts << ", " << cpu_seconds << std::endl;
+    }
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
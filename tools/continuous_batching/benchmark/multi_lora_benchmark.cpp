@@ -0,0 +1,110 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#include <cxxopts.hpp>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "openvino/genai/lora_adapter.hpp"
+
+namespace {
+
+template <typename T>
+std::vector<T> parse_list(const std::string& list) {
+    std::vector<T> values;
+    std::istringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        T value;
+        std::istringstream(item) >> value;
+        values.push_back(value);
+    }
+    return values;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("multi_lora_benchmark",
+                             "Measures throughput of continuous batching when requests of a batch use different LoRA adapters");
+    options.add_options()
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>())
+    ("a,adapters", "Comma separated list of LoRA adapter files, requests cycle over them", cxxopts::value<std::string>())
+    ("d,device", "Target device to run the model", cxxopts::value<std::string>()->default_value("CPU"))
+    ("distinct_adapters", "Comma separated list of numbers of distinct adapter configs per batch, 0 means no adapters", cxxopts::value<std::string>()->default_value("0,1,8,64"))
+    ("n,num_prompts", "Number of requests per measurement", cxxopts::value<size_t>()->default_value("64"))
+    ("max_new_tokens", "Number of tokens generated for each request", cxxopts::value<size_t>()->default_value("64"))
+    ("p,prompt", "Prompt used by all requests", cxxopts::value<std::string>()->default_value("The Sky is blue because"))
+    ("cache_size", "Size of memory used for KV cache in GB", cxxopts::value<size_t>()->default_value("4"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help") || !result.count("model") || !result.count("adapters")) {
+        std::cout << options.help() << std::endl;
+        return result.count("help") ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    const size_t num_prompts = result["num_prompts"].as<size_t>();
+
+    std::vector<ov::genai::Adapter> adapters;
+    for (const auto& path : parse_list<std::string>(result["adapters"].as<std::string>())) {
+        adapters.emplace_back(path);
+    }
+
+    ov::genai::SchedulerConfig scheduler_config;
+    scheduler_config.cache_size = result["cache_size"].as<size_t>();
+    scheduler_config.max_num_seqs = num_prompts;
+
+    // all adapters the requests can use are registered once, a request selects its own config
+    ov::genai::ContinuousBatchingPipeline pipe(result["model"].as<std::string>(), scheduler_config, result["device"].as<std::string>(),
+                                               {ov::genai::adapters(adapters)});
+
+    std::cout << "distinct adapters, requests, generated tokens, duration ms, tokens/s" << std::endl;
+    for (size_t num_distinct : parse_list<size_t>(result["distinct_adapters"].as<std::string>())) {
+        std::vector<std::string> prompts(num_prompts, result["prompt"].as<std::string>());
+        std::vector<ov::genai::GenerationConfig> configs(num_prompts, ov::genai::greedy());
+        for (size_t i = 0; i < num_prompts; ++i) {
+            configs[i].max_new_tokens = result["max_new_tokens"].as<size_t>();
+            configs[i].ignore_eos = true;
+            if (num_distinct > 0) {
+                // configs differ by alpha when there are fewer files than distinct configs, each config still occupies its own slot
+                const size_t config_id = i % num_distinct;
+                configs[i].adapters = ov::genai::AdapterConfig(adapters[config_id % adapters.size()], 1.0f - 0.5f * config_id / num_distinct);
+            }
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<ov::genai::GenerationResult> results = pipe.generate(prompts, configs);
+        const double duration_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        size_t num_tokens = 0;
+        for (const auto& generation : results) {
+            OPENVINO_ASSERT(generation.m_status == ov::genai::GenerationStatus::FINISHED, "Request wasn't finished");
+            num_tokens += configs.front().max_new_tokens * generation.m_generation_ids.size();
+        }
+        std::cout << num_distinct << ", " << num_prompts << ", " << num_tokens << ", " << duration_ms << ", "
+                  << num_tokens * 1000.0 / duration_ms << std::endl;
+    }
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
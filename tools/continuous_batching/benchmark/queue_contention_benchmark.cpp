@@ -0,0 +1,173 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "mpsc_queue.hpp"
+#include "spsc_queue.hpp"
+#include "synchronized_queue.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// the way ContinuousBatchingImpl admitted requests before MPSCQueue
+class MutexAdmissionQueue {
+    std::vector<size_t> m_awaiting;
+    std::mutex m_mutex;
+
+public:
+    void push(size_t request) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_awaiting.push_back(request);
+    }
+
+    bool empty() {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_awaiting.empty();
+    }
+
+    size_t drain_to(std::vector<size_t>& requests) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        const size_t count = m_awaiting.size();
+        requests.insert(requests.end(), m_awaiting.begin(), m_awaiting.end());
+        m_awaiting.clear();
+        return count;
+    }
+};
+
+// client threads add requests while a pipeline thread checks for and pulls them, like the engine loop does
+template <typename Queue>
+double admission_ms(size_t num_clients, size_t num_requests) {
+    Queue queue;
+    std::atomic<bool> started{false};
+    std::vector<std::thread> clients;
+    for (size_t client = 0; client < num_clients; ++client) {
+        clients.emplace_back([&] {
+            while (!started.load()) {}
+            for (size_t request = 0; request < num_requests; ++request) {
+                queue.push(request);
+            }
+        });
+    }
+
+    const auto start = Clock::now();
+    started.store(true);
+    std::vector<size_t> requests;
+    requests.reserve(num_clients * num_requests);
+    while (requests.size() < num_clients * num_requests) {
+        if (!queue.empty()) {
+            queue.drain_to(requests);
+        }
+    }
+    const auto end = Clock::now();
+    for (auto& client : clients) {
+        client.join();
+    }
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// a pipeline thread pushes a token to every stream per step, a client thread per stream reads them
+template <typename Queue>
+double streaming_ms(size_t num_streams, size_t num_tokens) {
+    std::vector<Queue> streams(num_streams);
+    std::vector<std::thread> clients;
+    for (size_t stream = 0; stream < num_streams; ++stream) {
+        clients.emplace_back([&, stream] {
+            for (size_t token = 0; token < num_tokens; ++token) {
+                if (streams[stream].pull() != token) {
+                    std::cerr << "Tokens of stream " << stream << " are reordered" << std::endl;
+                    std::abort();
+                }
+            }
+        });
+    }
+
+    const auto start = Clock::now();
+    for (size_t token = 0; token < num_tokens; ++token) {
+        for (auto& stream : streams) {
+            stream.push(token);
+        }
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("queue_contention_benchmark",
+                             "Compares mutex based and lock-free queues used for request admission and output streaming "
+                             "of continuous batching pipeline under contention of many client threads");
+    options.add_options()
+    ("c,num_clients", "Number of client threads adding requests", cxxopts::value<size_t>()->default_value("64"))
+    ("r,num_requests", "Number of requests added by each client thread", cxxopts::value<size_t>()->default_value("10000"))
+    ("s,num_streams", "Number of streams read by separate client threads", cxxopts::value<size_t>()->default_value("256"))
+    ("t,num_tokens", "Number of tokens pushed to each stream", cxxopts::value<size_t>()->default_value("1000"))
+    ("n,num_iter", "Number of iterations", cxxopts::value<size_t>()->default_value("3"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const size_t num_clients = result["num_clients"].as<size_t>();
+    const size_t num_requests = result["num_requests"].as<size_t>();
+    const size_t num_streams = result["num_streams"].as<size_t>();
+    const size_t num_tokens = result["num_tokens"].as<size_t>();
+    const size_t num_iter = result["num_iter"].as<size_t>();
+
+    double mutex_admission = 0.0, lockfree_admission = 0.0, mutex_streaming = 0.0, lockfree_streaming = 0.0;
+    for (size_t iter = 0; iter < num_iter; ++iter) {
+        mutex_admission += admission_ms<MutexAdmissionQueue>(num_clients, num_requests);
+        lockfree_admission += admission_ms<MPSCQueue<size_t>>(num_clients, num_requests);
+        mutex_streaming += streaming_ms<SynchronizedQueue<size_t>>(num_streams, num_tokens);
+        lockfree_streaming += streaming_ms<SPSCQueue<size_t>>(num_streams, num_tokens);
+    }
+
+    const double num_added = static_cast<double>(num_clients * num_requests), num_streamed = static_cast<double>(num_streams * num_tokens);
+    auto print = [&](const std::string& name, double total_ms, double num_items) {
+        const double ms = total_ms / num_iter;
+        std::cout << std::left << std::setw(28) << name << std::fixed << std::setprecision(2) << ms << " ms, "
+                  << num_items / ms / 1000.0 << " M items/s" << std::endl;
+    };
+    std::cout << "Admission of " << num_clients << " x " << num_requests << " requests:" << std::endl;
+    print("  mutex + vector", mutex_admission, num_added);
+    print("  lock-free MPSC queue", lockfree_admission, num_added);
+    std::cout << "Streaming of " << num_streams << " x " << num_tokens << " tokens:" << std::endl;
+    print("  mutex + condition variable", mutex_streaming, num_streamed);
+    print("  lock-free SPSC queue", lockfree_streaming, num_streamed);
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,93 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "openvino/genai/image_generation/text2image_pipeline.hpp"
+#include "openvino/genai/image_generation/text2image_request_queue.hpp"
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("text2image_batching_benchmark",
+                             "Compares throughput of sequential Text2ImagePipeline::generate calls and batched serving of the same requests");
+    options.add_options()
+    ("m,model", "Path to the Stable Diffusion or Latent Consistency Model folder", cxxopts::value<std::string>())
+    ("d,device", "Target device to run the model", cxxopts::value<std::string>()->default_value("CPU"))
+    ("p,prompt", "Prompt of all requests, each request has its own seed", cxxopts::value<std::string>()->default_value("a photo of a cat sitting on a windowsill"))
+    ("n,num_requests", "Number of requests", cxxopts::value<size_t>()->default_value("8"))
+    ("b,max_batch_size", "Max number of images denoised together", cxxopts::value<size_t>()->default_value("4"))
+    ("s,num_steps", "Number of inference steps", cxxopts::value<size_t>()->default_value("20"))
+    ("r,resolution", "Square image size", cxxopts::value<size_t>()->default_value("512"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help") || !result.count("model")) {
+        std::cout << options.help() << std::endl;
+        return result.count("help") ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    const std::string prompt = result["prompt"].as<std::string>();
+    const size_t num_requests = result["num_requests"].as<size_t>();
+    const size_t resolution = result["resolution"].as<size_t>();
+    const size_t num_steps = result["num_steps"].as<size_t>();
+
+    ov::genai::Text2ImagePipeline pipe(result["model"].as<std::string>(), result["device"].as<std::string>());
+
+    auto get_request_properties = [&](size_t request_id) {
+        return ov::AnyMap{ov::genai::width(resolution),
+                          ov::genai::height(resolution),
+                          ov::genai::num_inference_steps(num_steps),
+                          ov::genai::rng_seed(42 + request_id)};
+    };
+
+    // warm up, so the first measurement doesn't include model loading to a device
+    pipe.generate(prompt, get_request_properties(0));
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t request_id = 0; request_id < num_requests; ++request_id) {
+        pipe.generate(prompt, get_request_properties(request_id));
+    }
+    const double sequential_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    double batched_s = 0.0;
+    {
+        ov::genai::Text2ImageRequestQueue queue(pipe, result["max_batch_size"].as<size_t>());
+
+        start = std::chrono::steady_clock::now();
+        std::vector<std::future<ov::Tensor>> images;
+        for (size_t request_id = 0; request_id < num_requests; ++request_id) {
+            images.push_back(queue.add_request(prompt, get_request_properties(request_id)));
+        }
+        for (auto& image : images) {
+            image.get();
+        }
+        batched_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::cout << "mode, requests, total s, images/s" << std::endl;
+    std::cout << "sequential, " << num_requests << ", " << sequential_s << ", " << num_requests / sequential_s << std::endl;
+    std::cout << "batched x" << result["max_batch_size"].as<size_t>() << ", " << num_requests << ", " << batched_s << ", "
+              << num_requests / batched_s << std::endl;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
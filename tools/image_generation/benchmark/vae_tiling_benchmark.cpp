@@ -0,0 +1,128 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+#include <cxxopts.hpp>
+
+#include "openvino/genai/image_generation/autoencoder_kl.hpp"
+
+namespace {
+
+// reads a value in kB from /proc/self/status, returns 0 if it's not available
+size_t read_proc_status_kb(const std::string& key) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind(key + ":", 0) == 0) {
+            std::istringstream fields(line.substr(key.size() + 1));
+            size_t value_kb = 0;
+            fields >> value_kb;
+            return value_kb;
+        }
+    }
+    return 0;
+}
+
+// resets peak RSS (VmHWM) to the current RSS, supported by Linux kernels >= 4.0
+void reset_peak_rss() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+}
+
+std::vector<size_t> parse_resolutions(const std::string& list) {
+    std::vector<size_t> resolutions;
+    std::istringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        resolutions.push_back(std::stoul(item));
+    }
+    return resolutions;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("vae_tiling_benchmark",
+                             "Measures latency and peak RSS of VAE decoding with and without tiling at several resolutions");
+    options.add_options()
+    ("m,model", "Path to the image generation model folder with 'vae_decoder' subfolder", cxxopts::value<std::string>())
+    ("d,device", "Target device to run the model", cxxopts::value<std::string>()->default_value("CPU"))
+    ("r,resolutions", "Comma separated list of square image sizes", cxxopts::value<std::string>()->default_value("512,1024,1536,2048"))
+    ("t,tile_size", "Tile size in pixels", cxxopts::value<size_t>()->default_value("512"))
+    ("o,tile_overlap", "Fraction of a tile shared with neighbour tiles", cxxopts::value<float>()->default_value("0.25"))
+    ("c,concurrent_tiles", "Max number of tiles inferred at the same time", cxxopts::value<size_t>()->default_value("1"))
+    ("skip_untiled", "Don't measure decoding of the whole latent at once, it may swap at high resolutions", cxxopts::value<bool>()->default_value("false"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help") || !result.count("model")) {
+        std::cout << options.help() << std::endl;
+        return result.count("help") ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    const std::string vae_decoder_path = result["model"].as<std::string>() + "/vae_decoder";
+    const std::string device = result["device"].as<std::string>();
+
+    ov::genai::AutoencoderKL::TilingConfig tiling;
+    tiling.tile_size = result["tile_size"].as<size_t>();
+    tiling.tile_overlap = result["tile_overlap"].as<float>();
+    tiling.max_concurrent_tiles = result["concurrent_tiles"].as<size_t>();
+
+    std::vector<ov::genai::AutoencoderKL::TilingConfig> modes;
+    if (!result["skip_untiled"].as<bool>())
+        modes.push_back(ov::genai::AutoencoderKL::TilingConfig{});
+    modes.push_back(tiling);
+
+    std::cout << "resolution, mode, latency ms, RSS before decode MB, peak RSS MB, peak RSS increase MB" << std::endl;
+    for (size_t resolution : parse_resolutions(result["resolutions"].as<std::string>())) {
+        for (const auto& mode : modes) {
+            // a fresh model per measurement, so memory allocated by previous decodings doesn't hide the peak
+            ov::genai::AutoencoderKL vae(vae_decoder_path, device);
+            const size_t vae_scale_factor = vae.get_vae_scale_factor();
+            const size_t latent_size = resolution / vae_scale_factor;
+
+            ov::Tensor latent(ov::element::f32, {1, vae.get_config().latent_channels, latent_size, latent_size});
+            std::mt19937 generator(42);
+            std::normal_distribution<float> normal;
+            float* latent_data = latent.data<float>();
+            for (size_t i = 0; i < latent.get_size(); ++i)
+                latent_data[i] = normal(generator);
+
+            reset_peak_rss();
+            const size_t rss_before_kb = read_proc_status_kb("VmRSS");
+
+            const auto start = std::chrono::steady_clock::now();
+            ov::Tensor image = vae.decode(latent, mode);
+            const double latency_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            const size_t peak_rss_kb = read_proc_status_kb("VmHWM");
+            std::cout << resolution << "x" << resolution << ", "
+                      << (mode.tile_size > 0 ? "tiled " + std::to_string(mode.tile_size) + "x" + std::to_string(mode.max_concurrent_tiles) : "untiled") << ", "
+                      << latency_ms << ", " << rss_before_kb / 1024 << ", " << peak_rss_kb / 1024 << ", "
+                      << (peak_rss_kb > rss_before_kb ? (peak_rss_kb - rss_before_kb) / 1024 : 0) << std::endl;
+        }
+    }
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,92 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+#include <cxxopts.hpp>
+
+#include "whisper/whisper_feature_extractor.hpp"
+
+namespace {
+
+// speech-like signal: a few harmonics with slowly changing pitch and white noise
+std::vector<float> generate_audio(size_t n_samples, size_t sampling_rate) {
+    std::mt19937 generator(42);
+    std::normal_distribution<float> noise(0.0f, 0.01f);
+
+    std::vector<float> audio(n_samples);
+    double phase = 0.0;
+    for (size_t i = 0; i < n_samples; i++) {
+        const double t = static_cast<double>(i) / sampling_rate;
+        const double pitch = 150.0 + 50.0 * std::sin(2.0 * M_PI * 0.3 * t);
+        phase += 2.0 * M_PI * pitch / sampling_rate;
+        audio[i] = static_cast<float>(0.3 * std::sin(phase) + 0.1 * std::sin(2.0 * phase) + 0.05 * std::sin(3.0 * phase)) +
+                   noise(generator);
+    }
+    return audio;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("whisper_features_benchmark", "Benchmark of whisper log-mel spectrogram extraction");
+    options.add_options()
+    ("m,model", "Path to the whisper model folder with preprocessor_config.json, defaults are used if not set", cxxopts::value<std::string>()->default_value(""))
+    ("d,duration", "Audio duration in seconds", cxxopts::value<size_t>()->default_value("3600"))
+    ("n,num_iter", "Number of benchmark iterations", cxxopts::value<size_t>()->default_value("3"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::filesystem::path models_path = result["model"].as<std::string>();
+    const size_t duration = result["duration"].as<size_t>();
+    const size_t num_iter = result["num_iter"].as<size_t>();
+
+    ov::genai::WhisperFeatureExtractor feature_extractor(models_path / "preprocessor_config.json");
+    const auto audio = generate_audio(duration * feature_extractor.sampling_rate, feature_extractor.sampling_rate);
+
+    // warm up threading pool
+    feature_extractor.extract(std::vector<float>(feature_extractor.sampling_rate));
+
+    double total_ms = 0.0;
+    size_t n_frames = 0;
+    for (size_t i = 0; i < num_iter; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        const auto features = feature_extractor.extract(audio);
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        n_frames = features.n_frames;
+        total_ms += ms;
+        std::cout << "Iteration " << i << ": " << ms << " ms" << std::endl;
+    }
+
+    const double mean_ms = total_ms / num_iter;
+    std::cout << "Audio duration: " << duration << " s, frames: " << n_frames << std::endl;
+    std::cout << "Mean features extraction time: " << mean_ms << " ms" << std::endl;
+    std::cout << "Mean time per frame: " << mean_ms * 1000.0 / n_frames << " us" << std::endl;
+    std::cout << "Real time factor: " << mean_ms / 1000.0 / duration << std::endl;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
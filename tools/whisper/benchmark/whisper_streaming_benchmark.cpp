@@ -0,0 +1,135 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include <cxxopts.hpp>
+
+#include "audio_utils.hpp"
+#include "openvino/genai/whisper_pipeline.hpp"
+
+namespace {
+
+double percentile(std::vector<double> values, double p) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    const size_t idx = std::min(values.size() - 1, static_cast<size_t>(p / 100.0 * values.size()));
+    return values[idx];
+}
+
+void print_stats(const std::string& name, const std::vector<double>& values) {
+    double sum = 0.0;
+    for (double value : values) {
+        sum += value;
+    }
+    const double mean = values.empty() ? 0.0 : sum / values.size();
+    std::cout << name << ": mean " << mean << " ms, p50 " << percentile(values, 50) << " ms, p90 "
+              << percentile(values, 90) << " ms, max " << percentile(values, 100) << " ms" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("whisper_streaming_benchmark",
+                             "Live transcription latency benchmark replaying a WAV file at real-time speed");
+    options.add_options()
+    ("m,model", "Path to the whisper model folder", cxxopts::value<std::string>())
+    ("w,wav", "Path to the WAV file, 16 kHz mono", cxxopts::value<std::string>())
+    ("d,device", "Target device to run the model", cxxopts::value<std::string>()->default_value("CPU"))
+    ("s,step", "Transcription step in seconds", cxxopts::value<float>()->default_value("1.0"))
+    ("c,chunk_ms", "Duration of audio pushed at once in milliseconds", cxxopts::value<size_t>()->default_value("100"))
+    ("no_sleep", "Push audio as fast as possible instead of real-time replay", cxxopts::value<bool>()->default_value("false"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help") || !result.count("model") || !result.count("wav")) {
+        std::cout << options.help() << std::endl;
+        return result.count("help") ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    const size_t sampling_rate = 16000;
+    const size_t chunk_ms = result["chunk_ms"].as<size_t>();
+    const size_t chunk_size = sampling_rate * chunk_ms / 1000;
+    const bool no_sleep = result["no_sleep"].as<bool>();
+
+    ov::genai::WhisperPipeline pipeline(result["model"].as<std::string>(), result["device"].as<std::string>());
+    const ov::genai::RawSpeechInput audio = utils::audio::read_wav(result["wav"].as<std::string>());
+    const double audio_duration = static_cast<double>(audio.size()) / sampling_rate;
+
+    // latency of push_audio() calls, the audio source is blocked for this time
+    std::vector<double> push_latencies;
+    // time between the moment the end of a chunk was captured and the moment the chunk became final
+    std::vector<double> finalization_latencies;
+    std::string transcription;
+
+    auto on_result = [&](const ov::genai::WhisperStreamingResult& step_result, double stream_time) {
+        for (const auto& chunk : step_result.final_chunks) {
+            finalization_latencies.push_back((stream_time - chunk.end_ts) * 1000.0);
+            transcription += chunk.text;
+        }
+    };
+
+    pipeline.start_stream(std::nullopt, result["step"].as<float>());
+
+    const auto stream_start = std::chrono::steady_clock::now();
+    for (size_t offset = 0; offset < audio.size(); offset += chunk_size) {
+        const size_t end = std::min(audio.size(), offset + chunk_size);
+        // audio is captured in real time, so the chunk is available only when its end is reached
+        if (!no_sleep) {
+            std::this_thread::sleep_until(stream_start + std::chrono::microseconds(end * 1000000 / sampling_rate));
+        }
+
+        const auto push_start = std::chrono::steady_clock::now();
+        auto step_result = pipeline.push_audio(ov::genai::RawSpeechInput(audio.begin() + offset, audio.begin() + end));
+        const auto push_end = std::chrono::steady_clock::now();
+        push_latencies.push_back(std::chrono::duration<double, std::milli>(push_end - push_start).count());
+
+        const double stream_time =
+            no_sleep ? static_cast<double>(end) / sampling_rate + push_latencies.back() / 1000.0
+                     : std::chrono::duration<double>(push_end - stream_start).count();
+        on_result(step_result, stream_time);
+    }
+
+    const auto finish_start = std::chrono::steady_clock::now();
+    auto final_result = pipeline.finish_stream();
+    const double finish_ms =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - finish_start).count();
+    on_result(final_result, audio_duration + finish_ms / 1000.0);
+
+    const double total_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - stream_start).count();
+
+    std::cout << transcription << "\n\n";
+    std::cout << "Audio duration: " << audio_duration << " s, wall time: " << total_s << " s" << std::endl;
+    print_stats("push_audio latency", push_latencies);
+    print_stats("Finalization latency", finalization_latencies);
+    std::cout << "finish_stream latency: " << finish_ms << " ms" << std::endl;
+
+    double busy_ms = finish_ms;
+    for (double latency : push_latencies) {
+        busy_ms += latency;
+    }
+    std::cout << "Real time factor: " << busy_ms / 1000.0 / audio_duration << std::endl;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}